@@ -25,6 +25,7 @@ __all__     = (
     'Sum1D'         , ## wrapper for RooAddPdf 
     'H1D_pdf'       , ## convertor of 1D-histo to RooHistPdf
     'Shape1D_pdf'   , ## simple PDF from C++ shape 
+    'ChebyshevProxy_pdf' , ## Chebyshev proxy for slow 1D-PDF
     'make_pdf'      , ## helper function to make PDF
     'all_args'      , ## check that all arguments has correct type 
     ##
@@ -3230,6 +3231,81 @@ class Shape1D_pdf(PDF) :
         """``shape'': the actual C++ callable shape"""
         return self.__shape 
             
+# =============================================================================
+## Proxy for the slow 1D-PDF (e.g. Faddeeva-based or integral-based shapes):
+#  the PDF is replaced by its adaptive piecewise Chebyshev approximation
+#  - the approximation is rebuilt when any parameter of the PDF changes
+#    or when the range of the observable changes
+#  - the observable of the original PDF is not modified by the sampling
+#  - the normalization integral is calculated analytically
+#  @code
+#  voigt = Voigt_pdf ( 'V' , xvar = mass , ... )
+#  proxy = ChebyshevProxy_pdf ( voigt , precision = 1.e-8 )
+#  proxy.fitTo ( dataset )
+#  @endcode
+#  @see Ostap::MoreRooFit::ChebyshevProxy
+#  @see Ostap::Math::AdaptiveChebyshev
+#  @author Ostap developers
+#  @date 2026-10-19
+class ChebyshevProxy_pdf(PDF) :
+    """Proxy for the slow 1D-PDF (e.g. Faddeeva-based or integral-based shapes):
+    the PDF is replaced by its adaptive piecewise Chebyshev approximation
+    - the approximation is rebuilt when any parameter of the PDF changes
+      or when the range of the observable changes
+    - the observable of the original PDF is not modified by the sampling
+    - the normalization integral is calculated analytically
+    >>> voigt = Voigt_pdf ( 'V' , xvar = mass , ... )
+    >>> proxy = ChebyshevProxy_pdf ( voigt , precision = 1.e-8 )
+    >>> proxy.fitTo ( dataset )
+    - see Ostap::MoreRooFit::ChebyshevProxy
+    - see Ostap::Math::AdaptiveChebyshev
+    """
+    def __init__ ( self               ,
+                   pdf                ,
+                   precision = 1.e-8  ,
+                   maxorder  = 128    ,
+                   maxpieces = 1000   , 
+                   name      = ''     ) :
+
+        assert isinstance ( pdf , PDF ) , "``pdf'' must be PDF instance!"
+        assert 0 < precision            , "``precision'' must be positive!"
+
+        name = name if name else self.generate_name ( prefix = 'cheb_%s_' % pdf.name )
+        
+        ##  initialize the base 
+        PDF.__init__ ( self , name , pdf.xvar )
+
+        self.__original = pdf
+        
+        ## create the actual pdf
+        self.pdf = Ostap.MoreRooFit.ChebyshevProxy (
+            self.roo_name ( 'cheb_' )               , 
+            "Chebyshev proxy for %s" % pdf.name     ,
+            self.xvar                               ,
+            pdf.pdf                                 ,
+            precision                               ,
+            maxorder                                ,
+            maxpieces                               ) 
+
+        ## save the configuration
+        self.config = {
+            'pdf'       : self.original  , 
+            'precision' : precision      , 
+            'maxorder'  : maxorder       , 
+            'maxpieces' : maxpieces      , 
+            'name'      : self.name      , 
+            }
+        
+    @property
+    def original ( self ) :
+        """``original'': the original (slow) PDF"""
+        return self.__original
+
+    @property
+    def chebyshev ( self ) :
+        """``chebyshev'': the actual approximation, see Ostap.Math.AdaptiveChebyshev"""
+        return self.pdf.chebyshev ()
+            
 # =============================================================================
 ## simple convertor of 1D-histogram into PDF
 #  @author Vanya Belyaev Ivan.Belyaev@itep.ru
@@ -15,7 +15,8 @@ __date__    = "2009-09-12"
 __version__ = ""
 # =============================================================================
 __all__     = (
-    'C2FIT' , ## simple chi2-fit 
+    'C2FIT'   , ## simple chi2-fit 
+    'C2BATCH' , ## many simple chi2-fits 
     ) 
 # =============================================================================
 import ROOT, cppyy
@@ -48,6 +49,30 @@ C2FIT . probability = _c2_prob_
 C2FIT . __len__     = lambda s     : s.size  (   )
 C2FIT . __getitem__ = lambda s , i : s.param ( i )
 
+# =============================================================================
+## many chi2-fits at once
+#  @see Ostap::Math::Chi2FitBatch
+C2BATCH = Ostap.Math.Chi2FitBatch
+
+# =============================================================================
+## chi2-probabilty for the i-th fit
+def _c2b_prob_  ( s , i ) :
+    """Chi2 probabiilty for the i-th fit
+    >>> batch = C2BATCH ( npoints , ncmps )
+    >>> ...
+    >>> batch.fit()
+    >>> batch.prob ( 0 ) 
+    """
+    dofs = s.points ( i ) - s.ncmps ()
+    return ROOT.TMath.Prob ( s.chi2 ( i ) , dofs )
+
+C2BATCH . Prob        = _c2b_prob_
+C2BATCH . Probability = _c2b_prob_
+C2BATCH . prob        = _c2b_prob_
+C2BATCH . probability = _c2b_prob_
+C2BATCH . __len__     = lambda s     : s.size   (   )
+C2BATCH . __getitem__ = lambda s , i : s.params ( i )
+
 # =============================================================================
 ## (Chi2)fit the histogram by sum of components
 #  The ``components'' could be histograms, functions and other
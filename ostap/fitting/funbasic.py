@@ -254,6 +254,31 @@ class FUNC(XVar) :
         ##
         return make_pdf ( self.fun , name = name , *self.variables )
 
+    # =========================================================================
+    ## Fuse the expression graph into one node
+    #  The connected subgraph of simple arithmetic nodes
+    #  (e.g. from <code>f1+f2*f3/f4</code>) is folded into one node,
+    #  that evaluates the flat instruction tape over the leaves of the graph
+    #  @code
+    #   fun   = f1 * f2 + f3
+    #   fused = fun.fused ()
+    #   @endcode
+    #  @see Ostap::MoreRooFit::Fused
+    def fused ( self , name = '' ) :
+        """Fuse the expression graph into one node
+        The connected subgraph of simple arithmetic nodes
+        (e.g. from `f1+f2*f3/f4`) is folded into one node,
+        that evaluates the flat instruction tape over the leaves of the graph
+        >>> fun   = f1 * f2 + f3
+        >>> fused = fun.fused ()
+        - see Ostap.MoreRooFit.Fused
+        """
+        name   = name if name else self.generate_name ( 'Fused_' + self.name )
+        fun    = Ostap.MoreRooFit.Fused ( self.fun , 'fused_' + name , '' )
+        result = make_fun ( fun , self.variables , name )
+        result.aux_keep.append ( self )
+        return result
+
     # =========================================================================
     @property 
     def dfdx ( self ) :
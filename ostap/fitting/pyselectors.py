@@ -779,6 +779,7 @@ class SelectorWithVars(SelectorWithCuts) :
         from collections import defaultdict
         self.__skip     = defaultdict(int)
         self.__notifier = None
+        self.__plan     = None
         self.__stat     = SelStat() 
 
     @property 
@@ -1179,6 +1180,22 @@ class SelectorWithVars(SelectorWithCuts) :
         for v in self.__variables :
             if isinstance ( v.accessor , ROOT.TObject ) :
                 self.__notifier.add  ( v.accessor ) 
+
+        if self.__plan :
+            self.__plan.stop()
+            self.__plan = None
+            
+        ## read planning: cache and read only the branches, used by the selector
+        #  (not possible for python cuts and python accessor functions) 
+        objects = ROOT.std.vector('const TObject*')()
+        if self.formula() : objects.push_back ( self.formula() )
+        known   = not self.__cuts 
+        for v in self.__variables :
+            if isinstance ( v.accessor , ROOT.TObject ) : objects.push_back ( v.accessor )
+            else                                        : known = False 
+        if known :
+            self.__plan = Ostap.Utils.ReadPlan ( tree , 0 , tree.GetEntries() , objects )
+            self.__plan.prune ()
         
     # =========================================================================
     ## Notify  (e.g. another TTree in the chain
@@ -1210,6 +1227,10 @@ class SelectorWithVars(SelectorWithCuts) :
         if self.__notifier :
             self.__notifier.exit()
             self.__notifier = None  
+
+        if self.__plan :
+            self.__plan.stop()
+            self.__plan = None 
             
 # =============================================================================
 import os
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file test_fitting_chi2batch.py
+# Test module
+# - It tests many simple chi2-fits at once 
+# @see Ostap::Math::Chi2FitBatch
+# =============================================================================
+""" Test module
+- It tests many simple chi2-fits at once 
+- see Ostap.Math.Chi2FitBatch
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+from   ostap.math.ve               import VE
+from   ostap.fitting.chi2fit       import C2FIT, C2BATCH 
+from   builtins                    import range
+from   ostap.utils.timing          import timing
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_fitting_chi2batch' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+DATA =   VE.Vector
+CMPS = DATA.Vector
+
+NPOINTS = 20
+NCMPS   = 2 
+
+# =============================================================================
+## make the data and the templates 
+def make_problem ( errors ) :
+
+    data = DATA ()
+    cmps = CMPS ()
+    for j in range ( NCMPS ) : cmps.push_back ( DATA () )
+
+    for i in range ( NPOINTS ) :
+        x  = ( i + 0.5 ) / NPOINTS
+        c0 = 10 * ( 1 - x )
+        c1 = 10 * x * x
+        v  = 50 * c0 + 20 * c1
+        data.push_back ( VE ( random.gauss ( v , v ** 0.5 ) , v ) )
+        cmps [ 0 ].push_back ( VE ( c0 , 0.01 * c0 if errors else 0 ) )
+        cmps [ 1 ].push_back ( VE ( c1 , 0.01 * c1 if errors else 0 ) )
+
+    return data , cmps 
+
+# =============================================================================
+def  test_chi2batch () :
+
+    for errors in ( False , True ) :
+
+        batch    = C2BATCH ( NPOINTS , NCMPS )
+        problems = [ make_problem ( errors ) for k in range ( 100 ) ]
+        for data , cmps in problems : batch.add ( data , cmps )
+
+        with timing ( 'Batch fit (errors=%s)' % errors , logger ) :
+            nfail = batch.fit ()
+        assert 0 == nfail , 'Failed batch fits: %d' % nfail
+
+        ## compare with the iterative minimiser 
+        for i , ( data , cmps ) in enumerate ( problems [ : 10 ] ) :
+            fit = C2FIT ( data , cmps )
+            if not fit.status().isSuccess() : continue
+            assert abs ( fit.chi2 () - batch.chi2 ( i ) ) <= 1.e-3 * max ( 1 , fit.chi2 () ) , \
+                   'Chi2 differs: %s vs %s' % ( fit.chi2 () , batch.chi2 ( i ) )
+            for j in range ( NCMPS ) :
+                p1 , p2 = fit.param ( j ) , batch.param ( i , j )
+                assert abs ( p1.value () - p2.value () ) <= 1.e-2 * p1.error () , \
+                       'Parameter differs: %s vs %s' % ( p1 , p2 )
+
+        logger.info ( 'Batch fit (errors=%s) is OK, e.g. %s, prob=%.3f' % ( errors , batch [ 0 ] , batch.prob ( 0 ) ) )
+
+    ## constrained fit 
+    batch = C2BATCH ( NPOINTS , NCMPS )
+    batch.setLimits ( 1 , 25 , 1.e+9 )
+    for k in range ( 100 ) : batch.add ( *make_problem ( False ) )
+    assert 0 == batch.fit () , 'Failed constrained batch fits'
+    for i in range ( len ( batch ) ) :
+        assert 25 <= batch.param ( i , 1 ).value () , 'Constraint is violated!'
+
+    logger.info ( 'Constrained batch fit is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    with timing ("chi2batch" , logger ) :
+        test_chi2batch ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file test_fitting_fused.py
+# Test module
+# - It tests fused expressions
+# @see Ostap::MoreRooFit::Fused
+# =============================================================================
+""" Test module
+- It tests fused expressions
+- see Ostap.MoreRooFit.Fused
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+import ostap.fitting.roofit
+from   ostap.core.core             import Ostap
+from   ostap.fitting.funbasic      import Fun1D
+from   builtins                    import range
+from   ostap.utils.timing          import timing
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'test_fitting_fused' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+
+
+# =============================================================================
+def  test_fused () :
+
+    x     = ROOT.RooRealVar ( 'x'     , '' , 0.3  , -5 , 5 )
+    mu    = ROOT.RooRealVar ( 'mu'    , '' , 0.1  , -1 , 1 )
+    sigma = ROOT.RooRealVar ( 'sigma' , '' , 0.5  ,  0 , 2 )
+    tau   = ROOT.RooRealVar ( 'tau'   , '' , -0.3 , -1 , 1 )
+
+    X     = Fun1D ( x , xvar = x , name = 'X' )
+
+    ## sWeight-like expression
+    fs    = ( ( X - mu ) / sigma ) ** 2
+    fb    = X * tau
+    expr  = ( 1.2 * fs - 0.2 * fb ) / ( 20 * fs + 80 * fb + 1 )
+
+    fused = expr.fused ()
+    logger.info ( 'Fused expression: %d leaves and %d instructions' % ( len ( fused.fun.leaves () ) , fused.fun.size () ) )
+
+    for i in range ( 1000 ) :
+
+        x    .setVal ( random.uniform ( -5   , 5   ) )
+        mu   .setVal ( random.uniform ( -1   , 1   ) )
+        sigma.setVal ( random.uniform (  0.1 , 2   ) )
+
+        v1 = expr .fun.getVal()
+        v2 = fused.fun.getVal()
+
+        assert abs ( v1 - v2 ) <= 1.e-12 * max ( 1 , abs ( v1 ) ) , \
+               'Fused expression differs: %s vs %s' % ( v1 , v2 )
+
+    logger.info ( 'Fused expression is OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    with timing ("fused" , logger ) :
+        test_fused    ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
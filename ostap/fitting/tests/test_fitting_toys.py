@@ -188,12 +188,46 @@ def test_significance_toys ( ) :
         time.sleep  ( 1 )
 
                 
+# =============================================================================
+## Perform toy-study with the in-process multi-threaded C++ engine
+#  - results must be reproducible and independent on the number of threads 
+def test_toys_mt ( ) :
+    """Perform toy-study with the in-process multi-threaded C++ engine
+    - results must be reproducible and independent on the number of threads 
+    """
+
+    logger = getLogger ( 'test_toys_mt' )
+
+    config = dict ( pdf       = gen_gauss ,
+                    nToys     = 200       ,
+                    data      = [ mass ]  ,
+                    nEvents   = 200       ,
+                    init_pars = { 'mean_GG' : 0.4  , 'sigma_GG' : 0.1 } ,
+                    seed      = 12345     , 
+                    silent    = True      ,
+                    progress  = False     )
+    
+    with timing ( 'Toys, 1 thread ' , logger = logger ) : 
+        results1 , stats1 = Toys.make_toys_mt ( nthreads = 1 , **config )
+    with timing ( 'Toys, 4 threads' , logger = logger ) : 
+        results4 , stats4 = Toys.make_toys_mt ( nthreads = 4 , **config )
+        
+    for p in stats4 :
+        logger.info (  "Toys: %-20s : %s" % (  p, stats4 [ p ] ) )
+
+    for p in ( 'mean_GG' , 'sigma_GG' ) :
+        assert len ( results1 [ p ] ) == len ( results4 [ p ] ) , 'Different number of accepted toys!'
+        for a , b in zip ( results1 [ p ] , results4 [ p ] ) :
+            assert abs ( a.value () - b.value () ) < 1.e-8 , 'Results are not reproducible: %s vs %s' % ( a , b )
+    
+                
 # =============================================================================
 if '__main__' == __name__ :
 
     test_toys  () 
     test_toys2 () 
     test_significance_toys ( ) 
+    test_toys_mt ( ) 
     
 
 # =============================================================================
@@ -15,6 +15,7 @@ __version__ = '$Revision$'
 __all__     = (
     "make_toys"        , ## run fitting toys (the same PDF to generate and fit)
     "make_toys2"       , ## run fitting toys (separate models to generate and fit)
+    "make_toys_mt"     , ## run fitting toys (in-process, multi-threaded C++ engine)
     'make_jackknife'   , ## run Jackknife analysis 
     'make_bootstrap'   , ## run Bootstrapanalysis 
     "vars_transform"   , ## helper fnuction to transform the variables
@@ -843,6 +844,168 @@ def make_toys2 ( gen_pdf             , ## pdf to generate toys
 
     return results, stats 
 
+# =============================================================================
+## make <code>nToys</code> pseudoexperiments in-process, using the
+#  multi-threaded C++ engine Ostap::Utils::ToyRunner
+#  - the model is cloned once per worker thread
+#  - the seed of each toy depends only on the global seed and the toy index,
+#    therefore the results are reproducible and do not depend on
+#    the number of threads
+#  - only fits with status 0 and covariance matrix quality 3 (or -1) are used
+#    for the statistics (as for <code>accept_fit</code>)
+#  - RooFit is not thread-safe: all RooFit calls (generation and fits) are
+#    serialized, for the parallel processing use ostap.parallel.parallel_toys
+#
+#  @code
+#  pdf = ...
+#  results , stats = make_toys_mt ( pdf   ,   ## PDF  to use 
+#     nToys      = 1000        ,           ## Number of pseudoexperiments 
+#     data       = [ 'mass' ]  ,           ## variables in dataset 
+#     nEvents    = 5000        ,           ## number of events per toy 
+#     init_pars  = { 'mean' : 0.0 , 'sigma' : 1.0 } , ## parameters to use for generation
+#     seed       = 12345       ,
+#     nthreads   = 8           )
+#  @endcode
+#
+#  The C++ engine can be used directly to get the results as TTree/RooDataSet:
+#  @code
+#  runner = Ostap.Utils.ToyRunner ( pdf.pdf , ROOT.RooArgSet ( mass ) , 5000 )
+#  runner.run ( 1000 )
+#  tree   = runner.tree    ()
+#  ds     = runner.dataset ()
+#  @endcode
+#
+# @param pdf        PDF to be used for generation and fitting
+# @param nToys      number of pseudoexperiments to generate
+# @param data       variable list of variables to be used for dataset generation
+# @param nEvents    (mean) number of events per pseudoexperiment 
+# @param init_pars  redefine these parameters for each pseudoexperiment
+# @param extended   extended generation and fit?
+# @param seed       the global seed
+# @param nthreads   maximal number of threads (0: all threads of ThreadPool)
+# @param minimizer  minimizer type (and algorithm)
+# @param strategy   minimization strategy 
+# @param hesse      run HESSE?
+# @param dataset    return also RooDataSet with results for each toy? 
+# @param silent     silent toys?
+# @param progress   show progress bar?
+# @param logger     use this logger 
+# @return dictionary with fit results for the toys and the dictionary of statistics
+# @see Ostap::Utils::ToyRunner
+def make_toys_mt ( pdf                 ,
+                   nToys               ,
+                   data                , ## template for dataset/variables 
+                   nEvents             , ## number of events per toy 
+                   init_pars  = {}     ,
+                   extended   = False  ,
+                   seed       = 0      ,
+                   nthreads   = 0      ,
+                   minimizer  = ()     ,
+                   strategy   = 1      ,
+                   hesse      = True   ,
+                   dataset    = False  , 
+                   silent     = True   ,
+                   progress   = True   ,
+                   logger     = logger ) :
+    """Make `nToys` pseudoexperiments in-process, using the
+    multi-threaded C++ engine `Ostap::Utils::ToyRunner`
+
+    - the model is cloned once per worker thread
+    - the seed of each toy depends only on the global seed and the toy index,
+    therefore the results are reproducible and do not depend on the number of threads
+    - only fits with status 0 and covariance matrix quality 3 (or -1) are used
+    for the statistics (as for `accept_fit`)
+    - RooFit is not thread-safe: all RooFit calls (generation and fits) are
+    serialized, for the parallel processing use `ostap.parallel.parallel_toys`
+
+    >>> pdf = ...
+    >>> results , stats = make_toys_mt ( pdf ,
+    ...     nToys     = 1000       , ## number of pseudoexperiments
+    ...     data      = [ 'mass' ] , ## variables in dataset
+    ...     nEvents   = 5000       , ## number of events per toy 
+    ...     init_pars = { 'mean' : 0.0 , 'sigma' : 1.0 } , ## parameters to use for generation
+    ...     seed      = 12345      ,
+    ...     nthreads  = 8          )
+
+    The C++ engine can be used directly to get the results as TTree/RooDataSet:
+    >>> runner = Ostap.Utils.ToyRunner ( pdf.pdf , ROOT.RooArgSet ( mass ) , 5000 )
+    >>> runner.run ( 1000 )
+    >>> tree   = runner.tree    ()
+    >>> ds     = runner.dataset ()
+    """
+    
+    from ostap.core.ostap_types import string_types, integer_types  
+    from ostap.core.core        import Ostap, SE 
+    from collections            import defaultdict 
+    
+    assert isinstance ( nToys , integer_types ) and 0 < nToys,\
+           'Invalid "nToys" argument %s/%s' % ( nToys , type ( nToys ) )
+    assert isinstance ( nEvents , integer_types ) and ( 0 < nEvents or extended ) ,\
+           'Invalid "nEvents" argument %s/%s' % ( nEvents , type ( nEvents ) )
+
+    import ostap.fitting.roofit
+    import ostap.fitting.variables
+    
+    params = pdf.params ()
+    varset = ROOT.RooArgSet() 
+    
+    if isinstance ( data , ROOT.RooAbsData       ) : varset = data.varset() 
+    else :
+        for v in data :
+            if   isinstance ( v , ROOT.RooAbsArg ) :
+                varset.add ( v )
+            elif isinstance ( v , string_types   ) and v in params :
+                varset.add ( params [ v ] )
+            else :
+                raise TypeError('Invalid variable %s/%s' % ( v , type ( v ) ) )
+
+    pdf.load_params ( params = vars_transform ( init_pars ) , silent = silent )
+    
+    runner = Ostap.Utils.ToyRunner ( pdf.pdf , varset , nEvents , extended )
+    runner.setSeed     ( seed     )
+    runner.setNThreads ( nthreads )
+    runner.setProgress ( progress )
+    runner.setStrategy ( strategy )
+    runner.setHesse    ( hesse    )
+    if minimizer :
+        if isinstance ( minimizer , string_types ) : minimizer = minimizer ,
+        runner.setMinimizer ( *minimizer ) 
+
+    runner.run ( nToys )
+
+    status  = runner.column ( 'status'  )
+    covqual = runner.column ( 'covQual' )
+    nevents = runner.column ( 'nEvents' )
+    sumw    = runner.column ( 'sumw'    )
+
+    fits = defaultdict ( SE )  ## fit statuses 
+    covs = defaultdict ( SE )  ## covariance matrix quality
+    for s in status  : fits [ int ( s ) ] += 1
+    for c in covqual : covs [ int ( c ) ] += 1
+
+    accepted = [ 0 == int ( s ) and int ( c ) in ( -1 , 3 ) for s , c in zip ( status , covqual ) ]
+    
+    results = defaultdict(list) 
+    for p , v0 in zip ( runner.parameters () , runner.initial () ) :
+        values = runner.column ( p          )
+        errors = runner.column ( p + '_err' )
+        for ok , v , e in zip ( accepted , values , errors ) :
+            if not ok : continue 
+            results [ p ].append ( VE ( v , e * e ) ) 
+            if 0 < e : results [ 'pull:%s' % p ].append ( ( v - v0 ) / e )
+            
+    for ok , n , w in zip ( accepted , nevents , sumw ) :
+        if not ok : continue 
+        results [ '#'     ] .append ( n )
+        results [ '#sumw' ] .append ( w )
+
+    stats = make_stats ( results , fits , covs )
+    if progress or not silent :
+        print_stats ( stats , nToys , logger = logger )
+
+    if dataset : return results , stats , runner.dataset ()
+    return results, stats 
+
 # =============================================================================
 ## run Jackknife analysis, useful for evaluaton of fit biases and uncertainty estimates
 # 
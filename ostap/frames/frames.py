@@ -19,6 +19,9 @@ __all__     = (
     'frame_progress'     , ## progress bar for frame 
     'frame_table'        , ## print data frame as table 
     'frame_project'      , ## project data frame to the (1D/2D/3D) histogram 
+    'frame_kinematics'   , ## evaluate kinematical variable for data frame (bulk)
+    'frame_define_kinematics' , ## define kinematical variable for data frame 
+    'frame_lazy'         , ## lazy frame: many actions in one event loop 
     ) 
 # =============================================================================
 import ROOT
@@ -214,6 +217,35 @@ def _fr_statCov_ ( frame       ,
     return stat1 , stat2 , cov2 , length
 
 
+# =============================================================================
+## Get the lazy frame: all StatVar/HistoProject-like actions, booked
+#  for the lazy frame, share the temporary columns and are processed
+#  in one event loop
+#  @code
+#  frame = ...
+#  lazy  = frame.lazy () 
+#  s1    = lazy.statVar ( 'pt'  , 'eta>2' ) 
+#  s2    = lazy.statVar ( 'eta' , 'eta>2' ) 
+#  h     = lazy.project ( histo , 'pt'    , 'eta>2' ) 
+#  lazy.run ()                  ## one event loop 
+#  print ( s1.get () , s2.get () ) 
+#  @endcode
+#  @see Ostap::LazyFrame 
+def frame_lazy ( frame ) :
+    """Get the lazy frame: all StatVar/HistoProject-like actions, booked
+    for the lazy frame, share the temporary columns and are processed
+    in one event loop
+    >>> frame = ...
+    >>> lazy  = frame.lazy () 
+    >>> s1    = lazy.statVar ( 'pt'  , 'eta>2' ) 
+    >>> s2    = lazy.statVar ( 'eta' , 'eta>2' ) 
+    >>> h     = lazy.project ( histo , 'pt'    , 'eta>2' ) 
+    >>> lazy.run ()                  ## one event loop 
+    >>> print ( s1.get () , s2.get () ) 
+    - see Ostap.LazyFrame 
+    """
+    return Ostap.LazyFrame ( frame )
+
 # ==================================================================================
 ## get statistics of variable(s)
 #  @code
@@ -662,6 +694,97 @@ def frame_project ( frame , model , *what ) :
     return histo 
     
 
+# ==============================================================================
+## Evaluate the kinematical variable from the components of four-vectors
+#  for all entries of the frame in bulk:
+#  all components are collected into contiguous arrays in one event loop,
+#  and the variable is evaluated by the batch kernel
+#  @code
+#  frame = ...
+#  cos_theta = frame_kinematics ( frame , 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+#  chi       = frame.Kinematics ( 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+#  mKK       = frame.Kinematics ( 'mass' , ( 'px1' , 'py1' , 'pz1' , 'e1' ) , ( 'px2' , 'py2' , 'pz2' , 'e2' ) )
+#  @endcode
+#  @return array of values (in the order of entries, collected by <code>Take</code>)
+#  @see Ostap::Kinematics::Batch
+#  @see frame_define_kinematics 
+def frame_kinematics ( frame , variable , *particles , **kwargs ) :
+    """Evaluate the kinematical variable from the components of four-vectors
+    for all entries of the frame in bulk:
+    all components are collected into contiguous arrays in one event loop,
+    and the variable is evaluated by the batch kernel
+    >>> frame = ...
+    >>> cos_theta = frame_kinematics ( frame , 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+    >>> chi       = frame.Kinematics ( 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+    >>> mKK       = frame.Kinematics ( 'mass' , ( 'px1' , 'py1' , 'pz1' , 'e1' ) , ( 'px2' , 'py2' , 'pz2' , 'e2' ) )
+    - returns the array of values (in the order of entries, collected by `Take`)
+    - see Ostap.Kinematics.Batch
+    - see frame_define_kinematics 
+    """
+    from ostap.math.kinematic import kinematic_variable, lorentz_components, batch_kinematics 
+    components = kwargs.pop ( 'components' , ( '_PX' , '_PY' , '_PZ' , '_PE' ) )
+    assert not kwargs , 'Unknown arguments: %s' % list ( kwargs.keys () )
+    
+    var = int ( kinematic_variable ( variable ) )
+    nv  = len ( particles )
+    assert Ostap.Kinematics.Batch.nVectorsMin ( var ) <= nv <= Ostap.Kinematics.Batch.nVectors ( var ) , \
+           'Invalid number of four-vectors %d for %s' % ( nv , variable )
+
+    ## the components as temporary columns of doubles 
+    current = frame
+    used    = tuple ( frame.GetColumnNames () )
+    columns = [] 
+    for p in particles :
+        for e in lorentz_components ( p , components ) :
+            cn      = var_name ( 'kin_' , used + tuple ( columns ) , e , variable )
+            current = current.Define ( cn , '(double)(%s)' % e )
+            columns.append ( cn )
+
+    ## book all actions first: one event loop for all columns 
+    actions = [ current.Take['double'] ( c ) for c in columns ]
+    values  = [ a.GetValue ()              for a in actions ]
+    
+    vectors = [ values [ 4 * i : 4 * i + 4 ] for i in range ( nv ) ]
+    return batch_kinematics ( var , *vectors )
+
+# ==============================================================================
+## Define the kinematical variable from the components of four-vectors
+#  as the new column. The variable is evaluated event-by-event by
+#  compiled code (the same expressions as for the batch kernels),
+#  no intermediate columns are created 
+#  @code
+#  frame = ...
+#  f1 = frame_define_kinematics ( frame , 'cos_theta' , 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+#  f2 = f1.DefineKinematics ( 'chi' , 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+#  @endcode
+#  @see Ostap::Kinematics::Batch
+#  @see frame_kinematics 
+def frame_define_kinematics ( frame , name , variable , *particles , **kwargs ) :
+    """Define the kinematical variable from the components of four-vectors
+    as the new column. The variable is evaluated event-by-event by
+    compiled code (the same expressions as for the batch kernels),
+    no intermediate columns are created 
+    >>> frame = ...
+    >>> f1 = frame_define_kinematics ( frame , 'cos_theta' , 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+    >>> f2 = f1.DefineKinematics ( 'chi' , 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+    - see Ostap.Kinematics.Batch
+    - see frame_kinematics 
+    """
+    from ostap.math.kinematic import kinematic_variable, lorentz_components
+    components = kwargs.pop ( 'components' , ( '_PX' , '_PY' , '_PZ' , '_PE' ) )
+    assert not kwargs , 'Unknown arguments: %s' % list ( kwargs.keys () )
+    
+    var = int ( kinematic_variable ( variable ) )
+    nv  = len ( particles )
+    assert Ostap.Kinematics.Batch.nVectorsMin ( var ) <= nv <= Ostap.Kinematics.Batch.nVectors ( var ) , \
+           'Invalid number of four-vectors %d for %s' % ( nv , variable )
+    
+    vectors = [ 'Ostap::LorentzVector(%s)' % ','.join ( lorentz_components ( p , components ) ) for p in particles ]
+    expression = 'Ostap::Kinematics::Batch::evaluate(Ostap::Kinematics::Batch::Variable(%d),std::array<Ostap::LorentzVector,%d>{{%s}}.data(),%d)' % (
+        var , nv , ','.join ( vectors ) , nv ) 
+    
+    return frame.Define ( name , expression ) 
+
 # ==============================================================================
 # decorate 
 # ==============================================================================
@@ -674,6 +797,9 @@ DataFrame .statVar     = _fr_statVar_
 DataFrame .statCov     = _fr_statCov_
 DataFrame .ProgressBar = frame_progress
 DataFrame .progress    = frame_progress
+DataFrame .Kinematics  = frame_kinematics
+DataFrame .DefineKinematics = frame_define_kinematics
+DataFrame .lazy        = frame_lazy 
 
 
 from ostap.stats.statvars import  data_decorate 
@@ -698,6 +824,8 @@ _new_methods_       = (
     #
     DataFrame.ProgressBar      ,
     DataFrame.progress         ,
+    DataFrame.Kinematics       ,
+    DataFrame.DefineKinematics ,
     #
     DataFrame.draw             , 
     DataFrame.project          ,
@@ -706,6 +834,7 @@ _new_methods_       = (
     DataFrame.statVar          ,
     DataFrame.statCov          ,
     DataFrame.nEff             ,
+    DataFrame.lazy             ,
     #
     DataFrame.get_moment       , 
     DataFrame.central_moment   , 
@@ -15,6 +15,7 @@ if '__main__' ==  __name__ : logger = getLogger ( 'test_frames_frames' )
 else                       : logger = getLogger ( __name__            )
 # ============================================================================= 
 import ROOT, os 
+from ostap.core.core     import Ostap
 from ostap.frames.frames import DataFrame
 from ostap.utils.cleanup import CleanUp
 from ostap.trees.trees   import Tree
@@ -97,13 +98,97 @@ def test_frame2 ( ) :
     h1 = tree .draw('b1','1/b1')
     h2 = frame.draw('b1','1/b1')
     
+
+## many actions in one event loop via the lazy frame 
+def test_frame3 ( ) :
+
+    lazy = frame.lazy ()
+    
+    s1 = lazy.statVar ( 'b1'        , 'b1<500' )
+    s2 = lazy.statVar ( 'b2'        , 'b1<500' )
+    s3 = lazy.statVar ( 'b1'                   )
+    n  = lazy.nEff    ( '1/(b1+1)'             )
+    c  = lazy.statCov ( 'b1' , 'b2' , 'b1<500' ) 
+    h  = ROOT.TH1D    ( 'h_lazy' , '' , 100 , 0 , 1000 )
+    hh = lazy.project ( h , 'b1' , 'b1<500' )
+
+    assert 6 == lazy.pending () , 'Invalid number of pending actions!' 
+    assert 6 == lazy.run     () , 'Invalid number of processed actions!'
+    assert 1 == lazy.nRuns   () , 'Invalid number of event loops!' 
+
+    e1 = frame.statVar ( 'b1' , 'b1<500' )
+    e2 = frame.statVar ( 'b2' , 'b1<500' )
+    e3 = frame.statVar ( 'b1'            )
+    
+    for a , b in ( ( s1.get () , e1 ) , ( s2.get () , e2 ) , ( s3.get () , e3 ) ) :
+        assert a.nEntries () == b.nEntries () and abs ( a.mean () - b.mean () ) <= 1.e-8 * abs ( b.mean () ) , \
+               'Mismatch in statistics: %s vs %s' % ( a , b )
+        
+    assert abs ( n.get () - frame.nEff ( '1/(b1+1)' ) ) < 1.e-6 , 'Mismatch in nEff!'
+    assert c.get ().stat1.nEntries () == e1.nEntries () , 'Mismatch in covariance!'
+    assert abs ( h.Integral () - e1.nEntries () ) < 0.5 , 'Mismatch in projection!' 
+
+    ## the access to the pending handle triggers the next event loop 
+    s4 = lazy.statVar ( 'b1' , 'b1>500' )
+    logger.info ( 'Lazy statistics: %s' % s4.get () )
+    assert 2 == lazy.nRuns () , 'Invalid number of event loops!' 
         
+# =============================================================================
+## kinematical variables for data frame: bulk (batch kernel) and per-event
+def test_frame4 ( ) :
+
+    import math 
+    K  = Ostap.Kinematics 
+    N  = 5000
+    
+    ## deterministic four-vectors as functions of the entry number 
+    comps = {
+        'a' : ( 'sin(0.1*x)' , 'cos(0.2*x)' , '3+sin(0.3*x)' , 0.140 ) ,
+        'b' : ( 'cos(0.7*x)' , 'sin(0.5*x)' , '4+cos(0.1*x)' , 0.494 ) ,
+        'c' : ( 'sin(1.1*x)' , 'cos(1.3*x)' , '5+sin(0.9*x)' , 0.106 ) ,
+        }
+    
+    def vector ( p , x ) :
+        px , py , pz , m = comps [ p ]
+        px , py , pz = [ eval ( e , { 'sin' : math.sin , 'cos' : math.cos , 'x' : x } ) for e in ( px , py , pz ) ]
+        return Ostap.LorentzVector ( px , py , pz , math.sqrt ( px * px + py * py + pz * pz + m * m ) )
+    
+    f = DataFrame ( N ).Define ( 'x' , '(double) rdfentry_' )
+    for p , ( px , py , pz , m ) in comps.items () :
+        f = f.Define ( '%s_PX' % p , px ).Define ( '%s_PY' % p , py ).Define ( '%s_PZ' % p , pz )
+        f = f.Define ( '%s_PE' % p , 'sqrt(%s_PX*%s_PX+%s_PY*%s_PY+%s_PZ*%s_PZ+%.17g)' % ( p , p , p , p , p , p , m * m ) )
+        
+    ## the four-vector as 4-tuple of expressions 
+    M = tuple ( '+'.join ( '%s_%s' % ( p , c ) for p in 'abc' ) for c in ( 'PX' , 'PY' , 'PZ' , 'PE' ) ) 
+    
+    checks = (
+        ( 'mass'         , ( 'a' , 'b'       ) , lambda a , b , c : ( a + b ).M ()              ) ,
+        ( 'cosThetaRest' , ( 'a' , 'b' , M   ) , lambda a , b , c : K.cosThetaRest ( a , b , a + b + c ) ) ,
+        ( 'restMomentum' , ( 'a' , 'c'       ) , lambda a , b , c : K.restMomentum ( a , c )    ) ,
+        )
+    
+    for mt in  ( False , True ) :
+        with implicitMT ( mt ) :
+            for variable , particles , scalar in checks :
+                expected = sorted ( scalar ( vector ( 'a' , i ) , vector ( 'b' , i ) , vector ( 'c' , i ) ) for i in range ( N ) )
+                ## bulk evaluation with the batch kernel 
+                r1 = sorted ( f.Kinematics ( variable , *particles ) )
+                ## per-event evaluation as the new column 
+                r2 = sorted ( f.DefineKinematics ( 'kin' , variable , *particles ).Take['double'] ( 'kin' ).GetValue () )
+                assert N == len ( r1 ) and N == len ( r2 ) , 'Invalid length for %s' % variable 
+                d1 = max ( abs ( u - v ) / max ( 1.0 , abs ( v ) ) for u , v in zip ( r1 , expected ) )
+                d2 = max ( abs ( u - v ) / max ( 1.0 , abs ( v ) ) for u , v in zip ( r2 , expected ) )
+                logger.info ( 'Kinematics %-14s MT:%-5s bulk/per-event max difference %.3g/%.3g' % ( variable , mt , d1 , d2 ) )
+                assert d1 < 1.e-8 and d2 < 1.e-8 , 'Mismatch for %s: %s/%s' % ( variable , d1 , d2 )
+
 # =============================================================================
 if '__main__' == __name__ :
     
     ## test_frame0 () 
     ## test_frame1 ()
     ## test_frame2 ()
+    ## test_frame3 ()
+    ## test_frame4 ()
     
     pass
 
@@ -27,6 +27,7 @@ __all__     = (
     'Histo1DFun'      , ## 1D-histogram as function object 
     'Histo2DFun'      , ## 2D-histogram as function object 
     'Histo3DFun'      , ## 3D-histogram as function object
+    'histo_memo'      , ## memo for the objects derived from histograms 
     )
 # =============================================================================
 import ROOT, sys, math, ctypes, array 
@@ -4207,6 +4208,34 @@ ROOT.TH1D. b2s       = _h1_b2s_
 ROOT.TH2F. b2s       = _h2_b2s_
 ROOT.TH2D. b2s       = _h2_b2s_
 
+# =============================================================================
+## get the (non-owning) view of the histogram content as
+#  array of values with errors (no copy!) 
+#  - all bins including underflow/overflow, in order of global bin numbers
+#  - the in-place operations modify the histogram 
+#  @code
+#  h = ...  ## TH1D, TH2D or TH3D
+#  v = h.values_with_errors ()
+#  v *= 2         ## scale the histogram 
+#  s  = v.sum ()  ## sum over all bins 
+#  @endcode
+#  @see Ostap::Math::ValuesWithErrors
+def _h_values_with_errors_ ( self ) :
+    """Get the (non-owning) view of the histogram content as
+    array of values with errors (no copy!)
+    - all bins including underflow/overflow, in order of global bin numbers
+    - the in-place operations modify the histogram 
+    >>> h = ...  ## TH1D, TH2D or TH3D
+    >>> v = h.values_with_errors ()
+    >>> v *= 2         ## scale the histogram 
+    >>> s  = v.sum ()  ## sum over all bins 
+    """
+    return Ostap.Math.ValuesWithErrors ( self )
+
+ROOT.TH1D. values_with_errors = _h_values_with_errors_
+ROOT.TH2D. values_with_errors = _h_values_with_errors_
+ROOT.TH3D. values_with_errors = _h_values_with_errors_
+
 
 
 # =============================================================================
@@ -7318,17 +7347,57 @@ for t in  ( ROOT.TH1D             ,
 #  histo = ...
 #  h     = hash ( histo ) 
 #  @endcode
+#  @see Ostap::Utils::hash_histo 
 def _h_hash_ ( histo) :
     """
     >>> histo = ...
     >>> h     = hash ( histo ) 
+    - see Ostap.Utils.hash_histo 
     """
-    hv = hash ( ( histo.GetName  () , histo.GetTitle() , type ( histo ) ) ) 
-    for item in histo.iteritems() :
-        hv = hash ( item + ( hv, ) )
-    return hv
+    return hash ( ( histo.GetName  () ,
+                    histo.GetTitle () ,
+                    type ( histo )    ,
+                    Ostap.Utils.hash_histo ( histo ) ) ) 
 
 ROOT.TH1.__hash__ = _h_hash_ 
+
+# =============================================================================
+## Get the (processed) histogram from the process-wide memo
+#  or create it and store it in the memo
+#  @code
+#  histo = ...
+#  ## the clone with zero uncertainties
+#  def _nullify_ ( h ) :
+#     ...
+#  h0 = histo_memo ( histo , 'nullify' , _nullify_ ) 
+#  @endcode
+#  - the memo keeps the copies of the objects, and each call returns the new copy
+#  - the key is defined by the content of the histogram, the operation and parameters 
+#  - the class, the binning and the statistics of the histogram are compared on each hit
+#  @see Ostap::Utils::HistoMemo
+#  @see Ostap::Utils::hash_histo 
+def histo_memo ( histo , operation , maker , params = () ) :
+    """Get the (processed) histogram from the process-wide memo
+    or create it and store it in the memo
+    >>> histo = ...
+    >>> def _nullify_ ( h ) : ...
+    >>> h0 = histo_memo ( histo , 'nullify' , _nullify_ ) 
+    - the memo keeps the copies of the objects, and each call returns the new copy
+    - the key is defined by the content of the histogram, the operation and parameters 
+    - the class, the binning and the statistics of the histogram are compared on each hit
+    - see Ostap.Utils.HistoMemo
+    - see Ostap.Utils.hash_histo 
+    """
+    memo = Ostap.Utils.HistoMemo.instance()
+    key  = memo.key ( histo , operation , hash ( params ) & 0xFFFFFFFFFFFFFFFF )
+    obj  = memo.clone ( key )
+    if obj :
+        ROOT.SetOwnership ( obj , True )
+        return obj 
+    obj = maker ( histo )
+    if obj : memo.store ( key , obj )
+    return obj 
+
 # =============================================================================
 
 # =============================================================================
@@ -7836,6 +7905,9 @@ _new_methods_   = (
     ROOT.TH1D. b2s       ,
     ROOT.TH2F. b2s       ,
     ROOT.TH2D. b2s       ,
+    ROOT.TH1D. values_with_errors ,
+    ROOT.TH2D. values_with_errors ,
+    ROOT.TH3D. values_with_errors ,
     #
     ROOT.TH1F. rescale_bins ,
     ROOT.TH1D. rescale_bins ,
@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_fill.py
+# Test module for the batch histogram filler Ostap::Utils::HistoFill
+# - the result must be identical to TH1::Fill
+# =============================================================================
+"""Test module for the batch histogram filler Ostap::Utils::HistoFill
+- the result must be identical to TH1::Fill
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random
+from   ostap.core.core      import Ostap, hID
+from   builtins             import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' == __name__  or '__builtin__' == __name__ :
+    logger = getLogger ( 'ostap.test_histos_fill' )
+else :
+    logger = getLogger ( __name__ )
+# =============================================================================
+## check that two histograms are identical
+def identical ( h1 , h2 ) :
+    """Check that two histograms are identical"""
+    if h1.GetEntries () != h2.GetEntries () : return False
+    if h1.GetSumw2N  () != h2.GetSumw2N  () : return False
+    for i in range ( h1.GetNcells () ) :
+        if h1.GetBinContent ( i ) != h2.GetBinContent ( i ) : return False
+        if h1.GetBinError   ( i ) != h2.GetBinError   ( i ) : return False
+    from array import array
+    s1 = array ( 'd' , 11 * [ 0 ] )
+    s2 = array ( 'd' , 11 * [ 0 ] )
+    h1.GetStats ( s1 )
+    h2.GetStats ( s2 )
+    return list ( s1 ) == list ( s2 )
+
+# =============================================================================
+def test_fill_1D () :
+
+    N = 50000
+    for htype in ( ROOT.TH1D , ROOT.TH1F ) :
+        for weighted in ( False , True ) :
+
+            h1 = htype ( hID () , '' , 37 , -5 , 5 )
+            h2 = htype ( hID () , '' , 37 , -5 , 5 )
+
+            filler = Ostap.Utils.HistoFill ( h2 , 1000 )
+            assert not filler.direct () , 'Batch filler is not activated!'
+
+            for i in range ( N ) :
+                x = random.gauss ( 0 , 3 )
+                if   0 == i % 1000 : x = float ( 'nan' )
+                elif 1 == i % 1000 : x = 5.0
+                w = random.uniform ( 0.5 , 2 ) if weighted else 1.0
+                h1.Fill   ( x , w )
+                filler.fill ( x , w )
+            filler.flush ()
+
+            assert identical ( h1 , h2 ) , 'Mismatch between TH1::Fill and HistoFill: %s/%s' % ( htype.__name__ , weighted )
+
+    logger.info ( 'HistoFill/1D: identical to TH1::Fill' )
+
+# =============================================================================
+def test_fill_2D () :
+
+    N = 50000
+    from array import array
+    edges = array ( 'd' , [ -3 , -1 , 0 , 0.5 , 2 , 4 ] )
+    h1 = ROOT.TH2D ( hID () , '' , 20 , -4 , 4 , len ( edges ) - 1 , edges )
+    h2 = ROOT.TH2D ( hID () , '' , 20 , -4 , 4 , len ( edges ) - 1 , edges )
+
+    filler = Ostap.Utils.HistoFill ( h2 )
+    for i in range ( N ) :
+        x , y , w = random.gauss ( 0 , 2 ) , random.gauss ( 0 , 2 ) , random.uniform ( 0.5 , 2 )
+        h1.Fill     ( x , y , w )
+        filler.fill2 ( x , y , w )
+    filler.flush ()
+
+    assert identical ( h1 , h2 ) , 'Mismatch between TH2::Fill and HistoFill'
+    logger.info ( 'HistoFill/2D: identical to TH2::Fill' )
+
+# =============================================================================
+def test_project () :
+
+    N  = 10000
+    x  = ROOT.RooRealVar ( 'x' , 'x' , -10 , 10 )
+    ds = ROOT.RooDataSet ( 'ds' , 'ds' , ROOT.RooArgSet ( x ) )
+    for i in range ( N ) :
+        x.setVal ( random.gauss ( 0 , 2 ) )
+        ds.add ( ROOT.RooArgSet ( x ) )
+
+    h1 = ROOT.TH1D ( hID () , '' , 50 , -5 , 5 )
+    h2 = ROOT.TH1D ( hID () , '' , 50 , -5 , 5 )
+
+    Ostap.HistoProject.project ( ds , h1 , 'x' , '' )
+    for i in range ( N ) :
+        v = ds.get ( i ).getRealValue ( 'x' )
+        if -5 <= v < 5 : h2.Fill ( v )
+
+    assert identical ( h1 , h2 ) , 'Mismatch between HistoProject and TH1::Fill'
+    logger.info ( 'HistoProject: identical to TH1::Fill' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_fill_1D  ()
+    test_fill_2D  ()
+    test_project  ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,197 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+# @file ostap/histos/tests/test_histos_memo.py
+# Test module for the histogram hashes and the process-wide memo
+# - stability of Ostap::Utils::hash_histo and Ostap::Utils::hash_buffer
+# - hits, misses and collisions of Ostap::Utils::HistoMemo
+# - LRU eviction of Ostap::Utils::HistoMemo
+# @see Ostap::Utils::HistoMemo
+# @see ostap.histos.histos.histo_memo
+# =============================================================================
+"""Test module for the histogram hashes and the process-wide memo
+- stability of Ostap::Utils::hash_histo and Ostap::Utils::hash_buffer
+- hits, misses and collisions of Ostap::Utils::HistoMemo
+- LRU eviction of Ostap::Utils::HistoMemo
+"""
+# =============================================================================
+__author__ = "Ostap developers"
+__all__    = () ## nothing to import
+# =============================================================================
+import ROOT, random, array
+from   ostap.core.core      import Ostap, hID
+from   ostap.histos.histos  import histo_memo
+from   builtins             import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_histos_memo' )
+else                       : logger = getLogger ( __name__           )
+# =============================================================================
+## create the histogram, filled with the fixed seed
+def make_histo ( seed = 1 , nbins = 50 , edges = None ) :
+    if edges : h = ROOT.TH1D ( hID () , '' , len ( edges ) - 1 , array.array ( 'd' , edges ) )
+    else     : h = ROOT.TH1D ( hID () , '' , nbins , -5 , 5 )
+    h.Sumw2 ()
+    rnd = random.Random ( seed )
+    for i in range ( 1000 ) : h.Fill ( rnd.gauss ( 0 , 1 ) )
+    return h
+
+# =============================================================================
+## stability of the hashes
+def test_histos_hash () :
+
+    logger = getLogger ( 'test_histos_hash' )
+
+    hash_histo  = Ostap.Utils.hash_histo
+    hash_buffer = Ostap.Utils.hash_buffer
+
+    h1 = make_histo ( 1 )
+    h2 = make_histo ( 1 )
+    assert hash_histo ( h1 ) == hash_histo ( h1 )         , 'Hash is not stable!'
+    assert hash_histo ( h1 ) == hash_histo ( h2 )         , 'Same content, different hashes!'
+    assert hash_histo ( h1 ) == hash_histo ( h1.Clone () ), 'Clone has the different hash!'
+
+    ## the content matters
+    h3 = h1.Clone ()
+    h3.SetBinContent ( 25 , h3.GetBinContent ( 25 ) + 1 )
+    assert hash_histo ( h1 ) != hash_histo ( h3 ) , 'Content is not hashed!'
+
+    ## the errors matter
+    h4 = h1.Clone ()
+    h4.SetBinError ( 25 , 2 * h4.GetBinError ( 25 ) + 1 )
+    assert hash_histo ( h1 ) != hash_histo ( h4 ) , 'Errors are not hashed!'
+
+    ## the edges matter: the same content, the different binning
+    edges = [ -5 + 0.2 * i for i in range ( 51 ) ]
+    edges [ 25 ] += 0.05
+    h5 = ROOT.TH1D ( hID () , '' , 50 , array.array ( 'd' , edges ) )
+    for i in range ( h1.GetNcells () ) :
+        h5.SetBinContent ( i , h1.GetBinContent ( i ) )
+        h5.SetBinError   ( i , h1.GetBinError   ( i ) )
+    assert hash_histo ( h1 ) != hash_histo ( h5 ) , 'Edges are not hashed!'
+
+    ## raw buffers
+    b1 = array.array ( 'd' , [ 0.1 * i for i in range ( 100 ) ] )
+    b2 = array.array ( 'd' , b1 ) ; b2 [ 50 ] += 1.e-12
+    n  = len ( b1 ) * b1.itemsize
+    assert hash_buffer ( b1 , n ) == hash_buffer ( array.array ( 'd' , b1 ) , n ) , 'Buffer hash is not stable!'
+    assert hash_buffer ( b1 , n ) != hash_buffer ( b2 , n )     , 'Buffer content is not hashed!'
+    assert hash_buffer ( b1 , n ) != hash_buffer ( b1 , n , 1 ) , 'Seed is ignored!'
+    assert 7 == hash_buffer ( b1 , 0 , 7 ) , 'Empty buffer must give the seed!'
+
+    logger.info ( 'Hashes are stable' )
+
+# =============================================================================
+## hits, misses and collisions
+def test_histos_memo_hits () :
+
+    logger = getLogger ( 'test_histos_memo_hits' )
+
+    memo = Ostap.Utils.HistoMemo.instance ()
+    memo.clear ()
+
+    calls = [ 0 ]
+    def _scale_ ( h ) :
+        calls [ 0 ] += 1
+        r = h.Clone ()
+        r.Scale ( 2 )
+        return r
+
+    h1 = make_histo ( 1 )
+    r1 = histo_memo ( h1 , 'test/scale' , _scale_ )
+    assert 1 == calls [ 0 ] and 0 == memo.hits () and 1 == memo.misses () , 'Invalid first call!'
+
+    ## the same content: hit, the new copy
+    r2 = histo_memo ( make_histo ( 1 ) , 'test/scale' , _scale_ )
+    assert 1 == calls [ 0 ] and 1 == memo.hits () , 'Hit is expected!'
+    assert r2 is not r1 and r2.GetBinContent ( 25 ) == r1.GetBinContent ( 25 ) , 'Invalid object from the memo!'
+
+    ## other operation, parameters or content: miss
+    histo_memo ( h1               , 'test/other' , _scale_ )
+    histo_memo ( h1               , 'test/scale' , _scale_ , params = ( 1 , 2 ) )
+    histo_memo ( make_histo ( 2 ) , 'test/scale' , _scale_ )
+    assert 4 == calls [ 0 ] and 1 == memo.hits () and 4 == memo.misses () , 'Misses are expected!'
+    assert 4 == memo.size () , 'Invalid size of the memo %s' % memo.size ()
+
+    ## the same hash, but no identity of the histogram: the collision is a miss
+    HM   = Ostap.Utils.HistoMemo
+    full = HM.key ( h1 , 'test/scale' , 0 )
+    bare = HM.key ( Ostap.Utils.hash_histo ( h1 ) , 'test/scale' , 0 )
+    assert full.hash () == bare.hash () and not full == bare , 'Keys must differ only by identity!'
+    assert not memo.clone ( bare ) , 'Collision is not detected!'
+    assert 1 == memo.collisions () , 'Collision is not counted!'
+    assert not memo.erase ( bare ) and memo.clone ( full ) , 'Colliding key removes the object!'
+
+    ## the same content and the different binning: the different key
+    h5 = ROOT.TH1D ( hID () , '' , 50 , -5 , 6 )
+    for i in range ( h1.GetNcells () ) :
+        h5.SetBinContent ( i , h1.GetBinContent ( i ) )
+        h5.SetBinError   ( i , h1.GetBinError   ( i ) )
+    assert not HM.key ( h5 , 'test/scale' , 0 ) == full , 'Binning is not in the key!'
+
+    logger.info ( 'hits %d, misses %d, collisions %d, size %d, memory %d' % (
+        memo.hits () , memo.misses () , memo.collisions () , memo.size () , memo.memory () ) )
+    memo.clear ()
+
+# =============================================================================
+## LRU eviction
+def test_histos_memo_lru () :
+
+    logger = getLogger ( 'test_histos_memo_lru' )
+
+    memo = Ostap.Utils.HistoMemo.instance ()
+    memo.clear ()
+    maxsize   = memo.maxSize   ()
+    maxmemory = memo.maxMemory ()
+
+    try :
+
+        histos = [ make_histo ( i ) for i in range ( 4 ) ]
+        keys   = [ memo.key ( h , 'test/lru' , 0 ) for h in histos ]
+
+        memo.setMaxSize ( 3 )
+        for k , h in zip ( keys [ : 3 ] , histos [ : 3 ] ) : memo.store ( k , h )
+        assert 3 == memo.size () , 'Invalid size %s' % memo.size ()
+
+        ## use the oldest one: now the second is the least recently used
+        assert memo.clone ( keys [ 0 ] ) , 'Object is not found!'
+        memo.store ( keys [ 3 ] , histos [ 3 ] )
+        assert 3 == memo.size () , 'Invalid size %s' % memo.size ()
+        assert     memo.clone ( keys [ 0 ] ) , 'Recently used object is evicted!'
+        assert not memo.clone ( keys [ 1 ] ) , 'Least recently used object is not evicted!'
+        assert     memo.clone ( keys [ 2 ] ) and memo.clone ( keys [ 3 ] ) , 'Wrong object is evicted!'
+
+        ## shrink by memory: only one histogram fits
+        memo.setMaxSize   ( maxsize )
+        one = memo.memory () // memo.size ()
+        memo.setMaxMemory ( one + one // 2 )
+        assert 1 == memo.size () and memo.memory () <= memo.maxMemory () , 'Memory limit is ignored!'
+        assert memo.clone ( keys [ 3 ] ) , 'The most recently used object is evicted!'
+
+        ## too large object is not kept
+        memo.setMaxMemory ( 16 )
+        memo.store ( keys [ 0 ] , histos [ 0 ] )
+        assert 0 == memo.size () , 'Too large object is kept!'
+
+        logger.info ( 'LRU eviction is OK' )
+
+    finally :
+
+        memo.setMaxSize   ( maxsize   )
+        memo.setMaxMemory ( maxmemory )
+        memo.clear ()
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_histos_hash      ()
+    test_histos_memo_hits ()
+    test_histos_memo_lru  ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -76,6 +76,8 @@ __all__     = (
     # for completeness  
     'interpolate_bernstein' , ## Newton-Bernstein interpolation 
     'interpolate_bspline'   , ## Basic spline interpolation
+    #
+    'local_interpolation'   , ## local interpolation for large tables 
     )
 # =============================================================================
 import  ROOT, math, sys 
@@ -754,6 +756,47 @@ def points ( func , abscissas  = None ) :
     ##
     return Ostap.Math.Interpolation.Table ( doubles ( abscissas ) , doubles ( func ) )
 
+# =============================================================================
+## Local polynomial interpolation for large tables: O(log n) or O(1) for
+#  the uniform abscissas, the stencil of (order+1) points
+#  @code
+#  l1 = local_interpolation ( math.sin , 100000 , 0 , 10 )          ## uniform table 
+#  l2 = local_interpolation ( table , order = 5  )                  ## Table 
+#  l3 = local_interpolation ( { 0:0 , 0.5:0.25 , 1:1 , 2:4 } )      ## mapping 
+#  l4 = local_interpolation ( [0,0.25,1,4] , [ 0,0.5, 1,2] )        ## x & y 
+#  @endcode 
+#  @see Ostap::Math::LocalInterpolation
+def local_interpolation ( func , *args , **kwargs ) :
+    """Local polynomial interpolation for large tables: O(log n) or O(1) for
+    the uniform abscissas, the stencil of (order+1) points
+    
+    >>> l1 = local_interpolation ( math.sin , 100000 , 0 , 10 )          ## uniform table 
+    >>> l2 = local_interpolation ( table , order = 5  )                  ## Table 
+    >>> l3 = local_interpolation ( { 0:0 , 0.5:0.25 , 1:1 , 2:4 } )      ## mapping 
+    >>> l4 = local_interpolation ( [0,0.25,1,4] , [ 0,0.5, 1,2] )        ## x & y 
+    - see Ostap.Math.LocalInterpolation
+    """
+    order = kwargs.pop ( 'order' , 3 )
+    assert not kwargs , 'Unknown arguments: %s' % list ( kwargs.keys () ) 
+    assert is_integer ( order ) and 1 <= order <= 12 , 'Invalid order %s' % order 
+    
+    LI = Ostap.Math.LocalInterpolation [ order ]
+    
+    if   isinstance ( func , Ostap.Math.Interpolation.Table ) and not args :
+        return LI ( func )
+    elif isinstance ( func , Mapping ) and not args :
+        keys = sorted ( func.keys () ) 
+        return LI ( doubles ( keys ) , doubles ( [ func [ k ] for k in keys ] ) )
+    elif callable ( func ) and 3 == len ( args ) :
+        n , low , high = args
+        assert is_integer ( n ) and 2 <= n , 'Invalid number of points %s' % n 
+        xs = [ low + i * ( high - low ) / ( n - 1.0 ) for i in range ( n ) ]
+        return LI ( doubles ( xs ) , doubles ( [ func ( x ) for x in xs ] ) )
+    elif 1 == len ( args ) :
+        return LI ( doubles ( func ) , doubles ( args [ 0 ] ) )
+    
+    raise TypeError ( "Can't create local interpolation from %s/%s" % ( func , args ) ) 
+
 # =============================================================================
 ## Bernstein & BSpline interpolation
 # =============================================================================
@@ -32,6 +32,10 @@ __all__     = (
     'kallen'      , ## Kallen ``lambda''/``triangle'' function
     'G'           , ## the basic universal 4-body function ``tetrahedron-function''
     ##
+    'kinematic_variable' , ## get the kinematical variable for batch evaluation
+    'lorentz_components' , ## expressions for the components of four-vector 
+    'batch_kinematics'   , ## evaluate kinematical variable for columns of four-vectors 
+    ##
     )
 # =============================================================================
 import ROOT, math
@@ -736,6 +740,122 @@ def G ( x , y , z , u , v , w ) :
     ##
     return result 
     
+# =============================================================================
+## Kinematical variables, known for the batch evaluation
+#  @see Ostap::Kinematics::Batch::Variable
+_KB = Ostap.Kinematics.Batch
+_VD = ROOT.std.vector('double')
+kinematic_variables = {
+    'decayangle'            : _KB.DecayAngle            , ## ( P  , Q  , D       ) 
+    'decayanglelab'         : _KB.DecayAngleLab         , ## ( D  , M            )
+    'costhetarest'          : _KB.CosThetaRest          , ## ( v1 , v2 , M       ) 
+    'decayanglechi'         : _KB.DecayAngleChi         , ## ( d1 , d2 , h1 , h2 )
+    'cosdecayanglechi'      : _KB.CosDecayAngleChi      , ## ( d1 , d2 , h1 , h2 )
+    'sindecayanglechi'      : _KB.SinDecayAngleChi      , ## ( d1 , d2 , h1 , h2 )
+    'armenteros'            : _KB.ArmenterosPodolanskiX , ## ( d1 , d2           )
+    'armenterospodolanskix' : _KB.ArmenterosPodolanskiX , ## ( d1 , d2           )
+    'restmomentum'          : _KB.RestMomentum          , ## ( v  , M            )
+    'restenergy'            : _KB.RestEnergy            , ## ( v  , M            )
+    'transversemomentumdir' : _KB.TransverseMomentumDir , ## ( p  , dir          )
+    'gramdelta2'            : _KB.GramDelta2            , ## ( p1 , p2           )
+    'gramdelta3'            : _KB.GramDelta3            , ## ( p1 , p2 , p3      )
+    'mass2'                 : _KB.Mass2                 , ## ( p1 , ... [ , p4 ] )
+    'mass'                  : _KB.Mass                  , ## ( p1 , ... [ , p4 ] )
+    }
+# =============================================================================
+## get the kinematical variable for batch evaluation
+#  @code
+#  v = kinematic_variable ( 'decayAngle' ) 
+#  @endcode 
+#  @see Ostap::Kinematics::Batch::Variable
+def kinematic_variable ( variable ) :
+    """Get the kinematical variable for batch evaluation
+    >>> v = kinematic_variable ( 'decayAngle' ) 
+    - see Ostap.Kinematics.Batch.Variable
+    """
+    from ostap.core.ostap_types import string_types
+    if isinstance ( variable , string_types ) :
+        key = variable.lower().replace ( '_' , '' )
+        assert key in kinematic_variables , \
+               "Unknown kinematic variable `%s'" % variable 
+        return kinematic_variables [ key ]
+    return variable 
+
+# =============================================================================
+## get the expressions for the components (px,py,pz,E) of four-vector
+#  @code
+#  lorentz_components ( 'B' ) ## ( 'B_PX' , 'B_PY' , 'B_PZ' , 'B_PE' )
+#  lorentz_components ( 'B' , ( '_px' , '_py' , '_pz' , '_e' ) )
+#  lorentz_components ( ( 'px' , 'py' , 'pz' , 'sqrt(px*px+py*py+pz*pz+0.25)' ) ) 
+#  @endcode 
+def lorentz_components ( particle , components = ( '_PX' , '_PY' , '_PZ' , '_PE' ) ) :
+    """Get the expressions for the components (px,py,pz,E) of four-vector
+    >>> lorentz_components ( 'B' ) ## ( 'B_PX' , 'B_PY' , 'B_PZ' , 'B_PE' )
+    >>> lorentz_components ( 'B' , ( '_px' , '_py' , '_pz' , '_e' ) )
+    >>> lorentz_components ( ( 'px' , 'py' , 'pz' , 'sqrt(px*px+py*py+pz*pz+0.25)' ) ) 
+    """
+    from ostap.core.ostap_types import string_types
+    if isinstance ( particle , string_types ) :
+        assert 4 == len ( components ) , 'Invalid components %s' % str ( components ) 
+        return tuple ( particle + c for c in components )
+    particle = tuple ( particle )
+    assert 4 == len ( particle ) , 'Invalid four-vector %s' % str ( particle )
+    return particle
+
+# =============================================================================
+## Evaluate the kinematical variable for the columns of four-vectors
+#  Each four-vector is specified as four arrays (px,py,pz,E),
+#  e.g. <code>numpy</code> arrays, <code>array.array('d')</code> or <code>std::vector<double></code>
+#  @code
+#  B   = px1 , py1 , pz1 , e1
+#  J   = px2 , py2 , pz2 , e2
+#  mu  = px3 , py3 , pz3 , e3
+#  cos_theta = batch_kinematics ( 'decayAngle' , B , J , mu )
+#  @endcode 
+#  @see Ostap::Kinematics::Batch
+def batch_kinematics ( variable , *vectors ) :
+    """Evaluate the kinematical variable for the columns of four-vectors
+    Each four-vector is specified as four arrays (px,py,pz,E),
+    e.g. numpy arrays, array.array('d') or std::vector<double>
+    >>> B   = px1 , py1 , pz1 , e1
+    >>> J   = px2 , py2 , pz2 , e2
+    >>> mu  = px3 , py3 , pz3 , e3
+    >>> cos_theta = batch_kinematics ( 'decayAngle' , B , J , mu )
+    - see Ostap.Kinematics.Batch
+    """
+    variable = kinematic_variable ( variable )
+    assert vectors , 'No four-vectors are specified!'
+    
+    import array 
+    n       = len ( vectors [ 0 ][ 0 ] )
+    columns = ROOT.std.vector('Ostap::Kinematics::LorentzColumns')()
+    keep    = [] 
+    for v in vectors :
+        assert 4 == len ( v ) , 'Invalid four-vector!'
+        cs = [] 
+        for c in v :
+            assert n == len ( c ) , 'Mismatch in the column length!'
+            if isinstance ( c , _VD ) :
+                keep.append ( c ) 
+                cs.append   ( c.data () )
+                continue 
+            if not isinstance ( c , array.array ) or 'd' != c.typecode :
+                try :
+                    import numpy
+                    if isinstance ( c , numpy.ndarray ) and numpy.float64 == c.dtype and c.flags.c_contiguous :
+                        cs.append ( c )
+                        continue 
+                except ImportError :
+                    pass 
+                c = array.array ( 'd' , c )
+            cs.append ( c ) 
+        keep.append ( cs ) 
+        columns.push_back ( Ostap.Kinematics.LorentzColumns ( *cs ) )
+        
+    result = array.array ( 'd' , [ 0.0 ] ) * n
+    if n : _KB.evaluate ( variable , n , columns , result )
+    return result 
+    
 # =============================================================================
 if '__main__' == __name__ :
     
@@ -0,0 +1,240 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_basiscache.py
+#  Test module for the cache of basis functions
+#  - compare the cached values with the direct evaluation of 1D/2D/3D Bernstein
+#    polynomials in double and single precision, for the new coefficients
+#  - the cache is not valid for the other degree, range or knots
+#  - compare PolyPositive with and without the cache
+#  @see Ostap::Math::BasisCache
+#  @see Ostap::Models::PolyPositive::cacheBasis
+# =============================================================================
+""" Test module for the cache of basis functions
+- compare the cached values with the direct evaluation of 1D/2D/3D Bernstein
+  polynomials in double and single precision, for the new coefficients
+- the cache is not valid for the other degree, range or knots
+- compare PolyPositive with and without the cache
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random, ctypes
+from   array            import array
+from   ostap.core.core  import Ostap
+from   builtins         import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_basiscache' )
+else                       : logger = getLogger ( __name__               )
+# =============================================================================
+# =============================================================================
+BC = Ostap.Math.BasisCache
+## the tolerances: the same sums, the different order of operations
+TOL_DOUBLE = 1.e-12
+## single precision for the basis values
+TOL_SINGLE = 1.e-6
+# =============================================================================
+def randomize ( f ) :
+    for k in range ( f.npars () ) : f.setPar ( k , random.uniform ( -1 , 1 ) )
+    return f
+
+# =============================================================================
+## the point
+def point ( x , y = 0 , z = 0 ) :
+    p = BC.Point ()
+    p [ 0 ] , p [ 1 ] , p [ 2 ] , p [ 3 ] = x , y , z , 0
+    return p
+
+# =============================================================================
+## random points in the unit cube, each point is added twice
+def points ( n ) :
+    result = [ point ( random.uniform ( 0 , 1 ) ,
+                       random.uniform ( 0 , 1 ) ,
+                       random.uniform ( 0 , 1 ) ) for i in range ( n ) ]
+    return result + result
+
+# =============================================================================
+## the dimension of the function
+def dimension ( f ) :
+    if   hasattr ( f , 'nZ' ) : return 3
+    elif hasattr ( f , 'nY' ) : return 2
+    return 1
+
+# =============================================================================
+## the key of the basis
+def key ( f ) :
+    if isinstance ( f , Ostap.Math.BSpline ) : return BC.keySpline ( f )
+    return ( BC.key1D , BC.key2D , BC.key3D ) [ dimension ( f ) - 1 ] ( f )
+
+# =============================================================================
+## the direct evaluation
+def direct ( f , p ) :
+    return f ( *[ p [ i ] for i in range ( dimension ( f ) ) ] )
+
+# =============================================================================
+## fill the cache
+def fill ( cache , f , points ) :
+    basis  = ( BC.basis1D , BC.basis2D , BC.basis3D ) [ dimension ( f ) - 1 ] ( f )
+    buffer = array ( 'd' , f.npars () * [ 0.0 ] )
+    for p in points :
+        basis ( p , buffer )
+        if not cache.add ( p , buffer ) : return False
+    return True
+
+# =============================================================================
+## get the value from the cache, None if the point is not in the cache
+def value ( cache , pars , p ) :
+    result = ctypes.c_double ( 0 )
+    return result.value if cache.value ( p , pars , result ) else None
+
+# =============================================================================
+## the maximal difference between the cache and the direct evaluation, relative to maximal value
+def diff ( cache , f , points ) :
+    dmax , scale = 0.0 , 0.0
+    for p in points :
+        v = value ( cache , f.pars () , p )
+        if v is None : return -1
+        d     = direct ( f , p )
+        dmax  = max ( dmax  , abs ( v - d ) )
+        scale = max ( scale , abs ( d ) )
+    return dmax / scale
+
+# =============================================================================
+## compare the cached values with the direct evaluation
+def test_basiscache_values () :
+
+    logger = getLogger ( 'test_basiscache_values' )
+
+    npoints = 1000
+    pnts    = points ( npoints )
+
+    functions = ( ( 'Bernstein(6)'       , Ostap.Math.Bernstein   ( 6 ,         0 , 1 ) ) ,
+                  ( 'Bernstein2D(4,3)'   , Ostap.Math.Bernstein2D ( 4 , 3 ,     0 , 1 , 0 , 1 ) ) ,
+                  ( 'Bernstein3D(3,2,2)' , Ostap.Math.Bernstein3D ( 3 , 2 , 2 , 0 , 1 , 0 , 1 , 0 , 1 ) ) )
+
+    for label , f in functions :
+        for single , tolerance in ( ( False , TOL_DOUBLE ) , ( True , TOL_SINGLE ) ) :
+
+            randomize ( f )
+            cache = BC ( f.npars () , single , BC.s_MAXMEMORY , key ( f ) )
+            assert fill ( cache , f , pnts ) , '%s: cache is not filled!' % label
+            assert npoints == cache.size ()  , '%s: duplicated points are not merged %s' % ( label , cache.size () )
+            assert cache.valid ( key ( f ) ) , '%s: cache is not valid!' % label
+
+            ## the values are recalculated for the new coefficients
+            for i in range ( 3 ) :
+                d = diff ( cache , f , pnts )
+                assert 0 <= d < tolerance , '%s/single=%s: cache vs direct difference is too large %s' % ( label , single , d )
+                randomize ( f )
+
+            logger.info ( '%-20s single=%-5s: #points %d, memory %7d, max difference %.3g' % (
+                label , single , cache.size () , cache.memory () , d ) )
+
+            ## the point that is not in the cache
+            assert value ( cache , f.pars () , pnts [ 0 ]                ) is not None , '%s: known point is not found!' % label
+            assert value ( cache , f.pars () , point ( 1.5 , 1.5 , 1.5 ) ) is     None , '%s: unknown point is found!'   % label
+
+# =============================================================================
+## the cache is not valid for the other degree, range or knots
+def test_basiscache_invalidation () :
+
+    logger = getLogger ( 'test_basiscache_invalidation' )
+
+    B  = Ostap.Math.Bernstein
+    B2 = Ostap.Math.Bernstein2D
+    B3 = Ostap.Math.Bernstein3D
+
+    pnts = points ( 100 )
+
+    ## 1D: degree and range
+    f     = randomize ( B ( 5 , 0 , 1 ) )
+    cache = BC ( f.npars () , False , BC.s_MAXMEMORY , key ( f ) )
+    assert fill ( cache , f , pnts ) , 'Cache is not filled!'
+    assert     cache.valid ( key ( B ( 5 , 0 , 1 ) ) ) , 'Cache must be valid for the same basis!'
+    assert not cache.valid ( key ( B ( 6 , 0 , 1 ) ) ) , 'Cache is valid for the other degree!'
+    assert not cache.valid ( key ( B ( 5 , 0 , 2 ) ) ) , 'Cache is valid for the other range!'
+    ## the coefficients of the other degree are rejected
+    assert value ( cache , B ( 6 , 0 , 1 ).pars () , pnts [ 0 ] ) is None , 'Cache is used for the other degree!'
+
+    ## 2D: the same number of parameters, the other degrees or range
+    k2 = key ( B2 ( 4 , 3 , 0 , 1 , 0 , 1 ) )
+    assert k2 != key ( B2 ( 3 , 4 , 0 , 1 , 0 , 1 ) ) , '2D: key does not depend on degrees!'
+    assert k2 != key ( B2 ( 4 , 3 , 0 , 1 , 0 , 2 ) ) , '2D: key does not depend on y-range!'
+
+    ## 3D: the same number of parameters, the other degrees or range
+    k3 = key ( B3 ( 2 , 3 , 4 , 0 , 1 , 0 , 1 , 0 , 1 ) )
+    assert k3 != key ( B3 ( 2 , 4 , 3 , 0 , 1 , 0 , 1 , 0 , 1 ) ) , '3D: key does not depend on degrees!'
+    assert k3 != key ( B3 ( 2 , 3 , 4 , 0 , 1 , 0 , 1 , 0 , 3 ) ) , '3D: key does not depend on z-range!'
+
+    ## splines: the same number of parameters, the other knots
+    VD = ROOT.std.vector ( 'double' )
+    s1 = Ostap.Math.BSpline ( VD ( [ 0 , 0.25 , 0.50 , 0.75 , 1 ] ) , 3 )
+    s2 = Ostap.Math.BSpline ( VD ( [ 0 , 0.20 , 0.50 , 0.70 , 1 ] ) , 3 )
+    assert s1.npars () == s2.npars ()  , 'Splines must have the same number of parameters!'
+    assert key ( s1 ) != key ( s2 ) , 'Spline key does not depend on knots!'
+
+    ## the memory limit
+    row   = 8 * f.npars ()
+    small = BC ( f.npars () , False , 10 * row , key ( f ) )
+    assert not fill ( small , f , pnts ) and 10 == small.size () , 'Memory limit is ignored!'
+
+    logger.info ( 'Invalidation by degree, range and knots is OK' )
+
+# =============================================================================
+## compare PolyPositive with and without the cache
+def test_basiscache_pdf () :
+
+    logger = getLogger ( 'test_basiscache_pdf' )
+
+    x    = ROOT.RooRealVar ( 'x_bc' , 'x' , 0 , 1 )
+    phis = [ ROOT.RooRealVar ( 'phi_bc_%d' % i , 'phi' , 0 , -10 , 10 ) for i in range ( 5 ) ]
+    lst  = ROOT.RooArgList ()
+    for p in phis : lst.add ( p )
+
+    pdf1 = Ostap.Models.PolyPositive ( 'pp_cached' , '' , x , lst , 0 , 1 )
+    pdf2 = Ostap.Models.PolyPositive ( 'pp_direct' , '' , x , lst , 0 , 1 )
+
+    values = [ random.uniform ( 0 , 1 ) for i in range ( 500 ) ]
+    ds     = ROOT.RooDataSet ( 'ds_bc' , '' , ROOT.RooArgSet ( x ) )
+    for v in values :
+        x.setVal ( v )
+        ds.add ( ROOT.RooArgSet ( x ) )
+
+    for single , tolerance in ( ( False , TOL_DOUBLE ) , ( True , TOL_SINGLE ) ) :
+
+        assert pdf1.cacheBasis ( ds , single ) , 'Cache is not built!'
+        assert pdf1.basisCache () and 500 == pdf1.basisCache ().size () , 'Invalid cache!'
+
+        dmax = 0.0
+        for i in range ( 3 ) :
+            for p in phis : p.setVal ( random.uniform ( -3 , 3 ) )
+            for v in values :
+                x.setVal ( v )
+                v1 , v2 = pdf1.getVal () , pdf2.getVal ()
+                dmax = max ( dmax , abs ( v1 - v2 ) / max ( 1.0 , abs ( v2 ) ) )
+
+        logger.info ( 'PolyPositive single=%-5s: max difference %.3g' % ( single , dmax ) )
+        assert dmax < tolerance , 'PolyPositive: cached vs direct difference is too large %s' % dmax
+
+        ## the point that is not in the dataset: the direct evaluation
+        x.setVal ( 0.123456789 )
+        assert pdf1.getVal () == pdf2.getVal () , 'Direct evaluation is not used for unknown points!'
+
+        pdf1.resetCache ()
+        assert not pdf1.basisCache () , 'Cache is not removed!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_basiscache_values       ()
+    test_basiscache_invalidation ()
+    test_basiscache_pdf          ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
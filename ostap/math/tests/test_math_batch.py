@@ -0,0 +1,181 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_batch.py
+#  Test module for the batch special functions
+#  - each vectorized function is compared with the scalar one over several
+#    ranges and special values, the difference must be within the accuracy,
+#    stated in Ostap/MoreMathBatch.h
+#  - the functions, evaluated with the scalar implementations in the loop,
+#    must give exactly the same results
+#  - the arrays are long enough to be processed in parallel
+#  @see Ostap::Math::Batch
+# =============================================================================
+""" Test module for the batch special functions
+- each vectorized function is compared with the scalar one over several
+  ranges and special values, the difference must be within the accuracy,
+  stated in Ostap/MoreMathBatch.h
+- the functions, evaluated with the scalar implementations in the loop,
+  must give exactly the same results
+- the arrays are long enough to be processed in parallel
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, math, random, sys
+from   array            import array
+from   ostap.core.core  import Ostap
+from   ostap.math.base  import doubles
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_batch' )
+else                       : logger = getLogger ( __name__          )
+# =============================================================================
+M = Ostap.Math
+B = Ostap.Math.Batch
+# =============================================================================
+inf     = float ( 'inf' )
+nan     = float ( 'nan' )
+SPECIAL = ( 0.0 , -0.0 , inf , -inf , nan )
+## number of the regular and random points per range:
+#  more than the grain of the parallel processing
+POINTS  = 10000
+# =============================================================================
+## the unit in the last place
+def ulp ( value ) :
+    a = abs ( value )
+    if math.isinf ( a ) or math.isnan ( a ) : return 0.0
+    if 0 == a                               : return 5.e-324
+    m , e = math.frexp ( a )
+    return max ( math.ldexp ( 1.0 , e - 53 ) , 5.e-324 )
+
+# =============================================================================
+## the unit for the functions with exp(+-x^2) factor
+def ulp_x2 ( x , value ) : return ulp ( value ) * max ( 1.0 , x * x )
+
+# =============================================================================
+## the unit for probit: the rounding of the argument is propagated dz = dp / phi(z)
+def ulp_probit ( p , z ) :
+    g = M.gauss_pdf ( z )
+    return ulp ( z ) + ( ulp ( p ) / g if 0 < g else inf )
+
+# =============================================================================
+## the coefficients for the Clenshaw sums
+PARS = doubles ( [ random.uniform ( -1 , 1 ) for i in range ( 20 ) ] )
+## the unit for the Clenshaw sums: epsilon times the sum of |p_i|
+def pnorm ( x , value ) : return sum ( abs ( v ) for v in PARS ) * sys.float_info.epsilon
+
+# =============================================================================
+## the difference in units
+def distance ( result , value , unit ) :
+    if math.isnan ( result ) and math.isnan ( value ) : return 0.0
+    if result == value                                : return 0.0
+    if math.isinf ( result ) or math.isnan ( result ) or \
+       math.isinf ( value  ) or math.isnan ( value  ) : return inf
+    u = unit ()
+    if not 0 < u : return inf
+    return abs ( result - value ) / u
+
+# =============================================================================
+## compare the batch function with the scalar one
+#  @return the maximal difference in units, its position and number of points
+def check ( scalar , batch , ranges , special , points , unit = lambda x , v : ulp ( v ) ) :
+
+    x = list ( special )
+    for low , high in ranges :
+        x += [ low + ( high - low ) * i / ( points - 1.0 ) for i in range ( points ) ]
+        x += [ random.uniform ( low , high )                for i in range ( points ) ]
+
+    n  = len ( x )
+    xs = array ( 'd' , x )
+    ys = array ( 'd' , n * [ 0.0 ] )
+    batch ( n , xs , ys )
+
+    worst , where = 0.0 , 0.0
+    for xi , yi in zip ( xs , ys ) :
+        value = scalar ( xi )
+        d     = distance ( yi , value , lambda : unit ( xi , value ) )
+        if worst < d or math.isnan ( d ) : worst , where = d , xi
+
+    return worst , where , n
+
+# =============================================================================
+## the vectorized functions: name, scalar and batch functions, ranges, special
+#  values, the stated accuracy (in units, see Ostap/MoreMathBatch.h) and the unit
+VECTORIZED = (
+    ( 'gauss_pdf' ,
+      lambda x : M.gauss_pdf ( x , 0.5 , 1.5 ) ,
+      lambda n , x , r : B.gauss_pdf ( n , x , r , 0.5 , 1.5 ) ,
+      ( ( -5 , 5 ) , ( -50 , 50 ) ) , SPECIAL , 3  ,
+      lambda x , v : ulp_x2 ( ( x - 0.5 ) / 1.5 , v ) ) ,
+    ## the scalar gauss_cdf uses erf: compare with the accurate expression
+    ( 'gauss_cdf' ,
+      lambda x : 0.5 * ROOT.std.erfc ( ( 0.5 - x ) / ( math.sqrt ( 2.0 ) * 1.5 ) ) ,
+      lambda n , x , r : B.gauss_cdf ( n , x , r , 0.5 , 1.5 ) ,
+      ( ( -5 , 5 ) , ( -50 , 50 ) ) , SPECIAL , 10 ,
+      lambda x , v : ulp_x2 ( ( x - 0.5 ) / 1.5 , v ) ) ,
+    ( 'erf'    , ROOT.std.erf  , B.erf    , ( ( -1 , 1 ) , ( -6  , 6  ) )                       , SPECIAL , 3 , None ) ,
+    ( 'erfc'   , ROOT.std.erfc , B.erfc   , ( ( -1 , 1 ) , ( -6  , 6  ) , ( 0 , 27 ) )          , SPECIAL , 8 , None ) ,
+    ( 'erfcx'  , M.erfcx       , B.erfcx  , ( ( -1 , 1 ) , ( -26 , 0  ) , ( 0 , 100 ) , ( 0 , 1.e+9 ) ) , SPECIAL , 3 , ulp_x2 ) ,
+    ( 'erfi'   , M.erfi        , B.erfi   , ( ( -1 , 1 ) , ( -26 , 26 ) )                       , SPECIAL , 3 , ulp_x2 ) ,
+    ( 'dowson' , M.dowson      , B.dowson , ( ( -1 , 1 ) , ( -100 , 100 ) , ( 0 , 1.e+9 ) )     , SPECIAL , 2 , None ) ,
+    ( 'probit' , M.probit      , B.probit , ( ( 0 , 1 ) , ( 0 , 0.03 ) , ( 0.97 , 1 ) , ( 0 , 1.e-10 ) , ( 0 , 1.e-300 ) ) ,
+      ( 0.0 , 0.5 , 1.0 , -1.0 , 2.0 , nan ) , 4 , ulp_probit ) ,
+    ( 'clenshaw_chebyshev' ,
+      lambda x : M.clenshaw_chebyshev ( PARS , x ) ,
+      lambda n , x , r : B.clenshaw_chebyshev ( PARS , n , x , r ) , ( ( -1 , 1 ) , ) , () , 40 , pnorm ) ,
+    ( 'clenshaw_legendre'  ,
+      lambda x : M.clenshaw_legendre  ( PARS , x ) ,
+      lambda n , x , r : B.clenshaw_legendre  ( PARS , n , x , r ) , ( ( -1 , 1 ) , ) , () , 40 , pnorm ) ,
+    ( 'clenshaw_polynom'   ,
+      lambda x : M.clenshaw_polynom   ( PARS , x ) ,
+      lambda n , x , r : B.clenshaw_polynom   ( PARS , n , x , r ) , ( ( -1 , 1 ) , ) , () , 40 , pnorm ) ,
+    )
+# =============================================================================
+## the scalar implementations in the loop: exactly the same results
+SCALAR = (
+    ( 'student_cdf' , lambda t : M.student_cdf ( t , 3.5 ) , lambda n , x , r : B.student_cdf ( n , x , r , 3.5 ) , ( ( -10  , 10   ) , ) ) ,
+    ( 'owen'        , lambda h : M.owen ( h , 0.7 )        , lambda n , x , r : B.owen        ( n , x , r , 0.7 ) , ( ( -5   , 5    ) , ) ) ,
+    ( 'igamma'      , M.igamma                             , B.igamma                                            , ( ( 0.1  , 10   ) , ) ) ,
+    ( 'bessel_Kn'   , lambda x : M.bessel_Kn ( 2 , x )     , lambda n , x , r : B.bessel_Kn   ( n , x , r , 2   ) , ( ( 0.1  , 20   ) , ) ) ,
+    ( 'bessel_Knu'  , lambda x : M.bessel_Knu ( 1.3 , x )  , lambda n , x , r : B.bessel_Knu  ( n , x , r , 1.3 ) , ( ( 0.1  , 20   ) , ) ) ,
+    ( 'elliptic_K'  , lambda k : M.elliptic_K ( k )        , B.elliptic_K                                        , ( ( 0.0  , 0.99 ) , ) ) ,
+    ( 'elliptic_E'  , lambda k : M.elliptic_E ( k )        , B.elliptic_E                                        , ( ( 0.0  , 0.99 ) , ) ) ,
+    )
+# =============================================================================
+## vectorized functions vs the scalar ones
+def test_batch_vectorized () :
+
+    logger = getLogger ( 'test_batch_vectorized' )
+    logger.info ( 'Instruction set: %s' % B.simd () )
+
+    for name , scalar , batch , ranges , special , bound , unit in VECTORIZED :
+        if unit : worst , where , n = check ( scalar , batch , ranges , special , POINTS , unit )
+        else    : worst , where , n = check ( scalar , batch , ranges , special , POINTS )
+        logger.info ( '%-20s: #points %7d, max error %8.3g at x=%-14.8g bound %d' % ( name , n , worst , where , bound ) )
+        assert worst <= bound , '%s: the difference %s at x=%s exceeds the stated accuracy %s' % ( name , worst , where , bound )
+
+# =============================================================================
+## scalar functions in the loop: exactly the same results
+def test_batch_scalar () :
+
+    logger = getLogger ( 'test_batch_scalar' )
+
+    for name , scalar , batch , ranges in SCALAR :
+        worst , where , n = check ( scalar , batch , ranges , () , POINTS )
+        logger.info ( '%-20s: #points %7d, max error %8.3g' % ( name , n , worst ) )
+        assert 0 == worst , '%s: the batch result differs from the scalar one at x=%s' % ( name , where )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_batch_vectorized ()
+    test_batch_scalar     ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
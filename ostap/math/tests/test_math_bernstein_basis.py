@@ -0,0 +1,174 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_bernstein_basis.py
+#  Test module for the evaluation of 2D/3D Bernstein polynomials
+#  - compare with the sum over the products of scalar 1D Bernstein basic
+#    polynomials (de Casteljau), including the high degrees (N>64)
+#  - compare the batch evaluation with the scalar one
+#  @see Ostap::Math::Bernstein2D
+#  @see Ostap::Math::Bernstein3D
+# =============================================================================
+""" Test module for the evaluation of 2D/3D Bernstein polynomials
+- compare with the sum over the products of scalar 1D Bernstein basic
+  polynomials (de Casteljau), including the high degrees (N>64)
+- compare the batch evaluation with the scalar one
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random
+from   array            import array
+from   ostap.core.core  import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_bernstein_basis' )
+else                       : logger = getLogger ( __name__                    )
+# =============================================================================
+# =============================================================================
+## scalar 1D basic polynomials
+def units ( N , xmin , xmax ) :
+    result = []
+    for k in range ( N + 1 ) :
+        b = Ostap.Math.Bernstein ( N , xmin , xmax )
+        b.setPar ( k , 1.0 )
+        result.append ( b )
+    return result
+
+# =============================================================================
+## the values of the basic polynomials, normalized as for 2D/3D polynomials
+def basics ( u , x ) :
+    b = u [ 0 ]
+    if x < b.xmin () or x > b.xmax () : return len ( u ) * [ 0.0 ]
+    scale = len ( u ) / ( b.xmax () - b.xmin () )
+    return [ scale * ui ( x ) for ui in u ]
+
+# =============================================================================
+## random points, some of them outside of the range and at the edges
+def points ( n , xmin , xmax ) :
+    d = 0.05 * ( xmax - xmin )
+    result = [ xmin , xmax ]
+    while len ( result ) < n : result.append ( random.uniform ( xmin - d , xmax + d ) )
+    random.shuffle ( result )
+    return array ( 'd' , result )
+
+# =============================================================================
+## random coefficients
+def randomize ( poly ) :
+    for k in range ( poly.npars () ) : poly.setPar ( k , random.uniform ( -1 , 1 ) )
+
+# =============================================================================
+## compare 2D: scalar and batch evaluation vs the scalar 1D polynomials
+#  @return the maximal differences, relative to the maximal value
+def check2 ( p , n ) :
+    randomize ( p )
+    ux = units ( p.nX () , p.xmin () , p.xmax () )
+    uy = units ( p.nY () , p.ymin () , p.ymax () )
+    x  = points ( n , p.xmin () , p.xmax () )
+    y  = points ( n , p.ymin () , p.ymax () )
+
+    batch = array ( 'd' , n * [ 0.0 ] )
+    p.evaluate ( n , x , y , batch )
+
+    scale , dscalar , dbatch = 0.0 , 0.0 , 0.0
+    for i in range ( n ) :
+        bx  = basics ( ux , x [ i ] )
+        by  = basics ( uy , y [ i ] )
+        ref = sum ( p.par ( l , m ) * bx [ l ] * by [ m ]
+                    for l in range ( p.nX () + 1 ) for m in range ( p.nY () + 1 ) )
+        value   = p ( x [ i ] , y [ i ] )
+        scale   = max ( scale   , abs ( ref ) )
+        dscalar = max ( dscalar , abs ( value      - ref   ) )
+        dbatch  = max ( dbatch  , abs ( batch [ i ] - value ) )
+
+    return dscalar / scale , dbatch / scale
+
+# =============================================================================
+## compare 3D: scalar and batch evaluation vs the scalar 1D polynomials
+#  @return the maximal differences, relative to the maximal value
+def check3 ( p , n ) :
+    randomize ( p )
+    ux = units ( p.nX () , p.xmin () , p.xmax () )
+    uy = units ( p.nY () , p.ymin () , p.ymax () )
+    uz = units ( p.nZ () , p.zmin () , p.zmax () )
+    x  = points ( n , p.xmin () , p.xmax () )
+    y  = points ( n , p.ymin () , p.ymax () )
+    z  = points ( n , p.zmin () , p.zmax () )
+
+    batch = array ( 'd' , n * [ 0.0 ] )
+    p.evaluate ( n , x , y , z , batch )
+
+    scale , dscalar , dbatch = 0.0 , 0.0 , 0.0
+    for i in range ( n ) :
+        bx  = basics ( ux , x [ i ] )
+        by  = basics ( uy , y [ i ] )
+        bz  = basics ( uz , z [ i ] )
+        ref = sum ( p.par ( l , m , k ) * bx [ l ] * by [ m ] * bz [ k ]
+                    for l in range ( p.nX () + 1 )
+                    for m in range ( p.nY () + 1 )
+                    for k in range ( p.nZ () + 1 ) )
+        value   = p ( x [ i ] , y [ i ] , z [ i ] )
+        scale   = max ( scale   , abs ( ref ) )
+        dscalar = max ( dscalar , abs ( value      - ref   ) )
+        dbatch  = max ( dbatch  , abs ( batch [ i ] - value ) )
+
+    return dscalar / scale , dbatch / scale
+
+# =============================================================================
+## the tolerances
+#  - scalar vs the products of 1D basic polynomials: the direct formula vs
+#    de Casteljau algorithm, the difference is the rounding only
+#  - batch vs scalar: the same kernel, the difference must be tiny
+TOL_SCALAR = 1.e-12
+TOL_BATCH  = 1.e-14
+# =============================================================================
+def check ( logger , label , poly , n ) :
+    dscalar , dbatch = check3 ( poly , n ) if hasattr ( poly , 'nZ' ) else check2 ( poly , n )
+    logger.info ( '%-32s: #pars %5d, scalar vs 1D: %.3g, batch vs scalar: %.3g' % ( label , poly.npars () , dscalar , dbatch ) )
+    assert dscalar < TOL_SCALAR , '%s: scalar vs 1D difference is too large %s' % ( label , dscalar )
+    assert dbatch  < TOL_BATCH  , '%s: batch vs scalar difference is too large %s' % ( label , dbatch  )
+
+# =============================================================================
+## 2D polynomials
+def test_bernstein2d_basis () :
+
+    logger = getLogger ( 'test_bernstein2d_basis' )
+
+    B2  = Ostap.Math.Bernstein2D
+    B2S = Ostap.Math.Bernstein2DSym
+
+    check ( logger , 'Bernstein2D(5,3)'         , B2  (  5 ,  3 ,  0 ,  1 , -1 , 2 ) , 500 )
+    check ( logger , 'Bernstein2D(0,4)'         , B2  (  0 ,  4 ,  0 ,  1 ,  0 , 1 ) , 500 )
+    ## high degree: the triangular recurrence for N>64
+    check ( logger , 'Bernstein2D(70,2)'        , B2  ( 70 ,  2 , -1 ,  1 ,  0 , 3 ) , 200 )
+    check ( logger , 'Bernstein2DSym(6)'        , B2S (  6 ,        -2 ,  2 )        , 500 )
+    check ( logger , 'Bernstein2DSym(66)'       , B2S ( 66 ,         0 ,  1 )        ,  50 )
+
+# =============================================================================
+## 3D polynomials
+def test_bernstein3d_basis () :
+
+    logger = getLogger ( 'test_bernstein3d_basis' )
+
+    B3  = Ostap.Math.Bernstein3D
+    B3S = Ostap.Math.Bernstein3DSym
+    B3M = Ostap.Math.Bernstein3DMix
+
+    check ( logger , 'Bernstein3D(4,3,2)'       , B3  (  4 ,  3 ,  2 ,  0 ,  1 , -1 ,  1 , 0 , 2 ) , 300 )
+    check ( logger , 'Bernstein3D(65,1,2)'      , B3  ( 65 ,  1 ,  2 ,  0 ,  1 ,  0 ,  1 , 0 , 1 ) , 100 )
+    check ( logger , 'Bernstein3DSym(4)'        , B3S (  4 ,              0 ,  2 )                   , 300 )
+    check ( logger , 'Bernstein3DMix(3,5)'      , B3M (  3 ,  5 ,         0 ,  1 ,             -1 , 1 ) , 300 )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_bernstein2d_basis ()
+    test_bernstein3d_basis ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_chebyshev.py
+#  Test module for the adaptive piecewise Chebyshev approximation
+#  @see Ostap::Math::AdaptiveChebyshev
+#  @see Ostap::MoreRooFit::ChebyshevProxy
+# =============================================================================
+""" Test module for the adaptive piecewise Chebyshev approximation
+- see Ostap::Math::AdaptiveChebyshev
+- see Ostap::MoreRooFit::ChebyshevProxy
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random
+from   ostap.core.core       import Ostap
+from   ostap.math.base       import doubles 
+from   builtins              import range
+import ostap.fitting.models  as     Models
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_chebyshev' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+
+# =============================================================================
+## approximate the Voigt function
+def test_chebyshev_voigt () :
+
+    logger = getLogger ( 'test_chebyshev_voigt' )
+
+    voigt  = Ostap.Math.Voigt ( 1.0 , 0.010 , 0.005 )
+    xmin , xmax = 0.8 , 1.2
+
+    cheb   = Ostap.Math.AdaptiveChebyshev ( lambda x : voigt ( x ) , xmin , xmax , 1.e-10 )
+
+    logger.info ( 'Voigt approximation: %d pieces and %d coefficients' % ( cheb.npieces () , cheb.size () ) )
+
+    vmax = voigt ( voigt.m0 () )
+    dmax = 0.0
+    for i in range ( 10000 ) :
+        x    = random.uniform ( xmin , xmax )
+        dmax = max ( dmax , abs ( cheb ( x ) - voigt ( x ) ) / vmax )
+
+    logger.info ( 'Voigt approximation: max difference %.3g' % dmax )
+    assert dmax < 1.e-8 , 'Approximation is not precise: %s' % dmax
+
+    ## batch evaluation
+    xs = [ random.uniform ( xmin , xmax ) for i in range ( 1000 ) ]
+    vs = cheb.evaluate ( doubles ( xs ) )
+    for x , v in zip ( xs , vs ) :
+        assert abs ( v - cheb ( x ) ) <= 1.e-12 * vmax , 'Batch evaluation differs!'
+
+    ## integrals
+    for low , high in [ ( 0.9 , 1.1 ) , ( 0.95 , 1.01 ) , ( xmin , xmax ) ] :
+        i1 = cheb .integral ( low , high )
+        i2 = voigt.integral ( low , high )
+        logger.info ( 'Integral [%.2f,%.2f]: %.10f vs %.10f' % ( low , high , i1 , i2 ) )
+        assert abs ( i1 - i2 ) < 1.e-8 , 'Integral is not precise: %s vs %s' % ( i1 , i2 )
+
+# =============================================================================
+## proxy for the slow PDF
+def test_chebyshev_proxy () :
+
+    logger = getLogger ( 'test_chebyshev_proxy' )
+
+    from ostap.fitting.basic import ChebyshevProxy_pdf
+
+    mass  = ROOT.RooRealVar ( 'mass_cheb' , 'mass' , 0.8 , 1.2 )
+    voigt = Models.Voigt_pdf ( 'VC' , xvar = mass , m0 = ( 1.0 , 0.95 , 1.05 ) , sigma = 0.005 , gamma = 0.010 )
+    proxy = ChebyshevProxy_pdf ( voigt , precision = 1.e-10 )
+
+    for m0 in ( 0.99 , 1.0 , 1.01 ) :
+        voigt.m0 = m0
+        dmax = 0.0
+        for i in range ( 200 ) :
+            x    = random.uniform ( 0.8 , 1.2 )
+            v1   = voigt ( x , normalized = False )
+            v2   = proxy ( x , normalized = False )
+            dmax = max ( dmax , abs ( v1 - v2 ) / max ( 1.e-3 , abs ( v1 ) ) )
+        logger.info ( 'Chebyshev proxy m0=%.2f: max difference %.3g' % ( m0 , dmax ) )
+        assert dmax < 1.e-6 , 'Proxy is not precise: %s' % dmax
+
+    ## the observable is not touched by the sampling
+    voigt.m0 = 1.005
+    mass.setVal ( 1.123 )
+    cheb = proxy.pdf.chebyshev ()
+    assert 1.123 == mass.getVal () , 'Observable is modified by the approximation!'
+    v1 = proxy.pdf.exact ( 0.97 )
+    assert 1.123 == mass.getVal () , 'Observable is modified by exact!'
+    v2 = voigt ( 0.97 , normalized = False )
+    assert abs ( v1 - v2 ) <= 1.e-10 * abs ( v2 ) , 'Exact value is wrong: %s vs %s' % ( v1 , v2 )
+
+    ## the range of the observable is changed: the approximation is rebuilt
+    mass.setRange ( 0.9 , 1.1 )
+    try :
+        cheb = proxy.pdf.chebyshev ()
+        assert 0.9 == cheb.xmin () and 1.1 == cheb.xmax () , \
+               'Approximation is not rebuilt for the new range [%s,%s]' % ( cheb.xmin () , cheb.xmax () )
+        dmax = 0.0
+        for i in range ( 200 ) :
+            x    = random.uniform ( 0.9 , 1.1 )
+            v1   = voigt ( x , normalized = False )
+            v2   = cheb  ( x )
+            dmax = max ( dmax , abs ( v1 - v2 ) / max ( 1.e-3 , abs ( v1 ) ) )
+        logger.info ( 'Chebyshev proxy in the new range: max difference %.3g' % dmax )
+        assert dmax < 1.e-6 , 'Proxy is not precise in the new range: %s' % dmax
+    finally :
+        mass.setRange ( 0.8 , 1.2 )
+
+    cheb = proxy.pdf.chebyshev ()
+    assert 0.8 == cheb.xmin () and 1.2 == cheb.xmax () , 'Approximation is not rebuilt for the original range!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_chebyshev_voigt ()
+    test_chebyshev_proxy ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_convolution.py
+#  Test module for FFT-based convolution Ostap::Math::FFTConvolution
+#  - compare with analytic convolutions with gaussian
+# =============================================================================
+""" Test module for FFT-based convolution Ostap::Math::FFTConvolution
+- compare with analytic convolutions with gaussian
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, math
+from   ostap.core.core     import Ostap
+import ostap.math.models
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_convolution' )
+else                       : logger = getLogger ( __name__                )
+# =============================================================================
+
+## maximal difference between two functions at the grid
+def max_diff ( f1 , f2 , xmin , xmax , N = 1000 ) :
+    dmax = 0.0
+    for i in range ( N + 1 ) :
+        x    = xmin + i * ( xmax - xmin ) / float ( N )
+        dmax = max ( dmax , abs ( f1 ( x ) - f2 ( x ) ) )
+    return dmax
+
+# =============================================================================
+## gaussian convoluted with gaussian is gaussian
+def test_convolution_gauss () :
+
+    logger = getLogger ( 'test_convolution_gauss' )
+
+    xmin , xmax = -5 , 5
+
+    for s1 , s2 in [ ( 1.0 , 0.1 ) , ( 0.5 , 0.2 ) , ( 0.3 , 0.3 ) ] :
+
+        signal     = Ostap.Math.Gauss ( 0.2 , s1 )
+        resolution = Ostap.Math.Gauss ( 0.0 , s2 )
+        result     = Ostap.Math.Gauss ( 0.2 , math.sqrt ( s1 * s1 + s2 * s2 ) )
+
+        cnv  = Ostap.Math.FFTConvolution.create ( signal , resolution , xmin , xmax , 7 * s2 , 2048 )
+
+        diff = max_diff ( cnv , result , xmin , xmax )
+        logger.info ( 'Gauss(%.2f)*Gauss(%.2f): max difference %.3g , integral %.8f' % ( s1 , s2 , diff , cnv.integral() ) )
+        assert diff < 1.e-6 , 'Gauss(%.2f)*Gauss(%.2f): difference is too large %s' % ( s1 , s2 , diff )
+
+# =============================================================================
+## Fourier sum convoluted with gaussian
+def test_convolution_fourier () :
+
+    logger = getLogger ( 'test_convolution_fourier' )
+
+    xmin , xmax = -math.pi , math.pi
+
+    fs = Ostap.Math.FourierSum ( 6 , xmin , xmax )
+    for i , p in enumerate ( ( 1.0 , 0.5 , -0.3 , 0.2 , 0.4 , -0.1 , 0.05 , 0.1 , -0.05 , 0.02 , 0.03 , -0.01 , 0.01 ) ) :
+        fs.setPar ( i , p )
+
+    for sigma in ( 0.05 , 0.1 , 0.3 ) :
+
+        resolution = Ostap.Math.Gauss ( 0.0 , sigma )
+        result     = fs.convolve ( sigma )
+
+        ## the fourier sum is periodic, padding=1 makes the convolution exact in whole range
+        cnv  = Ostap.Math.FFTConvolution.create ( fs , resolution , xmin , xmax , 7 * sigma , 2048 , 1.0 )
+
+        diff = max_diff ( cnv , result , xmin , xmax )
+        logger.info ( 'Fourier*Gauss(%.2f): max difference %.3g' % ( sigma , diff ) )
+        assert diff < 1.e-6 , 'Fourier*Gauss(%.2f): difference is too large %s' % ( sigma , diff )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_convolution_gauss   ()
+    test_convolution_fourier ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -19,10 +19,11 @@ from ostap.logger.logger import getLogger
 if '__main__' ==  __name__ : logger = getLogger ( 'test_math_dalitz'   )
 else                       : logger = getLogger ( __name__             )
 # ============================================================================= 
-import ROOT, random, time  
+import ROOT, random, time, math
 from   ostap.core.core import Ostap
 import ostap.math.kinematic
 import ostap.math.dalitz
+import ostap.math.models
 
 LV = Ostap.LorentzVector
 CT = Ostap.Kinematics.cos_theta
@@ -162,12 +163,86 @@ def test_dalitz3 () :
         gr.draw  ( 'al' )
         time.sleep ( 1 ) 
         
+
+# =============================================================================
+## reference integrals for the normalization of the amplitude model
+DI = Ostap.Math.DalitzIntegrator
+## the components of the model: K*(892) in s1 and K0*(1430) in s2
+bw1 = Ostap.Math.BreitWigner ( 0.892 , 0.050 , 0.139 , 0.493 , 1 )
+bw2 = Ostap.Math.BreitWigner ( 1.430 , 0.270 , 0.493 , 0.139 , 0 )
+def a1 ( s1 , s2 ) : return bw1.amplitude ( math.sqrt ( s1 ) )
+def a2 ( s1 , s2 ) : return bw2.amplitude ( math.sqrt ( s2 ) )
+## the analytic area of the Dalitz plot via the three-body phase space
+def area_ps3 ( d ) :
+    ps3 = Ostap.Math.PhaseSpace3 ( d.m1 () , d.m2 () , d.m3 () )
+    return ps3 ( d.sqs () ) * 4 * d.s () / ( math.pi * math.pi )
+## the area of the Dalitz plot via DalitzIntegrator
+def area_integrator ( d ) :
+    return DI.integrate_s1s2 ( DI.function2 ( lambda s1 , s2 : 1.0 ) , d.s () , d )
+## the normalization of the model via DalitzIntegrator
+def norm_integrator ( d , c1 , c2 ) :
+    def density ( s1 , s2 ) :
+        return abs ( c1 * complex ( a1 ( s1 , s2 ) ) + c2 * complex ( a2 ( s1 , s2 ) ) ) ** 2
+    return DI.integrate_s1s2 ( DI.function2 ( density ) , d.s () , d )
+# =============================================================================
+## normalization of the amplitude model via the cached grid
+#  - the area of the Dalitz plot vs the analytic area (massless particles),
+#    the three-body phase space and DalitzIntegrator
+#  - the normalization vs DalitzIntegrator
+def test_dalitz4 () :
+
+    DN = Ostap.Math.DalitzNormalization
+
+    ## massless particles: the area is s^2/2
+    M    = 5.279
+    dm   = Ostap.Kinematics.Dalitz ( M , 0 , 0 , 0 )
+    a0   = DN ( dm , 64 , 64 ).area ()
+    logger.info ( 'Dalitz area (massless) : %.12g vs %.12g' % ( a0 , 0.5 * M ** 4 ) )
+    assert abs ( a0 - 0.5 * M ** 4 ) < 1.e-12 * a0 , 'Invalid Dalitz area for massless particles!'
+
+    ## the grid in theta absorbs the square-root behaviour at the edges:
+    ## the area converges fast, the three-body phase space is evaluated
+    ## with the adaptive 1D integration, and DalitzIntegrator uses 2D cubature
+    dd    = Ostap.Kinematics.Dalitz ( M , 0.139 , 0.493 , 0.139 )
+    area  = DN ( dd , 64 , 64 ).area ()
+    a_ps3 = area_ps3        ( dd )
+    a_int = area_integrator ( dd )
+    logger.info ( 'Dalitz area            : %.12g vs %.12g (PhaseSpace3) vs %.12g (DalitzIntegrator)' % ( area , a_ps3 , a_int ) )
+    assert abs ( area - a_ps3 ) < 1.e-7 * a_ps3 , 'Dalitz area differs from the phase space!'
+    assert abs ( area - a_int ) < 1.e-6 * a_int , 'Dalitz area differs from DalitzIntegrator!'
+
+    ## the narrow K*(892) in s1 needs the dense grid in theta:
+    ## with 512x48 points the quadrature error is below 1e-7,
+    ## the tolerance 1e-4 is defined by the 2D cubature of DalitzIntegrator
+    norm = DN ( dd , 512 , 48 )
+    i1   = norm.add ( a1 , 1 )
+    i2   = norm.add ( a2 , 2 )
+
+    for c in ( [ complex ( 1 , 0 ) , complex ( 0.5 ,  0.3 ) ] ,
+               [ complex ( 1 , 0 ) , complex ( 2.0 , -1.0 ) ] ,
+               [ complex ( 0 , 0 ) , complex ( 1.0 ,  0.0 ) ] ) :
+
+        n1 = norm.norm ( c )
+        n2 = norm_integrator ( dd , c [ 0 ] , c [ 1 ] )
+        logger.info ( 'Normalization : %.10g vs %.10g (DalitzIntegrator)' % ( n1 , n2 ) )
+        assert abs ( n1 - n2 ) < 1.e-4 * abs ( n2 ) , 'Normalization differs from DalitzIntegrator!'
+
+        f1 , f2 = norm.fraction ( c , i1 ) , norm.fraction ( c , i2 )
+        r1 = norm_integrator ( dd , c [ 0 ] , 0j      ) / n2
+        r2 = norm_integrator ( dd , 0j      , c [ 1 ] ) / n2
+        logger.info ( 'Fractions     : %.6f %.6f vs %.6f %.6f (DalitzIntegrator)' % ( f1 , f2 , r1 , r2 ) )
+        assert abs ( f1 - r1 ) < 1.e-4 and abs ( f2 - r2 ) < 1.e-4 , 'Fractions differ from DalitzIntegrator!'
+
+    ## the same tag: nothing to be recalculated
+    assert not norm.update ( i2 , 2 ) , 'Component is recalculated!'
+
 # =============================================================================
 if '__main__' == __name__ :
 
     test_dalitz1 ()
     test_dalitz2 ()
     test_dalitz3 ()
+    test_dalitz4 ()
 
 # =============================================================================
 ##                                                                      The END 
@@ -19,7 +19,8 @@ import random,math
 import ostap.math.models
 from   ostap.math.interpolation import ( interpolate , points  ,
                                          interpolate_bernstein ,
-                                         interpolate_bspline   ) 
+                                         interpolate_bspline   ,
+                                         local_interpolation   ) 
 from   ostap.core.core          import Ostap,  SE 
 # =============================================================================
 
@@ -212,12 +213,43 @@ def test_dict () :
     
     return run_grid_interpolation ( tfun , dct , N , low , high , scale = 1.e-6 ) 
     
+# =============================================================================
+## local interpolation for the large tables 
+def test_local () :
+
+    from ostap.math.base import doubles
+    
+    fun = lambda x : math.sin ( x ) * math.exp ( -0.1 * x ) 
+    N , low , high = 20000 , 0 , 10 
+
+    ## uniform table 
+    l1 = local_interpolation ( fun , N , low , high , order = 3 )
+    assert l1.uniform () , 'Abscissas must be uniform!'
+    
+    ## random abscissas 
+    xs = [ random.uniform ( low , high ) for i in range ( N ) ] + [ low , high ]
+    l2 = local_interpolation ( xs , [ fun ( x ) for x in xs ] , order = 3 ) 
+    
+    xx = sorted ( random.uniform ( low , high ) for i in range ( 10000 ) ) 
+    r1 = l1.evaluate ( doubles ( xx ) )
+    r2 = l2.evaluate ( doubles ( xx ) )
+
+    m1 , m2 = 0 , 0 
+    for x , v1 , v2 in zip ( xx , r1 , r2 ) :
+        assert v1 == l1 ( x ) and v2 == l2 ( x ) , 'Batch and scalar evaluations differ!'
+        m1 = max ( m1 , abs ( v1 - fun ( x ) ) )
+        m2 = max ( m2 , abs ( v2 - fun ( x ) ) )
+        
+    logger.info ( 'Local interpolation: max deviation uniform/random %.3g/%.3g' % ( m1 , m2 ) ) 
+    assert m1 < 1.e-10 and m2 < 1.e-6 , 'Local interpolation is not precise!'
+    
 # =============================================================================
 if '__main__' == __name__ :
     
     test_cos    () 
     test_abssin ()
     test_dict   ()
+    test_local  ()
     
     pass 
     
@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_kinematics.py
+#  Test module for batch kinematical functions Ostap::Kinematics::Batch
+#  - compare with the scalar functions from Ostap::Kinematics
+# =============================================================================
+""" Test module for batch kinematical functions Ostap::Kinematics::Batch
+- compare with the scalar functions from Ostap::Kinematics
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, math, random, array
+from   ostap.core.core       import Ostap
+from   ostap.math.kinematic  import batch_kinematics
+from   builtins              import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_kinematics' )
+else                       : logger = getLogger ( __name__               )
+# =============================================================================
+
+## random four-vector
+def random_vector ( mass ) :
+    px = random.uniform ( -1 , 1 )
+    py = random.uniform ( -1 , 1 )
+    pz = random.uniform (  2 , 8 )
+    return Ostap.LorentzVector ( px , py , pz , math.sqrt ( px * px + py * py + pz * pz + mass * mass ) )
+
+## columns (px,py,pz,E) for the list of four-vectors
+def columns ( vectors ) :
+    return ( array.array ( 'd' , [ v.Px () for v in vectors ] ) ,
+             array.array ( 'd' , [ v.Py () for v in vectors ] ) ,
+             array.array ( 'd' , [ v.Pz () for v in vectors ] ) ,
+             array.array ( 'd' , [ v.E  () for v in vectors ] ) )
+
+# =============================================================================
+## compare batch and scalar functions
+def test_kinematics_batch () :
+
+    logger = getLogger ( 'test_kinematics_batch' )
+
+    N = 1000
+    d1 = [ random_vector ( 0.140 ) for i in range ( N ) ]
+    d2 = [ random_vector ( 0.494 ) for i in range ( N ) ]
+    h1 = [ random_vector ( 0.106 ) for i in range ( N ) ]
+    h2 = [ random_vector ( 0.106 ) for i in range ( N ) ]
+    M  = [ a + b + c + d for a , b , c , d in zip ( d1 , d2 , h1 , h2 ) ]
+    D  = [ a + b         for a , b         in zip ( d1 , d2 ) ]
+
+    c_d1 , c_d2 , c_h1 , c_h2 = columns ( d1 ) , columns ( d2 ) , columns ( h1 ) , columns ( h2 )
+    c_M  , c_D                = columns ( M  ) , columns ( D  )
+
+    K = Ostap.Kinematics
+    checks = (
+        ( 'decayAngle'            , ( c_M  , c_D  , c_d1        ) , lambda i : K.decayAngle            ( M [i] , D [i] , d1[i]         ) ) ,
+        ( 'decayAngleLab'         , ( c_d1 , c_D                ) , lambda i : K.decayAngle            ( d1[i] , D [i]                 ) ) ,
+        ( 'cosThetaRest'          , ( c_d1 , c_h1 , c_M         ) , lambda i : K.cosThetaRest          ( d1[i] , h1[i] , M [i]         ) ) ,
+        ( 'decayAngleChi'         , ( c_d1 , c_d2 , c_h1 , c_h2 ) , lambda i : K.decayAngleChi         ( d1[i] , d2[i] , h1[i] , h2[i] ) ) ,
+        ( 'cosDecayAngleChi'      , ( c_d1 , c_d2 , c_h1 , c_h2 ) , lambda i : K.cosDecayAngleChi      ( d1[i] , d2[i] , h1[i] , h2[i] ) ) ,
+        ( 'sinDecayAngleChi'      , ( c_d1 , c_d2 , c_h1 , c_h2 ) , lambda i : K.sinDecayAngleChi      ( d1[i] , d2[i] , h1[i] , h2[i] ) ) ,
+        ( 'armenterosPodolanskiX' , ( c_d1 , c_d2               ) , lambda i : K.armenterosPodolanskiX ( d1[i] , d2[i]                 ) ) ,
+        ( 'restMomentum'          , ( c_d1 , c_D                ) , lambda i : K.restMomentum          ( d1[i] , D [i]                 ) ) ,
+        ( 'restEnergy'            , ( c_d1 , c_D                ) , lambda i : K.restEnergy            ( d1[i] , D [i]                 ) ) ,
+        ( 'gramDelta2'            , ( c_d1 , c_d2               ) , lambda i : K.Gram.Delta            ( d1[i] , d2[i]                 ) ) ,
+        ( 'mass'                  , ( c_d1 , c_d2 , c_h1        ) , lambda i : ( d1[i] + d2[i] + h1[i] ).M ()                            ) ,
+        )
+
+    for name , cols , scalar in checks :
+
+        result = batch_kinematics ( name , *cols )
+        assert N == len ( result ) , 'Invalid length of the result for %s' % name
+
+        dmax = 0.0
+        for i in range ( N ) :
+            v    = scalar ( i )
+            dmax = max ( dmax , abs ( result [ i ] - v ) / max ( 1.0 , abs ( v ) ) )
+
+        logger.info ( '%-22s : max difference %.3g' % ( name , dmax ) )
+        assert dmax < 1.e-8 , '%s: difference is too large %s' % ( name , dmax )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_kinematics_batch ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_kramerskronig.py
+#  Test module for the tabulation of the dispersion integral
+#  - compare Ostap::Math::KramersKronig::tabulate with the direct integration
+#    for n=0 and n>0 subtractions
+#  @see Ostap::Math::KramersKronig
+# =============================================================================
+""" Test module for the tabulation of the dispersion integral
+- compare Ostap::Math::KramersKronig::tabulate with the direct integration
+  for n=0 and n>0 subtractions
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT
+from   ostap.core.core  import Ostap
+from   builtins         import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_kramerskronig' )
+else                       : logger = getLogger ( __name__                  )
+# =============================================================================
+## spectral function: non-zero at the threshold (logarithmic singularity)
+#  and decreasing as 1/x^2 (the integral converges for n=0)
+def rho ( x ) : return 1.0 / ( 1.0 + ( x - 3 ) * ( x - 3 ) ) if 1 <= x else 0.0
+## wrapped into std::function for the templated constructor
+RHO = ROOT.std.function ( 'double(double)' ) ( rho )
+# =============================================================================
+## compare tabulated and direct integrals
+def test_kramers_kronig_tabulate () :
+
+    logger = getLogger ( 'test_kramers_kronig_tabulate' )
+
+    omega0 , xmin , xmax = 1.0 , 1.0 , 10.0
+    ## the tolerance: the relative precision of the interpolation refers to the
+    ## regular part, the singular part and the subtraction factor are exact
+    precision = 1.e-7
+    tolerance = 1.e-5
+
+    for n in ( 0 , 1 , 2 ) :
+
+        kk = Ostap.Math.KramersKronig ( RHO , omega0 , n )
+        assert not kk.tabulated () , 'The integral must not be tabulated by default!'
+
+        kk.tabulate ( xmin , xmax , precision )
+        assert kk.tabulated () , 'The integral is not tabulated!'
+
+        ## points inside the table (off the nodes), near the threshold and outside
+        points  = [ xmin + ( xmax - xmin ) * ( i + 0.37 ) / 200 for i in range ( 200 ) ]
+        points += [ omega0 + 1.e-3 , omega0 + 1.e-2 , 20.0 , 50.0 ]
+
+        dmax = 0.0
+        for x in points :
+            e    = kk.exact ( x )
+            t    = kk       ( x )
+            dmax = max ( dmax , abs ( t - e ) / max ( 1.0 , abs ( e ) ) )
+
+        logger.info ( 'n=%d: #nodes %5d, max difference %.3g' % ( n , kk.table ().size () , dmax ) )
+        assert dmax < tolerance , 'n=%d: tabulated vs exact difference is too large %s' % ( n , dmax )
+
+        ## outside the table: the direct integration
+        assert kk ( 20.0 ) == kk.exact ( 20.0 ) , 'Outside the table the integral must be exact!'
+
+        ## the copy shares the table
+        kk2 = Ostap.Math.KramersKronig ( kk )
+        assert kk2.tabulated () and kk2 ( 5.0 ) == kk ( 5.0 ) , 'The table is not shared by the copy!'
+
+        kk.untabulate ()
+        assert not kk.tabulated () and kk ( 5.0 ) == kk.exact ( 5.0 ) , 'The table is not removed!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_kramers_kronig_tabulate ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
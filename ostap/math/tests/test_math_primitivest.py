@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_primitivest.py
+#  Test module for the compile-time combinators from Ostap/PrimitivesT.h
+#  - compare them with the direct calculations
+#  - scalar calls, the batch evaluation and the type-erased copies
+#  The comparison with std::function-based classes from Ostap/Primitives.h
+#  and the arithmetic operators are checked by ostap_accuracy
+#  @see Ostap::Math::Primitives
+# =============================================================================
+""" Test module for the compile-time combinators from Ostap/PrimitivesT.h
+- compare them with the direct calculations
+- scalar calls, the batch evaluation and the type-erased copies
+The comparison with std::function-based classes from Ostap/Primitives.h
+and the arithmetic operators are checked by ostap_accuracy
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random
+from   array            import array
+from   ostap.core.core  import Ostap
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_primitivest' )
+else                       : logger = getLogger ( __name__                )
+# =============================================================================
+P = Ostap.Math.Primitives
+# =============================================================================
+## the leaf without the batch evaluation: Bernstein polynomial with random coefficients
+def bernstein ( n ) :
+    b = Ostap.Math.Bernstein ( n , -3 , 3 )
+    for k in range ( b.npars () ) : b.setPar ( k , random.uniform ( -1 , 1 ) )
+    return b
+
+# =============================================================================
+## the grid of points
+xs = array ( 'd' , [ -3.0 + 6.0 * i / 1000 for i in range ( 1001 ) ] )
+# =============================================================================
+## the maximal difference with the reference function:
+#  scalar calls, the batch evaluation and the type-erased copy
+def diff ( ft , f ) :
+    n  = len ( xs )
+    rs = array ( 'd' , n * [ 0.0 ] )
+    P.evaluate ( ft , xs , rs , n )
+    fe = P.to_function ( ft )
+    d  = 0.0
+    for x , r in zip ( xs , rs ) :
+        v = f ( x )
+        s = max ( 1.0 , abs ( v ) )
+        d = max ( d , abs ( ft ( x ) - v ) / s , abs ( r - v ) / s , abs ( fe ( x ) - v ) / s )
+    return d
+
+# =============================================================================
+## has the composed function the batch evaluation?
+def batch ( f ) : return P.has_batch [ type ( f ) ].value
+
+# =============================================================================
+## compare the compile-time combinators with the direct calculations
+def test_primitives_combinators () :
+
+    logger = getLogger ( 'test_primitives_combinators' )
+
+    ## the same operations in the same order: the results must be (almost) identical
+    tolerance = 1.e-14
+
+    b1 = bernstein ( 3 )
+    b2 = bernstein ( 5 )
+    x  = P.identity ()
+    c  = P.constant ( 1.5 )
+
+    for name , ft , f in (
+            ( 'Linear'   , P.linear   ( b1 , 2.0 , b2 , -3.0  ) , lambda t : 2.0 * b1 ( t ) - 3.0 * b2 ( t ) ) ,
+            ( 'Compose'  , P.compose  ( b1 , b2 , 1.5 , 0.5   ) , lambda t : 1.5 * b1 ( 0.5 * b2 ( t ) )     ) ,
+            ( 'Scale'    , P.scale    ( b1 , 2.5 , -1.0       ) , lambda t : 2.5 * b1 ( t ) - 1.0            ) ,
+            ( 'Multiply' , P.multiply ( b1 , b2               ) , lambda t : b1 ( t ) * b2 ( t )             ) ,
+            ( 'Divide'   , P.divide   ( b1 , c                ) , lambda t : b1 ( t ) / 1.5                  ) ,
+            ( 'Max'      , P.maximum  ( b1 , b2               ) , lambda t : max ( b1 ( t ) , b2 ( t ) )     ) ,
+            ( 'Min'      , P.minimum  ( b1 , b2               ) , lambda t : min ( b1 ( t ) , b2 ( t ) )     ) ,
+            ## the batch evaluation
+            ( 'Batch'    , P.linear   ( P.multiply ( x , x ) , 0.5 , c , 2.0 ) , lambda t : 0.5 * ( t * t ) + 2.0 * 1.5 ) ) :
+        d = diff ( ft , f )
+        logger.info ( '%-10s : max difference %.3g' % ( name , d ) )
+        assert d <= tolerance , '%s: difference is too large %s' % ( name , d )
+
+# =============================================================================
+## the batch evaluation is available only if all components provide it
+def test_primitives_batch () :
+
+    logger = getLogger ( 'test_primitives_batch' )
+
+    b = bernstein ( 3 )
+    x = P.identity ()
+    c = P.constant ( 1.0 )
+
+    assert     batch ( P.linear   ( P.multiply ( x , x ) , 1.0 , c , 1.0 ) ) , 'Batch evaluation is lost!'
+    assert     batch ( P.maximum  ( x , c ) ) , 'Batch evaluation is lost!'
+    assert not batch ( P.compose  ( b , x ) ) , 'Batch evaluation without batch leaves!'
+    assert not batch ( P.multiply ( b , c ) ) , 'Batch evaluation without batch leaves!'
+    logger.info ( 'Batch evaluation flags are OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_primitives_combinators ()
+    test_primitives_batch       ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,140 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_tabulated.py
+#  Test module for Ostap::Math::TabulatedFunction and tabulated Breit-Wigners
+#  - compare tabulated and direct values
+#  - rebuild of the table when the key changes
+#  - tabulated Breit-Wigner after the parameter changes
+#  @see Ostap::Math::TabulatedFunction
+#  @see Ostap::Math::BW::tabulate
+# =============================================================================
+""" Test module for Ostap::Math::TabulatedFunction and tabulated Breit-Wigners
+- compare tabulated and direct values
+- rebuild of the table when the key changes
+- tabulated Breit-Wigner after the parameter changes
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random, math
+from   ostap.core.core  import Ostap
+from   builtins         import range
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_tabulated' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+# =============================================================================
+## the three-body phase space
+ps3 = Ostap.Math.PhaseSpace3 ( 0.139 , 0.139 , 0.139 )
+# =============================================================================
+## the function with the mutable parameter and its key
+class Expo(object) :
+    def __init__ ( self , a = 1.0 ) : self.a = a
+    def __call__ ( self , x       ) : return math.exp ( -self.a * x ) * ( 1 + x * x )
+    def key      ( self           ) : return int ( 1000 * self.a )
+# =============================================================================
+## Breit-Wigner with the running width from the three-body phase space
+def bw3 ( m0 , gamma ) :
+    s0 = ps3.lowEdge () ** 2
+    ch = Ostap.Math.ChannelWidth ( gamma , lambda s : ps3 ( math.sqrt ( s ) ) , s0 , 3 , '3pi' )
+    return Ostap.Math.BreitWignerMC ( m0 , ch )
+# =============================================================================
+## maximal difference, relative to the maximal value of the function
+def max_diff ( f1 , f2 , points ) :
+    scale = max ( abs ( f2 ( x ) ) for x in points )
+    return max ( abs ( f1 ( x ) - f2 ( x ) ) for x in points ) / scale
+
+# =============================================================================
+## compare tabulated and direct values
+def test_tabulated_function () :
+
+    logger = getLogger ( 'test_tabulated_function' )
+
+    precision = 1.e-6
+    t = Ostap.Math.TabulatedFunction ( lambda x : ps3 ( x ) , ps3.lowEdge () , 3.0 , precision )
+    points = [ random.uniform ( t.xmin () , t.xmax () ) for i in range ( 1000 ) ]
+    d = max_diff ( t , ps3 , points )
+    logger.info ( 'PhaseSpace3: #nodes %5d, max difference %.3g' % ( t.size () , d ) )
+    assert d < 100 * precision , 'Tabulated vs direct difference is too large %s' % d
+
+    ## outside the range: the direct evaluation
+    assert t ( 5.0 ) == ps3 ( 5.0 ) , 'Outside the range the function must be exact!'
+
+    ## the copy shares the table
+    t2 = Ostap.Math.TabulatedFunction ( t )
+    assert t2 ( 1.0 ) == t ( 1.0 ) , 'The table is not shared by the copy!'
+
+# =============================================================================
+## rebuild of the table when the key changes
+def test_tabulated_rebuild () :
+
+    logger = getLogger ( 'test_tabulated_rebuild' )
+
+    precision = 1.e-8
+    expo = Expo ( 1.0 )
+    t = Ostap.Math.TabulatedFunction ( expo , 0.0 , 5.0 , precision , 100000 , expo.key )
+    points = [ random.uniform ( 0.0 , 5.0 ) for i in range ( 500 ) ]
+
+    for a in ( 1.0 , 0.5 , 2.0 , 2.0 , 1.0 ) :
+        expo.a = a
+        d = max_diff ( t , expo , points )
+        logger.info ( 'a=%.1f: #nodes %5d, max difference %.3g' % ( a , t.size () , d ) )
+        assert d < 100 * precision , 'a=%s: table is not rebuilt, difference %s' % ( a , d )
+
+# =============================================================================
+## tabulated Breit-Wigner: compare with the direct one after parameter changes
+def test_tabulated_bw () :
+
+    logger = getLogger ( 'test_tabulated_bw' )
+
+    m0 , gamma , mmax = 1.26 , 0.40 , 2.0
+    bw_t = bw3 ( m0 , gamma )
+    bw_d = bw3 ( m0 , gamma )
+
+    assert 1 == bw_t.tabulate ( mmax , 1.e-6 ) , 'The channel is not tabulated!'
+    assert bw_t.tabulated () and not bw_d.tabulated () , 'Invalid tabulation flags!'
+
+    points = [ random.uniform ( bw_d.threshold () , 2.5 ) for i in range ( 500 ) ]
+
+    def check ( what ) :
+        d = max_diff ( bw_t , bw_d , points )
+        logger.info ( '%-22s: range %.3f, max difference %.3g' % ( what , bw_t.tab_range () , d ) )
+        assert d < 1.e-4 , '%s: tabulated vs direct difference is too large %s' % ( what , d )
+
+    check ( 'initial' )
+
+    ## partial width is not tabulated: no rebuild is needed
+    for bw in ( bw_t , bw_d ) : bw.setGamma ( 0 , 0.30 )
+    check ( 'setGamma' )
+
+    ## the pole is still inside the tables: no rebuild
+    for bw in ( bw_t , bw_d ) : bw.setM0 ( 1.50 )
+    assert mmax == bw_t.tab_range () , 'Tables are rebuilt without need!'
+    check ( 'setM0 (inside)' )
+
+    ## the pole is moved outside the tables: rebuild
+    for bw in ( bw_t , bw_d ) : bw.setM0 ( 2.20 )
+    assert mmax < bw_t.tab_range () and 2.20 < bw_t.tab_range () , 'Tables are not rebuilt!'
+    check ( 'setM0 (outside)' )
+
+    ## the copy keeps the tables and the settings
+    bw_c = Ostap.Math.BreitWignerMC ( bw_t )
+    assert bw_c.tabulated () and bw_c.tab_range () == bw_t.tab_range () , 'Tabulation is lost in the copy!'
+    assert bw_c ( 1.3 ) == bw_t ( 1.3 ) , 'The copy differs from the original!'
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_tabulated_function ()
+    test_tabulated_rebuild  ()
+    test_tabulated_bw       ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_threadpool.py
+#  Test module for the process-wide pool of threads Ostap::Utils::ThreadPool
+#  - the number of threads
+#  - 2D cubature for PS2DPol* models with the parallel evaluation of batches
+#    against the serial evaluation and the nested 1D integration
+#  - batch evaluation of PS2DPol2/PS2DPol2Sym against the scalar one
+#  @see Ostap::Utils::ThreadPool
+# =============================================================================
+""" Test module for the process-wide pool of threads Ostap::Utils::ThreadPool
+- the number of threads
+- 2D cubature for PS2DPol* models with the parallel evaluation of batches
+  against the serial evaluation and the nested 1D integration
+- batch evaluation of PS2DPol2/PS2DPol2Sym against the scalar one
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random
+from   array               import array
+import ostap.math.models
+from   ostap.core.core     import Ostap, SE
+from   ostap.math.integral import integral
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_threadpool' )
+else                       : logger = getLogger ( __name__               )
+# =============================================================================
+TP = Ostap.Utils.ThreadPool
+# =============================================================================
+## create the 2D-models, integrated by cubature
+def models () :
+
+    psx = Ostap.Math.PhaseSpaceNL ( 0.28 , 2.5 , 2 , 4 )
+    psy = Ostap.Math.PhaseSpaceNL ( 0.28 , 2.5 , 2 , 4 )
+
+    funcs = [
+        Ostap.Math.PS2DPol2    ( psx , psy , 3.0 , 2 , 2 ) ,
+        Ostap.Math.PS2DPol2Sym ( psx ,       3.0 , 2     ) ,
+        Ostap.Math.PS2DPol3    ( psx , psy , 3.0 , 2 , 2 ) ,
+        Ostap.Math.PS2DPol3Sym ( psx ,       3.0 , 2     ) ,
+        ]
+
+    for f in funcs :
+        for k in range ( f.npars () ) : f.setPar ( k , 0.1 * k - 0.2 )
+
+    return funcs
+
+# =============================================================================
+## the number of threads
+def test_threadpool_threads () :
+
+    logger = getLogger ( 'test_threadpool_threads' )
+
+    nthreads = TP.nThreads ()
+    try :
+        for n in ( 4 , 1 , 3 ) :
+            nt = TP.setNThreads ( n )
+            assert nt == n == TP.nThreads () , 'Number of threads is not set!'
+            assert not TP.inWorker ()        , 'The main thread is marked as worker!'
+        logger.info ( 'Default number of threads: %d' % nthreads )
+    finally :
+        TP.setNThreads ( nthreads )
+
+# =============================================================================
+## 2D cubature: parallel vs serial evaluation of the batches
+def test_threadpool_cubature () :
+
+    logger = getLogger ( 'test_threadpool_cubature' )
+
+    nthreads = TP.nThreads ()
+    try :
+
+        ## different objects: the integration cache is not shared
+        funcs4 = models ()
+        funcs1 = models ()
+
+        for f4 , f1 in zip ( funcs4 , funcs1 ) :
+
+            TP.setNThreads ( 4 )
+            v4  = f4.integral ( f4.xmin () , f4.xmax () , f4.ymin () , f4.ymax () )
+            TP.setNThreads ( 1 )
+            v1  = f1.integral ( f1.xmin () , f1.xmax () , f1.ymin () , f1.ymax () )
+
+            ## the reference: nested 1D integrations, no cubature
+            ref = integral ( lambda x : f1.integrateY ( x , f1.ymin () , f1.ymax () ) , f1.xmin () , f1.xmax () )
+
+            logger.info ( '%-12s integral: 4 threads %.12g, 1 thread %.12g, nested 1D %.12g' % (
+                type ( f1 ).__name__ , v4 , v1 , ref ) )
+            ## the same points, the same values: identical results
+            assert abs ( v4 - v1 ) <= 1.e-12 * abs ( v1 ) , \
+                   '%s: parallel and serial cubature differ: %s vs %s' % ( type ( f1 ).__name__ , v4 , v1 )
+            ## the function has the kink at x+y=mmax and cubature is limited by 20000 calls
+            assert abs ( v1 - ref ) <= 1.e-4 * abs ( ref ) , \
+                   '%s: cubature and nested integration differ: %s vs %s' % ( type ( f1 ).__name__ , v1 , ref )
+
+    finally :
+        TP.setNThreads ( nthreads )
+
+# =============================================================================
+## batch evaluation of PS2DPol2 and PS2DPol2Sym against the scalar one
+def test_threadpool_batch () :
+
+    logger = getLogger ( 'test_threadpool_batch' )
+
+    N = 1000
+    for f in models () [ :2 ] :
+
+        ## including the points outside the range and above mmax
+        xs = array ( 'd' , [ random.uniform ( 0 , 3 ) for i in range ( N ) ] )
+        ys = array ( 'd' , [ random.uniform ( 0 , 3 ) for i in range ( N ) ] )
+        rs = array ( 'd' , N * [ 0.0 ] )
+
+        f.evaluate ( N , xs , ys , rs )
+
+        cnt = SE ()
+        for x , y , r in zip ( xs , ys , rs ) :
+            v = f ( x , y )
+            d = abs ( r - v ) / max ( abs ( v ) , 1.e-100 ) if v or r else 0.0
+            cnt += d
+            assert d <= 1.e-14 , '%s: batch and scalar values differ at (%s,%s): %s vs %s' % (
+                type ( f ).__name__ , x , y , r , v )
+
+        logger.info ( '%-12s batch vs scalar: %s' % ( type ( f ).__name__ , cnt ) )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_threadpool_threads  ()
+    test_threadpool_cubature ()
+    test_threadpool_batch    ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developpers.
+# =============================================================================
+## @file ostap/math/tests/test_math_vearray.py
+#  Test module for the array of values with errors Ostap::Math::ValuesWithErrors
+#  - compare with the scalar Ostap::Math::ValueWithError
+# =============================================================================
+""" Test module for the array of values with errors Ostap::Math::ValuesWithErrors
+- compare with the scalar Ostap::Math::ValueWithError
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, random
+from   ostap.core.core       import Ostap
+from   ostap.math.ve         import VE, VEs
+from   ostap.math.base       import doubles
+from   builtins              import range
+import ostap.histos.histos
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_vearray' )
+else                       : logger = getLogger ( __name__            )
+# =============================================================================
+
+## compare two values with errors
+def same ( a , b ) :
+    return abs ( a.value () - b.value () ) <= 1.e-12 * max ( 1.0 , abs ( b.value () ) ) and \
+           abs ( a.cov2  () - b.cov2  () ) <= 1.e-12 * max ( 1.0 , abs ( b.cov2  () ) )
+
+# =============================================================================
+## compare elementwise operations with the scalar ones
+def test_vearray_ops () :
+
+    logger = getLogger ( 'test_vearray_ops' )
+
+    N  = 1000
+    a  = [ VE ( random.uniform ( 1 , 5 ) , random.uniform ( 0 , 0.1 ) ) for i in range ( N ) ]
+    b  = [ VE ( random.uniform ( 1 , 5 ) , random.uniform ( 0 , 0.1 ) ) for i in range ( N ) ]
+    va = VEs ( VE.Vector ( a ) )
+    vb = VEs ( VE.Vector ( b ) )
+    c  = VE  ( 2 , 0.01 )
+
+    checks = (
+        ( 'a+b'    , va + vb           , lambda i : a [ i ] + b [ i ]  ) ,
+        ( 'a-b'    , va - vb           , lambda i : a [ i ] - b [ i ]  ) ,
+        ( 'a*b'    , va * vb           , lambda i : a [ i ] * b [ i ]  ) ,
+        ( 'a/b'    , va / vb           , lambda i : a [ i ] / b [ i ]  ) ,
+        ( 'a*c'    , va * c            , lambda i : a [ i ] * c        ) ,
+        ( '2-a'    , 2 - va            , lambda i : 2 - a [ i ]        ) ,
+        ( '2/a'    , 2 / va            , lambda i : 2 / a [ i ]        ) ,
+        ( 'exp'    , Ostap.Math.exp  ( va ) , lambda i : Ostap.Math.exp  ( a [ i ] ) ) ,
+        ( 'log'    , Ostap.Math.log  ( va ) , lambda i : Ostap.Math.log  ( a [ i ] ) ) ,
+        ( 'sqrt'   , Ostap.Math.sqrt ( va ) , lambda i : Ostap.Math.sqrt ( a [ i ] ) ) ,
+        ( 'pow'    , va ** 2.5         , lambda i : a [ i ] ** 2.5     ) ,
+        )
+
+    for name , result , scalar in checks :
+        assert N == len ( result ) , 'Invalid length for %s' % name
+        for i in range ( N ) :
+            assert same ( result [ i ] , scalar ( i ) ) , \
+                   '%s: mismatch %s vs %s' % ( name , result [ i ] , scalar ( i ) )
+        logger.info ( 'Operation %-5s is OK' % name )
+
+    ## reductions
+    s1 = va.sum ()
+    s2 = Ostap.Math.sum ( VE.Vector ( a ) )
+    assert same ( s1 , s2 ) , 'Mismatch in sum: %s vs %s' % ( s1 , s2 )
+    logger.info ( 'Sum              : %s' % s1 )
+    logger.info ( 'Mean             : %s' % va.mean () )
+
+    w1 = VEs ( VE.Vector ( a[:2] ) ).weighted_average ()
+    w2 = a [ 0 ] .mean ( a [ 1 ] )
+    assert same ( w1 , w2 ) , 'Mismatch in weighted average: %s vs %s' % ( w1 , w2 )
+    logger.info ( 'Weighted average : %s' % va.weighted_average () )
+
+    ## interpolation
+    xs    = [ 0.5 * i for i in range ( 10 ) ]
+    ys    = [ x * x for x in xs ]
+    table = Ostap.Math.Interpolation.Table ( doubles ( xs ) , doubles ( ys ) )
+    vx    = VEs ( VE.Vector ( [ VE ( random.uniform ( 0 , 4 ) , 0.01 ) for i in range ( 100 ) ] ) )
+    vy    = Ostap.Math.interpolate ( table , vx )
+    for x , y in zip ( vx , vy ) :
+        y0 = Ostap.Math.interpolate ( doubles ( ys ) , doubles ( xs ) , x )
+        assert abs ( y.value () - y0.value () ) < 1.e-8 and abs ( y.error () - y0.error () ) < 1.e-8 , \
+               'Mismatch in interpolation: %s vs %s' % ( y , y0 )
+
+# =============================================================================
+## operations with the same object: full correlation
+def test_vearray_same () :
+
+    logger = getLogger ( 'test_vearray_same' )
+
+    N  = 100
+    a  = [ VE ( random.uniform ( 1 , 5 ) , random.uniform ( 0.01 , 0.1 ) ) for i in range ( N ) ]
+    va = VEs ( VE.Vector ( a ) )
+
+    checks = (
+        ( 'a+a' , va + va , lambda i : a [ i ] + a [ i ] , lambda i : VE ( 2 * a [ i ].value () , 4 * a [ i ].cov2 () ) ) ,
+        ( 'a-a' , va - va , lambda i : a [ i ] - a [ i ] , lambda i : VE ( 0 , 0 ) ) ,
+        ( 'a*a' , va * va , lambda i : a [ i ] * a [ i ] , lambda i : VE ( a [ i ].value () ** 2 , 4 * a [ i ].value () ** 2 * a [ i ].cov2 () ) ) ,
+        ( 'a/a' , va / va , lambda i : a [ i ] / a [ i ] , lambda i : VE ( 1 , 0 ) ) ,
+        )
+
+    for name , result , scalar , exact in checks :
+        for i in range ( N ) :
+            assert same ( result [ i ] , scalar ( i ) ) , \
+                   '%s: mismatch with scalar %s vs %s' % ( name , result [ i ] , scalar ( i ) )
+            assert same ( result [ i ] , exact  ( i ) ) , \
+                   '%s: mismatch with exact  %s vs %s' % ( name , result [ i ] , exact  ( i ) )
+        logger.info ( 'Operation %-5s is OK' % name )
+
+# =============================================================================
+## the histogram view: no copy
+def test_vearray_histo () :
+
+    logger = getLogger ( 'test_vearray_histo' )
+
+    h = ROOT.TH1D ( 'h_vearray' , '' , 20 , 0 , 1 )
+    h.Sumw2 ()
+    for i in range ( 10000 ) : h.Fill ( random.random () )
+
+    total = h.Integral ()
+    v     = h.values_with_errors ()
+    assert v.view () and len ( v ) == h.GetNbinsX () + 2 , 'Invalid view of the histogram!'
+
+    s = v.sum ()
+    assert abs ( s.value () - total ) < 1.e-6 , 'Mismatch in sum: %s vs %s' % ( s , total )
+
+    ## modify the histogram via the view
+    v *= 2
+    assert abs ( h.Integral () - 2 * total ) < 1.e-6 , 'Histogram is not modified!'
+    for i in range ( 1 , h.GetNbinsX () + 1 ) :
+        assert same ( h [ i ] , v [ i ] ) , 'Mismatch in bin %d: %s vs %s' % ( i , h [ i ] , v [ i ] )
+
+    ## the entries and the statistics are not updated by the view
+    assert 10000 == h.GetEntries () , 'Entries are modified by the view!'
+
+    logger.info ( 'Histogram view is OK: %s' % v.sum () )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_vearray_ops   ()
+    test_vearray_same  ()
+    test_vearray_histo ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,119 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# Copyright (c) Ostap developers.
+# =============================================================================
+## @file ostap/math/tests/test_math_workspace.py
+#  Test module for the thread-local pool of GSL integration workspaces
+#  - acquire/release and the size of the pool for the current thread
+#  - concurrent integrations with the same shared object from several threads
+#  @see Ostap::Math::WorkSpace
+# =============================================================================
+""" Test module for the thread-local pool of GSL integration workspaces
+- acquire/release and the size of the pool for the current thread
+- concurrent integrations with the same shared object from several threads
+"""
+# =============================================================================
+from __future__ import print_function
+# =============================================================================
+import ROOT, threading
+from   ostap.core.core     import Ostap
+from   ostap.math.integral import integral
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_math_workspace' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+# =============================================================================
+## the pool for the current thread
+def test_workspace_pool () :
+
+    logger = getLogger ( 'test_workspace_pool' )
+
+    WS = Ostap.Math.WorkSpace
+    WS.pool_clear ()
+    assert 0 == WS.pool_size () , 'Pool is not cleared!'
+
+    ws1 = WS ( 1000 )
+    ws2 = WS ( ws1  )
+    assert ws1.size () == ws2.size () , 'Size is not copied!'
+
+    ## nested acquisitions get different workspaces
+    w1 = ws1.acquire ()
+    w2 = ws2.acquire ()
+    assert 0 == WS.pool_size () , 'Acquired workspaces are in the pool!'
+
+    WS.release ( w2 )
+    WS.release ( w1 )
+    assert 2 == WS.pool_size () , 'Workspaces are not returned to the pool!'
+
+    ## reuse from the pool
+    w3 = ws1.acquire ()
+    assert 1 == WS.pool_size () , 'Workspace is not reused!'
+    WS.release ( w3 )
+
+    assert 2 == WS.pool_clear () and 0 == WS.pool_size () , 'Pool is not cleared!'
+    logger.info ( 'Thread-local pool is OK' )
+
+# =============================================================================
+## concurrent integrations with one shared object
+def test_workspace_threads () :
+
+    logger = getLogger ( 'test_workspace_threads' )
+
+    WS = Ostap.Math.WorkSpace
+    WS.pool_clear ()
+
+    ## the integral is calculated by GSL with the workspace from the pool
+    ps    = Ostap.Math.PhaseSpace2 ( 0.139 , 0.494 )
+    edges = [ ( ps.lowEdge () + 0.1 * i , ps.lowEdge () + 0.5 + 0.2 * i ) for i in range ( 20 ) ]
+
+    ## the reference: the same integrals from the main thread
+    reference = [ ps.integral ( a , b ) for a , b in edges ]
+    WS.pool_clear ()
+
+    results = {}
+    def work ( index ) :
+        ## each thread starts with the empty pool
+        before = WS.pool_size ()
+        values = [ ps.integral ( a , b ) for a , b in edges ]
+        after  = WS.pool_size  ()
+        freed  = WS.pool_clear ()
+        results [ index ] = before , after , freed , values
+
+    nthreads = 8
+    threads  = [ threading.Thread ( target = work , args = ( i , ) ) for i in range ( nthreads ) ]
+    for t in threads : t.start ()
+    for t in threads : t.join  ()
+
+    ## the pool of the main thread is not touched by other threads
+    assert 0 == WS.pool_size () , 'Pool of the main thread is modified!'
+    assert nthreads == len ( results ) , 'Some threads failed!'
+
+    for i in range ( nthreads ) :
+        before , after , freed , values = results [ i ]
+        ## the workspace is returned back to the pool of the thread
+        assert 0 == before         , 'Thread #%d: pool is not empty at start %s' % ( i , before )
+        assert 1 == after == freed , 'Thread #%d: invalid pool size %s/%s'       % ( i , after , freed )
+        assert values == reference , 'Thread #%d: different integrals'           % i
+
+    ## and the integrals are correct
+    emax = 0.0
+    for ( a , b ) , v in zip ( edges , reference ) :
+        r    = integral ( ps , a , b )
+        emax = max ( emax , abs ( v - r ) / abs ( r ) )
+
+    logger.info ( '#threads %d, #integrals %d, max relative error %.3g' % ( nthreads , len ( edges ) , emax ) )
+    assert emax < 1.e-6 , 'Integration is wrong: %s' % emax
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_workspace_pool    ()
+    test_workspace_threads ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
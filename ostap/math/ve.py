@@ -23,6 +23,7 @@ r""" Simple `value-with-error' concept
 __all__     = (
     'VE'  ,  # Value with error  
     'VVE' ,  # vector of values with errors
+    'VEs' ,  # array of values with errors (structure of arrays)
     )
 # ============================================================================= 
 import ROOT
@@ -389,11 +390,55 @@ def _ve_poisson_ ( s , fluctuate , accept = lambda s : True ) :
 VE.gauss   = _ve_gauss_
 VE.poisson = _ve_poisson_ 
 
+# =============================================================================
+## array of values with errors (structure of arrays)
+#  @code
+#  h = ... ## TH1D
+#  v = VEs ( h ) ## view of the histogram content, no copy!
+#  v *= 2        ## scale the histogram (entries and statistics are not updated!)
+#  s = v.sum ()  
+#  @endcode 
+#  @see Ostap::Math::ValuesWithErrors
+VEs = Ostap.Math.ValuesWithErrors
+
+# =============================================================================
+## get the item with the check
+#  @code
+#  v = VEs ( ... )
+#  print ( v[2] ) 
+#  @endcode 
+def _ves_getitem_ ( s , index ) :
+    """Get the item with the check
+    >>> v = VEs ( ... )
+    >>> print ( v[2] ) 
+    """
+    n = len ( s )
+    if index < 0 : index += n
+    if not 0 <= index < n : raise IndexError ( 'Invalid index %s' % index )
+    return s.at ( index )
+
+# =============================================================================
+## iterator over values with errors 
+def _ves_iter_ ( s ) :
+    """Iterator over values with errors
+    >>> v = VEs ( ... )
+    >>> for i in v : print ( i ) 
+    """
+    for i in range ( len ( s ) ) : yield s.at ( i )
+
+VEs.__len__     = lambda s : s.size ()
+VEs.__getitem__ = _ves_getitem_
+VEs.__setitem__ = lambda s , i , v : s.set ( i , VE ( v ) )
+VEs.__iter__    = _ves_iter_
+VEs.__str__     = lambda s : str ( [ i for i in s ] )
+VEs.__repr__    = lambda s : str ( [ i for i in s ] )
+
 # =============================================================================
 ## decorated classes 
 _decorated_classes_  = (
     Ostap.Math.ValueWithError         ,
     Ostap.Math.ValueWithError.Vector  ,
+    Ostap.Math.ValuesWithErrors       ,
     Ostap.Math.Point3DWithError       ,
     Ostap.Math.Vector3DWithError      ,
     Ostap.Math.LorentzVectorWithError )
@@ -420,6 +465,12 @@ _new_methods_ = (
     VE . minmax           ,
     VE . gauss            , 
     VE . poisson          ,
+    VEs. __len__          , 
+    VEs. __getitem__      , 
+    VEs. __setitem__      , 
+    VEs. __iter__         , 
+    VEs. __str__          , 
+    VEs. __repr__         , 
    )
 
 # =============================================================================
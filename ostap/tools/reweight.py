@@ -38,6 +38,7 @@ from   ostap.math.operations  import Mul as MULT  ## needed for proper abstract
 import ostap.io.zipshelve     as     DBASE ## needed to store the weights&histos
 from   ostap.trees.funcs      import FuncTree, FuncData ## add weigth to TTree/RooDataSet
 from   ostap.logger.utils     import pretty_ve 
+from   ostap.histos.histos    import histo_memo 
 import ostap.histos.histos 
 import ostap.histos.compare 
 import ostap.trees.trees
@@ -62,6 +63,17 @@ class AttrGetter(object):
         """
         return self.__attributes
     
+# =============================================================================
+## the clone of the histogram with zero uncertainties
+def _nullify_ ( histo ) :
+    """The clone of the histogram with zero uncertainties
+    """
+    ff = histo.clone()
+    for i in ff :
+        v     = float ( ff[i] )
+        ff[i] = VE(v,0)
+    return ff
+
 # =============================================================================
 ## @class Weight
 #  helper class for semiautomatic reweighting of data 
@@ -186,10 +198,7 @@ class Weight(object) :
                 _first     = True 
                 for f in reversed ( functions ) :
                     if isinstance ( f , ROOT.TH1 ) and _first : 
-                        ff = f.clone()
-                        for i in ff :
-                            v     = float ( ff[i] )
-                            ff[i] = VE(v,0)
+                        ff = histo_memo ( f , 'Weight/nullify' , _nullify_ )
                         _functions.append ( ff  )                        
                         _first = False 
                     else :
@@ -1421,8 +1421,10 @@ def _add_response_tree  ( tree  , *args ) :
         return sc , tree 
 
 # =============================================================================
-def _add_response_chain ( chain , *args ) :
+def _add_response_chain ( chain , *args , **kwargs ) :
     """Specific action to ROOT.TChain
+    - with `checkpoint` the processed files are recorded in the journal
+      and the rerun skips them, see ostap.trees.checkpoint.FileJournal
     """
     
     import ostap.trees.trees
@@ -1434,11 +1436,23 @@ def _add_response_chain ( chain , *args ) :
         logger.warning ( 'addTMVAResponse: empty chain (no files)' )
         return Ostap.StatusCode ( 900 ) , chain 
 
+    checkpoint = kwargs.pop ( 'checkpoint' , '' )
+    assert not kwargs , 'addTMVAResponse: unknown arguments %s' % list ( kwargs.keys () )
+
+    journal = None
+    if checkpoint :
+        from ostap.trees.checkpoint import FileJournal
+        _ , _inputs , _map , _ , prefix , suffix , _ = args
+        key = 'addTMVAResponse' , cname , str ( _inputs ) , str ( _map ) , prefix , suffix 
+        journal = FileJournal ( checkpoint , key , files )
+        
     status = None 
     
     verbose = True and 1 < len ( files )
     from ostap.utils.progress_bar import progress_bar
     for f in progress_bar ( files , len ( files ) , silent = not verbose ) :
+
+        if journal and journal.done ( f ) : continue
         
         with ROOT.TFile.Open ( f , 'UPDATE' ,  exception = True ) as rfile :
             ## get the tree
@@ -1446,6 +1460,11 @@ def _add_response_chain ( chain , *args ) :
             ## treat the tree
             sc , nt = _add_response_tree ( tt  , *args )
             if status is None or sc.isFailure() : status = sc
+
+        if journal and sc.isSuccess () : journal.mark ( f )
+
+    if status is None : status = Ostap.StatusCode ( Ostap.StatusCode.SUCCESS )
+    if journal and status.isSuccess () : journal.close () 
             
     newc = ROOT.TChain ( cname )
     for f in  files : newc.Add ( f  )
@@ -1468,6 +1487,8 @@ def _add_response_chain ( chain , *args ) :
 #  @param options  options to be used in TMVA Reader
 #  @param verbose  verbose operation?
 #  @param aux       obligatory for the cuts method, where it represents the efficiency cutoff
+#  @param checkpoint journal file for TChain: the rerun skips already processed files
+#  @see ostap.trees.checkpoint.FileJournal
 def addTMVAResponse ( dataset                ,   ## input dataset to be updated
                       inputs                 ,   ## input variables 
                       weights_files          ,   ## files with TMVA weigths (tar/gz or xml)
@@ -1475,13 +1496,16 @@ def addTMVAResponse ( dataset                ,   ## input dataset to be updated
                       suffix   = '_response' ,   ## suffix for TMVA-variable
                       options  = ''          ,   ## TMVA-reader options
                       verbose  = True        ,   ## verbosity flag 
-                      aux      = 0.9         ) : ## for Cuts method : efficiency cut-off
+                      aux      = 0.9         ,   ## for Cuts method : efficiency cut-off
+                      checkpoint = ''        ) : ## journal file for TChain 
     """
     Helper function to add TMVA  response into dataset
     >>> tar_file = trainer.tar_file
     >>> dataset  = ...
     >>> inputs = [ 'var1' , 'var2' , 'var2' ]
     >>> dataset.addTMVAResponse (  inputs , tar_file , prefix = 'tmva_' )
+    - for TChain with `checkpoint` the rerun (after interruption) skips already processed files:
+    >>> chain.addTMVAResponse (  inputs , tar_file , prefix = 'tmva_' , checkpoint = 'tmva.ckpt' )
     """
     assert dataset and isinstance ( dataset , ( ROOT.TTree , ROOT.RooAbsData ) ),\
            'Invalid dataset type!'
@@ -1502,7 +1526,7 @@ def addTMVAResponse ( dataset                ,   ## input dataset to be updated
     args = dataset , _inputs, _map, options, prefix , suffix , aux
     
     if   isinstance ( dataset , ROOT.TChain     ) :
-        sc , newdata = _add_response_chain ( *args )
+        sc , newdata = _add_response_chain ( *args , checkpoint = checkpoint )
         if sc.isFailure() : logger.error ( 'Error from Ostap::TMVA::addResponse %s' % sc )
     elif isinstance ( dataset , ROOT.TTree      ) :
         sc , newdata = _add_response_tree  ( *args )
@@ -0,0 +1,531 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+## @file ostap/trees/checkpoint.py
+#  Resumable, checkpointed loops over looong TChains
+#
+#  The chain is processed file-by-file, each file in chunks of N clusters;
+#  after each chunk the merged result (StatEntity/WStatEntity, moment counters,
+#  histograms, partial covariances, ...), the position in the chain and the
+#  checksums of the processed input files are saved into the local checkpoint file.
+#  A rerun with the same arguments resumes from the last checkpoint.
+#
+#  @code
+#  chain = ...
+#  stat  = chain.cstatVar ( 'pt' , 'eta>2' , checkpoint = 'pt.ckpt' )
+#  h     = ROOT.TH1D ( ... )
+#  chain.cproject ( h , 'pt' , 'eta>2' , checkpoint = 'pt_histo.ckpt' )
+#  @endcode
+#
+#  The final result does not depend on the number of interruptions, but since
+#  the chunks are merged, it can differ (in the last digits) from the result
+#  of the single uninterrupted loop over the whole chain.
+#
+#  @author Ostap developers
+#  @date   2026-10-19
+# =============================================================================
+"""Resumable, checkpointed loops over looong TChains
+
+The chain is processed file-by-file, each file in chunks of N clusters;
+after each chunk the merged result (StatEntity/WStatEntity, moment counters,
+histograms, partial covariances, ...), the position in the chain and the
+checksums of the processed input files are saved into the local checkpoint file.
+A rerun with the same arguments resumes from the last checkpoint.
+
+>>> chain = ...
+>>> stat  = chain.cstatVar ( 'pt' , 'eta>2' , checkpoint = 'pt.ckpt' )
+>>> h     = ROOT.TH1D ( ... )
+>>> chain.cproject ( h , 'pt' , 'eta>2' , checkpoint = 'pt_histo.ckpt' )
+
+The final result does not depend on the number of interruptions, but since
+the chunks are merged, it can differ (in the last digits) from the result
+of the single uninterrupted loop over the whole chain.
+"""
+# =============================================================================
+__version__ = "$Revision$"
+__author__  = "Ostap developers"
+__date__    = "2026-10-19"
+__all__     = (
+    'file_checksum'  , ## ``checksum'' of the input file
+    'cluster_chunks' , ## split the tree into chunks of N clusters
+    'merge'          , ## default merge of the partial results
+    'Checkpoint'     , ## the checkpoint file
+    'FileJournal'    , ## journal of processed files for the per-file updates
+    'checkpointed'   , ## run the action over the chain with checkpoints
+    'cStatVar'       , ## checkpointed statVar
+    'cStatCov'       , ## checkpointed statCov
+    'cproject'       , ## checkpointed project
+    )
+# =============================================================================
+import ROOT, os, zlib
+from   ostap.core.core        import Ostap, ROOTCWD
+from   ostap.core.ostap_types import string_types
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'ostap.trees.checkpoint' )
+else                       : logger = getLogger ( __name__                 )
+# =============================================================================
+try :
+    import cPickle as pickle
+except ImportError :
+    import pickle
+# =============================================================================
+## the version of the checkpoint format
+VERSION = 1
+# =============================================================================
+## ``checksum'' of the input file:
+#  the file size, ROOT UUID, and (for local files) CRC32 of the head and the tail
+#  @code
+#  cs = file_checksum ( 'data.root' )
+#  @endcode
+def file_checksum ( fname , nbytes = 65536 ) :
+    """``Checksum'' of the input file:
+    the file size, ROOT UUID, and (for local files) CRC32 of the head and the tail
+    >>> cs = file_checksum ( 'data.root' )
+    """
+    import ostap.io.root_file
+    with ROOTCWD () , ROOT.TFile.Open ( fname , 'READ' , exception = True ) as rfile :
+        size = rfile.GetSize ()
+        uuid = str ( rfile.GetUUID ().AsString () )
+
+    crc = 0
+    if os.path.exists ( fname ) and os.path.isfile ( fname ) :
+        with open ( fname , 'rb' ) as f :
+            crc = zlib.crc32 ( f.read ( nbytes ) )
+            if nbytes < size :
+                f.seek ( max ( nbytes , size - nbytes ) )
+                crc = zlib.crc32 ( f.read ( nbytes ) , crc )
+
+    return size , uuid , crc & 0xffffffff
+
+# =============================================================================
+## split the tree into chunks of N clusters
+#  @code
+#  tree = ...
+#  for first , last in cluster_chunks ( tree , 100 ) : ...
+#  @endcode
+#  @return list of (first,last) entries
+def cluster_chunks ( tree , clusters = 100 ) :
+    """Split the tree into chunks of N clusters
+    >>> tree = ...
+    >>> for first , last in cluster_chunks ( tree , 100 ) : ...
+    - return list of (first,last) entries
+    """
+    clusters = max ( 1 , clusters )
+    nentries = tree.GetEntries ()
+
+    result   = []
+    first    = 0
+    count    = 0
+    it       = tree.GetClusterIterator ( 0 )
+    start    = it.Next ()
+    while start < nentries :
+        count += 1
+        end    = min ( it.GetNextEntry () , nentries )
+        if clusters <= count :
+            result.append ( ( first , end ) )
+            first , count = end , 0
+        start = it.Next ()
+
+    if first < nentries : result.append ( ( first , nentries ) )
+    return result
+
+# =============================================================================
+## default merge of the partial results:
+#  - histograms are added
+#  - dictionaries, lists and tuples are merged elementwise
+#  - all other objects (StatEntity, WStatEntity, moment counters, numbers) with <code>+=</code>
+def merge ( a , b ) :
+    """Default merge of the partial results:
+    - histograms are added
+    - dictionaries, lists and tuples are merged elementwise
+    - all other objects (StatEntity, WStatEntity, moment counters, numbers) with +=
+    """
+    if   a is None                    : return b
+    elif b is None                    : return a
+    elif isinstance ( a , ROOT.TH1  ) :
+        a.Add ( b )
+        return a
+    elif isinstance ( a , dict      ) :
+        for k in b : a [ k ] = merge ( a [ k ] , b [ k ] ) if k in a else b [ k ]
+        return a
+    elif isinstance ( a , ( list , tuple ) ) :
+        assert len ( a ) == len ( b ) , 'merge: mismatch in lengths!'
+        return type ( a ) ( merge ( x , y ) for x , y in zip ( a , b ) )
+    a += b
+    return a
+
+# =============================================================================
+## @class Checkpoint
+#  The checkpoint file: the state is pickled, the file is replaced atomically
+#  @code
+#  ck = Checkpoint ( 'stat.ckpt' , key = ... )
+#  if ck.load () : ...  ## resume
+#  ck.state [ 'result' ] = ...
+#  ck.save ()
+#  @endcode
+class Checkpoint(object) :
+    """The checkpoint file: the state is pickled, the file is replaced atomically
+    >>> ck = Checkpoint ( 'stat.ckpt' , key = ... )
+    >>> if ck.load () : ...  ## resume
+    >>> ck.state [ 'result' ] = ...
+    >>> ck.save ()
+    """
+    def __init__ ( self , filename , key ) :
+        self.__filename = os.path.abspath ( os.path.expandvars ( os.path.expanduser ( filename ) ) )
+        self.__key      = key
+        self.__state    = self.initial ()
+
+    ## the initial state
+    def initial ( self ) :
+        """The initial state"""
+        return { 'version'   : VERSION    ,
+                 'key'       : self.__key ,
+                 'checksums' : {}         , ## checksums of the processed files
+                 'file'      : 0          , ## the current file
+                 'chunk'     : 0          , ## the next chunk in the current file
+                 'result'    : None       } ## the merged result
+
+    ## load the state from the file, return True if the state is valid
+    def load ( self ) :
+        """Load the state from the file, return True if the state is valid
+        - the key (arguments) must be the same
+        - the checksums of all processed files must be the same
+        """
+        self.__state = self.initial ()
+        if not os.path.exists ( self.__filename ) : return False
+
+        try :
+            with open ( self.__filename , 'rb' ) as f : state = pickle.load ( f )
+        except Exception :
+            logger.warning ( "Checkpoint: cannot read %s, start from scratch" % self.__filename )
+            return False
+
+        if VERSION != state.get ( 'version' , None ) or self.__key != state.get ( 'key' , None ) :
+            logger.warning ( "Checkpoint: %s is for other arguments, start from scratch" % self.__filename )
+            return False
+
+        for fname , cs in state [ 'checksums' ].items () :
+            if file_checksum ( fname ) != cs :
+                logger.warning ( "Checkpoint: file %s is changed, start from scratch" % fname )
+                return False
+
+        self.__state = state
+        return True
+
+    ## save the state (atomically)
+    def save ( self ) :
+        """Save the state (atomically)"""
+        tmp = self.__filename + '.tmp'
+        with open ( tmp , 'wb' ) as f :
+            pickle.dump ( self.__state , f , pickle.HIGHEST_PROTOCOL )
+            f.flush ()
+            os.fsync ( f.fileno () )
+        os.rename ( tmp , self.__filename ) ## atomic on POSIX
+
+    ## remove the checkpoint file
+    def remove ( self ) :
+        """Remove the checkpoint file"""
+        if os.path.exists ( self.__filename ) : os.remove ( self.__filename )
+
+    @property
+    def filename ( self ) :
+        """``filename'' : the name of the checkpoint file"""
+        return self.__filename
+
+    @property
+    def key      ( self ) :
+        """``key'' : the key (the arguments)"""
+        return self.__key
+
+    @property
+    def state    ( self ) :
+        """``state'' : the state"""
+        return self.__state
+
+# =============================================================================
+## the files of the tree/chain
+def _files_ ( tree ) :
+    """The files of the tree/chain"""
+    if isinstance ( tree , ROOT.TChain ) : return tuple ( tree.files () )
+    from ostap.trees.trees import Chain
+    return tuple ( Chain ( tree ).files )
+
+# =============================================================================
+## run the action over the chain with checkpoints
+#  @code
+#  chain  = ...
+#  action = lambda tree , first , last : tree.statVar ( 'pt' , 'eta>2' , first , last )
+#  result = checkpointed ( chain , action , 'pt.ckpt' , key = 'statVar/pt/eta>2' )
+#  @endcode
+#  @param chain      the chain
+#  @param action     the action <code>action ( tree , first , last )</code> that returns mergeable result
+#  @param checkpoint the name of the checkpoint file
+#  @param key        the key that identifies the action and its arguments
+#  @param clusters   number of clusters per chunk (the state is saved after each chunk)
+#  @param merge      the function to merge the partial results
+#  @param keep       keep the checkpoint file at the end?
+#  @param silent     silent processing?
+def checkpointed ( chain             ,
+                   action            ,
+                   checkpoint        ,
+                   key               ,
+                   clusters = 100    ,
+                   merge    = merge  ,
+                   keep     = False  ,
+                   silent   = False  ) :
+    """Run the action over the chain with checkpoints
+    >>> chain  = ...
+    >>> action = lambda tree , first , last : tree.statVar ( 'pt' , 'eta>2' , first , last )
+    >>> result = checkpointed ( chain , action , 'pt.ckpt' , key = 'statVar/pt/eta>2' )
+    - action   : the action `action ( tree , first , last )` that returns mergeable result
+    - key      : the key that identifies the action and its arguments
+    - clusters : number of clusters per chunk (the state is saved after each chunk)
+    """
+    name  = chain.GetName ()
+    files = _files_ ( chain )
+
+    ## the chunk plan is a part of the key: the result depends on it
+    ck    = Checkpoint ( checkpoint , key = ( str ( key ) , name , files , int ( clusters ) ) )
+    if ck.load () and not silent :
+        logger.info ( "Checkpoint: resume from file #%d/chunk #%d" % ( ck.state [ 'file' ] , ck.state [ 'chunk' ] ) )
+
+    state = ck.state
+    from ostap.utils.progress_bar import progress_bar
+    for index , fname in progress_bar ( enumerate ( files ) , len ( files ) , silent = silent or len ( files ) < 2 ) :
+
+        if index < state [ 'file' ] : continue
+
+        checksum = file_checksum ( fname )
+
+        tree = ROOT.TChain ( name )
+        tree.Add ( fname )
+
+        for j , ( first , last ) in enumerate ( cluster_chunks ( tree , clusters ) ) :
+
+            if index == state [ 'file' ] and j < state [ 'chunk' ] : continue
+
+            result = action ( tree , first , last )
+            state [ 'result'    ] = merge ( state [ 'result' ] , result )
+            state [ 'checksums' ] [ fname ] = checksum
+            state [ 'file'      ] = index
+            state [ 'chunk'     ] = j + 1
+            ck.save ()
+
+        state [ 'checksums' ] [ fname ] = checksum
+        state [ 'file'      ] = index + 1
+        state [ 'chunk'     ] = 0
+        ck.save ()
+
+        del tree
+
+    result = state [ 'result' ]
+    if not keep : ck.remove ()
+
+    return result
+
+# =============================================================================
+## checkpointed statVar for looong chain
+#  @code
+#  chain = ...
+#  stat  = chain.cstatVar ( 'pt' , 'eta>2' , checkpoint = 'pt.ckpt' )
+#  stats = chain.cstatVar ( [ 'pt' , 'eta' ] , 'y>2' , checkpoint = 'pt_eta.ckpt' )
+#  @endcode
+#  @see Ostap::StatVar::statVar
+def cStatVar ( chain              ,
+               what               ,
+               cuts       = ''    ,
+               checkpoint = ''    ,
+               clusters   = 100   , **kwargs ) :
+    """Checkpointed statVar for looong chain
+    >>> chain = ...
+    >>> stat  = chain.cstatVar ( 'pt' , 'eta>2' , checkpoint = 'pt.ckpt' )
+    >>> stats = chain.cstatVar ( [ 'pt' , 'eta' ] , 'y>2' , checkpoint = 'pt_eta.ckpt' )
+    """
+    import ostap.trees.trees
+    cuts = str ( cuts )
+    if not checkpoint : return chain.statVar ( what , cuts )
+
+    what_ = what if isinstance ( what , string_types ) else tuple ( what )
+    def _action_ ( tree , first , last ) : return tree.statVar ( what , cuts , first , last )
+
+    return checkpointed ( chain , _action_ , checkpoint ,
+                          key      = ( 'statVar' , what_ , cuts ) ,
+                          clusters = clusters , **kwargs )
+
+# =============================================================================
+## checkpointed statCov for looong chain
+#  @code
+#  chain = ...
+#  stat1 , stat2 , cov2 , len = chain.cstatCov ( 'x' , 'y' , 'z>0' , checkpoint = 'xy.ckpt' )
+#  @endcode
+#  The partial covariances are merged via the raw second moments
+#  @see Ostap::StatVar::statCov
+def cStatCov ( chain            ,
+               expression1      ,
+               expression2      ,
+               cuts       = ''  ,
+               checkpoint = ''  ,
+               clusters   = 100 , **kwargs ) :
+    """Checkpointed statCov for looong chain
+    >>> chain = ...
+    >>> stat1 , stat2 , cov2 , len = chain.cstatCov ( 'x' , 'y' , 'z>0' , checkpoint = 'xy.ckpt' )
+    - the partial covariances are merged via the raw second moments
+    """
+    import ostap.trees.trees
+    import ostap.math.linalg
+    cuts = str ( cuts )
+    if not checkpoint : return chain.statCov ( expression1 , expression2 , cuts )
+
+    def _action_ ( tree , first , last ) :
+        s1 , s2 , c2 , n = tree.statCov ( expression1 , expression2 , cuts , first , last )
+        if not n : return [ s1 , s2 , 0 , 0.0 , 0.0 , 0.0 ]
+        m1 , m2 = s1.mean () , s2.mean ()
+        ## the raw second moments
+        return [ s1 , s2 , n ,
+                 n * ( c2 [ 0 , 0 ] + m1 * m1 ) ,
+                 n * ( c2 [ 0 , 1 ] + m1 * m2 ) ,
+                 n * ( c2 [ 1 , 1 ] + m2 * m2 ) ]
+
+    s1 , s2 , n , s00 , s01 , s11 = checkpointed ( chain , _action_ , checkpoint ,
+                                                   key      = ( 'statCov' , expression1 , expression2 , cuts ) ,
+                                                   clusters = clusters , **kwargs )
+    cov2 = Ostap.Math.SymMatrix(2) ()
+    if n :
+        m1 , m2 = s1.mean () , s2.mean ()
+        cov2 [ 0 , 0 ] = s00 / n - m1 * m1
+        cov2 [ 0 , 1 ] = s01 / n - m1 * m2
+        cov2 [ 1 , 1 ] = s11 / n - m2 * m2
+
+    return s1 , s2 , cov2 , n
+
+# =============================================================================
+## checkpointed project for looong chain
+#  @code
+#  chain = ...
+#  h     = ROOT.TH1D ( ... )
+#  chain.cproject ( h , 'pt' , 'eta>2' , checkpoint = 'pt_histo.ckpt' )
+#  @endcode
+def cproject ( chain            ,
+               histo            ,
+               what             ,
+               cuts       = ''  ,
+               checkpoint = ''  ,
+               clusters   = 100 , **kwargs ) :
+    """Checkpointed project for looong chain
+    >>> chain = ...
+    >>> h     = ROOT.TH1D ( ... )
+    >>> chain.cproject ( h , 'pt' , 'eta>2' , checkpoint = 'pt_histo.ckpt' )
+    """
+    import ostap.trees.trees
+    cuts = str ( cuts )
+    if not checkpoint : return chain.project ( histo , what , cuts )
+
+    histo.Reset ()
+    def _action_ ( tree , first , last ) :
+        h = histo.clone ()
+        tree.project ( h , what , cuts , '' , last - first , first )
+        return h
+
+    what_ = what if isinstance ( what , string_types ) else tuple ( what )
+    ## the binning is a part of the key
+    axes  = tuple ( ( a.GetNbins () , a.GetXmin () , a.GetXmax () ) for a in
+                    ( histo.GetXaxis () , histo.GetYaxis () , histo.GetZaxis () ) )
+    result = checkpointed ( chain , _action_ , checkpoint ,
+                            key      = ( 'project' , histo.ClassName () , axes , what_ , cuts ) ,
+                            clusters = clusters , **kwargs )
+    if result : histo.Add ( result )
+
+    return result.GetEntries () if result else 0 , histo
+
+# =============================================================================
+## @class FileJournal
+#  Journal of the processed files for the operations that update the input
+#  files one by one (<code>add_new_branch</code>, <code>addTMVAResponse</code>).
+#  The file is considered as processed if its current checksum
+#  is the same as the checksum recorded after its processing.
+#  @code
+#  with FileJournal ( 'add_branch.ckpt' , key , files ) as journal :
+#     for f in files :
+#        if journal.done ( f ) : continue
+#        ... update the file ...
+#        journal.mark ( f )
+#  @endcode
+#  The journal is removed by <code>close</code> or at the normal exit from the context
+class FileJournal(object) :
+    """Journal of the processed files for the operations that update the input
+    files one by one (add_new_branch, addTMVAResponse)
+    - the file is considered as processed if its current checksum
+    is the same as the checksum recorded after its processing
+    >>> with FileJournal ( 'add_branch.ckpt' , key , files ) as journal :
+    ...    for f in files :
+    ...       if journal.done ( f ) : continue
+    ...       ... update the file ...
+    ...       journal.mark ( f )
+    - the journal is removed by `close` or at the normal exit from the context
+    """
+    def __init__ ( self , filename , key , files ) :
+        ## the checksums of processed files are validated at load
+        self.__ck = Checkpoint ( filename , key = ( 'journal' , str ( key ) , tuple ( files ) ) )
+        if self.__ck.load () and self.__ck.state [ 'checksums' ] :
+            logger.info ( "FileJournal: %d file(s) are already processed" % len ( self.__ck.state [ 'checksums' ] ) )
+
+    def __enter__ ( self ) : return self
+    def __exit__  ( self , exc_type , exc_value , traceback ) :
+        if exc_type is None : self.close ()
+
+    ## all files are processed: remove the journal
+    def close ( self ) :
+        """All files are processed: remove the journal"""
+        self.__ck.remove ()
+
+    ## is the file already processed?
+    def done ( self , fname ) :
+        """Is the file already processed?"""
+        return fname in self.__ck.state [ 'checksums' ]
+
+    ## mark the file as processed
+    def mark ( self , fname ) :
+        """Mark the file as processed"""
+        self.__ck.state [ 'checksums' ] [ fname ] = file_checksum ( fname )
+        self.__ck.save ()
+
+    @property
+    def processed ( self ) :
+        """``processed'': the files that are already processed"""
+        return tuple ( self.__ck.state [ 'checksums' ].keys () )
+
+# =============================================================================
+ROOT.TTree .cstatVar = cStatVar
+ROOT.TChain.cstatVar = cStatVar
+ROOT.TTree .cstatCov = cStatCov
+ROOT.TChain.cstatCov = cStatCov
+ROOT.TTree .cproject = cproject
+ROOT.TChain.cproject = cproject
+
+# =============================================================================
+_decorated_classes_ = (
+    ROOT.TTree  ,
+    ROOT.TChain ,
+    )
+
+_new_methods_       = (
+    ROOT.TTree .cstatVar ,
+    ROOT.TChain.cstatVar ,
+    ROOT.TTree .cstatCov ,
+    ROOT.TChain.cstatCov ,
+    ROOT.TTree .cproject ,
+    ROOT.TChain.cproject ,
+    )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    from ostap.utils.docme import docme
+    docme ( __name__ , logger = logger )
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -23,6 +23,8 @@ __all__     = (
     'FuncTH1'           , ## TH1-based Tree-function 
     'FuncTH2'           , ## TH2-based Tree-function 
     'FuncTH3'           , ## TH3-based Tree-function 
+    'FuncKinematics'    , ## kinematical Tree-function
+    'kinematics_tree'   , ## ditto, but as function 
     ) 
 # =============================================================================
 import ROOT
@@ -199,6 +201,45 @@ FuncRooFormula = Ostap.Functions.FuncRooFormula
 FuncTH1        = Ostap.Functions.FuncTH1
 FuncTH2        = Ostap.Functions.FuncTH2
 FuncTH3        = Ostap.Functions.FuncTH3
+
+## kinematical ITreeFunc, that reads the components of four-vectors 
+FuncKinematics = Ostap.Functions.FuncKinematics
+
+# =================================================================================
+## create the kinematical Ostap.IFuncTree object 
+#  The four-vectors are specified either by name (the components
+#  are built using the suffixes) or as the 4-tuple of expressions 
+#  @code
+#  cos_theta = kinematics_tree ( 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+#  chi       = kinematics_tree ( 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+#  tree.add_new_branch ( 'cos_theta' , cos_theta ) 
+#  @endcode 
+#  @see Ostap::Functions::FuncKinematics
+#  @see Ostap::Kinematics::Batch
+def kinematics_tree ( variable , *particles , **kwargs ) :
+    """Create the kinematical Ostap.IFuncTree object 
+    The four-vectors are specified either by name (the components
+    are built using the suffixes) or as the 4-tuple of expressions 
+    >>> cos_theta = kinematics_tree ( 'decayAngle' , 'B' , 'Jpsi' , 'mu_plus' )
+    >>> chi       = kinematics_tree ( 'decayAngleChi' , 'mu_plus' , 'mu_minus' , 'K' , 'pi' )
+    >>> tree.add_new_branch ( 'cos_theta' , cos_theta ) 
+    - for plain branches the components are read and the variable is
+    evaluated by blocks of `block` entries; `block=1` switches it off 
+    - see Ostap.Functions.FuncKinematics
+    - see Ostap.Kinematics.Batch
+    """
+    from ostap.math.kinematic import kinematic_variable, lorentz_components
+    components  = kwargs.pop ( 'components' , ( '_PX' , '_PY' , '_PZ' , '_PE' ) )
+    tree        = kwargs.pop ( 'tree'       , None )
+    block       = kwargs.pop ( 'block'      , 1024 )
+    assert not kwargs , 'Unknown arguments: %s' % list ( kwargs.keys () )
+    
+    expressions = ROOT.std.vector('std::string')()
+    for p in particles :
+        for e in lorentz_components ( p , components ) : expressions.push_back ( e )
+        
+    if tree is None : tree = ROOT.nullptr
+    return FuncKinematics ( kinematic_variable ( variable ) , expressions , tree , block )
          
 # =============================================================================
 if '__main__' == __name__ :
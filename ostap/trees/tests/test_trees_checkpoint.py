@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/trees/tests/test_trees_checkpoint.py
+# Test for resumable, checkpointed loops over TChains
+# @see ostap.trees.checkpoint
+# Copyright (c) Ostap developers.
+# =============================================================================
+""" Test for resumable, checkpointed loops over TChains
+- see ostap.trees.checkpoint
+"""
+# =============================================================================
+from   __future__               import print_function
+import ROOT, random, os
+import ostap.trees.trees
+import ostap.trees.checkpoint
+from   ostap.core.core          import Ostap, hID
+from   ostap.trees.data         import Data
+from   ostap.trees.checkpoint   import checkpointed
+from   ostap.utils.cleanup      import CleanUp
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_trees_checkpoint' )
+else                       : logger = getLogger ( __name__                )
+# =============================================================================
+## create a file with tree
+def create_tree ( fname , nentries = 1000 ) :
+    """Create a file with a tree
+    >>> create_tree ( 'file.root' ,  1000 )
+    """
+
+    import ostap.io.root_file
+
+    from array import array
+    x = array ( 'd' , [ 0 ] )
+    y = array ( 'd' , [ 0 ] )
+
+    from ostap.core.core import ROOTCWD
+
+    with ROOTCWD() , ROOT.TFile.Open( fname , 'new' ) as root_file:
+        root_file.cd ()
+        tree = ROOT.TTree ( 'S','tree' )
+        tree.SetDirectory ( root_file  )
+        tree.SetAutoFlush ( 500 ) ## many small clusters
+        tree.Branch ( 'x' , x , 'x/D' )
+        tree.Branch ( 'y' , y , 'y/D' )
+
+        for i in range ( nentries ) :
+            x[0] = random.gauss ( 0 , 1 )
+            y[0] = random.gauss ( x[0] , 1 )
+            tree.Fill()
+
+        root_file.Write()
+
+# =============================================================================
+def prepare_data ( nfiles = 4 ,  nentries = 5000  ) :
+
+    files = [ CleanUp.tempfile ( prefix = 'ostap-test-trees-checkpoint-%d-' % i ,
+                                 suffix = '.root' ) for i in range ( nfiles)  ]
+
+    for f in files : create_tree ( f , nentries )
+    return files
+
+# =============================================================================
+## interrupted and resumed loop must give the same result as uninterrupted one
+def test_checkpoint_resume () :
+
+    files = prepare_data ( 4 , 5000 )
+    chain = Data ( 'S' , files ).chain
+
+    action = lambda tree , first , last : tree.statVar ( 'x+y' , 'x>0' , first , last )
+
+    ## uninterrupted checkpointed loop
+    ck1 = CleanUp.tempfile ( suffix = '.ckpt' )
+    r1  = checkpointed ( chain , action , ck1 , key = 'x+y' , clusters = 2 )
+    assert not os.path.exists ( ck1 ) , 'Checkpoint file is not removed!'
+
+    ## interrupted loop
+    class Interrupt(Exception) : pass
+    calls = [ 0 ]
+    def failing ( tree , first , last ) :
+        calls [ 0 ] += 1
+        if 7 < calls [ 0 ] : raise Interrupt ()
+        return action ( tree , first , last )
+
+    ck2 = CleanUp.tempfile ( suffix = '.ckpt' )
+    try :
+        checkpointed ( chain , failing , ck2 , key = 'x+y' , clusters = 2 )
+        assert False , 'The loop must be interrupted!'
+    except Interrupt :
+        pass
+    assert os.path.exists ( ck2 ) , 'Checkpoint file is not saved!'
+
+    ## resume
+    r2  = checkpointed ( chain , action , ck2 , key = 'x+y' , clusters = 2 )
+
+    assert r1.nEntries () == r2.nEntries () and r1.mean () == r2.mean () and r1.rms () == r2.rms () , \
+           'Mismatch between uninterrupted and resumed loops: %s vs %s' % ( r1 , r2 )
+
+    ## compare with the single pass
+    r0  = chain.statVar ( 'x+y' , 'x>0' )
+    assert r0.nEntries () == r2.nEntries () and abs ( r0.mean () - r2.mean () ) <= 1.e-9 * abs ( r0.mean () ) , \
+           'Mismatch between single pass and checkpointed loop: %s vs %s' % ( r0 , r2 )
+
+    logger.info ( 'Resumed statVar: %s' % r2 )
+
+# =============================================================================
+## checkpointed statCov/project
+def test_checkpoint_decorations () :
+
+    files = prepare_data ( 3 , 5000 )
+    chain = Data ( 'S' , files ).chain
+
+    s1 , s2 , c2 , n = chain.statCov  ( 'x' , 'y' , 'x>-1' )
+    t1 , t2 , d2 , m = chain.cstatCov ( 'x' , 'y' , 'x>-1' ,
+                                        checkpoint = CleanUp.tempfile ( suffix = '.ckpt' ) , clusters = 3 )
+    assert n == m , 'Mismatch in statCov: %s vs %s' % ( n , m )
+    for i in range ( 2 ) :
+        for j in range ( 2 ) :
+            assert abs ( c2 [ i , j ] - d2 [ i , j ] ) <= 1.e-8 , 'Mismatch in covariance: %s vs %s' % ( c2 , d2 )
+
+    h1 = ROOT.TH1D ( hID () , '' , 50 , -5 , 5 )
+    h2 = h1.clone ()
+    chain.project  ( h1 , 'x+y' , 'y>0' )
+    chain.cproject ( h2 , 'x+y' , 'y>0' , checkpoint = CleanUp.tempfile ( suffix = '.ckpt' ) , clusters = 3 )
+    for i in range ( h1.GetNcells () ) :
+        assert h1.GetBinContent ( i ) == h2.GetBinContent ( i ) , 'Mismatch in project!'
+
+    logger.info ( 'Checkpointed statCov/project: OK' )
+
+# =============================================================================
+## resumable add_new_branch
+def test_checkpoint_add_branch () :
+
+    files = prepare_data ( 3 , 2000 )
+    chain = Data ( 'S' , files ).chain
+
+    ck = CleanUp.tempfile ( suffix = '.ckpt' )
+    chain = chain.add_new_branch ( 'z' , 'x*y' , checkpoint = ck )
+    assert 'z' in chain.branches () , 'Branch is not added!'
+    assert not os.path.exists ( ck ) , 'Journal is not removed!'
+
+    logger.info ( 'Checkpointed add_new_branch: OK' )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_checkpoint_resume      ()
+    test_checkpoint_decorations ()
+    test_checkpoint_add_branch  ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/trees/tests/test_trees_instrumentation.py
+# Test for the hot-path instrumentation counters
+# @see Ostap::Utils::Instrumentation
+# Copyright (c) Ostap developers.
+# =============================================================================
+""" Test for the hot-path instrumentation counters
+- see Ostap::Utils::Instrumentation
+"""
+# =============================================================================
+from   __future__                  import print_function
+import ROOT, random
+import ostap.trees.trees
+from   ostap.core.core             import Ostap, ROOTCWD
+from   ostap.utils.instrumentation import instrumentation, snapshot, enabled
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_trees_instrumentation' )
+else                       : logger = getLogger ( __name__                     )
+# =============================================================================
+def test_instrumentation () :
+
+    from array import array
+    x = array ( 'd' , [ 0 ] )
+
+    with ROOTCWD () :
+        ROOT.gROOT.cd ()
+        tree = ROOT.TTree ( 'T' , 'tree' )
+        tree.Branch ( 'x' , x , 'x/D' )
+        N = 10000
+        for i in range ( N ) :
+            x[0] = random.gauss ( 0 , 1 )
+            tree.Fill ()
+
+        assert not enabled () , 'Instrumentation must be disabled by default!'
+
+        ## nothing is counted when disabled
+        Ostap.StatVar.statVar ( tree , 'x' )
+        before = snapshot ().get ( 'Formula::evaluate' , ( 0 , None , None ) ) [ 0 ]
+
+        with instrumentation () as i :
+            Ostap.StatVar.statVar ( tree , 'x' , 'x>0' )
+
+        data = i.data
+        assert N     <= data [ 'Formula::evaluate' ][0] , 'Invalid number of formula evaluations!'
+        assert 1     <= data [ 'StatVar/TTree'     ][0] , 'Invalid number of TTree loops!'
+        assert not enabled () , 'Instrumentation must be switched off at exit!'
+
+        logger.info ( 'Formula evaluations: %d (disabled: %d)' % ( data [ 'Formula::evaluate' ][0] , before ) )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_instrumentation ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
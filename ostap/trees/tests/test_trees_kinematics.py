@@ -0,0 +1,166 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/trees/tests/test_trees_kinematics.py
+# Test for kinematical TTree-functions Ostap::Functions::FuncKinematics
+# - block (batch) evaluation for plain branches
+# - entry-by-entry evaluation for expressions and friend trees
+# - compare with the scalar functions from Ostap::Kinematics
+# @see ostap.trees.funcs.kinematics_tree
+# Copyright (c) Ostap developers.
+# =============================================================================
+""" Test for kinematical TTree-functions Ostap::Functions::FuncKinematics
+- block (batch) evaluation for plain branches
+- entry-by-entry evaluation for expressions and friend trees
+- compare with the scalar functions from Ostap::Kinematics
+"""
+# =============================================================================
+from   __future__               import print_function
+import ROOT, random, math
+import ostap.trees.trees
+from   ostap.core.core          import Ostap
+from   ostap.trees.data         import Data
+from   ostap.trees.funcs        import kinematics_tree
+from   ostap.utils.cleanup      import CleanUp
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_trees_kinematics' )
+else                       : logger = getLogger ( __name__                )
+# =============================================================================
+## particles, stored in the main tree: name, mass, type of the branches
+particles = ( ( 'mu_plus' , 0.106 , 'D' ) ,
+              ( 'mu_minus', 0.106 , 'D' ) ,
+              ( 'K'       , 0.494 , 'F' ) ) ## float branches
+## particle, stored in the friend tree
+friend    =   ( 'pi'      , 0.140 , 'D' )
+# =============================================================================
+## create a file with the main tree and the friend tree
+def create_tree ( fname , nentries = 3000 ) :
+    """Create a file with the main and the friend tree
+    >>> create_tree ( 'file.root' ,  3000 )
+    """
+
+    import ostap.io.root_file
+    from   array           import array
+    from   ostap.core.core import ROOTCWD
+
+    comps = ( '_PX' , '_PY' , '_PZ' , '_PE' )
+
+    with ROOTCWD() , ROOT.TFile.Open( fname , 'new' ) as root_file:
+        root_file.cd ()
+        tree = ROOT.TTree ( 'S' , 'tree'   )
+        frnd = ROOT.TTree ( 'F' , 'friend' )
+        tree.SetDirectory ( root_file  )
+        frnd.SetDirectory ( root_file  )
+        tree.SetAutoFlush ( 700 ) ## clusters are not aligned with the blocks
+
+        buffers = {}
+        for t , ( p , m , typ ) in [ ( tree , q ) for q in particles ] + [ ( frnd , friend ) ] :
+            for c in comps :
+                b = array ( 'd' if 'D' == typ else 'f' , [ 0 ] )
+                t.Branch  ( p + c , b , '%s%s/%s' % ( p , c , typ ) )
+                buffers [ p + c ] = b
+
+        for i in range ( nentries ) :
+            for p , m , typ in particles + ( friend , ) :
+                px = random.uniform ( -1 , 1 )
+                py = random.uniform ( -1 , 1 )
+                pz = random.uniform (  2 , 8 )
+                e  = math.sqrt ( px * px + py * py + pz * pz + m * m )
+                for c , v in zip ( comps , ( px , py , pz , e ) ) : buffers [ p + c ] [ 0 ] = v
+            tree.Fill ()
+            frnd.Fill ()
+
+        root_file.Write()
+
+# =============================================================================
+## get the four-vector for the current entry
+def vector ( tree , p ) :
+    return Ostap.LorentzVector ( getattr ( tree , p + '_PX' ) ,
+                                 getattr ( tree , p + '_PY' ) ,
+                                 getattr ( tree , p + '_PZ' ) ,
+                                 getattr ( tree , p + '_PE' ) )
+
+K = Ostap.Kinematics
+## variable, particles, scalar function
+checks = (
+    ( 'mass'          , ( 'mu_plus' , 'mu_minus'             ) ,
+      lambda t : ( vector ( t , 'mu_plus' ) + vector ( t , 'mu_minus' ) ).M () ) ,
+    ( 'cosThetaRest'  , ( 'mu_plus' , 'mu_minus' , 'K'       ) ,
+      lambda t : K.cosThetaRest  ( vector ( t , 'mu_plus' ) , vector ( t , 'mu_minus' ) , vector ( t , 'K' ) ) ) ,
+    ( 'decayAngleChi' , ( 'mu_plus' , 'mu_minus' , 'K' , 'pi' ) ,  ## friend tree: entry-by-entry
+      lambda t : K.decayAngleChi ( vector ( t , 'mu_plus' ) , vector ( t , 'mu_minus' ) , vector ( t , 'K' ) , vector ( t , 'pi' ) ) ) ,
+    ( 'restMomentum'  , ( ( '2*mu_plus_PX' , '2*mu_plus_PY' , '2*mu_plus_PZ' , '2*mu_plus_PE' ) , 'K' ) , ## expression: entry-by-entry
+      lambda t : K.restMomentum  ( vector ( t , 'mu_plus' ) * 2.0 , vector ( t , 'K' ) ) ) ,
+    )
+
+# =============================================================================
+## FuncKinematics for the tree: block and entry-by-entry modes
+def test_kinematics_tree () :
+
+    logger = getLogger ( 'test_kinematics_tree' )
+
+    fname = CleanUp.tempfile ( prefix = 'ostap-test-trees-kinematics-' , suffix = '.root' )
+    create_tree ( fname , 3000 )
+
+    rfile = ROOT.TFile.Open ( fname , 'read' )
+    tree  = rfile.Get ( 'S' )
+    tree.AddFriend ( 'F' , rfile )
+    N     = tree.GetEntries ()
+
+    for variable , parts , scalar in checks :
+
+        f_block = kinematics_tree ( variable , *parts , tree = tree )
+        f_entry = kinematics_tree ( variable , *parts , tree = tree , block = 1 )
+
+        ## forward, backward and random access
+        entries = list ( range ( N ) ) + list ( reversed ( range ( N ) ) ) + [ random.randrange ( N ) for i in range ( 500 ) ]
+
+        dmax = 0.0
+        for i in entries :
+            tree.GetEntry ( i )
+            v  = scalar ( tree )
+            v1 = f_block ( tree )
+            v2 = f_entry ( tree )
+            dmax = max ( dmax , abs ( v1 - v ) / max ( 1.0 , abs ( v ) ) , abs ( v2 - v ) / max ( 1.0 , abs ( v ) ) )
+            ## the branch buffers are restored after reading the block
+            assert scalar ( tree ) == v , 'Branch buffers are not restored!'
+
+        logger.info ( '%-14s : max difference %.3g' % ( variable , dmax ) )
+        assert dmax < 1.e-8 , '%s: difference is too large %s' % ( variable , dmax )
+
+    rfile.Close ()
+
+# =============================================================================
+## kinematics_tree for add_new_branch over the chain (blocks cross the files)
+def test_kinematics_add_branch () :
+
+    logger = getLogger ( 'test_kinematics_add_branch' )
+
+    files = [ CleanUp.tempfile ( prefix = 'ostap-test-trees-kinematics-%d-' % i , suffix = '.root' ) for i in range ( 3 ) ]
+    for f in files : create_tree ( f , 1500 )
+
+    data  = Data ( 'S' , files )
+    chain = data.chain
+    chain = chain.add_new_branch ( 'mmm' , kinematics_tree ( 'mass' , 'mu_plus' , 'mu_minus' ) )
+    assert 'mmm' in chain.branches () , 'Branch is not added!'
+
+    dmax = 0.0
+    for t in chain :
+        v    = ( vector ( t , 'mu_plus' ) + vector ( t , 'mu_minus' ) ).M ()
+        dmax = max ( dmax , abs ( t.mmm - v ) / max ( 1.0 , abs ( v ) ) )
+
+    logger.info ( 'add_new_branch: max difference %.3g' % dmax )
+    assert dmax < 1.e-8 , 'Difference is too large %s' % dmax
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_kinematics_tree       ()
+    test_kinematics_add_branch ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/trees/tests/test_trees_readplan.py
+# Test for read planning (cache/prefetch/pruning) in TTree loops
+# @see Ostap::Utils::ReadPlan
+# Copyright (c) Ostap developers.
+# =============================================================================
+""" Test for read planning (cache/prefetch/pruning) in TTree loops
+- see Ostap::Utils::ReadPlan
+"""
+# =============================================================================
+from   __future__               import print_function
+import ROOT, random
+import ostap.trees.trees
+from   ostap.core.core          import Ostap
+from   ostap.trees.data         import Data
+from   ostap.trees.trees        import io_monitor
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_trees_readplan' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+## create a file with tree
+def create_tree ( fname , nentries = 1000 ) :
+    """Create a file with a tree
+    >>> create_tree ( 'file.root' ,  1000 )
+    """
+
+    import ostap.io.root_file
+
+    from array import array
+    vars = [ array ( 'd', [ 0 ] ) for i in range ( 10 ) ]
+
+    from ostap.core.core import ROOTCWD
+
+    with ROOTCWD() , ROOT.TFile.Open( fname , 'new' ) as root_file:
+        root_file.cd ()
+        tree = ROOT.TTree ( 'S','tree' )
+        tree.SetDirectory ( root_file  )
+        for i , v in enumerate ( vars ) :
+            tree.Branch ( 'v%d' % i , v , 'v%d/D' % i )
+
+        for i in range ( nentries ) :
+            for v in vars : v[0] = random.uniform ( 0 , 10 )
+            tree.Fill()
+
+        root_file.Write()
+
+# =============================================================================
+def prepare_data ( nfiles = 5 ,  nentries = 20000  ) :
+
+    from ostap.utils.cleanup import CleanUp
+    files = [ CleanUp.tempfile ( prefix = 'ostap-test-trees-readplan-%d-' % i ,
+                                 suffix = '.root' ) for i in range ( nfiles)  ]
+
+    for f in files : create_tree ( f , nentries )
+    return files
+
+# =============================================================================
+## compare the results with and without read planning
+def test_readplan () :
+
+    files = prepare_data ( 5 , 20000 )
+    data  = Data ( 'S' , files )
+    chain = data.chain
+
+    with io_monitor ( time = True ) as m :
+        s1 = Ostap.StatVar.statVar ( chain , 'v1+v2' , 'v3>5' )
+
+    logger.info ( m.summary() )
+    assert 1 <= m.stat.loops and 0 < m.stat.bytes , 'No I/O is accounted!'
+
+    old = Ostap.Utils.ReadPlan.setEnabled ( False )
+    s2  = Ostap.StatVar.statVar ( chain , 'v1+v2' , 'v3>5' )
+    Ostap.Utils.ReadPlan.setEnabled ( old )
+
+    assert s1.nEntries () == s2.nEntries () and abs ( s1.mean () - s2.mean () ) <= 1.e-9 * abs ( s2.mean () ) , \
+           'Mismatch with/without read planning: %s vs %s' % ( s1 , s2 )
+
+    ## pruning must restore the branch status
+    chain.SetBranchStatus ( 'v9' , False )
+    sf = Ostap.SFactor.sFactor ( chain , 'v0' )
+    assert     chain.GetBranchStatus ( 'v1' ) , 'Branch status is not restored!'
+    assert not chain.GetBranchStatus ( 'v9' ) , 'Branch status is not restored!'
+    chain.SetBranchStatus ( 'v9' , True )
+
+    logger.info ( 'sFactor for v0: %s' % sf )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_readplan ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
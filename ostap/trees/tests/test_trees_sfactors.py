@@ -0,0 +1,172 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file ostap/trees/tests/test_trees_sfactors.py
+# Test for single-pass (parallel) s-factors for many weights
+# @see Ostap::SFactor::sFactors
+# Copyright (c) Ostap developers.
+# =============================================================================
+""" Test for single-pass (parallel) s-factors for many weights
+- see Ostap::SFactor::sFactors
+"""
+# =============================================================================
+from   __future__               import print_function
+import ROOT, random
+import ostap.trees.trees
+from   ostap.core.core          import Ostap
+from   ostap.trees.data         import Data
+from   ostap.utils.progress_bar import progress_bar
+# =============================================================================
+# logging
+# =============================================================================
+from ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'test_trees_sfactors' )
+else                       : logger = getLogger ( __name__              )
+# =============================================================================
+## create a file with tree
+def create_tree ( fname , nentries = 1000 ) :
+    """Create a file with a tree
+    >>> create_tree ( 'file.root' ,  1000 )
+    """
+
+    import ostap.io.root_file
+
+    from array import array
+    var1 = array ( 'd', [ 0 ] )
+    var2 = array ( 'd', [ 0 ] )
+    var3 = array ( 'd', [ 0 ] )
+
+    from ostap.core.core import ROOTCWD
+
+    with ROOTCWD() , ROOT.TFile.Open( fname , 'new' ) as root_file:
+        root_file.cd ()
+        tree = ROOT.TTree ( 'S','tree' )
+        tree.SetDirectory ( root_file  )
+        tree.Branch ( 'S_sw' , var1 , 'S_sw/D' )
+        tree.Branch ( 'B_sw' , var2 , 'B_sw/D' )
+        tree.Branch ( 'pt'   , var3 , 'pt/D'   )
+
+        for i in range ( nentries ) :
+
+            s = random.gauss   ( 0.7 , 0.5 )
+
+            var1[0] = s
+            var2[0] = 1 - s
+            var3[0] = random.uniform ( 0 , 10 )
+
+            tree.Fill()
+
+        root_file.Write()
+
+# =============================================================================
+def prepare_data ( nfiles = 20 ,  nentries = 20000  ) :
+
+    from ostap.utils.cleanup import CleanUp
+    files = [ CleanUp.tempfile ( prefix = 'ostap-test-trees-sfactors-%d-' % i ,
+                                 suffix = '.root' ) for i in range ( nfiles)  ]
+
+    for f in progress_bar ( files ) : create_tree ( f , nentries )
+    return files
+
+# =============================================================================
+## compare single-pass s-factors with the individual ones
+def test_sfactors () :
+
+    files = prepare_data ( 20 , 20000 )
+    data  = Data ( 'S' , files )
+    chain = data.chain
+
+    logger.info ( '#files:    %s'  % len ( files ) )
+
+    for cuts in ( '' , 'pt>5' ) :
+
+        result = chain.sFactors ( 'S_sw' , 'B_sw' , 'S_sw*B_sw' , cuts = cuts , nthreads = 4 )
+
+        for w in ( 'S_sw' , 'B_sw' , 'S_sw*B_sw' ) :
+
+            sf , neff = result [ w ]
+
+            expr = '(%s)*(%s)' % ( w , cuts ) if cuts else w
+            n2   = Ostap.StatVar.nEff ( chain , expr )
+
+            logger.info ( "sFactor for %-12s %-6s: %s, nEff=%.1f vs %.1f" % ( w , cuts , sf , neff , n2 ) )
+
+            assert abs ( neff - n2 ) <= 1.e-6 * abs ( n2 ) , \
+                   'Mismatch in nEff for %s/%s: %s vs %s' % ( w , cuts , neff , n2 )
+
+        ## compare with the serial s-factor
+        if not cuts :
+            sf0 = Ostap.SFactor.sFactor ( chain , 'S_sw' )
+            sf1 = result [ 'S_sw' ][0]
+            assert abs ( sf0.value () - sf1.value () ) <= 1.e-6 * abs ( sf0.value () ) and \
+                   abs ( sf0.cov2  () - sf1.cov2  () ) <= 1.e-6 * abs ( sf0.cov2  () )  , \
+                   'Mismatch in sFactor: %s vs %s' % ( sf0 , sf1 )
+
+# =============================================================================
+## create a friend file with the weight
+def create_friend ( fname , nentries = 1000 ) :
+    """Create a friend file with the weight
+    >>> create_friend ( 'file.root' ,  1000 )
+    """
+
+    import ostap.io.root_file
+
+    from array import array
+    var = array ( 'd', [ 0 ] )
+
+    from ostap.core.core import ROOTCWD
+
+    with ROOTCWD() , ROOT.TFile.Open( fname , 'new' ) as root_file:
+        root_file.cd ()
+        tree = ROOT.TTree ( 'F','friend' )
+        tree.SetDirectory ( root_file  )
+        tree.Branch ( 'F_sw' , var , 'F_sw/D' )
+
+        for i in range ( nentries ) :
+            var[0] = random.gauss ( 0.5 , 0.5 )
+            tree.Fill()
+
+        root_file.Write()
+
+# =============================================================================
+## s-factors for the weights from the friend tree
+def test_sfactors_friends () :
+
+    nfiles , nentries = 10 , 20000
+    files   = prepare_data ( nfiles , nentries )
+
+    from ostap.utils.cleanup import CleanUp
+    friends = [ CleanUp.tempfile ( prefix = 'ostap-test-trees-sfactors-friend-%d-' % i ,
+                                   suffix = '.root' ) for i in range ( nfiles )  ]
+    for f in friends : create_friend ( f , nentries )
+
+    chain  = Data ( 'S' , files   ).chain
+    fchain = Data ( 'F' , friends ).chain
+    chain.AddFriend ( fchain )
+
+    result = chain.sFactors ( 'F_sw' , 'S_sw*F_sw' , nthreads = 4 )
+    serial = chain.sFactors ( 'F_sw' , 'S_sw*F_sw' , nthreads = 1 )
+
+    for w in ( 'F_sw' , 'S_sw*F_sw' ) :
+
+        sf  , neff  = result [ w ]
+        sf0 , neff0 = serial [ w ]
+        n2          = Ostap.StatVar.nEff ( chain , w )
+
+        logger.info ( "sFactor for friend weight %-12s: %s vs %s, nEff=%.1f vs %.1f" % ( w , sf , sf0 , neff , n2 ) )
+
+        assert abs ( sf0.value () - sf.value () ) <= 1.e-6 * abs ( sf0.value () ) and \
+               abs ( sf0.cov2  () - sf.cov2  () ) <= 1.e-6 * abs ( sf0.cov2  () )  , \
+               'Mismatch in sFactor for friend weight %s: %s vs %s' % ( w , sf0 , sf )
+        assert abs ( neff - n2 ) <= 1.e-6 * abs ( n2 ) , \
+               'Mismatch in nEff for friend weight %s: %s vs %s' % ( w , neff , n2 )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    test_sfactors         ()
+    test_sfactors_friends ()
+
+# =============================================================================
+##                                                                      The END
+# =============================================================================
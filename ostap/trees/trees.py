@@ -17,6 +17,8 @@ __all__     = (
     'Tree'            , ## helper class , needed for multiprocessing
     'ActiveBranches'  , ## context manager to activate certain branches 
     'active_branches' , ## context manager to activate certain branches 
+    'IOMonitor'       , ## context manager to monitor I/O for TTree loops 
+    'io_monitor'      , ## context manager to monitor I/O for TTree loops 
   ) 
 # =============================================================================
 import ROOT, os, math
@@ -1499,20 +1501,29 @@ ROOT.TTree.topdir = property ( top_dir , None , None )
 ## add new branch to the chain
 #  @see Ostap::Trees::add_branch
 #  @see Ostap::IFuncTree   
-def _chain_add_new_branch ( chain , name , function , verbose = True , skip = False ) :
+def _chain_add_new_branch ( chain , name , function , verbose = True , skip = False , checkpoint = '' ) :
     """ Add new branch to the tree
     - see Ostap::Trees::add_branch
     - see Ostap::IFuncTree 
+    - with `checkpoint` the processed files are recorded in the journal
+      and the rerun skips them, see ostap.trees.checkpoint.FileJournal
     """
     assert isinstance ( chain , ROOT.TChain ), 'Invalid chain!'
 
-    names = name
-    if isinstance ( names , string_types )  : names =  [ names ]    
-    for n in names : 
-        assert not n in chain.branches() ,'Branch %s already exists!' % n 
-    
     files = chain.files   ()
     cname = chain.GetName () 
+
+    names = name
+    if isinstance ( names , string_types )  : names =  [ names ]    
+
+    journal = None
+    if checkpoint :
+        from ostap.trees.checkpoint import FileJournal
+        journal = FileJournal ( checkpoint , ( 'add_new_branch' , cname , str ( names ) ) , files )
+
+    if not journal or not journal.processed : 
+        for n in names : 
+            assert not n in chain.branches() ,'Branch %s already exists!' % n 
     
     the_function = function
     if   isinstance ( function , string_types    ) : pass 
@@ -1529,13 +1540,19 @@ def _chain_add_new_branch ( chain , name , function , verbose = True , skip = Fa
     import ostap.io.root_file
     for fname in progress_bar ( files , len ( files ) , silent = not verbose ) :
         
+        if journal and journal.done ( fname ) : continue 
+        
         logger.debug ('Add_new_branch: processing file %s' % fname )
         with ROOT.TFile.Open  ( fname , 'UPDATE' , exception = True ) as rfile :
             ## get the tree 
             ttree = rfile.Get ( cname )
             ## treat the tree 
             add_new_branch    ( ttree , name , the_function , verbose , skip ) 
+
+        if journal : journal.mark ( fname ) 
             
+    if journal : journal.close () 
+    
     ## recollect the chain 
     newc = ROOT.TChain ( cname )
     for f in files : newc.Add ( f  )
@@ -1598,7 +1615,7 @@ def _chain_add_new_branch ( chain , name , function , verbose = True , skip = Fa
 #
 #  @see Ostap::Trees::add_branch
 #  @see Ostap::IFuncTree 
-def add_new_branch ( tree , name , function , verbose = True , skip = False ) :
+def add_new_branch ( tree , name , function , verbose = True , skip = False , checkpoint = '' ) :
     """ Add new branch to the tree
 
     - Using formula:
@@ -1644,13 +1661,17 @@ def add_new_branch ( tree , name , function , verbose = True , skip = False ) :
     
     - ATTENTION: it makes a try to reopen the file with tree in UPDATE mode,
     and it fails when it is not possible!
+
+    - for TChain with `checkpoint` the processed files are recorded in the
+    journal and the rerun (after interruption) skips them:
+    >>> chain.add_new_branch ( 'pt2' , 'pt*pt' , checkpoint = 'pt2.ckpt' ) 
     
     - see Ostap::Trees::add_branch
     - see Ostap::IFuncTree
     
     """
     if isinstance ( tree  , ROOT.TChain ) :
-        return _chain_add_new_branch ( tree , name , function , verbose , skip )
+        return _chain_add_new_branch ( tree , name , function , verbose , skip , checkpoint )
 
     if not tree :
         logger.error (  "Invalid Tree!" )
@@ -1780,6 +1801,42 @@ def _rt_nEff_  ( self , cuts = '' , *args ) :
 
 ROOT.TTree.nEff = _rt_nEff_ 
 # =============================================================================
+## Get s-factors and effective numbers of entries for many weights in one pass
+#  All weights are accumulated in a single (parallel) pass over the tree/chain
+#  @code
+#  chain = ...
+#  result = chain.sFactors ( 'S_sw' , 'B_sw' , cuts = 'pt>1' )
+#  sf , neff = result [ 'S_sw' ]
+#  scale = sf.value() / sf.cov2() ## use in fit!
+#  @endcode
+#  @see Ostap::SFactor::sFactors
+def _rt_sFactors_ ( tree , weight , *weights , **kwargs ) :
+    """Get s-factors and effective numbers of entries for many weights in one pass
+    All weights are accumulated in a single (parallel) pass over the tree/chain
+    >>> chain = ...
+    >>> result = chain.sFactors ( 'S_sw' , 'B_sw' , cuts = 'pt>1' )
+    >>> sf , neff = result [ 'S_sw' ]
+    >>> scale = sf.value() / sf.cov2() ## use in fit!
+    - see Ostap::SFactor::sFactors
+    """
+    cuts     = str ( kwargs.pop ( 'cuts'     , ''                        ) )
+    first    =       kwargs.pop ( 'first'    , 0                         )
+    last     =       kwargs.pop ( 'last'     , Ostap.SFactor.LAST        )
+    nthreads =       kwargs.pop ( 'nthreads' , 0                         )
+    assert not kwargs , 'sFactors: unknown arguments %s' % kwargs.keys() 
+
+    names  = ( weight , ) + weights
+    names  = [ str ( w ) for w in names ]
+    
+    sfs    = Ostap.SFactor.sFactors ( tree , strings ( *names ) , cuts , first , last , nthreads )
+    
+    result = {}
+    for name , sf in zip ( names , sfs ) :
+        result [ name ] = VE ( sf ) , Ostap.SFactor.nEff ( sf )
+    return result 
+
+ROOT.TTree.sFactors = _rt_sFactors_
+# =============================================================================
 
 from  ostap.stats.statvars import data_decorate as _dd
 _dd ( ROOT.TTree )
@@ -1936,6 +1993,76 @@ def active_branches ( tree , *vars ) :
     """
     return ActiveBranches ( tree , *vars ) 
     
+# ===============================================================================
+## @class IOMonitor
+#  Context manager to monitor the I/O for the C++ loops over TTree/TChain
+#  (statistics, projections, s-factors, new branches, selectors, ...)
+#  @code
+#  with IOMonitor ( time = True ) as m :
+#     tree.statVar ( 'pt' , 'eta>2' ) 
+#  print ( m.stat.bytes , m.stat.calls , m.stat.ioTime )  
+#  @endcode
+#  @see Ostap::Utils::ReadPlan
+class IOMonitor(object) :
+    """Context manager to monitor the I/O for the C++ loops over TTree/TChain
+    (statistics, projections, s-factors, new branches, selectors, ...)
+    >>> with IOMonitor ( time = True ) as m :
+    ...     tree.statVar ( 'pt' , 'eta>2' ) 
+    >>> print ( m.stat.bytes , m.stat.calls , m.stat.ioTime )
+    - time   : measure the time spent in reading/unzipping (TTreePerfStats) 
+    - report : report the statistics at exit 
+    - see Ostap.Utils.ReadPlan
+    """
+    def __init__ ( self , time = False , report = True ) :
+        
+        self.__time   = True if time   else False 
+        self.__report = True if report else False
+        self.__stat   = None
+        self.__old    = None 
+        
+    ## context manager: ENTER 
+    def __enter__ ( self ) :
+        Ostap.Utils.ReadPlan.resetTotal ()
+        self.__old  = Ostap.Utils.ReadPlan.setMonitor ( self.__time )
+        self.__stat = None 
+        return self
+    
+    ## context manager: EXIT 
+    def __exit__ ( self , *_ ) :
+        Ostap.Utils.ReadPlan.setMonitor ( self.__old )
+        self.__stat = Ostap.Utils.ReadPlan.total ()
+        if self.__report : logger.info ( self.summary () ) 
+
+    ## the summary 
+    def summary ( self ) :
+        """The summary of I/O statistics"""
+        s = self.stat
+        r  = 'IOMonitor: #loops %d, #entries %d, %.3f MB read in %d calls, time %.3fs' % (
+            s.loops , s.entries , s.bytes / 1024.0 / 1024.0 , s.calls , s.time )
+        if 0 <= s.ioTime  : r += ', reading %.3fs'   % s.ioTime
+        if 0 <= s.zipTime : r += ', unzipping %.3fs' % s.zipTime
+        return r 
+        
+    @property
+    def stat ( self ) :
+        """``stat'' : the I/O statistics (Ostap.Utils.ReadPlan.Statistics) for the completed loops"""
+        return self.__stat if self.__stat else Ostap.Utils.ReadPlan.total ()
+
+# ===============================================================================
+## Context manager to monitor the I/O for the C++ loops over TTree/TChain
+#  @code
+#  with io_monitor ( time = True ) as m :
+#     tree.statVar ( 'pt' , 'eta>2' ) 
+#  @endcode
+#  @see Ostap::Utils::ReadPlan
+def io_monitor ( time = False , report = True ) :
+    """Context manager to monitor the I/O for the C++ loops over TTree/TChain
+    >>> with io_monitor ( time = True ) as m :
+    ...     tree.statVar ( 'pt' , 'eta>2' ) 
+    - see Ostap.Utils.ReadPlan
+    """
+    return IOMonitor ( time = time , report = report ) 
+
 
 # =============================================================================
 ## files and utilisties for TTree/TChain "serialization"
@@ -2525,6 +2652,7 @@ _new_methods_       = (
     ROOT.TTree.slices       ,
     #
     ROOT.TTree.nEff             , 
+    ROOT.TTree.sFactors         , 
     ROOT.TTree.get_moment       , 
     ROOT.TTree.central_moment   , 
     ROOT.TTree.mean             ,
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# =============================================================================
+# @file
+# Access to the hot-path instrumentation of the C++ core:
+# counters and timers for PDFs, integrators, formulae and event loops
+# @see Ostap::Utils::Instrumentation
+# =============================================================================
+"""Access to the hot-path instrumentation of the C++ core:
+counters and timers for PDFs, integrators, formulae and event loops
+- see Ostap::Utils::Instrumentation
+"""
+# =============================================================================
+__all__     = (
+    'enabled'         , ## is instrumentation enabled?
+    'enable'          , ## enable/disable instrumentation
+    'snapshot'        , ## get the snapshot of all counters and timers
+    'reset'           , ## reset all counters and timers
+    'Instrumentation' , ## context manager to collect the counters
+    'instrumentation' , ## context manager to collect the counters
+   )
+# =============================================================================
+from   ostap.core.core     import Ostap
+from   ostap.logger.logger import getLogger
+if '__main__' ==  __name__ : logger = getLogger ( 'ostap.utils.instrumentation' )
+else                       : logger = getLogger ( __name__                      )
+del getLogger
+# =============================================================================
+_I = Ostap.Utils.Instrumentation
+# =============================================================================
+## is instrumentation enabled?
+def enabled () :
+    """Is instrumentation enabled?"""
+    return _I.enabled ()
+
+# =============================================================================
+## enable/disable the instrumentation, return the previous state
+def enable ( value = True ) :
+    """Enable/disable the instrumentation, return the previous state"""
+    return _I.setEnabled ( True if value else False )
+
+# =============================================================================
+## get the snapshot of all counters and timers as dictionary
+#  @code
+#  for name , ( count , items , time ) in snapshot().items() : ...
+#  @endcode
+def snapshot ( all = False ) :
+    """Get the snapshot of all counters and timers as dictionary
+    >>> for name , ( count , items , time ) in snapshot().items() : ...
+    - for counters `items` and `time` are `None`
+    """
+    result = {}
+    for r in _I.snapshot ( all ) :
+        name = str ( r.name )
+        if r.timer : result [ name ] = int ( r.count ) , int ( r.items ) , float ( r.time )
+        else       : result [ name ] = int ( r.count ) , None            , None
+    return result
+
+# =============================================================================
+## reset all counters and timers
+def reset () :
+    """Reset all counters and timers"""
+    _I.reset ()
+
+# =============================================================================
+## format the snapshot as table
+def table ( data , title = 'Instrumentation' , prefix = '' ) :
+    """Format the snapshot as table"""
+    rows = [ ( 'Name' , 'Counts/calls' , 'Items' , 'Time [s]' , 'Time/call [us]' ) ]
+    for name in sorted ( data ) :
+        count , items , time = data [ name ]
+        if time is None : row = name , '%d' % count , '' , '' , ''
+        else            : row = name , '%d' % count , '%d' % items , '%.4f' % time , \
+            '%.3f' % ( 1.e+6 * time / count ) if count else ''
+        rows.append ( row )
+    import ostap.logger.table as T
+    return T.table ( rows , title = title , prefix = prefix , alignment = 'lrrrr' )
+
+# =============================================================================
+## @class Instrumentation
+#  Context manager to collect the counters and timers of the C++ core
+#  @code
+#  with Instrumentation () as i :
+#     pdf.fitTo ( dataset )
+#  print ( i.data )
+#  @endcode
+class Instrumentation(object) :
+    """Context manager to collect the counters and timers of the C++ core
+    >>> with Instrumentation () as i :
+    ...    pdf.fitTo ( dataset )
+    >>> print ( i.data )
+    - the counters are reset at enter, the summary table is printed at exit
+    """
+    def __init__ ( self , report = True , title = 'Instrumentation' ) :
+        self.__report = True if report else False
+        self.__title  = title
+        self.__data   = {}
+        self.__old    = None
+
+    def __enter__ ( self ) :
+        reset ()
+        self.__old  = enable ( True )
+        self.__data = {}
+        return self
+
+    def __exit__  ( self , *_ ) :
+        enable ( self.__old )
+        self.__data = snapshot ()
+        if self.__report :
+            logger.info ( '%s:\n%s' % ( self.__title , table ( self.__data , title = self.__title ) ) )
+
+    @property
+    def data ( self ) :
+        """``data'' : collected counters and timers: { name : ( counts , items , time ) }"""
+        return self.__data
+
+# =============================================================================
+## Context manager to collect the counters and timers of the C++ core
+#  @code
+#  with instrumentation () :
+#     pdf.fitTo ( dataset )
+#  @endcode
+def instrumentation ( report = True , title = 'Instrumentation' ) :
+    """Context manager to collect the counters and timers of the C++ core
+    >>> with instrumentation () :
+    ...    pdf.fitTo ( dataset )
+    """
+    return Instrumentation ( report = report , title = title )
+
+# =============================================================================
+if '__main__' == __name__ :
+
+    from ostap.utils.docme import docme
+    docme ( __name__ , logger = logger )
+
+# =============================================================================
+# The END
+# =============================================================================
@@ -1,10 +1,12 @@
 #---Create a shared library 
 add_library(ostap SHARED src/format.cpp
                          src/gauss.cpp
+                         src/AdaptiveChebyshev.cpp
                          src/AddBranch.cpp
                          src/AddVars.cpp
                          src/BLOB.cpp
                          src/BSpline.cpp
+                         src/BasisCache.cpp
                          src/Bernstein.cpp
                          src/Bernstein1D.cpp
                          src/Bernstein2D.cpp
@@ -17,12 +19,14 @@ add_library(ostap SHARED src/format.cpp
                          src/Chi2Fit.cpp
                          src/Dalitz.cpp
                          src/DalitzIntegrator.cpp
+                         src/DalitzNormalization.cpp
                          src/DataFrameActions.cpp
                          src/DataFrameUtils.cpp
                          src/EigenSystem.cpp   
                          src/Error2Exception.cpp   
                          src/Exception.cpp
                          src/Faddeeva.cpp 
+                         src/FFTConvolution.cpp
                          src/Formula.cpp   
                          src/FormulaVar.cpp   
                          src/Fourier.cpp   
@@ -33,18 +37,23 @@ add_library(ostap SHARED src/format.cpp
                          src/GSL_utils.cpp 
                          src/Hesse.cpp
                          src/HistoDump.cpp
+                         src/HistoFill.cpp
                          src/HistoHash.cpp
                          src/HistoInterpolation.cpp
                          src/HistoInterpolators.cpp
+                         src/HistoMemo.cpp
                          src/HistoMake.cpp
                          src/HistoProject.cpp
                          src/HistoStat.cpp
                          src/IFuncs.cpp
+                         src/Instrumentation.cpp
                          src/Integrator.cpp
                          src/Interpolation.cpp
                          src/Iterator.cpp
                          src/Kinematics.cpp
+                         src/KinematicsBatch.cpp
                          src/KramersKronig.cpp
+                         src/LazyFrame.cpp
                          src/Lomont.cpp
                          src/LorentzVectorWithError.cpp
                          src/Math.cpp
@@ -53,6 +62,7 @@ add_library(ostap SHARED src/format.cpp
                          src/Models2D.cpp
                          src/Moments.cpp
                          src/MoreMath.cpp
+                         src/MoreMathBatch.cpp
                          src/MoreRooFit.cpp
                          src/MoreVars.cpp
                          src/Mute.cpp
@@ -82,18 +92,23 @@ add_library(ostap SHARED src/format.cpp
                          src/PySelector.cpp
                          src/PySelectorWithCuts.cpp
                          src/PyVar.cpp   
+                         src/ReadPlan.cpp
                          src/RootID.cpp
                          src/SFactor.cpp
                          src/StatEntity.cpp
                          src/StatVar.cpp
                          src/StatusCode.cpp
+                         src/TabulatedFunction.cpp
                          src/Tee.cpp
                          src/Tensors.cpp
+                         src/ThreadPool.cpp
                          src/Topics.cpp
+                         src/ToyRunner.cpp
                          src/Tmva.cpp
                          src/UStat.cpp
                          src/Valid.cpp
                          src/ValueWithError.cpp
+                         src/ValuesWithErrors.cpp
                          src/Vector3DWithError.cpp
                          src/Voigt.cpp
                          src/Workspace.cpp    
@@ -121,3 +136,34 @@ target_compile_features ( ostap PUBLIC cxx_right_angle_brackets           )
 target_compile_features ( ostap PUBLIC cxx_nullptr                        )
 target_compile_features ( ostap PUBLIC cxx_auto_type                      )
 target_compile_features ( ostap PUBLIC cxx_aggregate_default_initializers )
+
+## the vectorized kernels for the batch special functions: no errno, no FP traps
+if ( CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" )
+  set_source_files_properties ( src/MoreMathBatch.cpp PROPERTIES COMPILE_OPTIONS "-O3;-fno-math-errno;-fno-trapping-math" )
+endif()
+
+## the batch histogram filler: no FP traps, otherwise the bin-index loop is not vectorized
+if ( CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" )
+  set_source_files_properties ( src/HistoFill.cpp     PROPERTIES COMPILE_OPTIONS "-O3;-fno-trapping-math" )
+endif()
+
+## micro-benchmarks for the C++ kernels: cmake -DOSTAP_BENCH=ON ... ; make ostap_bench 
+option ( OSTAP_BENCH "Build ostap_bench micro-benchmarks" OFF )
+if ( OSTAP_BENCH ) 
+  add_executable             ( ostap_bench bench/ostap_bench.cpp
+                                           bench/Bench.cpp
+                                           bench/BenchData.cpp
+                                           bench/BenchMath.cpp
+                                           bench/BenchRooFit.cpp )
+  target_link_libraries      ( ostap_bench ostap )
+  target_compile_features    ( ostap_bench PRIVATE cxx_lambdas cxx_range_for cxx_auto_type ) 
+  install ( TARGETS ostap_bench RUNTIME DESTINATION bin )
+  ## smoke test: the quick run with the minimal statistics 
+  add_test ( NAME ostap-bench-quick 
+             COMMAND ostap_bench --quick --min-time=0.001 --repetitions=1 --format=json )
+  ## accuracy sweep for the batch special functions 
+  add_executable             ( ostap_accuracy bench/ostap_accuracy.cpp )
+  target_link_libraries      ( ostap_accuracy ostap )
+  install ( TARGETS ostap_accuracy RUNTIME DESTINATION bin )
+  add_test ( NAME ostap-accuracy COMMAND ostap_accuracy --points=10000 )
+endif() 
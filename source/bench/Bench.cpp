@@ -0,0 +1,377 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Bench.h"
+// ============================================================================
+/** @file Bench.cpp
+ *  Simple framework for micro-benchmarks of Ostap kernels
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the sink
+  volatile double s_sink = 0 ;
+  // ==========================================================================
+  typedef std::chrono::steady_clock Clock ;
+  // ==========================================================================
+  /// time n operations (in seconds)
+  double timeit ( const Ostap::Bench::Operation& op , const std::size_t n )
+  {
+    const auto start = Clock::now () ;
+    for ( std::size_t i = 0 ; i < n ; ++i ) { op () ; }
+    const auto stop  = Clock::now () ;
+    return std::chrono::duration<double> ( stop - start ).count () ;
+  }
+  // ==========================================================================
+  /// make the unique key
+  std::string make_key ( const std::string&  name    ,
+                         const std::string&  params  ,
+                         const unsigned int  threads )
+  { return name + "/" + params + "/threads=" + std::to_string ( threads ) ; }
+  // ==========================================================================
+  /// escape the string for JSON/CSV
+  std::string quoted ( const std::string& s )
+  {
+    std::string r = "\"" ;
+    for ( const char c : s )
+    {
+      if ( '"' == c || '\\' == c ) { r += '\\' ; }
+      r += c ;
+    }
+    return r + "\"" ;
+  }
+  // ==========================================================================
+  /// get the (quoted or numeric) value for the key from JSON line
+  bool json_value ( const std::string& line  ,
+                    const std::string& key   ,
+                    std::string&       value )
+  {
+    const std::string k = "\"" + key + "\"" ;
+    std::size_t pos = line.find ( k ) ;
+    if ( std::string::npos == pos ) { return false ; }
+    pos = line.find ( ':' , pos + k.size () ) ;
+    if ( std::string::npos == pos ) { return false ; }
+    pos = line.find_first_not_of ( " \t" , pos + 1 ) ;
+    if ( std::string::npos == pos ) { return false ; }
+    value.clear () ;
+    if ( '"' == line [ pos ] )
+    {
+      for ( std::size_t i = pos + 1 ; i < line.size () ; ++i )
+      {
+        if      ( '\\' == line [ i ] && i + 1 < line.size () ) { value += line [ ++i ] ; }
+        else if ( '"'  == line [ i ] ) { return true ; }
+        else    { value += line [ i ] ; }
+      }
+      return false ;
+    }
+    const std::size_t end = line.find_first_of ( ",} \t" , pos ) ;
+    value = line.substr ( pos , std::string::npos == end ? end : end - pos ) ;
+    return !value.empty () ;
+  }
+  // ==========================================================================
+  /// split CSV line
+  std::vector<std::string> csv_split ( const std::string& line )
+  {
+    std::vector<std::string> result ;
+    std::string current ;
+    bool        inquote = false ;
+    for ( std::size_t i = 0 ; i < line.size () ; ++i )
+    {
+      const char c = line [ i ] ;
+      if      ( inquote && '\\' == c && i + 1 < line.size () ) { current += line [ ++i ] ; }
+      else if ( '"' == c  ) { inquote = !inquote ; }
+      else if ( ',' == c && !inquote ) { result.push_back ( current ) ; current.clear () ; }
+      else    { current += c ; }
+    }
+    result.push_back ( current ) ;
+    return result ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// the unique key
+// ============================================================================
+std::string Ostap::Bench::Case::key   () const
+{ return make_key ( name , params , threads ) ; }
+// ============================================================================
+// the unique key
+// ============================================================================
+std::string Ostap::Bench::Result::key () const
+{ return make_key ( name , params , threads ) ; }
+// ============================================================================
+// the only one instance
+// ============================================================================
+Ostap::Bench::Registry& Ostap::Bench::Registry::instance ()
+{
+  static Registry s_registry ;
+  return s_registry ;
+}
+// ============================================================================
+// add the case
+// ============================================================================
+void Ostap::Bench::Registry::add
+( const std::string&    name    ,
+  const std::string&    params  ,
+  const std::size_t     items   ,
+  Ostap::Bench::Factory factory ,
+  const bool            quick   ,
+  const unsigned int    threads )
+{
+  Case c ;
+  c.name    = name    ;
+  c.params  = params  ;
+  c.threads = std::max ( threads , 1u ) ;
+  c.items   = std::max ( items   , std::size_t ( 1 ) ) ;
+  c.quick   = quick   ;
+  c.factory = factory ;
+  m_cases.push_back ( c ) ;
+}
+// ============================================================================
+// prevent the optimizer to remove the calculations
+// ============================================================================
+void Ostap::Bench::sink ( const double value ) { s_sink = s_sink + value ; }
+// ============================================================================
+// thread counts used for the multi-threaded kernels
+// ============================================================================
+std::vector<unsigned int> Ostap::Bench::thread_counts ()
+{
+  const unsigned int hw = std::max ( std::thread::hardware_concurrency () , 1u ) ;
+  std::vector<unsigned int> result { 1 } ;
+  for ( unsigned int n = 2 ; n < hw ; n *= 2 ) { result.push_back ( n ) ; }
+  if ( 1 < hw ) { result.push_back ( hw ) ; }
+  return result ;
+}
+// ============================================================================
+// run the selected cases
+// ============================================================================
+std::vector<Ostap::Bench::Result>
+Ostap::Bench::run ( const Ostap::Bench::Config& config )
+{
+  std::vector<Result> results ;
+  //
+  const unsigned int nthreads = Ostap::Utils::ThreadPool::nThreads () ;
+  //
+  for ( const Case& c : Registry::instance().cases () )
+  {
+    if ( config.quick && !c.quick ) { continue ; }
+    const std::string key = c.key () ;
+    if ( !config.filter.empty () && std::string::npos == key.find ( config.filter ) ) { continue ; }
+    //
+    Ostap::Utils::ThreadPool::setNThreads ( c.threads ) ;
+    //
+    const Operation op = c.factory () ;
+    op () ;                                                    // warm-up
+    //
+    // calibrate number of iterations
+    std::size_t n = 1 ;
+    double      t = timeit ( op , n ) ;
+    while ( t < 0.1 * config.min_time && n < ( std::size_t ( 1 ) << 40 ) )
+    {
+      n = std::size_t ( n * ( t <= 0 ? 100.0 : std::max ( 2.0 , std::min ( 100.0 , 0.2 * config.min_time / t ) ) ) ) ;
+      t  = timeit ( op , n ) ;
+    }
+    n = std::max ( std::size_t ( 1 ) ,
+                   std::size_t ( n * config.min_time / std::max ( t , 1.e-9 ) ) ) ;
+    //
+    std::vector<double> times ;
+    for ( unsigned int r = 0 ; r < std::max ( config.repetitions , 1u ) ; ++r )
+    { times.push_back ( timeit ( op , n ) * 1.e+9 / n ) ; }
+    std::sort ( times.begin () , times.end () ) ;
+    //
+    Result result ;
+    result.name       = c.name    ;
+    result.params     = c.params  ;
+    result.threads    = c.threads ;
+    result.items      = c.items   ;
+    result.iterations = n         ;
+    result.ns_per_op  = times [ times.size () / 2 ] ;
+    result.ns_min     = times.front () ;
+    results.push_back ( result ) ;
+    //
+    std::cerr << "ostap_bench: " << std::left << std::setw ( 70 ) << key
+              << std::right << std::setw ( 14 ) << std::setprecision ( 6 )
+              << result.ns_per_op << " ns/op" << std::endl ;
+  }
+  //
+  Ostap::Utils::ThreadPool::setNThreads ( nthreads ) ;
+  return results ;
+}
+// ============================================================================
+// write results as JSON
+// ============================================================================
+void Ostap::Bench::write_json
+( std::ostream&                            stream  ,
+  const std::vector<Ostap::Bench::Result>& results )
+{
+  stream << "{\n  \"ostap_bench\" : 1 ,\n  \"results\" : [\n" ;
+  for ( std::size_t i = 0 ; i < results.size () ; ++i )
+  {
+    const Result& r = results [ i ] ;
+    stream << "    { \"name\" : "        << quoted ( r.name   )
+           << " , \"params\" : "         << quoted ( r.params )
+           << " , \"threads\" : "        << r.threads
+           << " , \"items\" : "          << r.items
+           << " , \"iterations\" : "     << r.iterations
+           << std::setprecision ( 10 )
+           << " , \"ns_per_op\" : "      << r.ns_per_op
+           << " , \"ns_min\" : "         << r.ns_min
+           << " , \"ns_per_item\" : "    << r.ns_per_item ()
+           << " }" << ( i + 1 < results.size () ? " ,\n" : "\n" ) ;
+  }
+  stream << "  ]\n}\n" ;
+}
+// ============================================================================
+// write results as CSV
+// ============================================================================
+void Ostap::Bench::write_csv
+( std::ostream&                            stream  ,
+  const std::vector<Ostap::Bench::Result>& results )
+{
+  stream << "name,params,threads,items,iterations,ns_per_op,ns_min,ns_per_item\n" ;
+  for ( const Result& r : results )
+  {
+    stream << quoted ( r.name   ) << ','
+           << quoted ( r.params ) << ','
+           << r.threads           << ','
+           << r.items             << ','
+           << r.iterations        << ','
+           << std::setprecision ( 10 )
+           << r.ns_per_op         << ','
+           << r.ns_min            << ','
+           << r.ns_per_item ()    << '\n' ;
+  }
+}
+// ============================================================================
+// write results as text table
+// ============================================================================
+void Ostap::Bench::write_text
+( std::ostream&                            stream  ,
+  const std::vector<Ostap::Bench::Result>& results )
+{
+  stream << std::left  << std::setw ( 70 ) << "# benchmark"
+         << std::right << std::setw ( 14 ) << "ns/op"
+         << std::right << std::setw ( 14 ) << "ns/item"
+         << std::right << std::setw ( 12 ) << "iterations" << '\n' ;
+  for ( const Result& r : results )
+  {
+    stream << std::left  << std::setw ( 70 ) << r.key ()
+           << std::right << std::setw ( 14 ) << std::setprecision ( 6 ) << r.ns_per_op
+           << std::right << std::setw ( 14 ) << std::setprecision ( 6 ) << r.ns_per_item ()
+           << std::right << std::setw ( 12 ) << r.iterations << '\n' ;
+  }
+}
+// ============================================================================
+// read the baseline (JSON or CSV file, produced by ostap_bench)
+// ============================================================================
+std::vector<Ostap::Bench::Result>
+Ostap::Bench::read_baseline ( const std::string& fname )
+{
+  std::vector<Result> results ;
+  std::ifstream input ( fname ) ;
+  if ( !input ) { return results ; }
+  //
+  std::string line ;
+  std::vector<std::string> header ;
+  while ( std::getline ( input , line ) )
+  {
+    if ( line.empty () ) { continue ; }
+    // JSON: one result per line
+    if ( std::string::npos != line.find ( "\"ns_per_op\"" ) &&
+         std::string::npos != line.find ( '{' ) )
+    {
+      Result r ;
+      std::string value ;
+      if ( !json_value ( line , "name"      , r.name   ) ) { continue ; }
+      json_value ( line , "params" , r.params ) ;
+      if ( json_value ( line , "threads"    , value ) ) { r.threads    = std::stoul ( value ) ; }
+      if ( json_value ( line , "items"      , value ) ) { r.items      = std::stoul ( value ) ; }
+      if ( json_value ( line , "iterations" , value ) ) { r.iterations = std::stoul ( value ) ; }
+      if ( json_value ( line , "ns_min"     , value ) ) { r.ns_min     = std::stod  ( value ) ; }
+      if ( json_value ( line , "ns_per_op"  , value ) ) { r.ns_per_op  = std::stod  ( value ) ; }
+      results.push_back ( r ) ;
+      continue ;
+    }
+    // CSV: the first line is the header
+    const std::vector<std::string> fields = csv_split ( line ) ;
+    if ( header.empty () ) { header = fields ; continue ; }
+    Result r ;
+    for ( std::size_t i = 0 ; i < fields.size () && i < header.size () ; ++i )
+    {
+      const std::string& h = header [ i ] ;
+      const std::string& v = fields [ i ] ;
+      if      ( "name"       == h ) { r.name       = v ; }
+      else if ( "params"     == h ) { r.params     = v ; }
+      else if ( "threads"    == h ) { r.threads    = std::stoul ( v ) ; }
+      else if ( "items"      == h ) { r.items      = std::stoul ( v ) ; }
+      else if ( "iterations" == h ) { r.iterations = std::stoul ( v ) ; }
+      else if ( "ns_per_op"  == h ) { r.ns_per_op  = std::stod  ( v ) ; }
+      else if ( "ns_min"     == h ) { r.ns_min     = std::stod  ( v ) ; }
+    }
+    if ( !r.name.empty () ) { results.push_back ( r ) ; }
+  }
+  return results ;
+}
+// ============================================================================
+/* compare the results with the baseline
+ *  @param stream    the output stream for the report
+ *  @param results   the current results
+ *  @param baseline  the baseline results
+ *  @param threshold the allowed relative slowdown
+ *  @return number of regressions
+ */
+// ============================================================================
+std::size_t Ostap::Bench::compare
+( std::ostream&                            stream    ,
+  const std::vector<Ostap::Bench::Result>& results   ,
+  const std::vector<Ostap::Bench::Result>& baseline  ,
+  const double                             threshold )
+{
+  std::map<std::string,const Result*> base ;
+  for ( const Result& r : baseline ) { base [ r.key () ] = &r ; }
+  //
+  std::size_t regressions = 0 ;
+  stream << std::left  << std::setw ( 70 ) << "# benchmark"
+         << std::right << std::setw ( 14 ) << "baseline"
+         << std::right << std::setw ( 14 ) << "current"
+         << std::right << std::setw ( 10 ) << "ratio" << '\n' ;
+  for ( const Result& r : results )
+  {
+    auto it = base.find ( r.key () ) ;
+    if ( base.end () == it || it->second->ns_per_op <= 0 ) { continue ; }
+    //
+    const double ratio = r.ns_per_op / it->second->ns_per_op ;
+    const bool   bad   = 1 + threshold < ratio ;
+    if ( bad ) { ++regressions ; }
+    //
+    stream << std::left  << std::setw ( 70 ) << r.key ()
+           << std::right << std::setw ( 14 ) << std::setprecision ( 6 ) << it->second->ns_per_op
+           << std::right << std::setw ( 14 ) << std::setprecision ( 6 ) << r.ns_per_op
+           << std::right << std::setw ( 10 ) << std::setprecision ( 3 ) << ratio
+           << ( bad ? "  REGRESSION" : "" ) << '\n' ;
+  }
+  return regressions ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,174 @@
+// ============================================================================
+#ifndef OSTAP_BENCH_H
+#define OSTAP_BENCH_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+// ============================================================================
+/** @file Bench.h
+ *  Simple framework for micro-benchmarks of Ostap kernels
+ *  @see ostap_bench.cpp
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Bench
+  {
+    // ========================================================================
+    /// one operation to be timed
+    typedef std::function<void()>          Operation ;
+    /// the factory of operation: prepare all data and return the operation
+    typedef std::function<Operation()>     Factory   ;
+    // ========================================================================
+    /** @struct Case
+     *  the benchmark case: the kernel with certain parameters
+     */
+    struct Case
+    {
+      /// the name of the kernel, e.g. "Bernstein::evaluate"
+      std::string  name    {} ;
+      /// the parameters, e.g. "N=10"
+      std::string  params  {} ;
+      /// number of threads to be used
+      unsigned int threads { 1 } ;
+      /// number of items processed by one operation
+      std::size_t  items   { 1 } ;
+      /// include it into the quick run?
+      bool         quick   { false } ;
+      /// the factory
+      Factory      factory {} ;
+      /// the unique key
+      std::string  key () const ;
+    } ;
+    // ========================================================================
+    /** @struct Result
+     *  the benchmark result
+     */
+    struct Result
+    {
+      /// the name of the kernel
+      std::string  name        {} ;
+      /// the parameters
+      std::string  params      {} ;
+      /// number of threads
+      unsigned int threads     { 1 } ;
+      /// number of items per operation
+      std::size_t  items       { 1 } ;
+      /// number of iterations in each repetition
+      std::size_t  iterations  { 0 } ;
+      /// median time per operation in nanoseconds
+      double       ns_per_op   { 0 } ;
+      /// the minimal time per operation in nanoseconds
+      double       ns_min      { 0 } ;
+      /// the unique key
+      std::string  key () const ;
+      /// median time per item in nanoseconds
+      double       ns_per_item () const { return ns_per_op / items ; }
+    } ;
+    // ========================================================================
+    /** @class Registry
+     *  the list of all known benchmark cases
+     */
+    class Registry
+    {
+    public:
+      // ======================================================================
+      /// the only one instance
+      static Registry& instance () ;
+      /// add the case
+      void add ( const std::string& name    ,
+                 const std::string& params  ,
+                 const std::size_t  items   ,
+                 Factory            factory ,
+                 const bool         quick   = false ,
+                 const unsigned int threads = 1     ) ;
+      /// all cases
+      const std::vector<Case>& cases () const { return m_cases ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      Registry () = default ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// all cases
+      std::vector<Case> m_cases {} ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @struct Register
+     *  helper to register the benchmark cases at static initialization
+     */
+    struct Register
+    {
+      Register ( std::function<void(Registry&)> fill )
+      { fill ( Registry::instance () ) ; }
+    } ;
+    // ========================================================================
+    /// prevent the optimizer to remove the calculations
+    void sink ( const double value ) ;
+    // ========================================================================
+    /// thread counts used for the multi-threaded kernels
+    std::vector<unsigned int> thread_counts () ;
+    // ========================================================================
+    /** @struct Config
+     *  configuration of the benchmark run
+     */
+    struct Config
+    {
+      /// the minimal time for each repetition (in seconds)
+      double       min_time    { 0.2   } ;
+      /// number of repetitions
+      unsigned int repetitions { 5     } ;
+      /// quick run ?
+      bool         quick       { false } ;
+      /// select only the cases with the key containing the substring
+      std::string  filter      {}        ;
+    } ;
+    // ========================================================================
+    /// run the selected cases
+    std::vector<Result> run ( const Config& config ) ;
+    // ========================================================================
+    /// write results as JSON
+    void write_json ( std::ostream& stream , const std::vector<Result>& results ) ;
+    /// write results as CSV
+    void write_csv  ( std::ostream& stream , const std::vector<Result>& results ) ;
+    /// write results as text table
+    void write_text ( std::ostream& stream , const std::vector<Result>& results ) ;
+    // ========================================================================
+    /** read the baseline (JSON or CSV file, produced by ostap_bench)
+     *  @return the results from the baseline
+     */
+    std::vector<Result> read_baseline ( const std::string& fname ) ;
+    // ========================================================================
+    /** compare the results with the baseline
+     *  @param stream    the output stream for the report
+     *  @param results   the current results
+     *  @param baseline  the baseline results
+     *  @param threshold the allowed relative slowdown
+     *  @return number of regressions
+     */
+    std::size_t compare
+    ( std::ostream&              stream    ,
+      const std::vector<Result>& results   ,
+      const std::vector<Result>& baseline  ,
+      const double               threshold ) ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Bench
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_BENCH_H
+// ============================================================================
@@ -0,0 +1,298 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TTree.h"
+#include "RooRealVar.h"
+#include "RooArgSet.h"
+#include "RooDataSet.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/StatEntity.h"
+#include "Ostap/Formula.h"
+#include "Ostap/HistoFill.h"
+#include "Ostap/HistoHash.h"
+#include "Ostap/HistoMemo.h"
+#include "Ostap/Instrumentation.h"
+#include "Ostap/StatVar.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Bench.h"
+// ============================================================================
+/** @file BenchData.cpp
+ *  micro-benchmarks for Ostap kernels that deal with the data
+ *  All data (TTree, RooDataSet) are synthetic and kept in memory
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Bench::Registry  Registry  ;
+  typedef Ostap::Bench::Operation Operation ;
+  // ==========================================================================
+  /// the memory-resident tree with three gaussian branches x, y and z
+  std::shared_ptr<TTree> make_tree ( const std::size_t nentries )
+  {
+    auto tree = std::make_shared<TTree> ( "bench_tree" , "synthetic tree for ostap_bench" ) ;
+    tree->SetDirectory ( nullptr ) ;
+    double x , y , z ;
+    tree->Branch ( "x" , &x , "x/D" ) ;
+    tree->Branch ( "y" , &y , "y/D" ) ;
+    tree->Branch ( "z" , &z , "z/D" ) ;
+    std::mt19937                     gen   ( 12345 ) ;
+    std::normal_distribution<double> gauss ( 0 , 1 ) ;
+    for ( std::size_t i = 0 ; i < nentries ; ++i )
+    {
+      x = gauss ( gen ) ;
+      y = gauss ( gen ) ;
+      z = gauss ( gen ) ;
+      tree->Fill () ;
+    }
+    tree->ResetBranchAddresses () ;
+    return tree ;
+  }
+  // ==========================================================================
+  /// the memory-resident dataset with two gaussian variables x and y
+  std::shared_ptr<RooDataSet> make_data ( const std::size_t nentries )
+  {
+    RooRealVar x ( "x" , "x" , -10 , 10 ) ;
+    RooRealVar y ( "y" , "y" , -10 , 10 ) ;
+    const RooArgSet vars ( x , y ) ;
+    auto data = std::make_shared<RooDataSet> ( "bench_data" , "synthetic dataset for ostap_bench" , vars ) ;
+    std::mt19937                     gen   ( 12345 ) ;
+    std::normal_distribution<double> gauss ( 0 , 1 ) ;
+    for ( std::size_t i = 0 ; i < nentries ; ++i )
+    {
+      x.setVal ( gauss ( gen ) ) ;
+      y.setVal ( gauss ( gen ) ) ;
+      data->add ( vars ) ;
+    }
+    return data ;
+  }
+  // ==========================================================================
+  const Ostap::Bench::Register s_statentity ( [] ( Registry& r )
+  {
+    const std::size_t N = 10000 ;
+    r.add ( "StatEntity::add" , "N=" + std::to_string ( N ) , N ,
+            [N] () -> Operation
+            {
+              std::mt19937                     gen   ( 12345 ) ;
+              std::normal_distribution<double> gauss ( 0 , 1 ) ;
+              auto x = std::make_shared<std::vector<double> > ( N ) ;
+              for ( auto& v : *x ) { v = gauss ( gen ) ; }
+              return [x] ()
+              {
+                Ostap::StatEntity cnt ;
+                for ( const double v : *x ) { cnt.add ( v ) ; }
+                Ostap::Bench::sink ( cnt.mean () ) ;
+              } ;
+            } , true ) ;
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_formula ( [] ( Registry& r )
+  {
+    const std::vector<std::pair<std::string,std::string> > expressions {
+      { "simple"  , "x+y"                              } ,
+      { "complex" , "sqrt(x*x+y*y)*exp(-0.5*z*z)+sin(x)" } } ;
+    for ( const std::size_t N : { 10000 , 100000 } )
+    {
+      for ( const auto& e : expressions )
+      {
+        const std::string expression = e.second ;
+        r.add ( "Formula::evaluate" ,
+                "entries=" + std::to_string ( N ) + ",expr=" + e.first , N ,
+                [N,expression] () -> Operation
+                {
+                  auto tree    = make_tree ( N ) ;
+                  auto formula = std::make_shared<Ostap::Formula> ( "bench_formula" , expression , tree.get () ) ;
+                  return [tree,formula] ()
+                  {
+                    double s = 0 ;
+                    const Long64_t nentries = tree->GetEntries () ;
+                    for ( Long64_t i = 0 ; i < nentries ; ++i )
+                    {
+                      tree->LoadTree ( i ) ;
+                      s += formula->evaluate () ;
+                    }
+                    Ostap::Bench::sink ( s ) ;
+                  } ;
+                } , 10000 == N ) ;
+      }
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_statvar ( [] ( Registry& r )
+  {
+    for ( const std::size_t N : { 10000 , 100000 } )
+    {
+      r.add ( "StatVar::statVar" , "TTree,entries=" + std::to_string ( N ) , N ,
+              [N] () -> Operation
+              {
+                auto tree = make_tree ( N ) ;
+                return [tree] ()
+                { Ostap::Bench::sink ( Ostap::StatVar::statVar ( tree.get () , "x*y+z" ).mean () ) ; } ;
+              } , 10000 == N ) ;
+      r.add ( "StatVar::statVar" , "RooDataSet,entries=" + std::to_string ( N ) , N ,
+              [N] () -> Operation
+              {
+                auto data = make_data ( N ) ;
+                return [data] ()
+                { Ostap::Bench::sink ( Ostap::StatVar::statVar ( data.get () , "x*y" ).mean () ) ; } ;
+              } , 10000 == N ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /** the overhead of the instrumentation probes:
+   *  the disabled probe must be negligible with respect to "Formula::evaluate"
+   */
+  const Ostap::Bench::Register s_instrumentation ( [] ( Registry& r )
+  {
+    const std::size_t N = 100000 ;
+    for ( const bool on : { false , true } )
+    {
+      r.add ( "Instrumentation::Counter::add" ,
+              std::string ( on ? "enabled" : "disabled" ) + ",N=" + std::to_string ( N ) , N ,
+              [N,on] () -> Operation
+              {
+                auto counter = std::make_shared<Ostap::Utils::Instrumentation::Counter> ( "bench/counter" ) ;
+                return [N,on,counter] ()
+                {
+                  const bool old = Ostap::Utils::Instrumentation::setEnabled ( on ) ;
+                  for ( std::size_t i = 0 ; i < N ; ++i ) { counter->add () ; }
+                  Ostap::Utils::Instrumentation::setEnabled ( old ) ;
+                } ;
+              } , true ) ;
+    }
+    // the formula with the enabled instrumentation: compare with "Formula::evaluate"
+    const std::size_t M = 10000 ;
+    r.add ( "Formula::evaluate" , "entries=" + std::to_string ( M ) + ",expr=simple,instrumented" , M ,
+            [M] () -> Operation
+            {
+              auto tree    = make_tree ( M ) ;
+              auto formula = std::make_shared<Ostap::Formula> ( "bench_formula" , "x+y" , tree.get () ) ;
+              return [tree,formula] ()
+              {
+                const bool old = Ostap::Utils::Instrumentation::setEnabled ( true ) ;
+                double s = 0 ;
+                const Long64_t nentries = tree->GetEntries () ;
+                for ( Long64_t i = 0 ; i < nentries ; ++i )
+                {
+                  tree->LoadTree ( i ) ;
+                  s += formula->evaluate () ;
+                }
+                Ostap::Utils::Instrumentation::setEnabled ( old ) ;
+                Ostap::Bench::sink ( s ) ;
+              } ;
+            } , true ) ;
+  } ) ;
+  // ==========================================================================
+  /** filling of the histogram: per-event TH1::Fill vs the batch filler
+   *  (the results are identical)
+   */
+  const Ostap::Bench::Register s_histofill ( [] ( Registry& r )
+  {
+    const std::size_t N = 100000 ;
+    for ( const bool batch : { false , true } )
+    {
+      r.add ( batch ? "HistoFill::fill" : "TH1::Fill" , "TH1D,bins=100,N=" + std::to_string ( N ) , N ,
+              [N,batch] () -> Operation
+              {
+                std::mt19937                     gen   ( 12345 ) ;
+                std::normal_distribution<double> gauss ( 0 , 1 ) ;
+                auto x = std::make_shared<std::vector<double> > ( N ) ;
+                for ( auto& v : *x ) { v = gauss ( gen ) ; }
+                auto h = std::make_shared<TH1D> ( "bench_histo" , "bench_histo" , 100 , -3 , 3 ) ;
+                h->SetDirectory ( nullptr ) ;
+                return [x,h,batch] ()
+                {
+                  h->Reset () ;
+                  if ( batch )
+                  {
+                    Ostap::Utils::HistoFill filler ( h.get () ) ;
+                    for ( const double v : *x ) { filler.fill ( v ) ; }
+                  }
+                  else { for ( const double v : *x ) { h->Fill ( v ) ; } }
+                  Ostap::Bench::sink ( h->GetBinContent ( 50 ) ) ;
+                } ;
+              } , true ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// the filled histogram with the given number of bins
+  std::shared_ptr<TH1D> make_histo ( const int nbins )
+  {
+    auto h = std::make_shared<TH1D> ( "bench_memo" , "bench_memo" , nbins , -3 , 3 ) ;
+    h->SetDirectory ( nullptr ) ;
+    h->Sumw2 () ;
+    std::mt19937                     gen   ( 12345 ) ;
+    std::normal_distribution<double> gauss ( 0 , 1 ) ;
+    for ( int i = 0 ; i < 10 * nbins ; ++i ) { h->Fill ( gauss ( gen ) ) ; }
+    return h ;
+  }
+  // ==========================================================================
+  const Ostap::Bench::Register s_histohash ( [] ( Registry& r )
+  {
+    for ( const int N : { 100 , 10000 , 1000000 } )
+    {
+      const std::size_t items = N + 2 ;
+      /// raw buffers at once (xxHash64) vs. the bin-by-bin combination
+      for ( const bool raw : { true , false } )
+      {
+        r.add ( raw ? "hash_histo" : "hash_histo(bin-by-bin)" , "TH1D,bins=" + std::to_string ( N ) , items ,
+                [N,raw] () -> Operation
+                {
+                  auto h = make_histo ( N ) ;
+                  return [h,raw] ()
+                  {
+                    std::size_t seed = 0 ;
+                    if ( raw ) { seed = Ostap::Utils::hash_histo ( h.get () ) ; }
+                    else
+                    {
+                      const int ncells = h->GetNcells () ;
+                      for ( int i = 0 ; i < ncells ; ++i )
+                      {
+                        seed ^= std::hash<double>() ( h->GetBinContent ( i ) ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ) ;
+                        seed ^= std::hash<double>() ( h->GetBinError   ( i ) ) + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ) ;
+                      }
+                    }
+                    Ostap::Bench::sink ( seed ) ;
+                  } ;
+                } , 100 == N ) ;
+      }
+      /// the hit in the memo: the key (with the hash) and the look-up
+      r.add ( "HistoMemo::get(hit)" , "TH1D,bins=" + std::to_string ( N ) , 1 ,
+              [N] () -> Operation
+              {
+                auto h = make_histo ( N ) ;
+                auto& memo = Ostap::Utils::HistoMemo::instance () ;
+                memo.get<double> ( memo.key ( h.get () , "bench/integral" ) ,
+                                   [h] () { return new double ( h->Integral () ) ; } ) ;
+                return [h] ()
+                {
+                  auto& m = Ostap::Utils::HistoMemo::instance () ;
+                  auto  v = m.get<double> ( m.key ( h.get () , "bench/integral" ) ,
+                                            [h] () { return new double ( h->Integral () ) ; } ) ;
+                  Ostap::Bench::sink ( *v ) ;
+                } ;
+              } , 100 == N ) ;
+    }
+  } ) ;
+  // ==========================================================================
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,722 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1D.h"
+#include "TH2D.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/AdaptiveChebyshev.h"
+#include "Ostap/Bernstein.h"
+#include "Ostap/BSpline.h"
+#include "Ostap/Chi2Fit.h"
+#include "Ostap/DalitzIntegrator.h"
+#include "Ostap/DalitzNormalization.h"
+#include "Ostap/MoreMath.h"
+#include "Ostap/MoreMathBatch.h"
+#include "Ostap/HistoInterpolation.h"
+#include "Ostap/Interpolation.h"
+#include "Ostap/Kinematics.h"
+#include "Ostap/KinematicsBatch.h"
+#include "Ostap/Peaks.h"
+#include "Ostap/PhaseSpace.h"
+#include "Ostap/Primitives.h"
+#include "Ostap/PrimitivesT.h"
+#include "Ostap/Models2D.h"
+#include "Ostap/ThreadPool.h"
+#include "Ostap/ValueWithError.h"
+#include "Ostap/ValuesWithErrors.h"
+#include "Ostap/Voigt.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Bench.h"
+// ============================================================================
+/** @file BenchMath.cpp
+ *  micro-benchmarks for Ostap::Math kernels
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Bench::Registry  Registry  ;
+  typedef Ostap::Bench::Operation Operation ;
+  // ==========================================================================
+  /// number of points per operation for the simple kernels
+  const std::size_t s_NPOINTS = 1000 ;
+  // ==========================================================================
+  /// uniformly distributed points (fixed seed)
+  std::vector<double> points ( const std::size_t n    ,
+                               const double      xmin ,
+                               const double      xmax )
+  {
+    std::mt19937                           gen  ( 12345 ) ;
+    std::uniform_real_distribution<double> flat ( xmin , xmax ) ;
+    std::vector<double> result ( n ) ;
+    for ( auto& x : result ) { x = flat ( gen ) ; }
+    return result ;
+  }
+  // ==========================================================================
+  /// random parameters
+  template <class FUNCTION>
+  void randomize ( FUNCTION& f , const std::size_t npars )
+  {
+    std::mt19937                           gen  ( 54321 ) ;
+    std::uniform_real_distribution<double> flat ( 0.1 , 1.0 ) ;
+    for ( std::size_t k = 0 ; k < npars ; ++k ) { f.setPar ( k , flat ( gen ) ) ; }
+  }
+  // ==========================================================================
+  const Ostap::Bench::Register s_bernstein ( [] ( Registry& r )
+  {
+    for ( const unsigned short N : { 2 , 5 , 10 , 20 , 50 } )
+    {
+      r.add ( "Bernstein::evaluate" , "N=" + std::to_string ( N ) , s_NPOINTS ,
+              [N] () -> Operation
+              {
+                auto b = std::make_shared<Ostap::Math::Bernstein> ( N , 0.0 , 1.0 ) ;
+                randomize ( *b , b->npars () ) ;
+                auto x = std::make_shared<std::vector<double> > ( points ( s_NPOINTS , 0 , 1 ) ) ;
+                return [b,x] ()
+                {
+                  double s = 0 ;
+                  for ( const double v : *x ) { s += (*b) ( v ) ; }
+                  Ostap::Bench::sink ( s ) ;
+                } ;
+              } , 5 == N || 50 == N ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_bspline ( [] ( Registry& r )
+  {
+    for ( const unsigned short inner : { 3 , 10 , 50 } )
+    {
+      for ( const unsigned short order : { 2 , 3 , 5 } )
+      {
+        r.add ( "BSpline::evaluate" ,
+                "inner=" + std::to_string ( inner ) + ",order=" + std::to_string ( order ) ,
+                s_NPOINTS ,
+                [inner,order] () -> Operation
+                {
+                  auto b = std::make_shared<Ostap::Math::BSpline> ( 0.0 , 1.0 , inner , order ) ;
+                  randomize ( *b , b->npars () ) ;
+                  auto x = std::make_shared<std::vector<double> > ( points ( s_NPOINTS , 0 , 1 ) ) ;
+                  return [b,x] ()
+                  {
+                    double s = 0 ;
+                    for ( const double v : *x ) { s += (*b) ( v ) ; }
+                    Ostap::Bench::sink ( s ) ;
+                  } ;
+                } , 10 == inner && 3 == order ) ;
+      }
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_faddeeva ( [] ( Registry& r )
+  {
+    // different regions of the complex plane use different algorithms
+    const std::vector<std::pair<std::string,double> > regions {
+      { "|z|<1" , 1 } , { "|z|<5" , 5 } , { "|z|<50" , 50 } } ;
+    for ( const auto& region : regions )
+    {
+      const double R = region.second ;
+      r.add ( "Faddeeva::w" , region.first , s_NPOINTS ,
+              [R] () -> Operation
+              {
+                const std::vector<double> re = points ( s_NPOINTS , -R , R ) ;
+                std::vector<double>       im = points ( 2 * s_NPOINTS , 0 , R ) ;
+                auto z = std::make_shared<std::vector<std::complex<double> > > () ;
+                for ( std::size_t i = 0 ; i < s_NPOINTS ; ++i )
+                { z->emplace_back ( re [ i ] , im [ s_NPOINTS + i ] ) ; }
+                return [z] ()
+                {
+                  double s = 0 ;
+                  for ( const auto& v : *z ) { s += std::abs ( Ostap::Math::faddeeva_w ( v ) ) ; }
+                  Ostap::Bench::sink ( s ) ;
+                } ;
+              } , 5 == R ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_histo ( [] ( Registry& r )
+  {
+    typedef Ostap::Math::HistoInterpolation HI ;
+    const std::vector<std::pair<std::string,HI::Type> > types {
+      { "Nearest"   , HI::Nearest   } ,
+      { "Linear"    , HI::Linear    } ,
+      { "Quadratic" , HI::Quadratic } ,
+      { "Cubic"     , HI::Cubic     } } ;
+    //
+    for ( const int nbins : { 10 , 100 , 1000 } )
+    {
+      for ( const auto& t : types )
+      {
+        const HI::Type type = t.second ;
+        r.add ( "HistoInterpolation::interpolate_1D" ,
+                "bins=" + std::to_string ( nbins ) + ",type=" + t.first , s_NPOINTS ,
+                [nbins,type] () -> Operation
+                {
+                  auto h = std::make_shared<TH1D> ( "h1_bench" , "" , nbins , 0 , 1 ) ;
+                  h->SetDirectory ( nullptr ) ;
+                  for ( int i = 1 ; i <= nbins ; ++i )
+                  { h->SetBinContent ( i , 1 + std::sin ( 10.0 * i / nbins ) ) ; }
+                  auto x = std::make_shared<std::vector<double> > ( points ( s_NPOINTS , 0 , 1 ) ) ;
+                  return [h,x,type] ()
+                  {
+                    double s = 0 ;
+                    for ( const double v : *x ) { s += HI::interpolate_1D ( *h , v , type ).value () ; }
+                    Ostap::Bench::sink ( s ) ;
+                  } ;
+                } , 100 == nbins ) ;
+      }
+    }
+    //
+    for ( const int nbins : { 10 , 100 } )
+    {
+      for ( const auto& t : types )
+      {
+        const HI::Type type = t.second ;
+        r.add ( "HistoInterpolation::interpolate_2D" ,
+                "bins=" + std::to_string ( nbins ) + "x" + std::to_string ( nbins ) + ",type=" + t.first ,
+                s_NPOINTS ,
+                [nbins,type] () -> Operation
+                {
+                  auto h = std::make_shared<TH2D> ( "h2_bench" , "" , nbins , 0 , 1 , nbins , 0 , 1 ) ;
+                  h->SetDirectory ( nullptr ) ;
+                  for ( int i = 1 ; i <= nbins ; ++i )
+                  { for ( int j = 1 ; j <= nbins ; ++j )
+                    { h->SetBinContent ( i , j , 1 + std::sin ( 10.0 * i / nbins ) * std::cos ( 5.0 * j / nbins ) ) ; } }
+                  auto x = std::make_shared<std::vector<double> > ( points ( 2 * s_NPOINTS , 0 , 1 ) ) ;
+                  return [h,x,type] ()
+                  {
+                    double s = 0 ;
+                    for ( std::size_t i = 0 ; i < s_NPOINTS ; ++i )
+                    { s += HI::interpolate_2D ( *h , (*x) [ i ] , (*x) [ s_NPOINTS + i ] , type , type ).value () ; }
+                    Ostap::Bench::sink ( s ) ;
+                  } ;
+                } , 10 == nbins && HI::Linear == type ) ;
+      }
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_integrator1d ( [] ( Registry& r )
+  {
+    // the same parameters: the integral is taken from the cache
+    r.add ( "Integrator1D::integral" , "Bukin,cached" , 1 ,
+            [] () -> Operation
+            {
+              auto b = std::make_shared<Ostap::Math::Bukin> ( 1.0 , 0.1 , 0.1 , 0.2 , 0.1 ) ;
+              return [b] () { Ostap::Bench::sink ( b->integral ( 0.5 , 1.7 ) ) ; } ;
+            } , true ) ;
+    // the parameter changes: the integral is recalculated
+    r.add ( "Integrator1D::integral" , "Bukin,uncached" , 1 ,
+            [] () -> Operation
+            {
+              auto b = std::make_shared<Ostap::Math::Bukin> ( 1.0 , 0.1 , 0.1 , 0.2 , 0.1 ) ;
+              auto n = std::make_shared<std::size_t> ( 0 ) ;
+              return [b,n] ()
+              {
+                b->setPeak ( 1.0 + 1.e-6 * ( ++(*n) % 1000 ) ) ;
+                Ostap::Bench::sink ( b->integral ( 0.5 , 1.7 ) ) ;
+              } ;
+            } , true ) ;
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_integrator2d ( [] ( Registry& r )
+  {
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "Integrator2D::integral" , "PS2DPol2,N=3x3" , 1 ,
+              [] () -> Operation
+              {
+                const Ostap::Math::PhaseSpaceNL psx ( 0.2 , 5 , 2 , 4 ) ;
+                const Ostap::Math::PhaseSpaceNL psy ( 0.2 , 5 , 2 , 4 ) ;
+                auto ps = std::make_shared<Ostap::Math::PS2DPol2> ( psx , psy , 5.5 , 3 , 3 ) ;
+                randomize ( *ps , ps->npars () ) ;
+                auto n  = std::make_shared<std::size_t> ( 0 ) ;
+                return [ps,n] ()
+                {
+                  // change the parameter to avoid the cache
+                  ps->setPar ( 0 , 1.0 + 1.e-6 * ( ++(*n) % 1000 ) ) ;
+                  Ostap::Bench::sink ( ps->integral ( 0.3 , 4.5 , 0.3 , 4.5 ) ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_threadpool ( [] ( Registry& r )
+  {
+    const std::size_t N = 100000 ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "ThreadPool::parallel_for" , "Bernstein,N=20" , N ,
+              [N] () -> Operation
+              {
+                auto b = std::make_shared<Ostap::Math::Bernstein> ( 20 , 0.0 , 1.0 ) ;
+                randomize ( *b , b->npars () ) ;
+                auto x = std::make_shared<std::vector<double> > ( points ( N , 0 , 1 ) ) ;
+                auto y = std::make_shared<std::vector<double> > ( N , 0.0 ) ;
+                return [b,x,y,N] ()
+                {
+                  Ostap::Utils::ThreadPool::parallel_for
+                    ( N , [&] ( const std::size_t begin , const std::size_t end )
+                      { for ( std::size_t i = begin ; i < end ; ++i ) { (*y) [ i ] = (*b) ( (*x) [ i ] ) ; } } ,
+                      1000 ) ;
+                  Ostap::Bench::sink ( y->back () ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// many template fits: the iterative minimiser vs the batch solver
+  const Ostap::Bench::Register s_chi2fit ( [] ( Registry& r )
+  {
+    const std::size_t    NFITS   = 100 ;
+    const unsigned int   NPOINTS = 50  ;
+    const unsigned short NCMPS   = 3   ;
+    typedef Ostap::Math::Chi2Fit::VE   VE   ;
+    typedef Ostap::Math::Chi2Fit::DATA DATA ;
+    typedef Ostap::Math::Chi2Fit::CMPS CMPS ;
+    // the problems: polynomial templates and the poissonian data
+    auto problems = [=] ()
+    {
+      std::mt19937 gen ( 12345 ) ;
+      auto result = std::make_shared<std::vector<std::pair<DATA,CMPS> > > () ;
+      for ( std::size_t k = 0 ; k < NFITS ; ++k )
+      {
+        DATA data ;
+        CMPS cmps ( NCMPS ) ;
+        for ( unsigned int i = 0 ; i < NPOINTS ; ++i )
+        {
+          const double x = ( i + 0.5 ) / NPOINTS ;
+          double       v = 0 ;
+          for ( unsigned short j = 0 ; j < NCMPS ; ++j )
+          {
+            const double c = 10 * std::pow ( x , j ) ;
+            cmps [ j ].push_back ( VE ( c , 0 ) ) ;
+            v += ( 100 - 20 * j ) * c ;
+          }
+          std::poisson_distribution<int> poisson ( v ) ;
+          const double n = poisson ( gen ) ;
+          data.push_back ( VE ( n , std::max ( n , 1.0 ) ) ) ;
+        }
+        result->emplace_back ( data , cmps ) ;
+      }
+      return result ;
+    } ;
+    //
+    const std::string params = "fits=" + std::to_string ( NFITS ) + ",N=" + std::to_string ( NPOINTS ) ;
+    r.add ( "Chi2Fit::fit" , params , NFITS ,
+            [problems] () -> Operation
+            {
+              auto p = problems () ;
+              return [p] ()
+              {
+                double s = 0 ;
+                for ( const auto& item : *p )
+                {
+                  const Ostap::Math::Chi2Fit fit ( item.first , item.second ) ;
+                  s += fit.chi2 () ;
+                }
+                Ostap::Bench::sink ( s ) ;
+              } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "Chi2FitBatch::fit" , params , NFITS ,
+              [problems,NPOINTS,NCMPS] () -> Operation
+              {
+                auto p     = problems () ;
+                auto batch = std::make_shared<Ostap::Math::Chi2FitBatch> ( NPOINTS , NCMPS ) ;
+                for ( const auto& item : *p ) { batch->add ( item.first , item.second ) ; }
+                return [batch] ()
+                {
+                  batch->fit () ;
+                  Ostap::Bench::sink ( batch->chi2 ( 0 ) ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// the columns of random four-vectors: (px,py,pz,E) for each
+  struct Vectors
+  {
+    std::vector<std::vector<double> >                 data    {} ;
+    std::vector<Ostap::Kinematics::LorentzColumns>    columns {} ;
+    std::vector<std::vector<Ostap::LorentzVector> >   vectors {} ;
+  } ;
+  std::shared_ptr<Vectors> vectors ( const unsigned short nv , const std::size_t n )
+  {
+    auto v = std::make_shared<Vectors> () ;
+    std::mt19937                           gen  ( 12345 ) ;
+    std::uniform_real_distribution<double> flat ( -1 , 1 ) ;
+    v->data   .resize ( 4 * nv , std::vector<double> ( n ) ) ;
+    v->vectors.resize ( nv ) ;
+    for ( unsigned short k = 0 ; k < nv ; ++k )
+    {
+      for ( std::size_t i = 0 ; i < n ; ++i )
+      {
+        const double px = flat ( gen ) , py = flat ( gen ) , pz = 5 + flat ( gen ) ;
+        const double e  = std::sqrt ( px * px + py * py + pz * pz + 0.25 ) ;
+        v->data [ 4 * k ] [ i ] = px ; v->data [ 4 * k + 1 ] [ i ] = py ;
+        v->data [ 4 * k + 2 ] [ i ] = pz ; v->data [ 4 * k + 3 ] [ i ] = e ;
+        v->vectors [ k ].emplace_back ( px , py , pz , e ) ;
+      }
+      v->columns.emplace_back ( v->data [ 4 * k     ].data () , v->data [ 4 * k + 1 ].data () ,
+                                v->data [ 4 * k + 2 ].data () , v->data [ 4 * k + 3 ].data () ) ;
+    }
+    return v ;
+  }
+  // ==========================================================================
+  /// the helicity angles: scalar functions vs batch kernels
+  const Ostap::Bench::Register s_kinematics ( [] ( Registry& r )
+  {
+    const std::size_t N = 100000 ;
+    r.add ( "Kinematics::decayAngleChi" , "scalar" , N ,
+            [N] () -> Operation
+            {
+              auto v = vectors ( 4 , N ) ;
+              return [v,N] ()
+              {
+                double s = 0 ;
+                const auto& p = v->vectors ;
+                for ( std::size_t i = 0 ; i < N ; ++i )
+                { s += Ostap::Kinematics::decayAngleChi ( p [ 0 ] [ i ] , p [ 1 ] [ i ] , p [ 2 ] [ i ] , p [ 3 ] [ i ] ) ; }
+                Ostap::Bench::sink ( s ) ;
+              } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "Kinematics::Batch::decayAngleChi" , "SoA" , N ,
+              [N] () -> Operation
+              {
+                auto v = vectors ( 4 , N ) ;
+                auto y = std::make_shared<std::vector<double> > ( N , 0.0 ) ;
+                return [v,y,N] ()
+                {
+                  const auto& c = v->columns ;
+                  Ostap::Kinematics::Batch::decayAngleChi ( N , c [ 0 ] , c [ 1 ] , c [ 2 ] , c [ 3 ] , y->data () ) ;
+                  Ostap::Bench::sink ( y->back () ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// Voigt profile: direct evaluation vs adaptive Chebyshev approximation
+  const Ostap::Bench::Register s_chebyshev ( [] ( Registry& r )
+  {
+    const std::size_t N = 100000 ;
+    r.add ( "Voigt::evaluate" , "exact" , N ,
+            [N] () -> Operation
+            {
+              auto f = std::make_shared<Ostap::Math::Voigt> ( 1.0 , 0.010 , 0.005 ) ;
+              auto x = std::make_shared<std::vector<double> > ( points ( N , 0.8 , 1.2 ) ) ;
+              return [f,x] ()
+              {
+                double s = 0 ;
+                for ( const double v : *x ) { s += (*f) ( v ) ; }
+                Ostap::Bench::sink ( s ) ;
+              } ;
+            } , true ) ;
+    r.add ( "AdaptiveChebyshev::evaluate" , "Voigt,scalar" , N ,
+            [N] () -> Operation
+            {
+              const Ostap::Math::Voigt voigt ( 1.0 , 0.010 , 0.005 ) ;
+              auto c = std::make_shared<Ostap::Math::AdaptiveChebyshev> ( voigt , 0.8 , 1.2 , 1.e-10 ) ;
+              c -> size () ; // build it outside of the timing
+              auto x = std::make_shared<std::vector<double> > ( points ( N , 0.8 , 1.2 ) ) ;
+              return [c,x] ()
+              {
+                double s = 0 ;
+                for ( const double v : *x ) { s += (*c) ( v ) ; }
+                Ostap::Bench::sink ( s ) ;
+              } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "AdaptiveChebyshev::evaluate" , "Voigt,batch" , N ,
+              [N] () -> Operation
+              {
+                const Ostap::Math::Voigt voigt ( 1.0 , 0.010 , 0.005 ) ;
+                auto c = std::make_shared<Ostap::Math::AdaptiveChebyshev> ( voigt , 0.8 , 1.2 , 1.e-10 ) ;
+                c -> size () ; // build it outside of the timing
+                auto x = std::make_shared<std::vector<double> > ( points ( N , 0.8 , 1.2 ) ) ;
+                auto y = std::make_shared<std::vector<double> > ( N , 0.0 ) ;
+                return [c,x,y,N] ()
+                {
+                  c -> evaluate ( N , x->data () , y->data () ) ;
+                  Ostap::Bench::sink ( y->back () ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+    r.add ( "AdaptiveChebyshev::build" , "Voigt,1e-10" , 1 ,
+            [] () -> Operation
+            {
+              auto c = std::make_shared<Ostap::Math::AdaptiveChebyshev>
+                ( Ostap::Math::Voigt ( 1.0 , 0.010 , 0.005 ) , 0.8 , 1.2 , 1.e-10 ) ;
+              return [c] ()
+              {
+                c -> reset () ;
+                Ostap::Bench::sink ( double ( c -> size () ) ) ;
+              } ;
+            } , false ) ;
+  } ) ;
+  // ==========================================================================
+  const Ostap::Bench::Register s_values_with_errors ( [] ( Registry& r )
+  {
+    const std::size_t N = 1000000 ;
+    r.add ( "ValueWithError::operator*" , "vector,exp" , N ,
+            [N] () -> Operation
+            {
+              const std::vector<double> xs = points ( N , 1.0 , 2.0 ) ;
+              auto a = std::make_shared<Ostap::Math::ValueWithError::Vector> ( N ) ;
+              for ( std::size_t i = 0 ; i < N ; ++i )
+              { (*a) [ i ] = Ostap::Math::ValueWithError ( xs [ i ] , 0.01 * xs [ i ] ) ; }
+              auto b = std::make_shared<Ostap::Math::ValueWithError::Vector> ( N ) ;
+              return [a,b,N] ()
+              {
+                for ( std::size_t i = 0 ; i < N ; ++i )
+                { (*b) [ i ] = Ostap::Math::exp ( (*a) [ i ] * (*a) [ i ] ) ; }
+                Ostap::Bench::sink ( Ostap::Math::sum ( *b ).value () ) ;
+              } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "ValuesWithErrors::operator*" , "SoA,exp" , N ,
+              [N] () -> Operation
+              {
+                const std::vector<double> xs = points ( N , 1.0 , 2.0 ) ;
+                std::vector<double> cs ( xs ) ;
+                for ( double& c : cs ) { c *= 0.01 ; }
+                auto a = std::make_shared<Ostap::Math::ValuesWithErrors> ( xs , cs ) ;
+                return [a] ()
+                {
+                  const Ostap::Math::ValuesWithErrors b = exp ( (*a) * (*a) ) ;
+                  Ostap::Bench::sink ( b.sum ().value () ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// amplitude normalization over the Dalitz plot: from scratch vs cached grid
+  const Ostap::Bench::Register s_dalitz_normalization ( [] ( Registry& r )
+  {
+    typedef std::complex<double> complex ;
+    const Ostap::Kinematics::Dalitz dalitz ( 5.279 , 0.139 , 0.493 , 0.139 ) ;
+    auto bw = [] ( const double s , const double m , const double g ) -> complex
+      { return 1.0 / complex ( m * m - s , -m * g ) ; } ;
+    const complex c1 ( 1.0 , 0.0 ) ;
+    const complex c2 ( 0.5 , 0.3 ) ;
+    r.add ( "DalitzIntegrator::integrate_s1s2" , "|A1+A2|^2" , 1 ,
+            [dalitz,bw,c1,c2] () -> Operation
+            {
+              return [dalitz,bw,c1,c2] ()
+              {
+                auto f = [&] ( const double s1 , const double s2 ) -> double
+                  { return std::norm ( c1 * bw ( s1 , 0.892 , 0.050 ) + c2 * bw ( s2 , 1.430 , 0.270 ) ) ; } ;
+                Ostap::Bench::sink ( Ostap::Math::DalitzIntegrator::integrate_s1s2
+                                     ( std::cref ( f ) , dalitz.s () , dalitz ) ) ;
+              } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "DalitzNormalization::norm" , "update one of 2" , 1 ,
+              [dalitz,bw,c1,c2] () -> Operation
+              {
+                auto norm = std::make_shared<Ostap::Math::DalitzNormalization> ( dalitz , 64 , 64 ) ;
+                norm->add ( [bw] ( double s1 , double ) { return bw ( s1 , 0.892 , 0.050 ) ; } , 0 ) ;
+                norm->add ( [bw] ( double , double s2 ) { return bw ( s2 , 1.430 , 0.270 ) ; } , 0 ) ;
+                auto tag  = std::make_shared<std::size_t> ( 0 ) ;
+                return [norm,tag,c1,c2] ()
+                {
+                  // emulate the change of the shape parameters for the second component
+                  norm->update ( 1 , ++(*tag) ) ;
+                  Ostap::Bench::sink ( norm->norm ( { c1 , c2 } ) ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// interpolation over the large tables: global vs local
+  const Ostap::Bench::Register s_local_interpolation ( [] ( Registry& r )
+  {
+    const std::size_t N     = 100000 ;
+    const std::size_t NP    = 1000   ;
+    auto fun = [] ( const double x ) { return std::sin ( x ) * std::exp ( -0.1 * x ) ; } ;
+    r.add ( "Barycentric::evaluate" , "Chebyshev,table=5e4" , NP ,
+            [fun,NP] () -> Operation
+            {
+              auto b  = std::make_shared<Ostap::Math::Barycentric>
+                ( fun , 50000 , 0.0 , 10.0 , Ostap::Math::Interpolation::Abscissas::Chebyshev ) ;
+              auto xs = std::make_shared<std::vector<double>> ( points ( NP , 0 , 10 ) ) ;
+              return [b,xs] ()
+              { double s = 0 ; for ( const double x : *xs ) { s += (*b) ( x ) ; } Ostap::Bench::sink ( s ) ; } ;
+            } , true ) ;
+    r.add ( "LocalInterpolation<3>" , "table=1e5,random" , NP ,
+            [fun,NP] () -> Operation
+            {
+              const std::vector<double> ax = points ( N , 0 , 10 ) ;
+              std::vector<double> ay ( ax.size () ) ;
+              std::transform ( ax.begin () , ax.end () , ay.begin () , fun ) ;
+              auto l  = std::make_shared<Ostap::Math::LocalInterpolation<3>> ( ax , ay ) ;
+              auto xs = std::make_shared<std::vector<double>> ( points ( NP , 0 , 10 ) ) ;
+              return [l,xs] ()
+              { double s = 0 ; for ( const double x : *xs ) { s += (*l) ( x ) ; } Ostap::Bench::sink ( s ) ; } ;
+            } , true ) ;
+    for ( const unsigned int nt : Ostap::Bench::thread_counts () )
+    {
+      r.add ( "LocalInterpolation<3>::evaluate" , "table=1e5,sorted batch" , 100 * NP ,
+              [fun,NP] () -> Operation
+              {
+                const std::vector<double> ax = points ( N , 0 , 10 ) ;
+                std::vector<double> ay ( ax.size () ) ;
+                std::transform ( ax.begin () , ax.end () , ay.begin () , fun ) ;
+                auto l  = std::make_shared<Ostap::Math::LocalInterpolation<3>> ( ax , ay ) ;
+                std::vector<double> x ( points ( 100 * NP , 0 , 10 ) ) ;
+                std::sort ( x.begin () , x.end () ) ;
+                auto xs = std::make_shared<std::vector<double>> ( x ) ;
+                return [l,xs] ()
+                {
+                  const std::vector<double> v = l->evaluate ( *xs ) ;
+                  Ostap::Bench::sink ( v.back () ) ;
+                } ;
+              } , 1 == nt , nt ) ;
+    }
+  } ) ;
+  // ==========================================================================
+  /// composed functions: std::function-based vs compile-time combinators
+  const Ostap::Bench::Register s_primitives ( [] ( Registry& r )
+  {
+    // f(x) = 2*x*(x+1)/(x*x+1) - x
+    r.add ( "Primitives" , "std::function" , s_NPOINTS ,
+            [] () -> Operation
+            {
+              using namespace Ostap::Math ;
+              const Apply x ( [] ( const double t ) { return t ; } ) ;
+              auto f  = std::make_shared<Linear>
+                ( Divide ( Multiply ( x , Sum ( x , 1.0 ) ) ,
+                           Sum ( Multiply ( x , x ) , 1.0 ) , 2.0 ) , 1.0 , x , -1.0 ) ;
+              auto xs = std::make_shared<std::vector<double>> ( points ( s_NPOINTS , -1 , 1 ) ) ;
+              return [f,xs] ()
+              { double s = 0 ; for ( const double v : *xs ) { s += (*f) ( v ) ; } Ostap::Bench::sink ( s ) ; } ;
+            } , true ) ;
+    r.add ( "Primitives" , "templates" , s_NPOINTS ,
+            [] () -> Operation
+            {
+              using namespace Ostap::Math::Primitives ;
+              const auto x = identity () ;
+              const auto f = 2.0 * ( x * ( x + 1.0 ) ) / ( x * x + 1.0 ) - x ;
+              auto xs = std::make_shared<std::vector<double>> ( points ( s_NPOINTS , -1 , 1 ) ) ;
+              return [f,xs] ()
+              { double s = 0 ; for ( const double v : *xs ) { s += f ( v ) ; } Ostap::Bench::sink ( s ) ; } ;
+            } , true ) ;
+    r.add ( "Primitives" , "templates,batch" , s_NPOINTS ,
+            [] () -> Operation
+            {
+              using namespace Ostap::Math::Primitives ;
+              const auto x = identity () ;
+              const auto f = 2.0 * ( x * ( x + 1.0 ) ) / ( x * x + 1.0 ) - x ;
+              auto xs = std::make_shared<std::vector<double>> ( points ( s_NPOINTS , -1 , 1 ) ) ;
+              auto rs = std::make_shared<std::vector<double>> ( s_NPOINTS ) ;
+              return [f,xs,rs] ()
+              {
+                evaluate ( f , xs->data () , rs->data () , xs->size () ) ;
+                Ostap::Bench::sink ( rs->back () ) ;
+              } ;
+            } , true ) ;
+  } ) ;
+  // ==========================================================================
+  /// special functions: scalar loop vs vectorized batch
+  const Ostap::Bench::Register s_batch_math ( [] ( Registry& r )
+  {
+    typedef double (*Scalar) ( double ) ;
+    typedef void   (*Vector) ( std::size_t , const double* , double* ) ;
+    struct Item { const char* name ; Scalar scalar ; Vector batch ; double xmin ; double xmax ; } ;
+    static const Item s_items [] =
+      {
+        { "gauss_cdf" ,
+          [] ( double x ) { return Ostap::Math::gauss_cdf ( x ) ; } ,
+          [] ( std::size_t n , const double* x , double* y ) { Ostap::Math::Batch::gauss_cdf ( n , x , y ) ; } ,
+          -5 , 5 } ,
+        { "erfc"      ,
+          [] ( double x ) { return std::erfc ( x ) ; } ,
+          Ostap::Math::Batch::erfc   , -5 , 5 } ,
+        { "probit"    ,
+          [] ( double x ) { return Ostap::Math::probit ( x ) ; } ,
+          Ostap::Math::Batch::probit , 1.e-6 , 1 - 1.e-6 } ,
+        { "dowson"    ,
+          [] ( double x ) { return Ostap::Math::dowson ( x ) ; } ,
+          Ostap::Math::Batch::dowson , -10 , 10 } ,
+      } ;
+    const std::size_t N = 100000 ;
+    for ( const Item& item : s_items )
+    {
+      const std::string name = std::string ( "MoreMath::" ) + item.name ;
+      r.add ( name , "scalar" , N ,
+              [item,N] () -> Operation
+              {
+                auto xs = std::make_shared<std::vector<double>> ( points ( N , item.xmin , item.xmax ) ) ;
+                auto ys = std::make_shared<std::vector<double>> ( N ) ;
+                return [item,xs,ys] ()
+                {
+                  std::transform ( xs->begin () , xs->end () , ys->begin () , item.scalar ) ;
+                  Ostap::Bench::sink ( ys->back () ) ;
+                } ;
+              } , true ) ;
+      r.add ( name , "batch"  , N ,
+              [item,N] () -> Operation
+              {
+                auto xs = std::make_shared<std::vector<double>> ( points ( N , item.xmin , item.xmax ) ) ;
+                auto ys = std::make_shared<std::vector<double>> ( N ) ;
+                return [item,xs,ys] ()
+                {
+                  item.batch ( xs->size () , xs->data () , ys->data () ) ;
+                  Ostap::Bench::sink ( ys->back () ) ;
+                } ;
+              } , true ) ;
+    }
+    // Clenshaw summation of the Chebyshev series with 20 terms
+    const std::vector<double> pars { 1.0 , 0.5 , -0.3 , 0.2 , 0.1 , -0.05 , 0.03 , 0.02 , -0.01 , 0.005 ,
+        0.004 , -0.003 , 0.002 , 0.001 , -5.e-4 , 4.e-4 , 3.e-4 , -2.e-4 , 1.e-4 , 5.e-5 } ;
+    r.add ( "MoreMath::clenshaw_chebyshev" , "scalar" , N ,
+            [pars,N] () -> Operation
+            {
+              auto xs = std::make_shared<std::vector<double>> ( points ( N , -1 , 1 ) ) ;
+              auto ys = std::make_shared<std::vector<double>> ( N ) ;
+              return [pars,xs,ys] ()
+              {
+                for ( std::size_t i = 0 ; i < xs->size () ; ++i )
+                { (*ys) [ i ] = Ostap::Math::clenshaw_chebyshev ( pars , (*xs) [ i ] ) ; }
+                Ostap::Bench::sink ( ys->back () ) ;
+              } ;
+            } , true ) ;
+    r.add ( "MoreMath::clenshaw_chebyshev" , "batch"  , N ,
+            [pars,N] () -> Operation
+            {
+              auto xs = std::make_shared<std::vector<double>> ( points ( N , -1 , 1 ) ) ;
+              auto ys = std::make_shared<std::vector<double>> ( N ) ;
+              return [pars,xs,ys] ()
+              {
+                Ostap::Math::Batch::clenshaw_chebyshev ( pars , xs->size () , xs->data () , ys->data () ) ;
+                Ostap::Bench::sink ( ys->back () ) ;
+              } ;
+            } , true ) ;
+  } ) ;
+  // ==========================================================================
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,154 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+// ============================================================================
+// ROOT/RooFit
+// ============================================================================
+#include "RooRealVar.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/MoreRooFit.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Bench.h"
+// ============================================================================
+/** @file BenchRooFit.cpp
+ *  micro-benchmarks for Ostap additions to RooFit
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef Ostap::Bench::Registry  Registry  ;
+  typedef Ostap::Bench::Operation Operation ;
+  // ==========================================================================
+  /// number of points per operation
+  const std::size_t s_NPOINTS = 1000 ;
+  // ==========================================================================
+  /** the expression graph: the observable, the parameters and
+   *  all intermediate nodes (the nodes keep the references to their servers)
+   */
+  struct Graph
+  {
+    RooRealVar                               x     { "x" , "x" , 0 , -5 , 5 } ;
+    std::vector<std::unique_ptr<RooRealVar> > pars  {} ;
+    std::vector<std::unique_ptr<RooAbsReal> > nodes {} ;
+    std::unique_ptr<Ostap::MoreRooFit::Fused> fused {} ;
+    //
+    RooRealVar& par ( const std::string& name , const double value )
+    {
+      pars.emplace_back ( new RooRealVar ( name.c_str () , name.c_str () , value , -100 , 100 ) ) ;
+      return *pars.back () ;
+    }
+    template <class NODE, class... ARGS>
+    RooAbsReal& node ( ARGS&&... args )
+    {
+      nodes.emplace_back ( new NODE ( std::forward<ARGS> ( args )... ) ) ;
+      return *nodes.back () ;
+    }
+    RooAbsReal& top () const { return *nodes.back () ; }
+  } ;
+  // ==========================================================================
+  /** sWeight-like expression
+   *  \f$ w = \frac{ V_{ss} f_s + V_{sb} f_b }{ N_s f_s + N_b f_b } \f$
+   *  with gaussian signal and exponential background
+   */
+  std::shared_ptr<Graph> sweight ()
+  {
+    namespace M = Ostap::MoreRooFit ;
+    auto g = std::make_shared<Graph> () ;
+    RooRealVar& mu    = g->par ( "mu"    ,  0.1 ) ;
+    RooRealVar& sigma = g->par ( "sigma" ,  0.5 ) ;
+    RooRealVar& tau   = g->par ( "tau"   , -0.3 ) ;
+    RooRealVar& vss   = g->par ( "Vss"   ,  1.2 ) ;
+    RooRealVar& vsb   = g->par ( "Vsb"   , -0.2 ) ;
+    RooRealVar& ns    = g->par ( "Ns"    , 20   ) ;
+    RooRealVar& nb    = g->par ( "Nb"    , 80   ) ;
+    RooAbsReal& d     = g->node<M::Subtraction> ( g->x , mu    ) ;
+    RooAbsReal& z     = g->node<M::Division>    ( d    , sigma ) ;
+    RooAbsReal& z2    = g->node<M::Product>     ( z    , z     ) ;
+    RooAbsReal& fs    = g->node<M::Exp>         ( z2   , -0.5  ) ;
+    RooAbsReal& fb    = g->node<M::Exp>         ( g->x , tau   ) ;
+    RooAbsReal& s1    = g->node<M::Product>     ( vss  , fs    ) ;
+    RooAbsReal& b1    = g->node<M::Product>     ( vsb  , fb    ) ;
+    RooAbsReal& s2    = g->node<M::Product>     ( ns   , fs    ) ;
+    RooAbsReal& b2    = g->node<M::Product>     ( nb   , fb    ) ;
+    RooAbsReal& num   = g->node<M::Addition>    ( s1   , b1    ) ;
+    RooAbsReal& den   = g->node<M::Addition>    ( s2   , b2    ) ;
+    g->node<M::Division> ( num , den ) ;
+    return g ;
+  }
+  // ==========================================================================
+  /** efficiency-like expression: the product of <code>depth</code>
+   *  sigmoid-like factors \f$ \epsilon_k = \frac{a_k}{a_k+\mathrm{e}^{-c_k x}} \f$
+   */
+  std::shared_ptr<Graph> efficiency ( const unsigned short depth )
+  {
+    namespace M = Ostap::MoreRooFit ;
+    auto g = std::make_shared<Graph> () ;
+    RooAbsReal* eff = nullptr ;
+    for ( unsigned short k = 0 ; k < depth ; ++k )
+    {
+      RooRealVar& a  = g->par ( "a" + std::to_string ( k ) , 1.0 + 0.1 * k ) ;
+      RooRealVar& c  = g->par ( "c" + std::to_string ( k ) , 0.5 + 0.2 * k ) ;
+      RooAbsReal& cx = g->node<M::Product>  ( g->x , c  ) ;
+      RooAbsReal& ex = g->node<M::Exp>      ( cx   , -1 ) ;
+      RooAbsReal& ek = g->node<M::Fraction> ( a    , ex ) ;
+      eff = nullptr == eff ? &ek : &g->node<M::Product> ( *eff , ek ) ;
+    }
+    return g ;
+  }
+  // ==========================================================================
+  /// register the pair of cases: the original expression tree and the fused one
+  void add ( Registry&                                    r        ,
+             const std::string&                           params   ,
+             const std::function<std::shared_ptr<Graph>()>& make   ,
+             const bool                                   quick    )
+  {
+    for ( const bool fused : { false , true } )
+    {
+      r.add ( fused ? "MoreRooFit::Fused" : "MoreRooFit::tree" , params , s_NPOINTS ,
+              [make,fused] () -> Operation
+              {
+                std::shared_ptr<Graph> g = make () ;
+                if ( fused ) { g->fused.reset ( new Ostap::MoreRooFit::Fused ( g->top () ) ) ; }
+                const RooAbsReal* expr = fused ? g->fused.get () : &g->top () ;
+                auto xs = std::make_shared<std::vector<double> > ( s_NPOINTS ) ;
+                std::mt19937                           gen  ( 12345 ) ;
+                std::uniform_real_distribution<double> flat ( -5 , 5 ) ;
+                for ( auto& v : *xs ) { v = flat ( gen ) ; }
+                return [g,xs,expr] ()
+                {
+                  double s = 0 ;
+                  for ( const double v : *xs ) { g->x.setVal ( v ) ; s += expr->getVal () ; }
+                  Ostap::Bench::sink ( s ) ;
+                } ;
+              } , quick ) ;
+    }
+  }
+  // ==========================================================================
+  const Ostap::Bench::Register s_fused ( [] ( Registry& r )
+  {
+    add ( r , "sWeight" , [] () { return sweight () ; } , true ) ;
+    for ( const unsigned short depth : { 5 , 20 } )
+    {
+      add ( r , "efficiency,depth=" + std::to_string ( depth ) ,
+            [depth] () { return efficiency ( depth ) ; } , 5 == depth ) ;
+    }
+  } ) ;
+  // ==========================================================================
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
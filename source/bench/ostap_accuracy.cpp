@@ -0,0 +1,358 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/MoreMath.h"
+#include "Ostap/MoreMathBatch.h"
+#include "Ostap/Primitives.h"
+#include "Ostap/PrimitivesT.h"
+// ============================================================================
+/** @file ostap_accuracy.cpp
+ *  Accuracy sweep for the batch special functions:
+ *  each batch function is compared with the scalar implementation
+ *  over the set of the ranges and the maximal difference is reported
+ *  in units of the last place (ULP) of the scalar result
+ *
+ *  The batch functions, that call the scalar implementations in the loop,
+ *  must give exactly the same results (the bound is zero)
+ *
+ *  The compile-time combinators from Ostap/PrimitivesT.h
+ *  (<code>primitives_*</code>) are compared with std::function-based
+ *  classes from Ostap/Primitives.h in the same way
+ *
+ *  @code
+ *  ostap_accuracy
+ *  ostap_accuracy --filter=erf --points=1000000
+ *  @endcode
+ *
+ *  Options:
+ *  - <code>--filter=STRING</code> : check only the functions with the name containing the string
+ *  - <code>--points=N</code>      : number of points per range (default 100000)
+ *
+ *  The exit code is 1 if the stated accuracy is exceeded
+ *  @see Ostap::Math::Batch
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  typedef std::function<double(double)>                          ScalarFun ;
+  typedef std::function<void(std::size_t,const double*,double*)> BatchFun  ;
+  typedef std::function<double(double,double)>                   UnitFun   ;
+  // ==========================================================================
+  /// the unit in the last place
+  double ulp ( const double value )
+  {
+    const double a = std::abs ( value ) ;
+    if ( !std::isfinite ( a ) ) { return 0 ; }
+    return std::nextafter ( a , std::numeric_limits<double>::infinity () ) - a ;
+  }
+  // ==========================================================================
+  /// the difference in units
+  double distance
+  ( const double result ,
+    const double value  ,
+    const double unit   )
+  {
+    if ( std::isnan ( result ) && std::isnan ( value ) ) { return 0 ; }
+    if ( result == value ) { return 0 ; }
+    if ( !std::isfinite ( result ) || !std::isfinite ( value ) || !( 0 < unit ) )
+    { return std::numeric_limits<double>::infinity () ; }
+    return std::abs ( result - value ) / unit ;
+  }
+  // ==========================================================================
+  /// the checked function
+  struct Check
+  {
+    std::string                           name    ;
+    ScalarFun                             scalar  ;
+    BatchFun                              batch   ;
+    std::vector<std::pair<double,double>> ranges  ;
+    double                                bound   ;
+    /// the unit, by default ULP of the scalar result
+    UnitFun                               unit    { [] ( double , double v ) { return ulp ( v ) ; } } ;
+    /// the special values
+    std::vector<double>                   special {} ;
+  } ;
+  // ==========================================================================
+  /** the unit for the functions with \f$ e^{\pm x^2}\f$ factor:
+   *  the scalar implementations lose \f$ x^2 \f$ ULP in the exponent
+   */
+  double ulp_x2 ( const double x , const double value )
+  { return ulp ( value ) * std::max ( 1.0 , x * x ) ; }
+  // ==========================================================================
+  /** the unit for probit: the rounding of the argument is propagated
+   *  \f$ \delta z = \delta p / \phi(z) \f$
+   */
+  double ulp_probit ( const double p , const double z )
+  { return ulp ( z ) + ulp ( p ) / Ostap::Math::gauss_pdf ( z ) ; }
+  // ==========================================================================
+  /// the Clenshaw sums: unit is epsilon times the sum of absolute values of coefficients
+  double norm ( const std::vector<double>& p )
+  {
+    double s = 0 ;
+    for ( const double v : p ) { s += std::abs ( v ) ; }
+    return s * std::numeric_limits<double>::epsilon () ;
+  }
+  // ==========================================================================
+  /// the leaves for the combinators: without the batch evaluation
+  double fexp ( const double x ) { return std::exp ( -x ) ; }
+  double fsin ( const double x ) { return std::sin (  x ) ; }
+  /// the leaf with the batch evaluation
+  struct Poly : public Ostap::Math::Primitives::Expression
+  {
+    double operator() ( const double x ) const { return 1 + x * ( 0.5 - 0.25 * x ) ; }
+    void   operator() ( const double* x , double* r , const std::size_t n ) const
+    { for ( std::size_t i = 0 ; i < n ; ++i ) { r [ i ] = (*this) ( x [ i ] ) ; } }
+  } ;
+  // ==========================================================================
+  /// the batch evaluation is available only if all the leaves provide it
+  namespace P = Ostap::Math::Primitives ;
+  static_assert (  P::has_batch<decltype ( P::identity () * Poly () + 1.0        )>::value , "batch is lost" ) ;
+  static_assert (  P::has_batch<decltype ( P::maximum ( Poly () , P::identity () ) )>::value , "batch is lost" ) ;
+  static_assert ( !P::has_batch<decltype ( P::compose  ( &fsin  , P::identity () ) )>::value , "batch without batch leaves" ) ;
+  static_assert ( !P::has_batch<decltype ( P::multiply ( &fexp  , Poly ()        ) )>::value , "batch without batch leaves" ) ;
+  // ==========================================================================
+  /// the combinator: batch evaluation of the compile-time version
+  template <class F>
+  BatchFun primitive ( const F& f )
+  { return [f] ( std::size_t n , const double* x , double* r ) { P::evaluate ( f , x , r , n ) ; } ; }
+  /// the unit for the combinators: ULP of max(1,|value|)
+  double ulp_1 ( const double /* x */ , const double value )
+  { return ulp ( std::max ( 1.0 , std::abs ( value ) ) ) ; }
+  // ==========================================================================
+  std::vector<Check> checks ()
+  {
+    using namespace Ostap::Math ;
+    const double inf = std::numeric_limits<double>::infinity () ;
+    const double nan = std::numeric_limits<double>::quiet_NaN () ;
+    const std::vector<double> special { 0.0 , -0.0 , inf , -inf , nan } ;
+    //
+    static const std::vector<double> pars = [] ()
+      {
+        std::vector<double> p ( 20 ) ;
+        std::mt19937 gen ( 12345 ) ;
+        std::uniform_real_distribution<double> u ( -1 , 1 ) ;
+        for ( double& v : p ) { v = u ( gen ) ; }
+        return p ;
+      } () ;
+    const double pnorm = norm ( pars ) ;
+    //
+    std::vector<Check> result ;
+    result.push_back ( { "gauss_pdf" ,
+          [] ( double x ) { return gauss_pdf ( x , 0.5 , 1.5 ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::gauss_pdf ( n , x , r , 0.5 , 1.5 ) ; } ,
+          { { -5 , 5 } , { -50 , 50 } } , 3 } ) ;
+    result.back().unit    = [] ( double x , double v ) { return ulp_x2 ( ( x - 0.5 ) / 1.5 , v ) ; } ;
+    result.back().special = special ;
+    // the scalar gauss_cdf uses erf: compare with the accurate expression
+    result.push_back ( { "gauss_cdf" ,
+          [] ( double x ) { return 0.5 * std::erfc ( ( 0.5 - x ) / ( std::sqrt ( 2.0 ) * 1.5 ) ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::gauss_cdf ( n , x , r , 0.5 , 1.5 ) ; } ,
+          { { -5 , 5 } , { -50 , 50 } } , 10 } ) ;
+    result.back().unit    = [] ( double x , double v ) { return ulp_x2 ( ( x - 0.5 ) / 1.5 , v ) ; } ;
+    result.back().special = special ;
+    result.push_back ( { "erf"    ,
+          [] ( double x ) { return std::erf ( x ) ; } ,
+          Batch::erf    , { { -1 , 1 } , { -6 , 6 } } , 3 } ) ;
+    result.back().special = special ;
+    result.push_back ( { "erfc"   ,
+          [] ( double x ) { return std::erfc ( x ) ; } ,
+          Batch::erfc   , { { -1 , 1 } , { -6 , 6 } , { 0 , 27 } } , 8 } ) ;
+    result.back().special = special ;
+    result.push_back ( { "erfcx"  ,
+          [] ( double x ) { return erfcx ( x ) ; } ,
+          Batch::erfcx  , { { -1 , 1 } , { -26 , 0 } , { 0 , 100 } , { 0 , 1.e+9 } } , 3 } ) ;
+    result.back().unit    = ulp_x2  ;
+    result.back().special = special ;
+    result.push_back ( { "erfi"   ,
+          [] ( double x ) { return erfi ( x ) ; } ,
+          Batch::erfi   , { { -1 , 1 } , { -26 , 26 } } , 3 } ) ;
+    result.back().unit    = ulp_x2  ;
+    result.back().special = special ;
+    result.push_back ( { "dowson" ,
+          [] ( double x ) { return dowson ( x ) ; } ,
+          Batch::dowson , { { -1 , 1 } , { -100 , 100 } , { 0 , 1.e+9 } } , 2 } ) ;
+    result.back().special = special ;
+    result.push_back ( { "probit" ,
+          [] ( double x ) { return probit ( x ) ; } ,
+          Batch::probit , { { 0 , 1 } , { 0 , 0.03 } , { 0.97 , 1 } , { 0 , 1.e-10 } , { 0 , 1.e-300 } } , 4 } ) ;
+    result.back().unit    = ulp_probit ;
+    result.back().special = { 0.0 , 0.5 , 1.0 , -1.0 , 2.0 , nan } ;
+    //
+    result.push_back ( { "clenshaw_chebyshev" ,
+          [] ( double x ) { return clenshaw_chebyshev ( pars , x ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::clenshaw_chebyshev ( pars , n , x , r ) ; } ,
+          { { -1 , 1 } } , 2.0 * pars.size () } ) ;
+    result.back().unit = [pnorm] ( double , double ) { return pnorm ; } ;
+    result.push_back ( { "clenshaw_legendre"  ,
+          [] ( double x ) { return clenshaw_legendre  ( pars , x ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::clenshaw_legendre  ( pars , n , x , r ) ; } ,
+          { { -1 , 1 } } , 2.0 * pars.size () } ) ;
+    result.back().unit = [pnorm] ( double , double ) { return pnorm ; } ;
+    result.push_back ( { "clenshaw_polynom"   ,
+          [] ( double x ) { return clenshaw_polynom   ( pars , x ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::clenshaw_polynom   ( pars , n , x , r ) ; } ,
+          { { -1 , 1 } } , 2.0 * pars.size () } ) ;
+    result.back().unit = [pnorm] ( double , double ) { return pnorm ; } ;
+    //
+    // the scalar implementations in the loop: exactly the same results
+    result.push_back ( { "student_cdf" ,
+          [] ( double t ) { return student_cdf ( t , 3.5 ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::student_cdf ( n , x , r , 3.5 ) ; } ,
+          { { -10 , 10 } } , 0 } ) ;
+    result.push_back ( { "owen" ,
+          [] ( double h ) { return owen ( h , 0.7 ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::owen ( n , x , r , 0.7 ) ; } ,
+          { { -5 , 5 } } , 0 } ) ;
+    result.push_back ( { "igamma" ,
+          [] ( double x ) { return igamma ( x ) ; } ,
+          Batch::igamma , { { 0.1 , 10 } } , 0 } ) ;
+    result.push_back ( { "bessel_Kn" ,
+          [] ( double x ) { return bessel_Kn ( 2 , x ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::bessel_Kn ( n , x , r , 2 ) ; } ,
+          { { 0.1 , 20 } } , 0 } ) ;
+    result.push_back ( { "bessel_Knu" ,
+          [] ( double x ) { return bessel_Knu ( 1.3 , x ) ; } ,
+          [] ( std::size_t n , const double* x , double* r ) { Batch::bessel_Knu ( n , x , r , 1.3 ) ; } ,
+          { { 0.1 , 20 } } , 0 } ) ;
+    result.push_back ( { "elliptic_K" ,
+          [] ( double k ) { return elliptic_K ( k ) ; } ,
+          Batch::elliptic_K , { { 0 , 0.99 } } , 0 } ) ;
+    result.push_back ( { "elliptic_E" ,
+          [] ( double k ) { return elliptic_E ( k ) ; } ,
+          Batch::elliptic_E , { { 0 , 0.99 } } , 0 } ) ;
+    //
+    // the compile-time combinators vs std::function-based classes
+    {
+      const auto x = P::identity   () ;
+      const auto p = Poly          () ;
+      const auto e = P::expression ( &fexp ) ;
+      const std::vector<std::pair<double,double>> range { { -3 , 3 } } ;
+      result.push_back ( { "primitives_linear"   , Linear   ( &fexp , 2 , Poly () , -3 )  ,
+            primitive ( P::linear   ( &fexp , 2 , Poly () , -3 ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_compose"  , Compose  ( &fsin , Poly () , 1.5 , 0.5 ) ,
+            primitive ( P::compose  ( &fsin , Poly () , 1.5 , 0.5 ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_scale"    , Linear   ( &fsin , 2.5 , Const ( -1 ) , 1 ) ,
+            primitive ( P::scale    ( &fsin , 2.5 , -1 ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_multiply" , Multiply ( &fexp , Poly () ) ,
+            primitive ( P::multiply ( &fexp , Poly () ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_divide"   , Divide   ( Poly () , &fexp ) ,
+            primitive ( P::divide   ( Poly () , &fexp ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_max"      , Max      ( &fsin , Poly () ) ,
+            primitive ( P::maximum  ( &fsin , Poly () ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_min"      , Min      ( &fsin , Poly () ) ,
+            primitive ( P::minimum  ( &fsin , Poly () ) ) , range , 2 } ) ;
+      // the arithmetic operators
+      result.push_back ( { "primitives_op1" ,
+            [] ( double t ) { return std::sin ( 2 * t + 1 ) * Poly () ( t ) - 3 ; } ,
+            primitive ( P::compose ( &fsin , 2 * x + 1 ) * p - 3.0 ) , range , 2 } ) ;
+      result.push_back ( { "primitives_op2" ,
+            [] ( double t ) { return ( Poly () ( t ) + t ) / ( 2 - std::exp ( -t ) ) ; } ,
+            primitive ( ( p + x ) / ( 2.0 - e ) ) , range , 2 } ) ;
+      result.push_back ( { "primitives_op3" ,
+            [] ( double t ) { return -t * Poly () ( t ) + 1 / ( 1 + t * t ) ; } ,
+            primitive ( -( x * p ) + 1.0 / ( 1.0 + x * x ) ) , range , 2 } ) ;
+      for ( auto i = result.end () - 10 ; i != result.end () ; ++i ) { i->unit = ulp_1 ; }
+    }
+    //
+    return result ;
+  }
+  // ==========================================================================
+  /// get the value of the option "--name=value"
+  bool option ( const std::string& arg   ,
+                const std::string& name  ,
+                std::string&       value )
+  {
+    const std::string prefix = "--" + name + "=" ;
+    if ( 0 != arg.compare ( 0 , prefix.size () , prefix ) ) { return false ; }
+    value = arg.substr ( prefix.size () ) ;
+    return true ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+int main ( int argc , char** argv )
+{
+  std::string filter {}     ;
+  std::size_t points = 100000 ;
+  //
+  for ( int i = 1 ; i < argc ; ++i )
+  {
+    const std::string arg = argv [ i ] ;
+    std::string value ;
+    if      ( option ( arg , "filter" , value ) ) { filter = value ; }
+    else if ( option ( arg , "points" , value ) ) { points = std::max ( 2L , std::atol ( value.c_str () ) ) ; }
+    else
+    {
+      std::cerr << "ostap_accuracy: unknown option '" << arg << "'\n"
+                << "usage: ostap_accuracy [--filter=STRING] [--points=N]" << std::endl ;
+      return 2 ;
+    }
+  }
+  //
+  std::cout << "Instruction set: " << Ostap::Math::Batch::simd () << '\n'
+            << std::left  << std::setw ( 20 ) << "Function"
+            << std::right << std::setw ( 10 ) << "Points"
+            << std::setw ( 14 ) << "Max error"
+            << std::setw ( 16 ) << "at x"
+            << std::setw ( 10 ) << "Bound" << "  Status" << '\n' ;
+  //
+  std::mt19937 gen ( 42 ) ;
+  unsigned int failed = 0 ;
+  for ( const Check& c : checks () )
+  {
+    if ( !filter.empty () && std::string::npos == c.name.find ( filter ) ) { continue ; }
+    //
+    std::vector<double> x ( c.special ) ;
+    for ( const auto& r : c.ranges )
+    {
+      // the regular grid and the random points
+      std::uniform_real_distribution<double> u ( r.first , r.second ) ;
+      for ( std::size_t i = 0 ; i < points ; ++i )
+      { x.push_back ( r.first + ( r.second - r.first ) * i / ( points - 1 ) ) ; }
+      for ( std::size_t i = 0 ; i < points ; ++i ) { x.push_back ( u ( gen ) ) ; }
+    }
+    //
+    std::vector<double> y ( x.size () ) ;
+    c.batch ( x.size () , x.data () , y.data () ) ;
+    //
+    double worst = 0 ;
+    double where = 0 ;
+    for ( std::size_t i = 0 ; i < x.size () ; ++i )
+    {
+      const double value = c.scalar ( x [ i ] ) ;
+      const double d     = distance ( y [ i ] , value , c.unit ( x [ i ] , value ) ) ;
+      if ( worst < d || std::isnan ( d ) ) { worst = d ; where = x [ i ] ; }
+    }
+    //
+    const bool ok = worst <= c.bound ;
+    if ( !ok ) { ++failed ; }
+    std::cout << std::left  << std::setw ( 20 ) << c.name
+              << std::right << std::setw ( 10 ) << x.size ()
+              << std::setw ( 14 ) << std::setprecision ( 4 ) << worst
+              << std::setw ( 16 ) << std::setprecision ( 8 ) << where
+              << std::setw ( 10 ) << c.bound
+              << ( ok ? "  OK" : "  FAILED" ) << '\n' ;
+  }
+  //
+  return 0 == failed ? 0 : 1 ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
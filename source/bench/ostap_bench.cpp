@@ -0,0 +1,154 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+// ============================================================================
+// local
+// ============================================================================
+#include "Bench.h"
+// ============================================================================
+/** @file ostap_bench.cpp
+ *  Micro-benchmarks for the C++ kernels of Ostap
+ *
+ *  @code
+ *  ostap_bench --list
+ *  ostap_bench --format=json --output=baseline.json
+ *  ostap_bench --baseline=baseline.json --threshold=0.10
+ *  ostap_bench --filter=Bernstein --quick
+ *  @endcode
+ *
+ *  Options:
+ *  - <code>--format=text|json|csv</code> : the output format
+ *  - <code>--output=FILE</code>          : write results to the file instead of stdout
+ *  - <code>--baseline=FILE</code>        : compare with the baseline (JSON or CSV)
+ *  - <code>--threshold=X</code>          : allowed relative slowdown (default 0.10)
+ *  - <code>--filter=STRING</code>        : run only the cases with the key containing the string
+ *  - <code>--min-time=SECONDS</code>     : minimal time for each repetition (default 0.2)
+ *  - <code>--repetitions=N</code>        : number of repetitions (default 5)
+ *  - <code>--quick</code>                : run only the reduced set of the cases
+ *  - <code>--list</code>                 : list all cases
+ *
+ *  The exit code is 1 if the regressions with respect to the baseline are found
+ *
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// get the value of the option "--name=value"
+  bool option ( const std::string& arg   ,
+                const std::string& name  ,
+                std::string&       value )
+  {
+    const std::string prefix = "--" + name + "=" ;
+    if ( 0 != arg.compare ( 0 , prefix.size () , prefix ) ) { return false ; }
+    value = arg.substr ( prefix.size () ) ;
+    return true ;
+  }
+  // ==========================================================================
+  void usage ( std::ostream& stream )
+  {
+    stream << "usage: ostap_bench [--format=text|json|csv] [--output=FILE]\n"
+           << "                   [--baseline=FILE] [--threshold=X] [--filter=STRING]\n"
+           << "                   [--min-time=SECONDS] [--repetitions=N] [--quick] [--list]\n" ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+int main ( int argc , char** argv )
+{
+  Ostap::Bench::Config config ;
+  std::string format    = "text" ;
+  std::string output    {}       ;
+  std::string baseline  {}       ;
+  double      threshold = 0.10   ;
+  bool        list      = false  ;
+  //
+  for ( int i = 1 ; i < argc ; ++i )
+  {
+    const std::string arg = argv [ i ] ;
+    std::string value ;
+    if      ( "--quick" == arg ) { config.quick = true ; }
+    else if ( "--list"  == arg ) { list         = true ; }
+    else if ( "--help"  == arg || "-h" == arg ) { usage ( std::cout ) ; return 0 ; }
+    else if ( option ( arg , "format"      , value ) ) { format             = value ; }
+    else if ( option ( arg , "output"      , value ) ) { output             = value ; }
+    else if ( option ( arg , "baseline"    , value ) ) { baseline           = value ; }
+    else if ( option ( arg , "filter"      , value ) ) { config.filter      = value ; }
+    else if ( option ( arg , "threshold"   , value ) ) { threshold          = std::atof ( value.c_str () ) ; }
+    else if ( option ( arg , "min-time"    , value ) ) { config.min_time    = std::atof ( value.c_str () ) ; }
+    else if ( option ( arg , "repetitions" , value ) ) { config.repetitions = std::atoi ( value.c_str () ) ; }
+    else
+    {
+      std::cerr << "ostap_bench: unknown option '" << arg << "'" << std::endl ;
+      usage ( std::cerr ) ;
+      return 2 ;
+    }
+  }
+  //
+  if ( "text" != format && "json" != format && "csv" != format )
+  {
+    std::cerr << "ostap_bench: unknown format '" << format << "'" << std::endl ;
+    return 2 ;
+  }
+  //
+  if ( list )
+  {
+    for ( const auto& c : Ostap::Bench::Registry::instance ().cases () )
+    { std::cout << c.key () << ( c.quick ? "  [quick]" : "" ) << '\n' ; }
+    return 0 ;
+  }
+  //
+  // read the baseline before the run to fail early
+  std::vector<Ostap::Bench::Result> base ;
+  if ( !baseline.empty () )
+  {
+    base = Ostap::Bench::read_baseline ( baseline ) ;
+    if ( base.empty () )
+    {
+      std::cerr << "ostap_bench: no results in the baseline '" << baseline << "'" << std::endl ;
+      return 2 ;
+    }
+  }
+  //
+  const std::vector<Ostap::Bench::Result> results = Ostap::Bench::run ( config ) ;
+  //
+  std::ofstream file ;
+  if ( !output.empty () )
+  {
+    file.open ( output ) ;
+    if ( !file )
+    {
+      std::cerr << "ostap_bench: cannot open '" << output << "'" << std::endl ;
+      return 2 ;
+    }
+  }
+  std::ostream& stream = output.empty () ? std::cout : file ;
+  //
+  if      ( "json" == format ) { Ostap::Bench::write_json ( stream , results ) ; }
+  else if ( "csv"  == format ) { Ostap::Bench::write_csv  ( stream , results ) ; }
+  else                         { Ostap::Bench::write_text ( stream , results ) ; }
+  //
+  if ( base.empty () ) { return 0 ; }
+  //
+  const std::size_t regressions =
+    Ostap::Bench::compare ( std::cout , results , base , threshold ) ;
+  if ( 0 < regressions )
+  {
+    std::cerr << "ostap_bench: " << regressions
+              << " regression(s) above " << 100 * threshold << "%" << std::endl ;
+    return 1 ;
+  }
+  return 0 ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
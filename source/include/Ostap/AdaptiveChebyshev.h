@@ -0,0 +1,182 @@
+// ============================================================================
+#ifndef OSTAP_ADAPTIVECHEBYSHEV_H
+#define OSTAP_ADAPTIVECHEBYSHEV_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class AdaptiveChebyshev Ostap/AdaptiveChebyshev.h
+     *  Lazily built piecewise Chebyshev approximation of
+     *  the expensive 1D function in the range \f$ [x_{min},x_{max}]\f$
+     *
+     *  - for each piece the function is sampled at Chebyshev-Lobatto points,
+     *    \f$ N = 16, 32, 64, ... , N_{max}\f$ (the samples are reused),
+     *    and the coefficients are obtained via discrete cosine transform
+     *  - the expansion is accepted when the tail coefficients are below
+     *    the requested precision, otherwise the piece is split into two halves
+     *  - the negligible trailing coefficients are chopped
+     *  - the approximation is evaluated with Clenshaw recurrence,
+     *    the batch evaluation is (optionally) parallel
+     *    @see Ostap::Utils::ThreadPool
+     *  - the integral is calculated exactly from the coefficients
+     *  - outside the range the function is evaluated directly
+     *  - if the key-function is specified, the approximation is rebuilt
+     *    each time the key changes (e.g. the parameters of the function)
+     *  - the approximation is shared between the copies and
+     *    the concurrent evaluations are thread-safe
+     *
+     *  Unlike Ostap::Math::ChebyshevApproximation the order is not fixed
+     *  and the approximation is guaranteed (up to the limits on the
+     *  number of pieces) to reproduce the function with the given precision
+     *
+     *  @code
+     *  const Ostap::Math::Voigt voigt ( 1.0 , 0.01 , 0.005 ) ;
+     *  const Ostap::Math::AdaptiveChebyshev a ( voigt , 0.8 , 1.2 , 1.e-10 ) ;
+     *  const double value = a ( 1.01 ) ;
+     *  const double integ = a.integral ( 0.9 , 1.1 ) ;
+     *  @endcode
+     *  @see Ostap::Math::ChebyshevApproximation
+     *  @see Ostap::Math::TabulatedFunction
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class AdaptiveChebyshev
+    {
+    public:
+      // ======================================================================
+      /// the function to be approximated
+      typedef std::function<double(double)> Function ;
+      /// the key function: the approximation is rebuilt when the key changes
+      typedef std::function<std::size_t()>  Key      ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the function and the range
+       *  @param fun       the function
+       *  @param xmin      low  edge of the approximation range
+       *  @param xmax      high edge of the approximation range
+       *  @param precision the relative precision of the approximation
+       *  @param maxorder  maximal order of the polynomial in one piece
+       *  @param maxpieces maximal number of pieces
+       *  @param key       the key function (if any)
+       */
+      AdaptiveChebyshev
+      ( Function           fun                ,
+        const double       xmin               ,
+        const double       xmax               ,
+        const double       precision = 1.e-10 ,
+        const unsigned int maxorder  = 128    ,
+        const std::size_t  maxpieces = 1000   ,
+        Key                key       = Key () ) ;
+      // ======================================================================
+      /// copy constructor: the approximation is shared
+      AdaptiveChebyshev ( const AdaptiveChebyshev&  right ) ;
+      /// default constructor (needed for serialization)
+      AdaptiveChebyshev () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// evaluate the function
+      double operator() ( const double x ) const { return evaluate ( x ) ; }
+      /// evaluate the function
+      double evaluate   ( const double x ) const ;
+      /** evaluate the function for the array of points
+       *  @param n      number of points
+       *  @param x      (input)  the points
+       *  @param result (output) the values
+       */
+      void   evaluate
+      ( const std::size_t n      ,
+        const double*     x      ,
+        double*           result ) const ;
+      /// evaluate the function for the vector of points
+      std::vector<double> evaluate ( const std::vector<double>& x ) const ;
+      /// evaluate the original function (no approximation)
+      double exact      ( const double x ) const { return m_fun ( x ) ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the integral over the whole approximation range
+      double integral   () const ;
+      /** get the integral between low and high
+       *  (the function is integrated numerically outside the range)
+       */
+      double integral   ( const double low , const double high ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low  edge of the approximation range
+      double       xmin      () const { return m_xmin      ; }
+      /// high edge of the approximation range
+      double       xmax      () const { return m_xmax      ; }
+      /// the requested relative precision
+      double       precision () const { return m_precision ; }
+      /// maximal order of the polynomial in one piece
+      unsigned int maxorder  () const { return m_maxorder  ; }
+      /// maximal number of pieces
+      std::size_t  maxpieces () const { return m_maxpieces ; }
+      /// number of pieces (the approximation is built if needed)
+      std::size_t  npieces   () const ;
+      /// total number of coefficients (the approximation is built if needed)
+      std::size_t  size      () const ;
+      /// get the edges of the pieces (the approximation is built if needed)
+      std::vector<double> edges        () const ;
+      /// get the coefficients for the given piece
+      std::vector<double> coefficients ( const std::size_t piece ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// drop the approximation, it will be rebuilt at next call
+      void reset () const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual approximation
+      class Table ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// get the valid approximation (build it if needed)
+      std::shared_ptr<const Table> table () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the function
+      Function     m_fun       {        } ; // the function
+      /// low edge
+      double       m_xmin      { 0      } ; // low edge
+      /// high edge
+      double       m_xmax      { 1      } ; // high edge
+      /// relative precision
+      double       m_precision { 1.e-10 } ; // relative precision
+      /// maximal order
+      unsigned int m_maxorder  { 128    } ; // maximal order
+      /// maximal number of pieces
+      std::size_t  m_maxpieces { 1000   } ; // maximal number of pieces
+      /// the key function
+      Key          m_key       {        } ; // the key function
+      /// the approximation itself
+      mutable std::shared_ptr<const Table> m_table {} ; //! the approximation itself
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_ADAPTIVECHEBYSHEV_H
+// ============================================================================
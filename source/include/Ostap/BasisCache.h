@@ -0,0 +1,304 @@
+// ============================================================================
+#ifndef OSTAP_BASISCACHE_H
+#define OSTAP_BASISCACHE_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// ============================================================================
+// forward declarations
+// ============================================================================
+class RooAbsData ; // RooFit
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class BasisCache Ostap/BasisCache.h
+     *  Cache of the basis functions for the functions that are linear
+     *  in the coefficients, \f$ f(x) = \sum_k c_k \phi_k(x) \f$,
+     *  e.g. Bernstein, Legendre, Chebyshev sums, B-splines and their
+     *  2D/3D counterparts.
+     *
+     *  For unbinned fits the observables never change, while
+     *  the coefficients are varied by Minuit. The values of the basis
+     *  functions \f$ \phi_k(x_i) \f$ are precomputed once for all
+     *  (distinct) points of the dataset, and the function values
+     *  for the new coefficients are obtained via the matrix-vector product,
+     *  that is calculated (in parallel) once per set of coefficients.
+     *
+     *  - the basis values could be stored in single precision
+     *  - if the required memory exceeds the limit the cache is not built,
+     *    and the function is evaluated directly
+     *  - for the points that are not in the cache
+     *    (e.g. drawing) the function is evaluated directly
+     *  - the cache is built for the certain basis (degree, range, knots),
+     *    identified by the key, and is not valid for the other basis
+     *
+     *  @code
+     *  const Ostap::Math::Bernstein b ( 5 , 0 , 1 ) ;
+     *  Ostap::Math::BasisCache cache ( b.npars () , false ,
+     *    Ostap::Math::BasisCache::s_MAXMEMORY , Ostap::Math::BasisCache::key1D ( b ) ) ;
+     *  cache.fill ( data , { "x" } , Ostap::Math::BasisCache::basis1D ( b ) ) ;
+     *  double value ;
+     *  if ( cache.valid ( Ostap::Math::BasisCache::key1D ( b ) ) &&
+     *       cache.value ( x , b.pars () , value ) ) { ... }
+     *  @endcode
+     *  @see Ostap::Models::PolyPositive::cacheBasis
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class BasisCache
+    {
+    public:
+      // ======================================================================
+      /// the point: the values of observables (at most 4)
+      typedef std::array<double,4>                      Point ;
+      /// the basis: fill the values of all basis functions for the point
+      typedef std::function<void(const Point&,double*)> Basis ;
+      /// default memory limit (bytes)
+      static const std::size_t s_MAXMEMORY ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor
+       *  @param nbasis    number of basis functions
+       *  @param single    store the basis values in single precision
+       *  @param maxmemory the memory limit (bytes) for the basis values
+       *  @param key       the key of the basis, e.g. from key1D/key2D/key3D
+       */
+      BasisCache
+      ( const unsigned short nbasis    = 0           ,
+        const bool           single    = false       ,
+        const std::size_t    maxmemory = s_MAXMEMORY ,
+        const std::size_t    key       = 0           ) ;
+      // ======================================================================
+      /// non-copyable
+      BasisCache ( const BasisCache& ) = delete ;
+      BasisCache& operator=( const BasisCache& ) = delete ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** add the point
+       *  @param point the point
+       *  @param basis the values of basis functions at this point
+       *  @return false if the memory limit is exceeded
+       */
+      bool add ( const Point& point , const double* basis ) ;
+      // ======================================================================
+      /** fill the cache from the dataset
+       *  @param data        the dataset
+       *  @param observables the names of observables (at most 4)
+       *  @param basis       the basis
+       *  @return false if observables are not in dataset or memory limit is exceeded
+       */
+      bool fill
+      ( const RooAbsData&               data        ,
+        const std::vector<std::string>& observables ,
+        Basis                           basis       ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the function value for the point from the cache
+       *  @param point  the point
+       *  @param pars   the coefficients
+       *  @param result (OUTPUT) the function value
+       *  @return false if the point is not in the cache
+       */
+      bool value
+      ( const Point&               point  ,
+        const std::vector<double>& pars   ,
+        double&                    result ) const ;
+      // ======================================================================
+      /// get the function value for the point from the cache
+      bool value
+      ( const double               x      ,
+        const std::vector<double>& pars   ,
+        double&                    result ) const
+      { return value ( Point { { x , 0 , 0 , 0 } } , pars , result ) ; }
+      /// get the function value for the point from the cache
+      bool value
+      ( const double               x      ,
+        const double               y      ,
+        const std::vector<double>& pars   ,
+        double&                    result ) const
+      { return value ( Point { { x , y , 0 , 0 } } , pars , result ) ; }
+      /// get the function value for the point from the cache
+      bool value
+      ( const double               x      ,
+        const double               y      ,
+        const double               z      ,
+        const std::vector<double>& pars   ,
+        double&                    result ) const
+      { return value ( Point { { x , y , z , 0 } } , pars , result ) ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// number of (distinct) points
+      std::size_t    size      () const { return m_points.size () ; }
+      /// number of basis functions
+      unsigned short nbasis    () const { return m_nbasis    ; }
+      /// single precision?
+      bool           single    () const { return m_single    ; }
+      /// the memory limit
+      std::size_t    maxmemory () const { return m_maxmemory ; }
+      /// the memory used for the basis values
+      std::size_t    memory    () const ;
+      /// the key of the basis
+      std::size_t    key       () const { return m_key       ; }
+      /** is the cache valid for the basis with this key?
+       *  If the degree, the range or the knots are changed,
+       *  the cache is not valid and must be rebuilt
+       */
+      bool           valid     ( const std::size_t key ) const { return key == m_key ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** the key of the basis
+       *  @param nbasis number of basis functions
+       *  @param begin  start of the parameters that define the basis (range, knots,...)
+       *  @param end    end   of the parameters that define the basis (range, knots,...)
+       */
+      static std::size_t key
+      ( const std::size_t nbasis ,
+        const double*     begin  ,
+        const double*     end    ) ;
+      /// the key of the basis for 1D-function: number of parameters and the range
+      template <class FUNCTION>
+      static std::size_t key1D ( const FUNCTION& fun )
+      {
+        const double r [] = { fun.xmin () , fun.xmax () } ;
+        return key ( fun.npars () , r , r + 2 ) ;
+      }
+      /// the key of the basis for 1D-spline: number of parameters and the knots
+      template <class SPLINE>
+      static std::size_t keySpline ( const SPLINE& fun )
+      {
+        const std::vector<double>& k = fun.knots () ;
+        return key ( fun.npars () , k.data () , k.data () + k.size () ) ;
+      }
+      /// the key of the basis for 2D-function: degrees and ranges
+      template <class FUNCTION>
+      static std::size_t key2D ( const FUNCTION& fun )
+      {
+        const double r [] = { 1.0 * fun.nX () , 1.0 * fun.nY () ,
+                              fun.xmin () , fun.xmax () , fun.ymin () , fun.ymax () } ;
+        return key ( fun.npars () , r , r + 6 ) ;
+      }
+      /// the key of the basis for 3D-function: degrees and ranges
+      template <class FUNCTION>
+      static std::size_t key3D ( const FUNCTION& fun )
+      {
+        const double r [] = { 1.0 * fun.nX () , 1.0 * fun.nY () , 1.0 * fun.nZ () ,
+                              fun.xmin () , fun.xmax () , fun.ymin () , fun.ymax () ,
+                              fun.zmin () , fun.zmax () } ;
+        return key ( fun.npars () , r , r + 9 ) ;
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** create the basis from 1D-function that is linear in the coefficients
+       *  the basis functions are the copies of the function with unit coefficients
+       */
+      template <class FUNCTION>
+      static Basis basis1D ( const FUNCTION& fun )
+      {
+        auto units = make_units ( fun ) ;
+        return [units] ( const Point& p , double* b )
+        { for ( std::size_t k = 0 ; k < units->size () ; ++k ) { b [ k ] = (*units) [ k ] ( p [ 0 ] ) ; } } ;
+      }
+      /// create the basis from 2D-function that is linear in the coefficients
+      template <class FUNCTION>
+      static Basis basis2D ( const FUNCTION& fun )
+      {
+        auto units = make_units ( fun ) ;
+        return [units] ( const Point& p , double* b )
+        { for ( std::size_t k = 0 ; k < units->size () ; ++k ) { b [ k ] = (*units) [ k ] ( p [ 0 ] , p [ 1 ] ) ; } } ;
+      }
+      /// create the basis from 3D-function that is linear in the coefficients
+      template <class FUNCTION>
+      static Basis basis3D ( const FUNCTION& fun )
+      {
+        auto units = make_units ( fun ) ;
+        return [units] ( const Point& p , double* b )
+        { for ( std::size_t k = 0 ; k < units->size () ; ++k ) { b [ k ] = (*units) [ k ] ( p [ 0 ] , p [ 1 ] , p [ 2 ] ) ; } } ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the copies of function with unit coefficients
+      template <class FUNCTION>
+      static std::shared_ptr<const std::vector<FUNCTION> >
+      make_units ( const FUNCTION& fun )
+      {
+        auto units = std::make_shared<std::vector<FUNCTION> > () ;
+        for ( unsigned short k = 0 ; k < fun.npars () ; ++k )
+        {
+          FUNCTION u ( fun ) ;
+          for ( unsigned short j = 0 ; j < u.npars () ; ++j ) { u.setPar ( j , k == j ? 1.0 : 0.0 ) ; }
+          units->push_back ( u ) ;
+        }
+        return units ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the function values for certain coefficients
+      class Values ;
+      /// get the function values for all points
+      std::shared_ptr<const Values> values ( const std::vector<double>& pars ) const ;
+      /// find the point
+      std::size_t index ( const Point& point ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// hash for the point
+      struct PointHash
+      { std::size_t operator() ( const Point& p ) const ; } ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// number of basis functions
+      unsigned short                                   m_nbasis    ;
+      /// single precision ?
+      bool                                             m_single    ;
+      /// the memory limit
+      std::size_t                                      m_maxmemory ;
+      /// the key of the basis
+      std::size_t                                      m_key       ;
+      /// the points
+      std::vector<Point>                               m_points    ;
+      /// the basis values (double precision)
+      std::vector<double>                              m_double    ;
+      /// the basis values (single precision)
+      std::vector<float>                               m_float     ;
+      /// the point -> index map
+      std::unordered_map<Point,std::size_t,PointHash>  m_index     ;
+      /// the last found index
+      mutable std::atomic<std::size_t>                 m_last      ;
+      /// the function values for the last coefficients
+      mutable std::shared_ptr<const Values>            m_values    ;
+      /// the lock for the calculation of the function values
+      mutable std::mutex                               m_mutex     ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_BASISCACHE_H
+// ============================================================================
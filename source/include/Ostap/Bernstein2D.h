@@ -75,6 +75,16 @@ namespace Ostap
       /// get the value
       double operator () ( const double x , const double y ) const 
       { return evaluate ( x , y ) ; }
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const ;
       // ======================================================================
     public: // setters
       // ======================================================================
@@ -271,7 +281,11 @@ namespace Ostap
       // ======================================================================
       /// helper function to make calculations
       double calculate ( const std::vector<double>& fx , 
-                         const std::vector<double>& fy ) const ;
+                         const std::vector<double>& fy ) const 
+      { return calculate ( fx.data () , fy.data () ) ; }
+      /// helper function to make calculations
+      double calculate ( const double* fx , 
+                         const double* fy ) const ;
       // ======================================================================
     private:
       // ======================================================================
@@ -362,6 +376,17 @@ namespace Ostap
       /// get the value
       double operator () ( const double x , const double y ) const
       { return evaluate    ( x , y ) ; }
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const 
+      { m_bernstein.evaluate ( n , x , y , result ) ; }
       // ======================================================================
     public:
       // ======================================================================
@@ -537,6 +562,16 @@ namespace Ostap
       /// get the value
       double operator () ( const double x , const double y ) const 
       { return evaluate ( x , y ) ; }
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const ;
       // ======================================================================
     public:
       // ======================================================================
@@ -729,7 +764,11 @@ namespace Ostap
       // ======================================================================
       /// helper function to make calculations
       double calculate ( const std::vector<double>& fx , 
-                         const std::vector<double>& fy ) const ;
+                         const std::vector<double>& fy ) const 
+      { return calculate ( fx.data () , fy.data () ) ; }
+      /// helper function to make calculations
+      double calculate ( const double* fx , 
+                         const double* fy ) const ;
       // ======================================================================
    private:
       // ======================================================================
@@ -809,6 +848,17 @@ namespace Ostap
       /// get the value
       double operator () ( const double x , const double y ) const 
       { return evaluate ( x , y ) ; }
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const 
+      { m_bernstein.evaluate ( n , x , y , result ) ; }
       // ======================================================================
     public:
       // ======================================================================
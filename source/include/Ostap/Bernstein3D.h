@@ -82,6 +82,19 @@ namespace Ostap
                            const double z ) const 
       { return evaluate ( x ,   y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const ;
+      // ======================================================================
     public: // setters
       // ======================================================================
       /// set k-parameter
@@ -385,7 +398,12 @@ namespace Ostap
       /// helper function to make calculations
       double calculate ( const std::vector<double>& fx , 
                          const std::vector<double>& fy , 
-                         const std::vector<double>& fz ) const ;
+                         const std::vector<double>& fz ) const 
+      { return calculate ( fx.data () , fy.data () , fz.data () ) ; }
+      /// helper function to make calculations
+      double calculate ( const double* fx , 
+                         const double* fy , 
+                         const double* fz ) const ;
       // ======================================================================
     private:
       // ======================================================================
@@ -475,6 +493,19 @@ namespace Ostap
                            const double z ) const 
       { return evaluate ( x ,   y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const ;
+      // ======================================================================
     public: // setters
       // ======================================================================
       /// set k-parameter
@@ -783,7 +814,12 @@ namespace Ostap
       /// helper function to make calculations
       double calculate ( const std::vector<double>& fx , 
                          const std::vector<double>& fy , 
-                         const std::vector<double>& fz ) const ;
+                         const std::vector<double>& fz ) const 
+      { return calculate ( fx.data () , fy.data () , fz.data () ) ; }
+      /// helper function to make calculations
+      double calculate ( const double* fx , 
+                         const double* fy , 
+                         const double* fz ) const ;
       // ======================================================================
     private:
       // ======================================================================
@@ -864,6 +900,19 @@ namespace Ostap
                            const double z ) const 
       { return evaluate ( x ,   y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const ;
+      // ======================================================================
     public: // setters
       // ======================================================================
       /// set k-parameter
@@ -1164,7 +1213,12 @@ namespace Ostap
       /// helper function to make calculations
       double calculate ( const std::vector<double>& fx , 
                          const std::vector<double>& fy , 
-                         const std::vector<double>& fz ) const ;
+                         const std::vector<double>& fz ) const 
+      { return calculate ( fx.data () , fy.data () , fz.data () ) ; }
+      /// helper function to make calculations
+      double calculate ( const double* fx , 
+                         const double* fy , 
+                         const double* fz ) const ;
       // ======================================================================
     private:
       // ======================================================================
@@ -1255,6 +1309,20 @@ namespace Ostap
                            const double z ) const
       { return evaluate  ( x , y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const
+      { m_bernstein.evaluate ( n , x , y , z , result ) ; }
+      // ======================================================================
     public:
       // ======================================================================
       /// get number of parameters
@@ -1521,6 +1589,20 @@ namespace Ostap
                            const double z ) const
       { return evaluate  ( x , y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const
+      { m_bernstein.evaluate ( n , x , y , z , result ) ; }
+      // ======================================================================
     public:
       // ======================================================================
       /// get number of parameters
@@ -1791,6 +1873,20 @@ namespace Ostap
                            const double z ) const
       { return evaluate  ( x , y , z ) ; }
       // ======================================================================
+      /** evaluate the polynomial for the batch of points 
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param z      (INPUT)  z-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           const double*     z      , 
+                           double*           result ) const
+      { m_bernstein.evaluate ( n , x , y , z , result ) ; }
+      // ======================================================================
     public:
       // ======================================================================
       /// get number of parameters
@@ -144,6 +144,20 @@ namespace Ostap
       /// describe the channel 
       virtual std::string describe  () const = 0 ;
       // =======================================================================
+    public: // tabulation
+      // =======================================================================
+      /** get the copy of the channel where the expensive mass-dependent 
+       *  functions are replaced by the interpolation tables 
+       *  @see Ostap::Math::TabulatedFunction
+       *  @param smax      upper edge of the tabulation range in \f$ s \f$
+       *  @param precision relative precision of the interpolation 
+       *  @return new channel or <code>nullptr</code> if the channel 
+       *  has nothing to tabulate (or it is already tabulated in this range)
+       */
+      virtual ChannelBW* tabulated 
+      ( const double /* smax      */         , 
+        const double /* precision */ = 1.e-7 ) const { return nullptr ; }
+      // =======================================================================
     public: // interpret it as (a partial) width 
       // =======================================================================
       /// get the partial width for the channel 
@@ -422,6 +436,11 @@ namespace Ostap
       /// clone the channel 
       ChannelWidth* clone () const override ;
       // ======================================================================
+      /// get the copy of the channel with the tabulated width 
+      ChannelWidth* tabulated 
+      ( const double smax              , 
+        const double precision = 1.e-7 ) const override ;
+      // ======================================================================
     public:
       // =======================================================================
       template <class WIDTH>
@@ -526,6 +545,11 @@ namespace Ostap
       /// clone the channel 
       ChannelGamma* clone () const override ;
       // ======================================================================
+      /// get the copy of the channel with the tabulated width 
+      ChannelGamma* tabulated 
+      ( const double smax              , 
+        const double precision = 1.e-7 ) const override ;
+      // ======================================================================
     public:
       // =======================================================================
       template <class WIDTH>
@@ -972,6 +996,11 @@ namespace Ostap
       // =======================================================================
       /// clone method
       ChannelGLR*  clone() const override ; // clone method
+      // ======================================================================
+      /// get the copy of the channel with all functions tabulated 
+      ChannelGLR* tabulated 
+      ( const double smax              , 
+        const double precision = 1.e-7 ) const override ;
       // =======================================================================
     public:
       // =======================================================================
@@ -1178,6 +1207,37 @@ namespace Ostap
       /// unique tag/label 
       virtual std::size_t tag() const ;
       // ======================================================================
+    public:
+      // ======================================================================
+      /** replace the channels with expensive mass-dependent functions 
+       *  (e.g. running widths from 3-body decays) by their tabulated versions
+       *  - it is an opt-in: the tables are built lazily at the first call 
+       *  - outside the range the functions are evaluated directly 
+       *  - the tabulated functions do not depend on the partial widths, 
+       *    therefore <code>setGamma</code> does not require the rebuild 
+       *  - the tables always include the pole position, since 
+       *    \f$ w(m_0^2)\f$ is needed for each evaluation: if the pole is 
+       *    moved by <code>setM0</code> outside the tables, they are rebuilt 
+       *    with some headroom 
+       *  @see Ostap::Math::ChannelBW::tabulated 
+       *  @see Ostap::Math::TabulatedFunction
+       *  @param mmax      the upper edge of the tabulation range in mass 
+       *  @param precision the relative precision of the interpolation 
+       *  @return number of tabulated channels 
+       */
+      unsigned int tabulate
+      ( const double mmax              , 
+        const double precision = 1.e-7 ) ;
+      /// are the channels tabulated? 
+      bool   tabulated () const { return 0 < m_tab_precision ; }
+      /// the actual upper edge (in mass) of the tables 
+      double tab_range () const { return m_tab_range ; }
+      // ======================================================================
+    private : 
+      // ======================================================================
+      /// (re)build the tables according to the current settings and pole position 
+      unsigned int retabulate () ;
+      // ======================================================================
     protected : 
       // ======================================================================
       /// add one more channel 
@@ -1198,6 +1258,13 @@ namespace Ostap
       /// the threshold 
       double m_threshold { 0 } ; // the threshold 
       // ======================================================================
+      /// the requested upper edge (in mass) of the tables 
+      double m_tab_mmax      { 0 } ; // the requested upper edge of the tables 
+      /// the precision of the tables (0: no tables) 
+      double m_tab_precision { 0 } ; // the precision of the tables 
+      /// the actual upper edge (in mass) of the tables 
+      double m_tab_range     { 0 } ; // the actual upper edge of the tables 
+      // ======================================================================
     protected:
       // ======================================================================
       /// the channel(s) 
@@ -2174,6 +2241,11 @@ namespace Ostap
       Channel23L ( const Channel23L& right ) ;
       Channel23L* clone () const override ;
       // ======================================================================
+      /// get the copy of the channel with the tabulated original channel 
+      Channel23L* tabulated 
+      ( const double smax              , 
+        const double precision = 1.e-7 ) const override ;
+      // ======================================================================
     public:
       // ======================================================================
       /// the first main method: numerator
@@ -2770,6 +2842,17 @@ namespace Ostap
       std::complex<double> amplitude ( const double m ) const 
       { return m_bw->amplitude  ( m ) ; }
       // ======================================================================
+    public:
+      // ======================================================================
+      /** tabulate the expensive channels of Breit-Wigner 
+       *  in the range up to <code>xmax()</code>
+       *  @see Ostap::Math::BW::tabulate
+       *  @param precision the relative precision of the interpolation 
+       *  @return number of tabulated channels 
+       */
+      unsigned int tabulate ( const double precision = 1.e-7 ) 
+      { return m_bw->tabulate ( xmax () , precision ) ; }
+      // ======================================================================
     public:
       // ======================================================================
       /// some unique tag 
@@ -2909,6 +2992,17 @@ namespace Ostap
       std::complex<double> amplitude ( const double m ) const 
       { return m_bw->amplitude  ( m ) ; }
       // ======================================================================
+    public:
+      // ======================================================================
+      /** tabulate the expensive channels of Breit-Wigner 
+       *  in the range up to <code>xmax()</code>
+       *  @see Ostap::Math::BW::tabulate
+       *  @param precision the relative precision of the interpolation 
+       *  @return number of tabulated channels 
+       */
+      unsigned int tabulate ( const double precision = 1.e-7 ) 
+      { return m_bw->tabulate ( xmax () , precision ) ; }
+      // ======================================================================
     public:
       // ======================================================================
       /// some unique tag 
@@ -0,0 +1,91 @@
+// ============================================================================
+#ifndef OSTAP_BUILDLOCK_H
+#define OSTAP_BUILDLOCK_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <memory>
+#include <mutex>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class BuildLock Ostap/BuildLock.h
+     *  Per-object lock for the lazily built immutable tables,
+     *  held via <code>std::shared_ptr</code>:
+     *  - the valid table is picked up with <code>std::atomic_load</code>
+     *    without any locking
+     *  - the table is (re)built under the lock of this object only,
+     *    the builds of the tables for different objects run concurrently
+     *  - the copy gets its own (new) lock
+     *
+     *  @code
+     *  mutable std::shared_ptr<const Table> m_table ;
+     *  mutable Ostap::Utils::BuildLock      m_lock  ;
+     *  ...
+     *  std::shared_ptr<const Table> t = m_lock.get
+     *    ( m_table ,
+     *      [key] ( const Table& t ) { return key == t.key ; } ,
+     *      [&]   () { return build ( key ) ; } ) ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class BuildLock
+    {
+    public:
+      // ======================================================================
+      /// default constructor
+      BuildLock () = default ;
+      /// copy constructor: the new lock
+      BuildLock ( const BuildLock& /* right */ ) : BuildLock () {}
+      /// assignment: keep own lock
+      BuildLock& operator= ( const BuildLock& /* right */ ) { return *this ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the valid table, build it if needed
+       *  @param table the table
+       *  @param valid is the table still valid?  <code>bool(const TABLE&)</code>
+       *  @param build build the new table <code>std::shared_ptr<const TABLE>()</code>
+       */
+      template <class TABLE, class VALID, class BUILD>
+      std::shared_ptr<const TABLE>
+      get ( std::shared_ptr<const TABLE>& table ,
+            VALID                         valid ,
+            BUILD                         build )
+      {
+        std::shared_ptr<const TABLE> t = std::atomic_load ( &table ) ;
+        if ( t && valid ( *t ) ) { return t ; }                      // RETURN
+        //
+        std::lock_guard<std::mutex> lock ( m_mutex ) ;
+        //
+        // somebody else could build it already
+        t = std::atomic_load ( &table ) ;
+        if ( t && valid ( *t ) ) { return t ; }                      // RETURN
+        //
+        t = build () ;
+        std::atomic_store ( &table , t ) ;
+        return t ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the mutex
+      std::mutex m_mutex {} ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_BUILDLOCK_H
+// ============================================================================
@@ -4,8 +4,13 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <vector>
+// ============================================================================
 // Ostap
 // ============================================================================
+#include "Ostap/StatusCode.h"
 #include "Ostap/ValueWithError.h"
 // ============================================================================
 /** @file Ostap/Chi2Fit.h
@@ -109,6 +114,154 @@ namespace Ostap
     inline std::ostream& operator<< ( std::ostream& s , const Chi2Fit& f ) 
     { return f.fillStream ( s ) ; }
     // ========================================================================
+    /** @class Chi2FitBatch  Ostap/Chi2Fit.h
+     *  Many independent chi2-fits of the data vectors with the templates, 
+     *  e.g. one fit per kinematic bin and per systematic variation.
+     *
+     *  The problems are stored in SoA layout. Since the model is linear 
+     *  in the parameters, each problem is solved directly with 
+     *  the small dense solver (Newton steps with the analytical hessian, 
+     *  just one step if the templates have no uncertainties), 
+     *  the box constraints are treated with the active-set method.
+     *  The problems are spread over the threads of Ostap::Utils::ThreadPool.
+     *  For the unconstrained problems, that can't be solved directly, 
+     *  the iterative minimiser from Ostap::Math::Chi2Fit is used.
+     *
+     *  @code
+     *  Ostap::Math::Chi2FitBatch batch ( npoints , 2 ) ;
+     *  batch.setLimits ( 0 , 0 , 1.e+9 ) ; // optional constraints 
+     *  for ( ... ) { batch.add ( data , cmps ) ; }
+     *  batch.fit () ;
+     *  for ( std::size_t i = 0 ; i < batch.size() ; ++i ) 
+     *  { if ( batch.status ( i ).isSuccess () ) { ... batch.param ( i , 0 ) ... } }
+     *  @endcode 
+     *  @see Ostap::Math::Chi2Fit
+     *  @author Ostap developers
+     *  @date   2026-10-19
+     */
+    class Chi2FitBatch 
+    {
+    public: 
+      // ======================================================================
+      typedef Chi2Fit::VE    VE   ;
+      typedef Chi2Fit::DATA  DATA ;
+      typedef Chi2Fit::CMPS  CMPS ;
+      // ======================================================================
+    public: 
+      // ======================================================================
+      /** constructor 
+       *  @param npoints number of points in each data vector 
+       *  @param ncmps   number of components
+       */
+      Chi2FitBatch ( const unsigned int   npoints , 
+                     const unsigned short ncmps   ) ;
+      // ======================================================================
+    public: 
+      // ======================================================================
+      /** add the problem 
+       *  @param data the data vector 
+       *  @param cmps the components 
+       *  @return the index of the problem 
+       */
+      std::size_t add ( const DATA& data , 
+                        const CMPS& cmps ) ;
+      /** add the problem (SoA) 
+       *  @param values  the data values            [npoints] 
+       *  @param cov2    the data cov2              [npoints] 
+       *  @param cvalues the component values       [ncmps*npoints], component by component 
+       *  @param ccov2   the component cov2         [ncmps*npoints], nullptr for exact templates
+       *  @return the index of the problem 
+       */
+      std::size_t add ( const double* values            , 
+                        const double* cov2              , 
+                        const double* cvalues           , 
+                        const double* ccov2   = nullptr ) ;
+      /** set the limits for the parameter (for all problems) 
+       *  @param index the parameter index 
+       *  @param low   the low  limit 
+       *  @param high  the high limit 
+       */
+      void setLimits ( const unsigned short index , 
+                       const double         low   , 
+                       const double         high  ) ;
+      /// remove all problems 
+      void clear () ;
+      // ======================================================================
+    public: 
+      // ======================================================================
+      /** fit all problems 
+       *  @return number of failed fits 
+       */
+      std::size_t fit () ;
+      // ======================================================================
+    public: 
+      // ======================================================================
+      /// number of problems 
+      std::size_t    size    () const { return m_chi2.size () ; }
+      /// number of points in each data vector 
+      unsigned int   npoints () const { return m_npoints ; }
+      /// number of components 
+      unsigned short ncmps   () const { return m_ncmps   ; }
+      // ======================================================================
+    public: // Fit results 
+      // ======================================================================
+      /// the status of the fit 
+      StatusCode  status   ( const std::size_t  i      ) const ;
+      /// get the parameter 
+      VE          param    ( const std::size_t  i      , 
+                             const unsigned int index  ) const ;
+      /// get the covariance matrix elements
+      double      cov2     ( const std::size_t  i      , 
+                             const unsigned int i1     , 
+                             const unsigned int i2     ) const ;
+      /// the function at minimum
+      double      chi2     ( const std::size_t  i      ) const ;
+      /// number of iterations 
+      std::size_t niters   ( const std::size_t  i      ) const ;
+      /// number of points 
+      std::size_t points   ( const std::size_t  i      ) const ;
+      /// was the iterative minimiser used? 
+      bool        fallback ( const std::size_t  i      ) const ;
+      /// get all parameters at once 
+      DATA        params   ( const std::size_t  i      ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// solve one problem directly 
+      StatusCode  solve    ( const std::size_t  i      ) ;
+      /// solve one problem with the iterative minimiser 
+      StatusCode  iterate  ( const std::size_t  i      ) ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// number of points 
+      unsigned int            m_npoints ;
+      /// number of components 
+      unsigned short          m_ncmps   ;
+      /// the limits 
+      std::vector<double>     m_low     ;
+      std::vector<double>     m_high    ;
+      // ======================================================================
+      /// the data (SoA) 
+      std::vector<double>     m_values  ;
+      std::vector<double>     m_cov2    ;
+      std::vector<double>     m_cvalues ;
+      std::vector<double>     m_ccov2   ;
+      /// templates without uncertainties?
+      std::vector<bool>       m_exact   ;
+      // ======================================================================
+    private: // fit results 
+      // ======================================================================
+      std::vector<StatusCode>  m_status   ;
+      std::vector<double>      m_solu     ;
+      std::vector<double>      m_covs     ;
+      std::vector<double>      m_chi2     ;
+      std::vector<std::size_t> m_iters    ;
+      std::vector<std::size_t> m_points   ;
+      std::vector<bool>        m_fallback ;
+      // ======================================================================
+    } ;
+    // ========================================================================
   } //                                             end of namespace Ostap::Math
   // ==========================================================================
 } //                                                     end of namespace Ostap
@@ -0,0 +1,229 @@
+// ============================================================================
+#ifndef OSTAP_DALITZNORMALIZATION_H
+#define OSTAP_DALITZNORMALIZATION_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+//  STD&STL
+// ============================================================================
+#include <complex>
+#include <vector>
+#include <functional>
+#include <mutex>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Dalitz.h"
+// ============================================================================
+namespace Ostap
+{
+  // =========================================================================
+  namespace Math
+  {
+    // =======================================================================
+    /** @class DalitzNormalization Ostap/DalitzNormalization.h
+     *  Normalization engine for the amplitude fits over the Dalitz plot:
+     *  for the density \f$ \left| \sum_i c_i A_i(s_1,s_2) \right|^2 \f$
+     *  the normalization is the bilinear form
+     *  \f[ N = \sum_{ij} c_i c_j^* M_{ij}\,, \qquad
+     *      M_{ij} = \int\int ds_1 ds_2 A_i(s_1,s_2) A^*_j(s_1,s_2) \f]
+     *
+     *  - the quadrature grid is built once and adapted to the Dalitz
+     *    boundary: Gauss-Legendre in the angle \f$ \theta \f$ for
+     *    \f$ s_1 = \frac{s_1^{max}+s_1^{min}}{2} -
+     *     \frac{s_1^{max}-s_1^{min}}{2}\cos\theta \f$, that removes
+     *    the square-root behaviour of the boundary near the edges,
+     *    and Gauss-Legendre in \f$ s_2 \f$ between the boundaries
+     *  - the values of each component are cached on the grid and
+     *    recalculated only when the tag of the component
+     *    (e.g. the hash of its shape parameters) is changed
+     *  - only the rows of \f$ M_{ij}\f$ for the modified components
+     *    are recalculated; the sums over the grid run in parallel
+     *
+     *  @code
+     *  Dalitz              dalitz ( M , m1 , m2 , m3 ) ;
+     *  DalitzNormalization norm   ( dalitz ) ;
+     *  const auto i1 = norm.add ( amp1 , amp1.tag() ) ;
+     *  const auto i2 = norm.add ( amp2 , amp2.tag() ) ;
+     *  ...
+     *  norm.update ( i2 , amp2.tag() ) ;  // nothing is done if tag is the same
+     *  const double n = norm.norm ( { c1 , c2 } ) ;
+     *  @endcode
+     *
+     *  @attention the amplitudes are evaluated sequentially,
+     *             they are not required to be thread-safe
+     *  @see Ostap::Math::DalitzIntegrator
+     *  @see Ostap::Kinematics::Dalitz
+     *  @author Ostap developers
+     *  @date   2026-10-19
+     */
+    class DalitzNormalization
+    {
+    public:
+      // ======================================================================
+      /// the complex type
+      typedef std::complex<double>                        complex      ;
+      /// the amplitude \f$ A(s_1,s_2) \f$
+      typedef std::function<complex(double,double)>       Amplitude    ;
+      /// the real function  \f$ f(s_1,s_2) \f$
+      typedef std::function<double(double,double)>        function2    ;
+      /// the coefficients
+      typedef std::vector<complex>                        Coefficients ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the Dalitz configuration
+       *  @param dalitz Dalitz configuration
+       *  @param n1     number of quadrature points for \f$ s_1 \f$
+       *  @param n2     number of quadrature points for \f$ s_2 \f$
+       */
+      DalitzNormalization
+      ( const Ostap::Kinematics::Dalitz& dalitz      ,
+        const unsigned short             n1     = 64 ,
+        const unsigned short             n2     = 64 ) ;
+      /** constructor from the Dalitz configuration
+       *  @param dalitz Dalitz configuration
+       *  @param M      the mass of the mother particle
+       *  @param n1     number of quadrature points for \f$ s_1 \f$
+       *  @param n2     number of quadrature points for \f$ s_2 \f$
+       */
+      DalitzNormalization
+      ( const Ostap::Kinematics::Dalitz0& dalitz      ,
+        const double                      M           ,
+        const unsigned short              n1     = 64 ,
+        const unsigned short              n2     = 64 ) ;
+      /// copy constructor
+      DalitzNormalization ( const DalitzNormalization& right ) ;
+      // ======================================================================
+    public: // the grid
+      // ======================================================================
+      /// Dalitz configuration
+      const Ostap::Kinematics::Dalitz& dalitz () const { return m_dalitz ; }
+      /// number of quadrature points for \f$ s_1 \f$
+      unsigned short n1   () const { return m_n1 ; }
+      /// number of quadrature points for \f$ s_2 \f$
+      unsigned short n2   () const { return m_n2 ; }
+      /// total number of grid points
+      std::size_t    size () const { return m_w.size () ; }
+      /// \f$ s_1 \f$ for the k-th grid point
+      double s1     ( const std::size_t k ) const { return m_s1 [ k ] ; }
+      /// \f$ s_2 \f$ for the k-th grid point
+      double s2     ( const std::size_t k ) const { return m_s2 [ k ] ; }
+      /// quadrature weight for the k-th grid point
+      double weight ( const std::size_t k ) const { return m_w  [ k ] ; }
+      /// the area of the Dalitz plot: sum of all weights
+      double area   () const ;
+      // ======================================================================
+      /** integrate the real function over the grid
+       *  \f[ \int\int ds_1 ds_2 f(s_1,s_2) \f]
+       *  @attention the function is evaluated sequentially
+       */
+      double integrate ( const function2& f ) const ;
+      // ======================================================================
+    public: // components
+      // ======================================================================
+      /** add new component, its values are calculated on the grid
+       *  @param amplitude the amplitude \f$ A(s_1,s_2)\f$
+       *  @param tag       the tag (e.g. hash of the shape parameters)
+       *  @return the index of the component
+       */
+      std::size_t add
+      ( Amplitude         amplitude   ,
+        const std::size_t tag     = 0 ) ;
+      /** update the component: the values are recalculated
+       *  only if the tag is changed
+       *  @param index the index of the component
+       *  @param tag   the new tag (e.g. hash of the shape parameters)
+       *  @return true if the values are recalculated
+       */
+      bool update
+      ( const std::size_t index       ,
+        const std::size_t tag         ) ;
+      /** replace the component: the values are recalculated
+       *  @param index     the index of the component
+       *  @param amplitude the new amplitude
+       *  @param tag       the new tag
+       */
+      void update
+      ( const std::size_t index       ,
+        Amplitude         amplitude   ,
+        const std::size_t tag     = 0 ) ;
+      /// force the recalculation of the component
+      void refresh ( const std::size_t index ) ;
+      /// number of components
+      std::size_t nComponents () const { return m_amplitudes.size () ; }
+      /// the tag of the component
+      std::size_t tag ( const std::size_t index ) const ;
+      // ======================================================================
+    public: // normalization
+      // ======================================================================
+      /** the integral \f$ M_{ij} = \int\int ds_1 ds_2 A_i A^*_j \f$
+       *  @param i the index of the first  component
+       *  @param j the index of the second component
+       */
+      complex integral
+      ( const std::size_t i ,
+        const std::size_t j ) const ;
+      /** the normalization for the given coefficients
+       *  \f[ N = \int\int ds_1 ds_2 \left| \sum_i c_i A_i \right|^2 =
+       *     \sum_{ij} c_i c_j^* M_{ij} \f]
+       *  @param c the coefficients
+       */
+      double norm     ( const Coefficients& c ) const ;
+      /** the fraction of the component
+       *  \f$ f_i = \left| c_i \right|^2 M_{ii} / N \f$
+       *  @param c the coefficients
+       *  @param i the index of the component
+       */
+      double fraction
+      ( const Coefficients& c ,
+        const std::size_t   i ) const ;
+      /// get the full matrix \f$ M_{ij}\f$ (row-major)
+      std::vector<complex> matrix () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// build the grid
+      void build    () ;
+      /// calculate the values of the component on the grid
+      void evaluate ( const std::size_t index ) ;
+      /// recalculate the modified rows of the matrix
+      void update_matrix () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// Dalitz configuration
+      Ostap::Kinematics::Dalitz         m_dalitz     {      } ;
+      /// number of points for s1
+      unsigned short                    m_n1         { 64   } ;
+      /// number of points for s2
+      unsigned short                    m_n2         { 64   } ;
+      /// grid: s1
+      std::vector<double>               m_s1         {      } ;
+      /// grid: s2
+      std::vector<double>               m_s2         {      } ;
+      /// grid: weights
+      std::vector<double>               m_w          {      } ;
+      /// the amplitudes
+      std::vector<Amplitude>            m_amplitudes {      } ;
+      /// the tags
+      std::vector<std::size_t>          m_tags       {      } ;
+      /// the values of amplitudes on the grid
+      std::vector<std::vector<complex>> m_values     {      } ;
+      /// the integrals \f$ M_{ij} \f$
+      mutable std::vector<std::vector<complex>> m_matrix   {} ; //!
+      /// modified components
+      mutable std::vector<bool>                 m_modified {} ; //!
+      /// lock for the matrix update
+      mutable std::mutex                        m_mutex    {} ; //!
+      // ======================================================================
+    };
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_DALITZNORMALIZATION_H
+// ============================================================================
@@ -20,10 +20,37 @@
 #include "Ostap/DataFrame.h"
 #include "Ostap/StatEntity.h"
 #include "Ostap/WStatEntity.h"
+#include "Ostap/SymmetricMatrixTypes.h"
 // ============================================================================
 /// ONLY starting from ROOT 6.16
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
 // ============================================================================
+namespace Ostap 
+{
+  // ==========================================================================
+  namespace Actions 
+  {
+    // ========================================================================
+    /** @struct Covariance 
+     *  The result of the covariance action for two columns 
+     *  @see Ostap::StatVar::statCov 
+     */
+    struct Covariance 
+    {
+      // ======================================================================
+      /// statistic for the first  column 
+      Ostap::WStatEntity  stat1 {} ; // statistic for the first column 
+      /// statistic for the second column 
+      Ostap::WStatEntity  stat2 {} ; // statistic for the second column 
+      /// the covariance matrix 
+      Ostap::SymMatrix2x2 cov2  {} ; // the covariance matrix 
+      // ======================================================================
+    } ;
+    // ========================================================================
+  }
+  // ==========================================================================
+}
+// ============================================================================
 namespace ROOT 
 {
   // ==========================================================================
@@ -173,6 +200,71 @@ namespace ROOT
         // ===================================================================
       } ; //                        The end of class ROOT::Detail::RDF::StatVar 
       // ======================================================================
+      /** @class StatCov
+       *  Helper class to get the (weighted) statistics and 
+       *  the covariance for two columns in DataFrame 
+       *  @see Ostap::StatVar::statCov 
+       *  @see Ostap::DataFrame 
+       */
+      class StatCov : public RActionImpl<StatCov> 
+      {
+      public:
+        // ====================================================================
+        /// define the result type 
+        using Result_t = Ostap::Actions::Covariance ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// default constructor 
+        StatCov () ;
+        /// Move constructor 
+        StatCov (       StatCov&& ) = default ;
+        /// Copy constructor is disabled 
+        StatCov ( const StatCov&  ) = delete ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// initialize (empty) 
+        void InitTask   ( TTreeReader * , unsigned int ) {} ;
+        /// initialize (empty) 
+        void Initialize () {} ;
+        /// finalize : sum over the slots and get the covariance 
+        void Finalize   () ;
+        /// who am I ?
+        std::string GetActionName() { return "StatCov" ; }
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// The basic method: increment the counters 
+        void Exec ( unsigned int slot , double v1 , double v2 , double w = 1 ) 
+        {
+          if ( !w ) { return ; }
+          Result_t& r = m_slots [ slot % m_N ] ;
+          r.stat1.add ( v1 , w ) ;
+          r.stat2.add ( v2 , w ) ;
+          r.cov2 ( 0 , 0 ) += w * v1 * v1 ;
+          r.cov2 ( 0 , 1 ) += w * v1 * v2 ;
+          r.cov2 ( 1 , 1 ) += w * v2 * v2 ;
+        } 
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// Get the result 
+        std::shared_ptr<Result_t> GetResultPtr () const { return m_result ; }
+        /// get partial result for the given slot 
+        Result_t& PartialUpdate ( unsigned int slot ) { return m_slots [ slot % m_N ] ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the final result 
+        const std::shared_ptr<Result_t> m_result {}    ;
+        /// size of m_slots 
+        unsigned long                   m_N      { 1 } ;
+        /// (current) results per  slot 
+        std::vector<Result_t>           m_slots  {}    ;
+        // ====================================================================
+      } ; //                        The end of class ROOT::Detail::RDF::StatCov
+      // ======================================================================
     } //                                 The end of namespace ROOT::Detail::RDF
     // ========================================================================
   } //                                        The end of namespace ROOT::Detail
@@ -187,6 +279,7 @@ namespace Ostap
     // ========================================================================
     using StatVar  = ROOT::Detail::RDF::StatVar  ;
     using WStatVar = ROOT::Detail::RDF::WStatVar ;
+    using StatCov  = ROOT::Detail::RDF::StatCov  ;
     // ========================================================================
   }
   // ==========================================================================
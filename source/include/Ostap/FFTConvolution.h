@@ -0,0 +1,216 @@
+// ============================================================================
+#ifndef OSTAP_FFTCONVOLUTION_H
+#define OSTAP_FFTCONVOLUTION_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <functional>
+#include <memory>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/BuildLock.h"
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class FFTConvolution Ostap/FFTConvolution.h
+     *  Numerical convolution of the function with the resolution function
+     *  using the real-to-real Fast Fourier Transform
+     *  \f[ g(x) = \int f(x-t) r(t) dt \f]
+     *
+     *  - both functions are sampled at the uniform grid with the same step
+     *  - the resolution function is sampled in the range  \f$ [-w,w]\f$
+     *  - the signal is sampled in the extended range
+     *    \f$ [ x_{min} - p w , x_{max} + p w ] \f$, where
+     *    \f$ p \f$ is a padding factor: <code>padding=1</code> means that
+     *    the result is exact (up to the sampling) for the whole
+     *    range \f$ [ x_{min} , x_{max} ]\f$, <code>padding=0</code> means that
+     *    the signal is considered as zero outside \f$ [ x_{min} , x_{max} ]\f$
+     *  - the arrays are zero-padded to the size of power of two,
+     *    therefore there is no wrap-around
+     *  - the resolution function can be tapered with the window function
+     *    and normalized to have unit integral
+     *  - the result is tabulated and interpolated with local cubic interpolation
+     *  - the result is cached and recalculated only when the key changes
+     *    (e.g. the <code>tag</code> of the signal and/or resolution functions)
+     *
+     *  @code
+     *  const Ostap::Math::FourierSum fs = ... ;
+     *  const Ostap::Math::Gauss      rf ( 0 , 0.1 ) ;
+     *  Ostap::Math::FFTConvolution cnv =
+     *     Ostap::Math::FFTConvolution::create ( fs , rf , fs.xmin() , fs.xmax() , 1.0 ) ;
+     *  const double value = cnv ( 0.5 ) ;
+     *  @endcode
+     *
+     *  To track the parameter changes, use <code>std::cref</code>
+     *  for the functions and specify the key:
+     *  @code
+     *  Ostap::Math::Gauss signal ( 0 , 1 ) ;
+     *  Ostap::Math::Gauss rf     ( 0 , 0.1 ) ;
+     *  Ostap::Math::FFTConvolution cnv
+     *     ( std::cref ( signal ) , std::cref ( rf ) , -5 , 5 , 1.0 ,
+     *       2048 , 1.0 , Ostap::Math::FFTConvolution::NoWindow , true ,
+     *       [&signal,&rf] () { return signal.tag () ^ ( rf.tag() << 1 ) ; } ) ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class FFTConvolution
+    {
+    public:
+      // ======================================================================
+      /// the function type
+      typedef std::function<double(double)> Function ;
+      /// the key function: the convolution is recalculated when the key changes
+      typedef std::function<std::size_t()>  Key      ;
+      // ======================================================================
+      /// the window function for the resolution function
+      enum Window {
+        NoWindow = 0 , // no tapering
+        Hann         , // Hann window
+        Hamming      , // Hamming window
+        Tukey          // Tukey window with 25% tapering
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the signal, resolution and the range
+       *  @param signal     the signal function
+       *  @param resolution the resolution function
+       *  @param xmin       low  edge of the range
+       *  @param xmax       high edge of the range
+       *  @param width      the half-width of the resolution function
+       *  @param N          number of grid points in the range
+       *  @param padding    the padding factor for the signal
+       *  @param window     the window function for the resolution
+       *  @param normalize  normalize the sampled resolution function?
+       *  @param key        the key function (if any)
+       */
+      FFTConvolution
+      ( Function          signal                 ,
+        Function          resolution             ,
+        const double      xmin                   ,
+        const double      xmax                   ,
+        const double      width                  ,
+        const std::size_t N          = 1024      ,
+        const double      padding    = 1.0       ,
+        const Window      window     = NoWindow  ,
+        const bool        normalize  = true      ,
+        Key               key        = Key ()    ) ;
+      // ======================================================================
+      /// copy constructor: the cached result is shared
+      FFTConvolution ( const FFTConvolution& right ) ;
+      /// default constructor (needed for serialization)
+      FFTConvolution () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** templated creator
+       *  (PyROOT does not like templated constructors)
+       */
+      template <class SIGNAL, class RESOLUTION>
+      static inline FFTConvolution
+      create
+      ( const SIGNAL&     signal                 ,
+        const RESOLUTION& resolution             ,
+        const double      xmin                   ,
+        const double      xmax                   ,
+        const double      width                  ,
+        const std::size_t N          = 1024      ,
+        const double      padding    = 1.0       ,
+        const Window      window     = NoWindow  ,
+        const bool        normalize  = true      )
+      { return FFTConvolution ( signal , resolution , xmin , xmax , width ,
+                                N , padding , window , normalize ) ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// evaluate the convolution
+      double operator() ( const double x ) const { return evaluate ( x ) ; }
+      /// evaluate the convolution
+      double evaluate   ( const double x ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low  edge of the range
+      double      xmin      () const { return m_xmin      ; }
+      /// high edge of the range
+      double      xmax      () const { return m_xmax      ; }
+      /// the half-width of the resolution function
+      double      width     () const { return m_width     ; }
+      /// number of grid points in the range
+      std::size_t N         () const { return m_N         ; }
+      /// padding factor
+      double      padding   () const { return m_padding   ; }
+      /// window function
+      Window      window    () const { return m_window    ; }
+      /// normalize the resolution function?
+      bool        normalize () const { return m_normalize ; }
+      /// the step of the grid
+      double      step      () const { return ( m_xmax - m_xmin ) / ( m_N - 1 ) ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the integral over the range (the convolution is calculated if needed)
+      double integral () const ;
+      /// get the convolution at the grid (the convolution is calculated if needed)
+      std::vector<double> values () const ;
+      /// drop the cached result, it will be recalculated at next call
+      void reset () const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual tabulated result
+      class Table ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// get the valid table (calculate it if needed)
+      std::shared_ptr<const Table> table () const ;
+      /// calculate the new table
+      std::shared_ptr<const Table> build ( const std::size_t key ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the signal
+      Function    m_signal     {          } ; // the signal
+      /// the resolution
+      Function    m_resolution {          } ; // the resolution
+      /// low edge
+      double      m_xmin       { 0        } ; // low edge
+      /// high edge
+      double      m_xmax       { 1        } ; // high edge
+      /// half-width of the resolution function
+      double      m_width      { 0.1      } ; // half-width of the resolution
+      /// number of grid points
+      std::size_t m_N          { 1024     } ; // number of grid points
+      /// padding factor
+      double      m_padding    { 1.0      } ; // padding factor
+      /// window function
+      Window      m_window     { NoWindow } ; // window function
+      /// normalize the resolution function ?
+      bool        m_normalize  { true     } ; // normalize the resolution?
+      /// the key function
+      Key         m_key        {          } ; // the key function
+      /// the tabulated result
+      mutable std::shared_ptr<const Table> m_table {} ; //! the tabulated result
+      /// the lock for the calculation
+      mutable Ostap::Utils::BuildLock      m_lock  {} ; //! the lock for the calculation
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_FFTCONVOLUTION_H
+// ============================================================================
@@ -9,17 +9,23 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <vector>
 // ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/IFuncs.h"
 #include "Ostap/Formula.h"
+#include "Ostap/KinematicsBatch.h"
 // ============================================================================
 // ROOT
 // ============================================================================
 #include  "TObject.h"
 #include  "RooFormulaVar.h"
 // ============================================================================
+// forward declarations 
+// ============================================================================
+class TLeaf ; // ROOT 
+// ============================================================================
 namespace Ostap 
 {
   // ==========================================================================
@@ -65,6 +71,8 @@ namespace Ostap
       // ======================================================================
       ///  evaluate the formula for  TTree
       double operator() ( const TTree* tree ) const override ;
+      /// the expressions, used by the function
+      bool   expressions ( std::vector<std::string>& result ) const override ;
       // ======================================================================
     public:
       // ======================================================================
@@ -132,6 +140,8 @@ namespace Ostap
       // ======================================================================
       ///  evaluate the function for TTree
       double operator () ( const TTree* tree ) const override ;
+      /// the expressions, used by the function
+      bool   expressions ( std::vector<std::string>& result ) const override ;
       // ======================================================================
     public:
       // ======================================================================
@@ -209,6 +219,8 @@ namespace Ostap
       // ======================================================================
       ///  evaluate the function for TTree
       double operator () ( const TTree* tree ) const override ;
+      /// the expressions, used by the function
+      bool   expressions ( std::vector<std::string>& result ) const override ;
       // ======================================================================
     public:
       // ======================================================================
@@ -297,6 +309,8 @@ namespace Ostap
       // ======================================================================
       ///  evaluate the function for TTree
       double operator () ( const TTree* tree ) const override ;
+      /// the expressions, used by the function
+      bool   expressions ( std::vector<std::string>& result ) const override ;
       // ======================================================================
     public:
       // ======================================================================
@@ -339,6 +353,119 @@ namespace Ostap
       // ======================================================================
     } ;
     // ========================================================================
+    /** @class FuncKinematics
+     *  Kinematical variable for TTree, evaluated from the components
+     *  \f$(p_x,p_y,p_z,E)\f$ of several four-vectors,
+     *  that are read directly from the tree
+     *
+     *  - if all components are plain scalar branches of the tree, the
+     *    components are read column-by-column for the block of entries,
+     *    starting from the current one, and the variable is evaluated
+     *    for the whole block by the batch kernel; the next entries
+     *    are taken from the block
+     *  - otherwise (expressions, friend trees) the components are
+     *    evaluated entry-by-entry with Ostap::Formula
+     *
+     *  @code
+     *  FuncKinematics cos_theta ( Ostap::Kinematics::Batch::DecayAngle ,
+     *    { "B_PX"    , "B_PY"    , "B_PZ"    , "B_PE"    ,
+     *      "Jpsi_PX" , "Jpsi_PY" , "Jpsi_PZ" , "Jpsi_PE" ,
+     *      "mu_PX"   , "mu_PY"   , "mu_PZ"   , "mu_PE"   } ) ;
+     *  @endcode
+     *  @see Ostap::Kinematics::Batch::Variable
+     *  @see Ostap::Kinematics::Batch::evaluate
+     */
+    class FuncKinematics : public TObject , public Ostap::IFuncTree
+    {
+    public:
+      // ======================================================================
+      ClassDefOverride(Ostap::Functions::FuncKinematics,1) ;
+      // ======================================================================
+    public :
+      // ======================================================================
+      /** constructor
+       *  @param variable    the kinematical variable
+       *  @param expressions the components of four-vectors: (px,py,pz,E) for each
+       *  @param tree        the tree
+       *  @param block       the size of the block (for plain branches),
+       *                     0 or 1 means entry-by-entry evaluation
+       */
+      FuncKinematics
+      ( const Ostap::Kinematics::Batch::Variable variable              ,
+        const std::vector<std::string>&          expressions           ,
+        const TTree*                             tree        = nullptr ,
+        const unsigned int                       block       = 1024    ) ;
+      /// copy constructor
+      FuncKinematics ( const FuncKinematics& right ) ;
+      /// default constructor, needed for serialization
+      FuncKinematics () = default ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      FuncKinematics* Clone ( const char* newname = "" ) const override ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      ///  evaluate the function for TTree
+      double operator () ( const TTree* tree ) const override ;
+      /// the expressions, used by the function
+      bool   expressions ( std::vector<std::string>& result ) const override ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      Bool_t Notify   () override ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the variable
+      Ostap::Kinematics::Batch::Variable variable    () const { return m_variable ; }
+      /// the expressions for the components
+      const std::vector<std::string>&    expressions () const { return m_expressions ; }
+      /// number of four-vectors
+      unsigned short nVectors () const { return m_expressions.size () / 4 ; }
+      /// the size of the block 
+      unsigned int   block    () const { return m_block ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// make formulae
+      bool make_formulae () const ;
+      /// get the plain leaves for the components 
+      bool make_leaves   () const ;
+      /// read the block of entries and evaluate the variable
+      void read_block    ( const TTree* tree , const long long entry ) const ;
+      /// reset the transient data 
+      void reset         () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the variable
+      Ostap::Kinematics::Batch::Variable m_variable { Ostap::Kinematics::Batch::Mass } ;
+      /// the expressions for the components
+      std::vector<std::string>           m_expressions {} ;
+      /// the size of the block
+      unsigned int                       m_block { 1024    } ;
+      /// the actual formulae
+      mutable std::vector<std::unique_ptr<Ostap::Formula> > m_formulae {} ; //!
+      /// the tree itself
+      mutable const TTree*               m_tree  { nullptr } ; //!
+      /// plain leaves? (-1: unknown)
+      mutable int                        m_plain       { -1      } ; //!
+      /// the plain leaves for the components 
+      mutable std::vector<TLeaf*>        m_leaves      {} ; //!
+      /// the (local) tree for the leaves and the block 
+      mutable const TTree*               m_local       { nullptr } ; //!
+      /// the tree number in the chain for the leaves 
+      mutable int                        m_number      { -1      } ; //!
+      /// the block: the components, column by column 
+      mutable std::vector<double>        m_columns     {} ; //!
+      /// the block: the results 
+      mutable std::vector<double>        m_results     {} ; //!
+      /// the first (local) entry of the block
+      mutable long long                  m_first       { -1      } ; //!
+      // ======================================================================
+    } ;
+    // ========================================================================
 
 
     // ========================================================================
@@ -0,0 +1,239 @@
+// ============================================================================
+#ifndef OSTAP_HISTOFILL_H
+#define OSTAP_HISTOFILL_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <vector>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TH1   ; // ROOT
+class TH2   ; // ROOT
+class TH3   ; // ROOT
+class TAxis ; // ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class HistoFill Ostap/HistoFill.h
+     *  Batch filling of the histogram: the replacement of the
+     *  per-event <code>TH1::Fill</code> in the event loops
+     *
+     *  - the values are collected into blocks and the bin indices
+     *    are computed for the whole block; for the uniform axes
+     *    the computation is a plain (vectorisable) loop
+     *  - the bin contents, the sums of squared weights and the
+     *    statistics are accumulated in the local flat arrays
+     *    (owned by the filler, hence by the calling thread)
+     *  - the histogram itself is updated only once, by <code>flush</code>
+     *    (or by the destructor)
+     *
+     *  For the empty (e.g. reset) histogram the result is identical to
+     *  the sequence of <code>TH1::Fill</code> calls: the same bin indices,
+     *  the same order of summation, the same treatment of underflows,
+     *  overflows and NaNs, the same automatic activation of
+     *  <code>Sumw2</code> for non-unit weights.
+     *
+     *  The histograms with buffers, extendable axes, the profiles and all
+     *  classes other than <code>TH[123][DF]</code> are filled directly with
+     *  <code>TH1::Fill</code>.
+     *
+     *  @code
+     *  TH1* histo = ... ;
+     *  histo->Reset() ;
+     *  Ostap::Utils::HistoFill filler ( histo ) ;
+     *  for ( ... ) { filler.fill ( x , w ) ; }
+     *  filler.flush () ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class HistoFill
+    {
+    public:
+      // ======================================================================
+      /** constructor
+       *  @param histo the histogram to be filled
+       *  @param block the size of the block
+       */
+      HistoFill ( TH1* histo , const std::size_t block = 1024 ) ;
+      /// destructor: flush the accumulated data
+      ~HistoFill () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// no copy
+      HistoFill            ( const HistoFill& ) ;
+      HistoFill& operator= ( const HistoFill& ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** fill 1D-histogram
+       *  @param x  the value
+       *  @param w  the weight
+       */
+      inline void fill ( const double x , const double w = 1 )
+      { fill ( x , w , w * w ) ; }
+      /** fill 1D-histogram
+       *  @param x  the value
+       *  @param w  the weight
+       *  @param w2 the contribution to the sum of squared weights
+       */
+      inline void fill ( const double x , const double w , const double w2 )
+      {
+        if ( m_direct ) { fill_direct ( x , 0 , 0 , w , w2 ) ; return ; }
+        push ( x , 0 , 0 , w , w2 ) ;
+      }
+      // ======================================================================
+      /** fill 2D-histogram
+       *  @param x  the x-value
+       *  @param y  the y-value
+       *  @param w  the weight
+       *  @param w2 the contribution to the sum of squared weights
+       */
+      inline void fill2 ( const double x     ,
+                          const double y     ,
+                          const double w     ,
+                          const double w2    )
+      {
+        if ( m_direct ) { fill_direct ( x , y , 0 , w , w2 ) ; return ; }
+        push ( x , y , 0 , w , w2 ) ;
+      }
+      /// fill 2D-histogram
+      inline void fill2 ( const double x , const double y , const double w = 1 )
+      { fill2 ( x , y , w , w * w ) ; }
+      // ======================================================================
+      /** fill 3D-histogram
+       *  @param x  the x-value
+       *  @param y  the y-value
+       *  @param z  the z-value
+       *  @param w  the weight
+       *  @param w2 the contribution to the sum of squared weights
+       */
+      inline void fill3 ( const double x     ,
+                          const double y     ,
+                          const double z     ,
+                          const double w     ,
+                          const double w2    )
+      {
+        if ( m_direct ) { fill_direct ( x , y , z , w , w2 ) ; return ; }
+        push ( x , y , z , w , w2 ) ;
+      }
+      /// fill 3D-histogram
+      inline void fill3 ( const double x , const double y , const double z , const double w = 1 )
+      { fill3 ( x , y , z , w , w * w ) ; }
+      // ======================================================================
+      /// write the accumulated data into the histogram
+      void flush () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the histogram
+      TH1*         histo     () const { return m_histo     ; }
+      /// the histogram dimension
+      unsigned int dimension () const { return m_dimension ; }
+      /// is the histogram filled directly with TH1::Fill ?
+      bool         direct    () const { return m_direct    ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** compute the bin indices, exactly as <code>TAxis::FindFixBin</code>
+       *  @param axis the axis
+       *  @param n    number of values
+       *  @param x    (INPUT)  the values
+       *  @param bins (OUTPUT) the bin indices
+       */
+      static void find_bins
+      ( const TAxis&      axis ,
+        const std::size_t n    ,
+        const double*     x    ,
+        int*              bins ) ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// add the entry to the block
+      inline void push ( const double x  ,
+                         const double y  ,
+                         const double z  ,
+                         const double w  ,
+                         const double w2 )
+      {
+        m_x  [ m_size ] = x  ;
+        m_y  [ m_size ] = y  ;
+        m_z  [ m_size ] = z  ;
+        m_w  [ m_size ] = w  ;
+        m_w2 [ m_size ] = w2 ;
+        if ( m_block <= ++m_size ) { process () ; }
+      }
+      /// process the block
+      void process () ;
+      /// fill the histogram directly
+      void fill_direct
+      ( const double x  ,
+        const double y  ,
+        const double z  ,
+        const double w  ,
+        const double w2 ) ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the histogram
+      TH1*                 m_histo     { nullptr } ;
+      /// 2D-histogram
+      TH2*                 m_h2        { nullptr } ;
+      /// 3D-histogram
+      TH3*                 m_h3        { nullptr } ;
+      /// the dimension
+      unsigned int         m_dimension { 1       } ;
+      /// fill directly?
+      bool                 m_direct    { true    } ;
+      /// float storage?
+      bool                 m_float     { false   } ;
+      /// statistics for underflow/overflow bins?
+      bool                 m_overflows { false   } ;
+      /// the block size
+      std::size_t          m_block     { 1024    } ;
+      /// number of values in the block
+      std::size_t          m_size      { 0       } ;
+      /// the block: values and weights
+      std::vector<double>  m_x         {} ;
+      std::vector<double>  m_y         {} ;
+      std::vector<double>  m_z         {} ;
+      std::vector<double>  m_w         {} ;
+      std::vector<double>  m_w2        {} ;
+      /// the block: bin indices
+      std::vector<int>     m_ix        {} ;
+      std::vector<int>     m_iy        {} ;
+      std::vector<int>     m_iz        {} ;
+      /// the accumulated bin contents (double storage)
+      std::vector<double>  m_sumw      {} ;
+      /// the accumulated bin contents (float storage)
+      std::vector<float>   m_sumwf     {} ;
+      /// the accumulated sums of squared weights
+      std::vector<double>  m_sumw2     {} ;
+      /// the accumulated statistics, the same layout as TH1::GetStats
+      double               m_stats [ 11 ] {} ;
+      /// number of entries
+      unsigned long long   m_entries   { 0       } ;
+      /// is Sumw2 needed (non-unit weights)?
+      bool                 m_need_w2   { false   } ;
+      /// is Sumw2 needed (explicit sums of squared weights)?
+      bool                 m_force_w2  { false   } ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOFILL_H
+// ============================================================================
@@ -3,10 +3,15 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+// ============================================================================
 // Forward declarations 
 // ============================================================================
 class TH1    ; // ROOT 
 class TGraph ; // ROOT
+class TAxis  ; // ROOT
 // ============================================================================
 namespace Ostap
 {
@@ -21,6 +26,9 @@ namespace Ostap
     std::size_t hash_graph ( const TGraph* graph  ) ;
     // ========================================================================
     /** get hash for the given histogram 
+     *  - for the ordinary histograms the raw arrays of bin contents 
+     *    and sums of squared weights are hashed at once 
+     *  - for profiles the bin-by-bin loop is used 
      *  @param histo the historgam  
      *  @return hash value 
      */
@@ -31,6 +39,18 @@ namespace Ostap
      *  @return hash value 
      */
     std::size_t hash_axis  ( const TAxis* axis )  ;
+    // ========================================================================
+    /** get the fast (xxHash64) hash for the raw memory buffer 
+     *  @see https://github.com/Cyan4973/xxHash
+     *  @param data the buffer 
+     *  @param size the size of buffer in bytes 
+     *  @param seed the seed 
+     *  @return hash value 
+     */
+    std::size_t hash_buffer 
+    ( const void*       data     , 
+      const std::size_t size     , 
+      const std::size_t seed = 0 ) ;
     // ========================================================================    
   } //                                        The end of namepsace Ostap::Utils 
   // ==========================================================================
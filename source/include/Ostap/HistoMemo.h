@@ -0,0 +1,282 @@
+// ============================================================================
+#ifndef OSTAP_HISTOMEMO_H
+#define OSTAP_HISTOMEMO_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TH1     ; // ROOT
+class TObject ; // ROOT
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class HistoMemo Ostap/HistoMemo.h
+     *  Process-wide, size-bounded memo for the expensive objects
+     *  derived from histograms: interpolation tables, integrals,
+     *  function wrappers, statistics, processed clones, ...
+     *
+     *  - the key is built from the histogram hash, the name of
+     *    the operation and the hash of its parameters
+     *    @see Ostap::Utils::hash_histo
+     *  - the key also keeps the identity of the histogram: the class,
+     *    the binning of all axes, the number of entries and the sum
+     *    of weights; they are compared on each hit, therefore the
+     *    collision of hashes is counted as a miss
+     *  - the least recently used objects are dropped when either
+     *    the total (estimated) memory or the number of objects
+     *    exceeds the limit
+     *  - the objects are shared: they are not deleted while used
+     *  - the memo is thread-safe, the objects are created outside the lock
+     *
+     *  @code
+     *  const TH3& histo = ... ;
+     *  auto& memo = Ostap::Utils::HistoMemo::instance () ;
+     *  std::shared_ptr<const Ostap::Math::Histo3D> h3 = memo.get<Ostap::Math::Histo3D>
+     *    ( memo.key ( &histo , "Histo3D" , tx + 10 * ty + 100 * tz ) ,
+     *      [&histo] () { return new Ostap::Math::Histo3D ( histo ) ; } ) ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class HistoMemo
+    {
+    public:
+      // ======================================================================
+      /** @class Key
+       *  the full key of the memo:
+       *  - the hash of the histogram, the operation and the hash of parameters
+       *  - the identity of the histogram: class, binning, entries, sum of weights
+       *  Two keys are equal only if all the components are equal
+       */
+      class Key
+      {
+      public:
+        // ====================================================================
+        /// default (empty) key
+        Key () = default ;
+        /** the key from the hash (no histogram identity)
+         *  @param hash      the hash of the histogram
+         *  @param operation the name of the operation
+         *  @param params    the hash of the parameters
+         */
+        Key ( const std::size_t  hash       ,
+              const std::string& operation  ,
+              const std::size_t  params = 0 ) ;
+        /** the key for the histogram
+         *  @param histo     the histogram
+         *  @param operation the name of the operation
+         *  @param params    the hash of the parameters
+         */
+        Key ( const TH1*         histo      ,
+              const std::string& operation  ,
+              const std::size_t  params = 0 ) ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// the combined hash
+        std::size_t        hash      () const { return m_hash      ; }
+        /// the hash of the histogram
+        std::size_t        content   () const { return m_content   ; }
+        /// the operation
+        const std::string& operation () const { return m_operation ; }
+        /// the hash of the parameters
+        std::size_t        params    () const { return m_params    ; }
+        /// the class of the histogram
+        const std::string& type      () const { return m_type      ; }
+        /// the binning & statistics of the histogram
+        const std::vector<double>& identity () const { return m_identity ; }
+        /// the estimated memory of the key
+        std::size_t        memory    () const ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// compare all the components
+        bool operator== ( const Key& right ) const ;
+        bool operator!= ( const Key& right ) const { return !( *this == right ) ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the combined hash
+        std::size_t         m_hash      { 0 } ;
+        /// the hash of the histogram
+        std::size_t         m_content   { 0 } ;
+        /// the operation
+        std::string         m_operation {   } ;
+        /// the hash of the parameters
+        std::size_t         m_params    { 0 } ;
+        /// the class of the histogram
+        std::string         m_type      {   } ;
+        /// the binning (per axis: bins, edges), entries and sum of weights
+        std::vector<double> m_identity  {   } ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the (process-wide) instance
+      static HistoMemo& instance () ;
+      // ======================================================================
+      /** build the key
+       *  @param hash      the hash of the histogram
+       *  @param operation the name of the operation
+       *  @param params    the hash of the parameters
+       */
+      static Key key
+      ( const std::size_t  hash       ,
+        const std::string& operation  ,
+        const std::size_t  params = 0 ) ;
+      /** build the key
+       *  @param histo     the histogram
+       *  @param operation the name of the operation
+       *  @param params    the hash of the parameters
+       */
+      static Key key
+      ( const TH1*         histo      ,
+        const std::string& operation  ,
+        const std::size_t  params = 0 ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** get the object from the memo or create it
+       *  @param key   the key
+       *  @param maker the function that creates the object, <code>T*</code>
+       *  @param cost  the estimated memory (bytes) of the object
+       */
+      template <class T, class MAKER>
+      std::shared_ptr<const T> get
+      ( const Key&        key              ,
+        MAKER             maker            ,
+        const std::size_t cost = sizeof(T) )
+      {
+        std::shared_ptr<const void> found = find ( key , typeid ( T ) ) ;
+        if ( found ) { return std::static_pointer_cast<const T> ( found ) ; }
+        //
+        std::shared_ptr<const T> created ( maker () ) ;
+        if ( !created ) { return created ; }
+        //
+        return std::static_pointer_cast<const T>
+          ( insert ( key , typeid ( T ) , created , cost ) ) ;
+      }
+      // ======================================================================
+    public: // ROOT objects (e.g. processed histograms)
+      // ======================================================================
+      /** store the copy of the object
+       *  @param key    the key
+       *  @param object the object
+       */
+      void     store ( const Key& key , const TObject& object ) ;
+      /** get the new copy of the object from the memo
+       *  @param key    the key
+       *  @return the copy of the object (to be deleted by the caller) or nullptr
+       */
+      TObject* clone ( const Key& key ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// remove all objects
+      void        clear () ;
+      /// remove the object
+      bool        erase ( const Key& key ) ;
+      /// number of objects
+      std::size_t size      () const ;
+      /// the estimated memory used by the objects
+      std::size_t memory    () const ;
+      /// the memory limit (bytes)
+      std::size_t maxMemory () const ;
+      /// the maximal number of objects
+      std::size_t maxSize   () const ;
+      /// set the memory limit (bytes)
+      void setMaxMemory ( const std::size_t value ) ;
+      /// set the maximal number of objects
+      void setMaxSize   ( const std::size_t value ) ;
+      /// number of hits
+      std::size_t hits      () const ;
+      /// number of misses
+      std::size_t misses    () const ;
+      /// number of hash collisions (counted also as misses)
+      std::size_t collisions () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// constructor
+      HistoMemo () ;
+      /// non-copyable
+      HistoMemo ( const HistoMemo& ) = delete ;
+      HistoMemo& operator=( const HistoMemo& ) = delete ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// find the object (and mark it as the most recently used)
+      std::shared_ptr<const void> find
+      ( const Key&             key  ,
+        const std::type_info&  type ) ;
+      /// insert the object, return the object in the memo
+      std::shared_ptr<const void> insert
+      ( const Key&                  key    ,
+        const std::type_info&       type   ,
+        std::shared_ptr<const void> object ,
+        const std::size_t           cost   ) ;
+      /// drop the least recently used objects (lock must be held)
+      void shrink () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the entry
+      struct Entry
+      {
+        Key                          key    ;
+        const std::type_info*        type   ;
+        std::shared_ptr<const void>  object ;
+        std::size_t                  cost   ;
+      } ;
+      typedef std::list<Entry>                                   LRU   ;
+      /// the index: the combined hash of the key -> entry
+      typedef std::unordered_map<std::size_t,LRU::iterator>      Index ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the mutex
+      mutable std::mutex m_mutex     ;
+      /// the entries, the most recently used first
+      LRU                m_lru       ;
+      /// the index
+      Index              m_index     ;
+      /// the estimated memory
+      std::size_t        m_memory    ;
+      /// the memory limit
+      std::size_t        m_maxmemory ;
+      /// the maximal number of objects
+      std::size_t        m_maxsize   ;
+      /// number of hits
+      std::size_t        m_hits      ;
+      /// number of misses
+      std::size_t        m_misses    ;
+      /// number of hash collisions
+      std::size_t        m_collisions ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_HISTOMEMO_H
+// ============================================================================
@@ -4,6 +4,11 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+// ============================================================================
 // Forward declarations
 // ============================================================================
 class TTree       ; // From ROOT 
@@ -21,6 +26,12 @@ namespace Ostap
     // ========================================================================
     /// evaluate the function from TTree 
     virtual double     operator () ( const TTree* tree ) const = 0 ;
+    /** get the expressions, used by this function, e.g. for the read planning
+     *  @param  result (UPDATE) the expressions are appended here 
+     *  @return false if the expressions are unknown (any branch can be used)
+     *  @see Ostap::Utils::ReadPlan 
+     */
+    virtual bool       expressions ( std::vector<std::string>& result ) const ;
     /// virtual destructor 
     virtual ~IFuncTree  () ;
     // ========================================================================
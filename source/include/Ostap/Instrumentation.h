@@ -0,0 +1,234 @@
+// ============================================================================
+#ifndef OSTAP_INSTRUMENTATION_H
+#define OSTAP_INSTRUMENTATION_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+//   STD&STL
+// ============================================================================
+#include <atomic>
+#include <string>
+#include <vector>
+// ============================================================================
+/** @file Ostap/Instrumentation.h
+ *  Low-overhead instrumentation of the hot paths:
+ *  named counters and timers with per-thread storage.
+ *
+ *  The instrumentation is compiled in, but it is switched off by default;
+ *  when it is switched off, each probe costs one relaxed atomic load
+ *  and the branch.
+ *
+ *  @code
+ *  // counter: e.g. number of calls
+ *  static const Ostap::Utils::Instrumentation::Counter s_calls ( "Formula::evaluate" ) ;
+ *  s_calls.add () ;
+ *  // timer: number of calls, processed items and the time
+ *  static const Ostap::Utils::Instrumentation::Timer   s_loop  ( "StatVar/TTree" ) ;
+ *  {
+ *    const Ostap::Utils::Instrumentation::Scope scope ( s_loop , nEntries ) ;
+ *    ... the loop ...
+ *  }
+ *  @endcode
+ *
+ *  Python:
+ *  @code
+ *  Ostap.Utils.Instrumentation.setEnabled ( True )
+ *  ...
+ *  for r in Ostap.Utils.Instrumentation.snapshot() : print ( r.name , r.count , r.time )
+ *  @endcode
+ *  @see ostap.utils.instrumentation
+ *
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    namespace Instrumentation
+    {
+      // ======================================================================
+      namespace details
+      {
+        // ====================================================================
+        /// the global switch
+        extern std::atomic<bool> s_enabled ;
+        /// the index of the inactive scope
+        const unsigned int s_NONE = ~0u ;
+        // ====================================================================
+      }
+      // ======================================================================
+      /// is instrumentation enabled?
+      inline bool enabled ()
+      { return details::s_enabled.load ( std::memory_order_relaxed ) ; }
+      // ======================================================================
+      /** enable/disable the instrumentation
+       *  @return the previous value
+       */
+      bool setEnabled ( const bool value ) ;
+      // ======================================================================
+      /** @struct Record
+       *  the snapshot of the counter or timer
+       */
+      struct Record
+      {
+        /// the name
+        std::string        name   {       } ;
+        /// is it timer?
+        bool               timer  { false } ;
+        /// number of counts (calls for timer)
+        unsigned long long count  { 0     } ;
+        /// number of processed items (timer only)
+        unsigned long long items  { 0     } ;
+        /// the total time in seconds (timer only)
+        double             time   { 0     } ;
+      } ;
+      // ======================================================================
+      /** get the snapshot of all counters and timers,
+       *  summed over all threads (including finished threads)
+       *  @param all include the counters with no counts
+       */
+      std::vector<Record> snapshot ( const bool all = false ) ;
+      // ======================================================================
+      /** reset all counters and timers
+       *  @attention the counts, accumulated concurrently
+       *  with the reset, can be partially lost
+       */
+      void reset () ;
+      // ======================================================================
+      /** @class Counter
+       *  the named counter; counters with the same name share the storage
+       */
+      class Counter
+      {
+      public:
+        // ====================================================================
+        /// constructor from the name
+        explicit Counter ( const std::string& name ) ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// increment the counter
+        inline void add ( const unsigned long long n = 1 ) const
+        { if ( enabled () ) { increment ( m_index , n ) ; } }
+        /// the name
+        std::string  name  () const ;
+        /// the index
+        unsigned int index () const { return m_index ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// increment the counter for the current thread
+        static void increment ( const unsigned int index , const unsigned long long n ) ;
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the index of the slot
+        unsigned int m_index ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Timer
+       *  the named timer: number of calls, processed items and the time
+       *  @see Ostap::Utils::Instrumentation::Scope
+       */
+      class Timer
+      {
+      public:
+        // ====================================================================
+        /// constructor from the name
+        explicit Timer ( const std::string& name ) ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// the name
+        std::string  name  () const ;
+        /// the index
+        unsigned int index () const { return m_index ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the index of the slot
+        unsigned int m_index ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Scope
+       *  the timed scope: if instrumentation is enabled at construction,
+       *  the time between constructor and destructor is accumulated
+       *  @see Ostap::Utils::Instrumentation::Timer
+       */
+      class Scope
+      {
+      public:
+        // ====================================================================
+        /** constructor
+         *  @param timer the timer
+         *  @param items number of processed items (e.g. entries in the loop)
+         */
+        Scope ( const Timer& timer , const unsigned long long items = 0 )
+          : m_index ( enabled () ? timer.index () : details::s_NONE )
+          , m_items ( items )
+        { if ( details::s_NONE != m_index ) { m_start = now () ; } }
+        /// destructor: accumulate the time
+        ~Scope () { if ( details::s_NONE != m_index ) { stop () ; } }
+        // ====================================================================
+      private:
+        // ====================================================================
+        Scope ( const Scope& ) ;
+        Scope& operator=( const Scope& ) ;
+        // ====================================================================
+      public:
+        // ====================================================================
+        /// update number of processed items
+        void setItems ( const unsigned long long items ) { m_items = items ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the current time in nanoseconds
+        static long long now () ;
+        /// accumulate the time
+        void stop () ;
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// the index of the slot
+        unsigned int       m_index ;
+        /// number of processed items
+        unsigned long long m_items ;
+        /// the start time (nanoseconds)
+        long long          m_start { 0 } ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** count the call of <code>evaluate</code> method
+       *  for the class with ROOT dictionary
+       *  @code
+       *  Double_t Ostap::Models::Gauss::evaluate() const
+       *  {
+       *    Ostap::Utils::Instrumentation::evaluated ( this ) ;
+       *    ...
+       *  }
+       *  @endcode
+       */
+      template <class OBJECT>
+      inline void evaluated ( const OBJECT* /* object */ )
+      {
+        if ( !enabled () ) { return ; }
+        static const Counter s_counter { std::string ( OBJECT::Class_Name () ) + "::evaluate" } ;
+        s_counter.add () ;
+      }
+      // ======================================================================
+    } //                      The end of namespace Ostap::Utils::Instrumentation
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_INSTRUMENTATION_H
+// ============================================================================
@@ -13,6 +13,7 @@
 #include <iterator>
 #include <algorithm>
 #include "Ostap/Math.h"
+#include "Ostap/ThreadPool.h"
 
 
 
@@ -1584,6 +1585,262 @@ namespace Ostap
       // ======================================================================
     } ;
     // ========================================================================
+    /** @class LocalInterpolation
+     *  Local polynomial interpolation of degree <code>N</code>
+     *  for large interpolation tables (e.g. 10^4-10^5 points)
+     *  - the bracketing interval is found with O(log n) binary search,
+     *    or in O(1) for the uniform abscissas
+     *  - the value is obtained with Neville's algorithm using
+     *    the stencil of <code>N+1</code> points around the interval,
+     *    the stencil size is fixed at compile time
+     *  - outside the table the boundary stencil is used (extrapolation)
+     *  - all evaluations are const and thread-safe
+     *  - the batch evaluation benefits from the sorted input
+     *
+     *  @code
+     *  Interpolation::Table table = ... ; // large table
+     *  LocalInterpolation<3> cubic ( table ) ;
+     *  const double value = cubic ( 0.5 ) ;
+     *  @endcode
+     *  @see Ostap::Math::Neville
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    template <unsigned short N = 3>
+    class LocalInterpolation : Interpolation::Table
+    {
+      // ======================================================================
+      static_assert ( 1 <= N && N <= 12 , "Invalid degree of local interpolation!" ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual type of data
+      typedef Interpolation::Abscissas::Data Data ;
+      /// the minimal size of the chunk for the parallel batch evaluation
+      enum { GRAIN = 4096 } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the interpolation table
+       *  @param table the interpolation table
+       */
+      LocalInterpolation ( const Interpolation::Table& table )
+        : Interpolation::Table ( table )
+      { this->init () ; }
+      // ======================================================================
+      /** the simplest constructor
+       *  @param data   input data
+       *  @param sorted indicate if data already  sorted and duplicated removed
+       */
+      LocalInterpolation ( const Interpolation::TABLE& data           ,
+                           const bool                  sorted = false )
+        : Interpolation::Table ( data , sorted )
+      { this->init () ; }
+      // ======================================================================
+      /** simple contructor from abscissas and y-list
+       *  @param x input vector of abscissas
+       *  @param y input vector of y
+       */
+      LocalInterpolation ( const Interpolation::Abscissas& x ,
+                           const Data&                     y )
+        : Interpolation::Table ( x , y )
+      { this->init () ; }
+      // ======================================================================
+      /** simple contructor from x&y-lists
+       *  @param x input vector of x
+       *  @param y input vector of y
+       *  @attention duplicated abscissas will be removed
+       */
+      LocalInterpolation ( const Data& x ,
+                           const Data& y )
+        : Interpolation::Table ( x , y )
+      { this->init () ; }
+      // ======================================================================
+      /** templated constructor for the uniform table
+       *  @param fun  function object
+       *  @param n    number of interpolation points
+       *  @param low  low edge of interpolation region
+       *  @param high high edge of interpolation region
+       */
+      template <class FUNCTION>
+      LocalInterpolation ( FUNCTION          fun  ,
+                           const std::size_t n    ,
+                           const double      low  ,
+                           const double      high )
+        : Interpolation::Table ( uniform ( fun , n , low , high ) )
+      { this->init () ; }
+      // ======================================================================
+      /// default constructor
+      LocalInterpolation () = default ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the main method: get the value of the interpolant
+      double evaluate    ( const double x ) const
+      {
+        if      ( 0 == m_n ) { return 0 ; }
+        else if ( 1 == m_n ) { return data () [ 0 ].second ; }
+        return value ( start ( bracket ( x ) , x ) , x ) ;
+      }
+      /// the main method: get the value of the interpolant
+      double operator () ( const double x ) const { return evaluate ( x ) ; }
+      // ======================================================================
+      /// get the derivative (dy/dx) at point x
+      double derivative  ( const double x ) const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** evaluate the interpolant for the array of points
+       *  - it is most efficient for the sorted input
+       *  - large arrays are processed in parallel
+       *  @param n      number of points
+       *  @param x      (input)  the points
+       *  @param result (output) the values
+       */
+      void evaluate
+      ( const std::size_t n      ,
+        const double*     x      ,
+        double*           result ) const ;
+      /// evaluate the interpolant for the vector of points
+      std::vector<double> evaluate ( const std::vector<double>& x ) const
+      {
+        std::vector<double> result ( x.size () , 0.0 ) ;
+        evaluate ( x.size () , x.data () , result.data () ) ;
+        return result ;
+      }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// degree of the local polynomial
+      static constexpr unsigned short degree () { return N ; }
+      /// are the abscissas uniform ?
+      bool uniform () const { return m_uniform ; }
+      // ======================================================================
+      using Interpolation::Table::n         ;
+      using Interpolation::Table::size      ;
+      using Interpolation::Table::empty     ;
+      using Interpolation::Table::xmin      ;
+      using Interpolation::Table::xmax      ;
+      using Interpolation::Table::data      ;
+      using Interpolation::Table::table     ;
+      using Interpolation::Table::abscissas ;
+      // ======================================================================
+      /// get the interpolation table
+      const Interpolation::Table& points () const { return *this ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** index of the bracketing interval
+       *  \f$ x_j \le x < x_{j+1}\f$, \f$ 0 \le j \le n-2 \f$
+       */
+      std::size_t bracket ( const double x ) const
+      {
+        if ( m_n < 3 ) { return 0 ; }
+        if ( m_uniform )
+        {
+          const double t = ( x - m_x0 ) * m_hi ;
+          return t <= 0 ? 0 : std::min ( std::size_t ( t ) , m_n - 2 ) ;
+        }
+        return search ( x , 0 ) ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// create the uniform table
+      template <class FUNCTION>
+      static Interpolation::Table uniform
+      ( FUNCTION          fun  ,
+        const std::size_t n    ,
+        const double      low  ,
+        const double      high )
+      {
+        const std::size_t nn = std::max ( n , std::size_t ( 2 ) ) ;
+        const double      xl = std::min ( low , high ) ;
+        const double      dx = ( std::max ( low , high ) - xl ) / ( nn - 1 ) ;
+        Data x ( nn ) , y ( nn ) ;
+        for ( std::size_t i = 0 ; i < nn ; ++i )
+        {
+          x [ i ] = xl + i * dx ;
+          y [ i ] = fun ( x [ i ] ) ;
+        }
+        return Interpolation::Table ( Interpolation::Abscissas ( x , true ) , y ) ;
+      }
+      // ======================================================================
+      /// precompute the parameters for the bracketing
+      void init ()
+      {
+        const Interpolation::TABLE& t = data () ;
+        m_n       = t.size () ;
+        m_uniform = false ;
+        if ( m_n < 3 ) { return ; }
+        m_x0 = t.front ().first ;
+        m_h  = ( t.back ().first - m_x0 ) / ( m_n - 1 ) ;
+        m_hi = 1 / m_h ;
+        const double eps = 1.e-9 * m_h ;
+        for ( std::size_t i = 0 ; i < m_n ; ++i )
+        { if ( eps < std::abs ( t [ i ].first - ( m_x0 + i * m_h ) ) ) { return ; } }
+        m_uniform = true ;
+      }
+      // ======================================================================
+      /// binary search for the bracketing interval starting from j
+      std::size_t search ( const double x , const std::size_t j ) const
+      {
+        const Interpolation::TABLE& t = data () ;
+        auto it = std::upper_bound
+          ( t.begin () + ( j + 1 ) , t.end () - 1 , x ,
+            [] ( const double v , const std::pair<double,double>& p ) { return v < p.first ; } ) ;
+        return ( it - t.begin () ) - 1 ;
+      }
+      // ======================================================================
+      /// the first point of the stencil for the bracketing interval j
+      std::size_t start ( const std::size_t j , const double x ) const
+      {
+        if ( m_n <= N + 1 ) { return 0 ; }
+        long k = 0 ;
+        if ( 1 == N % 2 ) { k = long ( j ) - long ( ( N - 1 ) / 2 ) ; } // symmetric stencil
+        else  // odd number of points: shift towards the nearest side
+        {
+          const Interpolation::TABLE& t = data () ;
+          k = long ( j ) - long ( N / 2 ) ;
+          if ( t [ j + 1 ].first - x < x - t [ j ].first ) { ++k ; }
+        }
+        return std::size_t ( std::max ( 0L , std::min ( k , long ( m_n - N - 1 ) ) ) ) ;
+      }
+      // ======================================================================
+      /// Neville's algorithm for the stencil, starting from k
+      double value ( const std::size_t k , const double x ) const
+      {
+        const Interpolation::TABLE& t = data () ;
+        const std::size_t L = std::min ( m_n , std::size_t ( N + 1 ) ) ;
+        std::array<double,N+1> p ;
+        for ( std::size_t i = 0 ; i < L ; ++i ) { p [ i ] = t [ k + i ].second ; }
+        for ( std::size_t m = 1 ; m < L ; ++m )
+        {
+          for ( std::size_t i = 0 ; i + m < L ; ++i )
+          {
+            const double xi = t [ k + i     ].first ;
+            const double xj = t [ k + i + m ].first ;
+            p [ i ] = ( ( x - xj ) * p [ i ] + ( xi - x ) * p [ i + 1 ] ) / ( xi - xj ) ;
+          }
+        }
+        return p [ 0 ] ;
+      }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// number of points
+      std::size_t m_n       { 0     } ; // number of points
+      /// uniform abscissas ?
+      bool        m_uniform { false } ; // uniform abscissas ?
+      /// the first abscissa
+      double      m_x0      { 0     } ; // the first abscissa
+      /// the step for uniform abscissas
+      double      m_h       { 1     } ; // the step
+      /// the inverse step for uniform abscissas
+      double      m_hi      { 1     } ; // the inverse step
+      // ======================================================================
+    } ;
+    // ========================================================================
     namespace Interpolation 
     {
       // ======================================================================
@@ -2315,6 +2572,76 @@ Ostap::Math::Interpolation::neville2
   return std::make_pair ( *ybegin , *dbegin ) ;
 }
 // ============================================================================
+// get the derivative (dy/dx) at point x
+// ============================================================================
+template <unsigned short N>
+inline double
+Ostap::Math::LocalInterpolation<N>::derivative ( const double x ) const
+{
+  if ( m_n < 2 ) { return 0 ; }
+  const Interpolation::TABLE& t = data () ;
+  const std::size_t k = start ( bracket ( x ) , x ) ;
+  const std::size_t L = std::min ( m_n , std::size_t ( N + 1 ) ) ;
+  std::array<double,N+1> p ;
+  std::array<double,N+1> d ;
+  for ( std::size_t i = 0 ; i < L ; ++i ) { p [ i ] = t [ k + i ].second ; d [ i ] = 0 ; }
+  for ( std::size_t m = 1 ; m < L ; ++m )
+  {
+    for ( std::size_t i = 0 ; i + m < L ; ++i )
+    {
+      const double xi = t [ k + i     ].first ;
+      const double xj = t [ k + i + m ].first ;
+      d [ i ] = ( ( x - xj ) * d [ i ] + p [ i ] + ( xi - x ) * d [ i + 1 ] - p [ i + 1 ] ) / ( xi - xj ) ;
+      p [ i ] = ( ( x - xj ) * p [ i ] +           ( xi - x ) * p [ i + 1 ]                ) / ( xi - xj ) ;
+    }
+  }
+  return d [ 0 ] ;
+}
+// ============================================================================
+/*  evaluate the interpolant for the array of points
+ *  - for the sorted input the bracketing interval is found by the
+ *    short forward walk from the previous one
+ *  - large arrays are split into the chunks, processed in parallel
+ */
+// ============================================================================
+template <unsigned short N>
+inline void
+Ostap::Math::LocalInterpolation<N>::evaluate
+( const std::size_t n      ,
+  const double*     x      ,
+  double*           result ) const
+{
+  if ( 0 == n ) { return ; }
+  //
+  auto kernel = [this,x,result] ( const std::size_t begin , const std::size_t end )
+    {
+      if      ( 0 == m_n ) { std::fill ( result + begin , result + end , 0.0 ) ; return ; }
+      else if ( 1 == m_n ) { std::fill ( result + begin , result + end , data () [ 0 ].second ) ; return ; }
+      //
+      const Interpolation::TABLE& t = data () ;
+      std::size_t j    = bracket ( x [ begin ] ) ;
+      double      prev = x [ begin ] ;
+      for ( std::size_t i = begin ; i < end ; ++i )
+      {
+        const double v = x [ i ] ;
+        if      ( m_uniform || m_n < 3 ) { j = bracket ( v ) ; }
+        else if ( v < prev             ) { j = search  ( v , 0 ) ; }
+        else
+        {
+          // short forward walk, then the binary search
+          unsigned short steps = 0 ;
+          while ( j + 2 < m_n && t [ j + 1 ].first <= v && steps < 4 ) { ++j ; ++steps ; }
+          if    ( j + 2 < m_n && t [ j + 1 ].first <= v ) { j = search ( v , j ) ; }
+        }
+        prev        = v ;
+        result [ i ] = value ( start ( j , v ) , v ) ;
+      }
+    } ;
+  //
+  if ( n < GRAIN ) { kernel ( 0 , n ) ; }
+  else { Ostap::Utils::ThreadPool::parallel_for ( n , kernel , GRAIN ) ; }
+}
+// ============================================================================
 //                                                                      The END 
 // ============================================================================
 #endif // OSTAP_INTERPOLATION_H
@@ -0,0 +1,279 @@
+// ============================================================================
+#ifndef OSTAP_KINEMATICSBATCH_H
+#define OSTAP_KINEMATICSBATCH_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <cstddef>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Vector4DTypes.h"
+// ============================================================================
+/** @file Ostap/KinematicsBatch.h
+ *  Batch (columnar) versions of the kinematical functions
+ *  from the file Ostap/Kinematics.h
+ *  @see Ostap/Kinematics.h
+ *  @author Ostap developers
+ *  @date   2026-10-19
+ */
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Kinematics
+  {
+    // ========================================================================
+    /** @class LorentzColumns Ostap/KinematicsBatch.h
+     *  Light-weight view of the four-vectors, stored as four
+     *  separate arrays ("structure of arrays"): \f$(p_x,p_y,p_z,E)\f$
+     *  The arrays are not owned by the view.
+     *  @code
+     *  std::vector<double> px , py , pz , e  ;
+     *  ...
+     *  const LorentzColumns B ( px.data() , py.data() , pz.data() , e.data() ) ;
+     *  @endcode
+     */
+    class LorentzColumns
+    {
+    public:
+      // ======================================================================
+      /// constructor from the arrays
+      LorentzColumns
+      ( const double* px ,
+        const double* py ,
+        const double* pz ,
+        const double* e  )
+        : m_px ( px )
+        , m_py ( py )
+        , m_pz ( pz )
+        , m_e  ( e  )
+      {}
+      /// default constructor
+      LorentzColumns () = default ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get i-th vector
+      inline Ostap::LorentzVector operator[] ( const std::size_t i ) const
+      { return Ostap::LorentzVector ( m_px [ i ] , m_py [ i ] , m_pz [ i ] , m_e [ i ] ) ; }
+      /// valid view ?
+      inline bool valid () const
+      { return m_px && m_py && m_pz && m_e ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      const double* px () const { return m_px ; }
+      const double* py () const { return m_py ; }
+      const double* pz () const { return m_pz ; }
+      const double* e  () const { return m_e  ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      const double* m_px { nullptr } ; // x-component of momentum
+      const double* m_py { nullptr } ; // y-component of momentum
+      const double* m_pz { nullptr } ; // z-component of momentum
+      const double* m_e  { nullptr } ; // energy
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class Batch Ostap/KinematicsBatch.h
+     *  Batch versions of the kinematical functions: the arguments
+     *  are the columns of four-vectors and the results are written into
+     *  the output array of (at least) <code>n</code> elements.
+     *
+     *  - no GenVector objects are created outside of the inner loops
+     *  - the functions are evaluated inline in the tight loops
+     *  - long arrays are split into chunks and processed in parallel
+     *    @see Ostap::Utils::ThreadPool
+     *  - for invalid kinematics the same large negative value is
+     *    returned as for scalar functions
+     *
+     *  @code
+     *  const std::size_t n = ... ;
+     *  LorentzColumns B  = ... ;
+     *  LorentzColumns J  = ... ;
+     *  LorentzColumns mu = ... ;
+     *  std::vector<double> cos_theta ( n ) ;
+     *  Ostap::Kinematics::Batch::decayAngle ( n , B , J , mu , cos_theta.data() ) ;
+     *  @endcode
+     *  @see Ostap/Kinematics.h
+     *  @see Ostap::Kinematics::LorentzColumns
+     */
+    class Batch
+    {
+    public:
+      // ======================================================================
+      /** @enum Variable
+       *  the kinematical variables, known for the generic evaluation
+       *  the number of required four-vectors is given in the brackets
+       */
+      enum Variable
+        {
+          DecayAngle            =  0 , ///< decayAngle ( P , Q , D )           (3)
+          DecayAngleLab         =  1 , ///< decayAngle ( D , M )               (2)
+          CosThetaRest          =  2 , ///< cosThetaRest ( v1 , v2 , M )       (3)
+          DecayAngleChi         =  3 , ///< decayAngleChi ( d1 , d2 , h1 , h2 ) (4)
+          CosDecayAngleChi      =  4 , ///< cosDecayAngleChi                   (4)
+          SinDecayAngleChi      =  5 , ///< sinDecayAngleChi                   (4)
+          ArmenterosPodolanskiX =  6 , ///< armenterosPodolanskiX ( d1 , d2 )  (2)
+          RestMomentum          =  7 , ///< restMomentum ( v , M )             (2)
+          RestEnergy            =  8 , ///< restEnergy   ( v , M )             (2)
+          TransverseMomentumDir =  9 , ///< transverseMomentumDir ( p , dir )  (2)
+          GramDelta2            = 10 , ///< Gram::Delta ( p1 , p2 )            (2)
+          GramDelta3            = 11 , ///< Gram::Delta ( p1 , p2 , p3 )       (3)
+          Mass2                 = 12 , ///< M2 ( p1 + ... + pn )             (1-4)
+          Mass                  = 13   ///< M  ( p1 + ... + pn )             (1-4)
+        } ;
+      // ======================================================================
+    public: // generic evaluation
+      // ======================================================================
+      /// number of four-vectors, required for the variable
+      static unsigned short nVectors    ( const Variable variable ) ;
+      /// minimal number of four-vectors, accepted for the variable
+      static unsigned short nVectorsMin ( const Variable variable ) ;
+      // ======================================================================
+      /** evaluate the variable for the given four-vectors
+       *  @param variable the variable
+       *  @param vectors  the four-vectors
+       *  @param nvectors number of four-vectors
+       */
+      static double evaluate
+      ( const Variable              variable ,
+        const Ostap::LorentzVector* vectors  ,
+        const unsigned short        nvectors ) ;
+      // ======================================================================
+      /** evaluate the variable for the columns of four-vectors
+       *  @param variable the variable
+       *  @param n        the length of columns
+       *  @param columns  the columns
+       *  @param result   the output array
+       */
+      static void evaluate
+      ( const Variable                     variable ,
+        const std::size_t                  n        ,
+        const std::vector<LorentzColumns>& columns  ,
+        double*                            result   ) ;
+      // ======================================================================
+    public: // the decay angles
+      // ======================================================================
+      /// @see Ostap::Kinematics::decayAngle ( P , Q , D )
+      static void decayAngle
+      ( const std::size_t     n      ,
+        const LorentzColumns& P      ,
+        const LorentzColumns& Q      ,
+        const LorentzColumns& D      ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::decayAngle ( D , M )
+      static void decayAngle
+      ( const std::size_t     n      ,
+        const LorentzColumns& D      ,
+        const LorentzColumns& M      ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::cosThetaRest ( v1 , v2 , M )
+      static void cosThetaRest
+      ( const std::size_t     n      ,
+        const LorentzColumns& v1     ,
+        const LorentzColumns& v2     ,
+        const LorentzColumns& M      ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::decayAngleChi ( d1 , d2 , h1 , h2 )
+      static void decayAngleChi
+      ( const std::size_t     n      ,
+        const LorentzColumns& d1     ,
+        const LorentzColumns& d2     ,
+        const LorentzColumns& h1     ,
+        const LorentzColumns& h2     ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::cosDecayAngleChi ( d1 , d2 , h1 , h2 )
+      static void cosDecayAngleChi
+      ( const std::size_t     n      ,
+        const LorentzColumns& d1     ,
+        const LorentzColumns& d2     ,
+        const LorentzColumns& h1     ,
+        const LorentzColumns& h2     ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::sinDecayAngleChi ( d1 , d2 , h1 , h2 )
+      static void sinDecayAngleChi
+      ( const std::size_t     n      ,
+        const LorentzColumns& d1     ,
+        const LorentzColumns& d2     ,
+        const LorentzColumns& h1     ,
+        const LorentzColumns& h2     ,
+        double*               result ) ;
+      // ======================================================================
+    public: // other variables
+      // ======================================================================
+      /// @see Ostap::Kinematics::armenterosPodolanskiX ( d1 , d2 )
+      static void armenterosPodolanskiX
+      ( const std::size_t     n      ,
+        const LorentzColumns& d1     ,
+        const LorentzColumns& d2     ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::restMomentum ( v , M )
+      static void restMomentum
+      ( const std::size_t     n      ,
+        const LorentzColumns& v      ,
+        const LorentzColumns& M      ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::restEnergy ( v , M )
+      static void restEnergy
+      ( const std::size_t     n      ,
+        const LorentzColumns& v      ,
+        const LorentzColumns& M      ,
+        double*               result ) ;
+      /** @see Ostap::Kinematics::transverseMomentumDir ( mom , dir )
+       *  only the spatial components of <code>dir</code> are used
+       */
+      static void transverseMomentumDir
+      ( const std::size_t     n      ,
+        const LorentzColumns& mom    ,
+        const LorentzColumns& dir    ,
+        double*               result ) ;
+      // ======================================================================
+    public: // Gram determinants
+      // ======================================================================
+      /// @see Ostap::Kinematics::Gram::Delta ( p1 , p2 )
+      static void gramDelta
+      ( const std::size_t     n      ,
+        const LorentzColumns& p1     ,
+        const LorentzColumns& p2     ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::Gram::Delta ( p1 , p2 , p3 )
+      static void gramDelta
+      ( const std::size_t     n      ,
+        const LorentzColumns& p1     ,
+        const LorentzColumns& p2     ,
+        const LorentzColumns& p3     ,
+        double*               result ) ;
+      // ======================================================================
+    public: // functions of invariants
+      // ======================================================================
+      /// @see Ostap::Kinematics::triangle ( a , b , c )
+      static void triangle
+      ( const std::size_t     n      ,
+        const double*         a      ,
+        const double*         b      ,
+        const double*         c      ,
+        double*               result ) ;
+      /// @see Ostap::Kinematics::kallen ( a , b , c )
+      static void kallen
+      ( const std::size_t     n      ,
+        const double*         a      ,
+        const double*         b      ,
+        const double*         c      ,
+        double*               result )
+      { triangle ( n , a , b , c , result ) ; }
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                      end of namespace Ostap::Kinenmatics
+  // ==========================================================================
+} //                                                     end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_KINEMATICSBATCH_H
+// ============================================================================
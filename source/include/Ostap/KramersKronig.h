@@ -7,10 +7,12 @@
 // STD&STL
 // ============================================================================
 #include <functional>
+#include <memory>
 // ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/Integrator.h"
+#include "Ostap/TabulatedFunction.h"
 // ============================================================================
 namespace Ostap
 {
@@ -28,12 +30,21 @@ namespace Ostap
      *     { \omega^{\prime n} \left( \omega^{\prime} - \omega \right) }  
      *     d \omega^{\prime} \f]
      *  - Note  the sign! 
+     *
+     *  For repeated evaluations (e.g. dispersive lineshapes in fits)
+     *  the integral can be tabulated once in the working range 
+     *  @see Ostap::Math::KramersKronig::tabulate 
      *  @see Ostap::Math::Integrtor
      *  @author Vanya Belyaev@itep.ru
      *  @date   2020-08-01
      */
     class KramersKronig
     {
+    public:
+      // ======================================================================
+      /// the key function: the table is rebuilt when the key changes
+      typedef Ostap::Math::TabulatedFunction::Key Key ;
+      // ======================================================================
     public:
       // ======================================================================
       /**  templated contructor from the function, low integration edge, 
@@ -99,6 +110,47 @@ namespace Ostap
        */
       double operator() ( const double x ) const ;
       // ======================================================================
+      /// evaluate the integral directly (no tabulation)
+      double exact      ( const double x ) const ;
+      // ======================================================================
+    public: // tabulation
+      // ======================================================================
+      /** tabulate the integral in the range \f$ [x_{min},x_{max}]\f$
+       *  - the nodes are chosen adaptively 
+       *    @see Ostap::Math::TabulatedFunction
+       *  - the tabulated function is the integral without 
+       *    the subtraction factor \f$ \omega^n \f$, that is applied 
+       *    exactly, therefore the zero at the subtraction point is preserved 
+       *  - the logarithmic singularity at the threshold 
+       *    \f$ -\frac{1}{\pi}\frac{\rho(\omega_0)}{\omega_0^n} 
+       *    \log \left| \omega - \omega_0 \right| \f$ is subtracted 
+       *    before the tabulation and added back analytically 
+       *  - each node contains the full integral up to \f$ +\infty \f$, 
+       *    and outside of the range the integral is evaluated directly 
+       *  - the relative precision of interpolation refers to the 
+       *    regular (tabulated) part  
+       *  - if the key-function is specified, the table is rebuilt 
+       *    each time the key changes (e.g. the parameters of \f$ \rho \f$)
+       *  - the table is shared between the copies, the evaluation is thread-safe 
+       *  @param xmin      low  edge of the tabulation range 
+       *  @param xmax      high edge of the tabulation range 
+       *  @param precision the relative precision of the interpolation
+       *  @param maxpoints maximal number of nodes
+       *  @param key       the key function (if any)
+       */
+      void tabulate 
+      ( const double      xmin               , 
+        const double      xmax               , 
+        const double      precision = 1.e-7  , 
+        const std::size_t maxpoints = 10000  ,
+        Key               key       = Key () ) ;
+      /// remove the table 
+      void untabulate () { m_table.reset () ; }
+      /// is the integral tabulated? 
+      bool tabulated  () const { return static_cast<bool> ( m_table ) ; }
+      /// get the table (if any)
+      const Ostap::Math::TabulatedFunction* table () const { return m_table.get () ; }
+      // ======================================================================
     public:
       // ====================================================================== 
       /// get the value of \f$ \varrho \f$ function  
@@ -110,6 +162,16 @@ namespace Ostap
       /// low integrtaion edge 
       double         lowEdge () const { return m_omega0 ; }
       // ======================================================================
+    private:
+      // ======================================================================
+      /** the coefficient of the logarithmic singularity at the threshold 
+       *  \f$ \frac{\rho(\omega_0)}{\omega_0^n} \f$
+       */
+      static double threshold 
+      ( const std::function<double(double)>& rho    , 
+        const double                         omega0 , 
+        const unsigned short                 n      ) ;
+      // ======================================================================
     private:
       // ======================================================================
       /// the function 
@@ -126,6 +188,8 @@ namespace Ostap
       unsigned short                 m_rescale    ; // #rescale points 
       /// Integrator
       Ostap::Math::Integrator        m_integrator ; // integrator 
+      /// the table (if any)
+      std::shared_ptr<const Ostap::Math::TabulatedFunction> m_table {} ; //! the table 
       // ======================================================================
     };
     // ========================================================================
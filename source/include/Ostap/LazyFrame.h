@@ -0,0 +1,234 @@
+// ============================================================================
+#ifndef OSTAP_LAZYFRAME_H
+#define OSTAP_LAZYFRAME_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <memory>
+#include <string>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "RVersion.h"   // ROOT
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/DataFrame.h"
+#include "Ostap/DataFrameActions.h"
+#include "Ostap/StatVar.h"
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TH1 ; // ROOT
+class TH2 ; // ROOT
+class TH3 ; // ROOT
+// ============================================================================
+/// ONLY starting from ROOT 6.16
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  /** @class LazyFrame Ostap/LazyFrame.h
+   *  Lazy versions of Ostap::StatVar and Ostap::HistoProject actions
+   *  for DataFrame:
+   *  - each call only books the action and returns the handle
+   *  - the temporary columns for identical expressions and selections
+   *    are defined (and JIT-compiled) only once and shared between
+   *    all booked actions
+   *  - all actions, booked before <code>run</code>, are processed
+   *    in one event loop
+   *  - the event loop is also triggered by the first access
+   *    to the result of any pending handle
+   *
+   *  @code
+   *  DataFrame       frame = ... ;
+   *  LazyFrame       lazy ( frame ) ;
+   *  auto s1 = lazy.statVar  ( "pt"  , "eta>2" ) ;
+   *  auto s2 = lazy.statVar  ( "eta" , "eta>2" ) ;
+   *  auto c  = lazy.statCov  ( "pt"  , "eta"   ) ;
+   *  auto h  = lazy.project  ( histo , "pt" , "eta>2" ) ;
+   *  lazy.run () ;   // one event loop for everything
+   *  const Ostap::StatVar::Statistic& pt = s1.get () ;
+   *  @endcode
+   *  @see Ostap::StatVar
+   *  @see Ostap::HistoProject
+   *  @author Ostap developers
+   *  @date   2026-10-19
+   */
+  class LazyFrame
+  {
+  public:
+    // ========================================================================
+    /// the actual type for statistic
+    typedef Ostap::StatVar::Statistic   Statistic  ;
+    /// the actual type for the covariance
+    typedef Ostap::Actions::Covariance  Covariance ;
+    // ========================================================================
+    /** @class Handle
+     *  The handle for the lazy result: the access to
+     *  the result triggers the event loop (if needed)
+     */
+    template <class RESULT>
+    class Handle
+    {
+      // ======================================================================
+      friend class LazyFrame ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual storage for the result
+      struct Slot
+      {
+        RESULT value {       } ;
+        bool   ready { false } ;
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// default constructor
+      Handle () = default ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// is the result ready?
+      bool          ready () const { return m_slot && m_slot->ready ; }
+      /// get the result (the event loop is triggered if needed)
+      const RESULT& get   () const ;
+      /// get the result (the event loop is triggered if needed)
+      const RESULT& operator* () const { return  get () ; }
+      /// get the result (the event loop is triggered if needed)
+      const RESULT* operator->() const { return &get () ; }
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// constructor from the frame
+      Handle ( const LazyFrame& frame )
+        : m_frame ( new LazyFrame ( frame ) )
+        , m_slot  ( std::make_shared<Slot> () )
+      {}
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the frame
+      std::shared_ptr<LazyFrame> m_frame {} ; // the frame
+      /// the result
+      std::shared_ptr<Slot>      m_slot  {} ; // the result
+      // ======================================================================
+    } ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /// constructor from the frame
+    LazyFrame ( DataFrame frame ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** book the number of equivalent entries
+     *  \f$ n_{eff} \equiv = \frac{ (\sum w)^2}{ \sum w^2} \f$
+     *  @param cuts  (INPUT) selection criteria/weight
+     *  @see Ostap::StatVar::nEff
+     */
+    Handle<double>     nEff
+    ( const std::string& cuts       = "" ) ;
+    // ========================================================================
+    /** book the statistic for the expression
+     *  @param expression (INPUT) the expression
+     *  @param cuts       (INPUT) the selection/weight
+     *  @see Ostap::StatVar::statVar
+     */
+    Handle<Statistic>  statVar
+    ( const std::string& expression      ,
+      const std::string& cuts       = "" ) ;
+    // ========================================================================
+    /** book the covariance for two expressions
+     *  @param exp1  (INPUT) the first  expression
+     *  @param exp2  (INPUT) the second expression
+     *  @param cuts  (INPUT) the selection/weight
+     *  @see Ostap::StatVar::statCov
+     */
+    Handle<Covariance> statCov
+    ( const std::string& exp1            ,
+      const std::string& exp2            ,
+      const std::string& cuts       = "" ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** book the projection of the frame into 1D-histogram
+     *  - the histogram is reset immediately and filled after the event loop
+     *  @param histo      (UPDATE) the histogram
+     *  @param expression (INPUT)  the expression
+     *  @param selection  (INPUT)  the selection/weight
+     *  @see Ostap::HistoProject::project
+     *  @attention the histogram must be alive till the end of the event loop
+     */
+    Handle<TH1*>       project
+    ( TH1*               histo            ,
+      const std::string& expression       ,
+      const std::string& selection  = ""  ) ;
+    // ========================================================================
+    /** book the projection of the frame into 2D-histogram
+     *  @see Ostap::HistoProject::project2
+     *  @attention the histogram must be alive till the end of the event loop
+     */
+    Handle<TH2*>       project2
+    ( TH2*               histo            ,
+      const std::string& xexpression      ,
+      const std::string& yexpression      ,
+      const std::string& selection  = ""  ) ;
+    // ========================================================================
+    /** book the projection of the frame into 3D-histogram
+     *  @see Ostap::HistoProject::project3
+     *  @attention the histogram must be alive till the end of the event loop
+     */
+    Handle<TH3*>       project3
+    ( TH3*               histo            ,
+      const std::string& xexpression      ,
+      const std::string& yexpression      ,
+      const std::string& zexpression      ,
+      const std::string& selection  = ""  ) ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /** run one event loop for all pending actions
+     *  @return number of processed actions
+     */
+    unsigned long run     () const ;
+    /// number of pending actions
+    unsigned long pending () const ;
+    /// number of event loops, run so far
+    unsigned long nRuns   () const ;
+    // ========================================================================
+  public:
+    // ========================================================================
+    /// the actual (shared) state
+    class Impl ;
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// the actual (shared) state
+    std::shared_ptr<Impl> m_impl {} ; // the actual (shared) state
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  // get the result (the event loop is triggered if needed)
+  // ==========================================================================
+  template <class RESULT>
+  inline const RESULT& LazyFrame::Handle<RESULT>::get () const
+  {
+    static const RESULT s_empty {} ;
+    if ( !m_slot ) { return s_empty ; }
+    if ( !m_slot->ready && m_frame ) { m_frame->run () ; }
+    return m_slot->value ;
+  }
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+#endif // #if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_LAZYFRAME_H
+// ============================================================================
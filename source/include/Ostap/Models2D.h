@@ -346,6 +346,17 @@ namespace Ostap
       // ======================================================================
       /// get the value
       double operator () ( const double x , const double y ) const ;
+      /** evaluate the function for the batch of points 
+       *  (the polynomial is evaluated with the batch kernel)
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const ;
       // ======================================================================
     public:
       // ======================================================================
@@ -489,6 +500,17 @@ namespace Ostap
       // ======================================================================
       /// get the value
       double operator () ( const double x , const double y ) const ;
+      /** evaluate the function for the batch of points 
+       *  (the polynomial is evaluated with the batch kernel)
+       *  @param n      number of points 
+       *  @param x      (INPUT)  x-values 
+       *  @param y      (INPUT)  y-values 
+       *  @param result (OUTPUT) the values 
+       */
+      void   evaluate    ( const std::size_t n      , 
+                           const double*     x      , 
+                           const double*     y      , 
+                           double*           result ) const ;
       // ======================================================================
     public:
       // ======================================================================
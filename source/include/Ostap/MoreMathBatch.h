@@ -0,0 +1,217 @@
+// ============================================================================
+#ifndef OSTAP_MOREMATHBATCH_H
+#define OSTAP_MOREMATHBATCH_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <string>
+#include <vector>
+// ============================================================================
+/** @file Ostap/MoreMathBatch.h
+ *  Batch versions of the special functions from Ostap/MoreMath.h:
+ *  the function is evaluated for the contiguous array of
+ *  <code>n</code> arguments and the results are written into
+ *  the output array of (at least) <code>n</code> elements.
+ *  The output array can coincide with the input array.
+ *
+ *  - the inner loops for the most frequently used functions
+ *    (gaussian pdf/cdf, error functions, Dawson integral, probit and
+ *    Clenshaw sums) are branch-free and vectorized; each loop is compiled
+ *    for AVX-512, AVX2 and the baseline instruction set and the
+ *    appropriate version is selected at runtime by the loader;
+ *    @see Ostap::Math::Batch::simd
+ *  - the remaining functions are evaluated with the scalar
+ *    implementations
+ *  - long arrays are split into chunks and processed in parallel
+ *    @see Ostap::Utils::ThreadPool
+ *
+ *  The accuracy with respect to the scalar functions is stated for
+ *  each function as the maximal difference in units in the last
+ *  place (ULP); it is verified by the test 
+ *  <code>ostap/math/tests/test_math_batch.py</code> and, with more points,
+ *  by the <code>ostap_accuracy</code> executable, built together with 
+ *  the benchmarks. For the functions
+ *  with \f$ e^{\pm x^2}\f$ factor the unit is \f$ \max(1,x^2)\f$ ULP:
+ *  the scalar implementations lose that much in the exponent, while
+ *  the vectorized kernels use the exact splitting of \f$ x^2 \f$.
+ *
+ *  @code
+ *  std::vector<double> x = ... ;
+ *  std::vector<double> y ( x.size() ) ;
+ *  Ostap::Math::Batch::gauss_cdf ( x.size() , x.data() , y.data() , mu , sigma ) ;
+ *  @endcode
+ *  @see Ostap/MoreMath.h
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    namespace Batch
+    {
+      // ======================================================================
+      /** the instruction set, used for the vectorized loops:
+       *  <code>"avx512f"</code>, <code>"avx2"</code> or <code>"default"</code>
+       */
+      std::string simd () ;
+      // ======================================================================
+      // vectorized functions
+      // ======================================================================
+      /** gaussian pdf, accuracy: 3 ULP
+       *  @see Ostap::Math::gauss_pdf
+       */
+      void gauss_pdf
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ,
+        const double      mu    = 0 ,
+        const double      sigma = 1 ) ;
+      // ======================================================================
+      /** gaussian cdf, accuracy: 10 ULP
+       *  (relative to the value, also in the far left tail)
+       *  @see Ostap::Math::gauss_cdf
+       */
+      void gauss_cdf
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ,
+        const double      mu    = 0 ,
+        const double      sigma = 1 ) ;
+      // ======================================================================
+      /// error function, accuracy: 3 ULP
+      void erf
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      // ======================================================================
+      /// complementary error function, accuracy: 8 ULP
+      void erfc
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      // ======================================================================
+      /** scaled complementary error function, accuracy: 3 ULP
+       *  @see Ostap::Math::erfcx
+       */
+      void erfcx
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      // ======================================================================
+      /** imaginary error function, accuracy: 3 ULP
+       *  @see Ostap::Math::erfi
+       */
+      void erfi
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      // ======================================================================
+      /** Dawson integral, accuracy: 2 ULP
+       *  @see Ostap::Math::dowson
+       */
+      void dowson
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      // ======================================================================
+      /** quantile function for the standard normal distribution,
+       *  accuracy: 4 ULP (including the propagated rounding of the argument)
+       *  @see Ostap::Math::probit
+       */
+      void probit
+      ( const std::size_t n         ,
+        const double*     alpha     ,
+        double*           result    ) ;
+      // ======================================================================
+      /** Clenshaw summation of the Chebyshev series
+       *  \f$ f(x) = \sum_i p_i T_i(x)\f$ for \f$ -1 \le x \le 1 \f$,
+       *  absolute accuracy: \f$ 2 N \epsilon \sum_i \left|p_i\right|\f$
+       *  @see Ostap::Math::clenshaw_chebyshev
+       */
+      void clenshaw_chebyshev
+      ( const std::vector<double>& pars   ,
+        const std::size_t          n      ,
+        const double*              x      ,
+        double*                    result ) ;
+      // ======================================================================
+      /** Clenshaw summation of the Legendre series
+       *  \f$ f(x) = \sum_i p_i P_i(x)\f$ for \f$ -1 \le x \le 1 \f$,
+       *  absolute accuracy: \f$ 2 N \epsilon \sum_i \left|p_i\right|\f$
+       *  @see Ostap::Math::clenshaw_legendre
+       */
+      void clenshaw_legendre
+      ( const std::vector<double>& pars   ,
+        const std::size_t          n      ,
+        const double*              x      ,
+        double*                    result ) ;
+      // ======================================================================
+      /** Horner summation of the monomial series
+       *  \f$ f(x) = \sum_i p_i x^i \f$,
+       *  absolute accuracy: \f$ 2 N \epsilon \sum_i \left|p_i x^i\right|\f$
+       *  @see Ostap::Math::clenshaw_polynom
+       */
+      void clenshaw_polynom
+      ( const std::vector<double>& pars   ,
+        const std::size_t          n      ,
+        const double*              x      ,
+        double*                    result ) ;
+      // ======================================================================
+      // scalar functions in the loop: exact the same results
+      // ======================================================================
+      /// @see Ostap::Math::student_cdf
+      void student_cdf
+      ( const std::size_t n         ,
+        const double*     t         ,
+        double*           result    ,
+        const double      nu        ) ;
+      /// @see Ostap::Math::owen
+      void owen
+      ( const std::size_t n         ,
+        const double*     h         ,
+        double*           result    ,
+        const double      a         ) ;
+      /// @see Ostap::Math::igamma
+      void igamma
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ) ;
+      /// @see Ostap::Math::bessel_Kn
+      void bessel_Kn
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ,
+        const int         order     ) ;
+      /// @see Ostap::Math::bessel_Knu
+      void bessel_Knu
+      ( const std::size_t n         ,
+        const double*     x         ,
+        double*           result    ,
+        const double      nu        ) ;
+      /// @see Ostap::Math::elliptic_K
+      void elliptic_K
+      ( const std::size_t n         ,
+        const double*     k         ,
+        double*           result    ) ;
+      /// @see Ostap::Math::elliptic_E
+      void elliptic_E
+      ( const std::size_t n         ,
+        const double*     k         ,
+        double*           result    ) ;
+      // ======================================================================
+    } //                                  The end of namespace Ostap::Math::Batch
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_MOREMATHBATCH_H
+// ============================================================================
@@ -7,6 +7,8 @@
 // STD&STL
 // ============================================================================
 #include <functional>
+#include <memory>
+#include <vector>
 // ============================================================================
 // ROOT/RooFit 
 // ============================================================================
@@ -15,8 +17,14 @@
 #include "RooProduct.h"
 #include "RooRealConstant.h"
 #include "RooRealProxy.h"
+#include "RooListProxy.h"
 #include "RooAbsPdf.h"
 #include "RooGlobalFunc.h"
+#include "RooAbsRealLValue.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/AdaptiveChebyshev.h"
 // ============================================================================
 namespace Ostap 
 {
@@ -308,6 +316,11 @@ namespace Ostap
       // the actual evaluation of the result 
       Double_t evaluate () const override ;
       // ======================================================================
+    public :
+      // ======================================================================
+      /// the actual transformation 
+      const std::function<double(double)>& fun () const { return m_fun ; }
+      // ======================================================================
     private:
       // ======================================================================
       /// actual transformation 
@@ -460,6 +473,11 @@ namespace Ostap
       // fictive default constructor 
       FunTwoVars() {}      
       // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual function 
+      const std::function<double(double,double)>& fun2 () const { return m_fun2 ; }
+      // ======================================================================
     protected:
       // ======================================================================
       // the actual evaluation of the result 
@@ -1826,6 +1844,256 @@ namespace Ostap
       RooRealProxy m_pdf2 ; // the second pdf 
       // ======================================================================
     } ;
+    // ========================================================================
+    /** @class ChebyshevProxy
+     *  Proxy for the 1D PDF with slow evaluation (e.g. Faddeeva-based or 
+     *  integral-based shapes): the PDF is replaced by its adaptive 
+     *  piecewise Chebyshev approximation in the range of the observable
+     *  - the approximation is rebuilt when any parameter of the PDF changes
+     *    or when the range of the observable changes 
+     *  - the PDF is sampled via its private copy, the observable and 
+     *    the parameters of the original PDF are never modified 
+     *  - the normalization integral is calculated analytically 
+     *    from the Chebyshev coefficients 
+     *  @see Ostap::Math::AdaptiveChebyshev
+     *  @attention each rebuild costs O(#nodes) evaluations of the original 
+     *  PDF, the proxy pays off only if the number of evaluations per 
+     *  parameter set (e.g. the size of the dataset) is much larger 
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class ChebyshevProxy : public RooAbsPdf
+    {
+      // ========================================================================
+      ClassDefOverride(Ostap::MoreRooFit::ChebyshevProxy , 1 ) ;  // Chebyshev proxy for PDF
+      // ========================================================================
+    public:
+      // ======================================================================== 
+      /** constructor from name, title, the observable and the PDF
+       *  @param name      name 
+       *  @param title     title 
+       *  @param x         the observable
+       *  @param pdf       the PDF to be approximated 
+       *  @param precision the relative precision of the approximation 
+       *  @param maxorder  maximal order of the polynomial in one piece 
+       *  @param maxpieces maximal number of pieces 
+       */
+      ChebyshevProxy ( const char*        name               , 
+                       const char*        title              , 
+                       RooAbsRealLValue&  x                  , 
+                       RooAbsPdf&         pdf                , 
+                       const double       precision = 1.e-8  ,
+                       const unsigned int maxorder  = 128    , 
+                       const unsigned int maxpieces = 1000   ) ;
+      /// copy constructor 
+      ChebyshevProxy ( const ChebyshevProxy& right    , 
+                       const char*           name = 0 ) ;
+      /// destructor 
+      virtual ~ChebyshevProxy() ;
+      /// clone 
+      ChebyshevProxy* clone ( const char* newname ) const override ;
+      /// fictive default constructor 
+      ChebyshevProxy () = default ;
+      // ========================================================================
+    public:
+      // ========================================================================
+      Int_t    getAnalyticalIntegral
+      ( RooArgSet&     allVars       , 
+        RooArgSet&     analVars      ,
+        const char*    rangeName = 0 ) const override ;
+      Double_t analyticalIntegral 
+      ( Int_t          code          , 
+        const char*    rangeName = 0 ) const override ;
+      // ========================================================================
+    public:
+      // ========================================================================
+      /// the observable 
+      const RooAbsReal& x          () const { return m_x   .arg () ; }
+      /// the original PDF 
+      const RooAbsReal& original   () const { return m_pdf .arg () ; }
+      /// the parameters of the PDF 
+      const RooArgList& parameters () const { return m_pars ; }
+      /// the relative precision 
+      double       precision () const { return m_precision ; }
+      /// the maximal order 
+      unsigned int maxorder  () const { return m_maxorder  ; }
+      /// the maximal number of pieces 
+      unsigned int maxpieces () const { return m_maxpieces ; }
+      /// get the approximation (build it if needed)
+      const Ostap::Math::AdaptiveChebyshev& chebyshev () const ;
+      /// the value of the original PDF 
+      double exact ( const double x ) const ;
+      /// the key: the hash of the current values of the parameters 
+      std::size_t key () const ;
+      // ========================================================================
+    private:
+      // ========================================================================
+      /// get the private copy of the PDF, synchronized with the parameters 
+      const RooAbsReal& sampler () const ;
+      // ========================================================================
+    protected:
+      // ========================================================================
+      /// the main method 
+      Double_t evaluate () const override ;
+      // ========================================================================
+    protected:
+      // ========================================================================
+      /// the observable 
+      RooRealProxy m_x    ; // the observable 
+      /// the pdf 
+      RooRealProxy m_pdf  ; // the original pdf 
+      /// the parameters of the PDF 
+      RooListProxy m_pars ; // the parameters of the original pdf 
+      /// the relative precision 
+      double       m_precision { 1.e-8 } ; // the relative precision 
+      /// the maximal order 
+      unsigned int m_maxorder  { 128   } ; // the maximal order 
+      /// the maximal number of pieces 
+      unsigned int m_maxpieces { 1000  } ; // the maximal number of pieces 
+      /// the approximation itself 
+      mutable std::unique_ptr<Ostap::Math::AdaptiveChebyshev> m_cheb {} ; //! the approximation 
+      /// the private copy of the PDF used for sampling 
+      mutable std::unique_ptr<RooAbsReal>     m_copy    {}        ; //! the copy of the PDF 
+      /// the PDF the copy is made from 
+      mutable const RooAbsReal*               m_origin  { nullptr } ; //! the origin of the copy 
+      /// the observable of the copy 
+      mutable RooAbsRealLValue*               m_xcopy   { nullptr } ; //! the observable of the copy 
+      /// the parameters of the copy (in the order of m_pars)
+      mutable std::vector<RooAbsRealLValue*>  m_pcopy   {}        ; //! the parameters of the copy 
+      /// the key the copy is synchronized with 
+      mutable std::size_t                     m_synced  { 0     } ; //! the synchronized key 
+      // ======================================================================
+    } ;
+    // ========================================================================
+    /** @class Fused
+     *  Fused arithmetic expression. 
+     *
+     *  The connected subgraph of simple arithmetic nodes 
+     *  (Addition, Subtraction, Product, Division, Fraction, Asymmetry, Power, 
+     *  Abs, Exp, Log, Log10, Erf, Erfc, Gamma, LGamma, IGamma, Sin, Cos, Tan, 
+     *  Sinh, Cosh, Tanh, Sech, Atan2, Id, FunOneVar, FunTwoVars as well as 
+     *  plain RooAddition and RooProduct) is folded into one node, 
+     *  that evaluates the flat instruction tape over the leaves of the graph:
+     *  - the leaves (variables, PDFs, other functions) are the servers 
+     *    of this node, therefore the dependency tracking is the same 
+     *  - constants (RooConstVar) are folded into the tape 
+     *  - common subexpressions are evaluated only once 
+     *  - there are no virtual calls, dirty-flag checks and 
+     *    value caches for the intermediate nodes 
+     *
+     *  @code
+     *  RooAbsReal& expression = ... ; 
+     *  Ostap::MoreRooFit::Fused fused ( expression ) ;
+     *  @endcode 
+     *  @attention the functions from FunOneVar/FunTwoVars are not persistent
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class Fused final : public RooAbsReal
+    {
+      // ========================================================================
+      ClassDefOverride(Ostap::MoreRooFit::Fused , 1 ) ;  // fused expression 
+      // ========================================================================
+    public:
+      // ======================================================================
+      /// the operations 
+      enum Operation {
+        OpCopy      = 0 , 
+        OpAdd           , 
+        OpMultiply      , 
+        OpDivide        , 
+        OpFraction      , 
+        OpAsymmetry     , 
+        OpPower         , 
+        OpAbs           , 
+        OpExp           , 
+        OpLog           , 
+        OpLog10         , 
+        OpErf           , 
+        OpErfc          , 
+        OpGamma         , 
+        OpLGamma        , 
+        OpIGamma        , 
+        OpSin           , 
+        OpCos           , 
+        OpTan           , 
+        OpSinh          , 
+        OpCosh          , 
+        OpTanh          , 
+        OpSech          , 
+        OpAtan2         , 
+        OpFun1          , 
+        OpFun2          
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the expression 
+       *  @param name       the name 
+       *  @param title      the title 
+       *  @param expression the expression to be fused 
+       */
+      Fused ( const std::string& name       , 
+              const std::string& title      , 
+              const RooAbsReal&  expression ) ;
+      /** constructor from the expression 
+       *  @param expression the expression to be fused 
+       *  @param name       the name 
+       *  @param title      the title 
+       */
+      Fused ( const RooAbsReal&  expression   , 
+              const std::string& name  = ""   , 
+              const std::string& title = ""   ) 
+        : Fused ( name , title , expression ) 
+      {}
+      /// copy 
+      Fused ( const Fused& right       , 
+              const char*  newname = 0 ) ;
+      /// destructor 
+      virtual ~Fused () ;
+      /// clone 
+      Fused* clone ( const char* newname ) const override ;
+      /// fictive default constructor 
+      Fused () = default ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// can this node be fused?
+      static bool fusable ( const RooAbsArg& node ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the leaves of the expression graph 
+      const RooArgList& leaves () const { return m_leaves ; }
+      /// number of instructions 
+      std::size_t       size   () const { return m_tape.size () / 4 ; }
+      // ======================================================================
+    protected:
+      // ======================================================================
+      // the actual evaluation of the result 
+      Double_t evaluate () const override ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the helper class to build the tape 
+      class Builder ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the leaves 
+      RooListProxy         m_leaves {} ; // the leaves 
+      /// the constants 
+      std::vector<double>  m_consts {} ; // the constants 
+      /// the tape: ( operation , operand1 , operand2 , function ) 
+      std::vector<int>     m_tape   {} ; // the tape 
+      /// the functions from FunOneVar 
+      std::vector<std::function<double(double)> >        m_fun1 {} ; //! 
+      /// the functions from FunTwoVars 
+      std::vector<std::function<double(double,double)> > m_fun2 {} ; //!
+      /// the registers: leaves, constants and the results of instructions
+      mutable std::vector<double> m_regs {} ; //! the registers 
+      // ======================================================================
+    } ;
     // ========================================================================    
   } //                                   The end of namespace Ostap::MoreRooFit  
   // ==========================================================================
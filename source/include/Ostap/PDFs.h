@@ -15,6 +15,7 @@
 #include "Ostap/Voigt.h"
 #include "Ostap/Models.h"
 #include "Ostap/BSpline.h"
+#include "Ostap/BasisCache.h"
 // ============================================================================
 // ROOT
 // ============================================================================
@@ -2671,6 +2672,27 @@ namespace Ostap
       /// access to underlying function
       const Ostap::Math::Positive& function() const { return m_positive ; }
       // ======================================================================
+    public: // basis cache 
+      // ======================================================================
+      /** precompute the basis functions for all entries of the dataset (opt-in).
+       *  For these entries the evaluation is reduced to the scalar product 
+       *  of the cached basis values with the current coefficients, 
+       *  for all other points the function is evaluated directly 
+       *  @param data      the dataset 
+       *  @param single    store the basis values in single precision 
+       *  @param maxmemory the memory limit (bytes) 
+       *  @return true if the cache is built 
+       *  @see Ostap::Math::BasisCache
+       */
+      bool cacheBasis 
+      ( const RooAbsData& data                                             , 
+        const bool        single    = false                                , 
+        const std::size_t maxmemory = Ostap::Math::BasisCache::s_MAXMEMORY ) ;
+      /// remove the cache of basis functions 
+      void resetCache () ;
+      /// get the cache of basis functions (if any)
+      const Ostap::Math::BasisCache* basisCache () const { return m_cache.get () ; }
+      // ======================================================================
     protected :
       // ======================================================================
       RooRealProxy m_x    ;
@@ -2680,6 +2702,8 @@ namespace Ostap
       // ======================================================================
       /// the actual function
       mutable Ostap::Math::Positive m_positive ;               // the function
+      /// the cache of basis functions (if any)
+      std::shared_ptr<const Ostap::Math::BasisCache> m_cache ; //! the cache 
       // ======================================================================
     } ;
     // ========================================================================
@@ -5438,6 +5462,27 @@ namespace Ostap
       const Ostap::Math::PositiveSpline& function() const { return m_spline ; }
       const Ostap::Math::PositiveSpline& spline  () const { return m_spline ; }
       // ======================================================================
+    public: // basis cache 
+      // ======================================================================
+      /** precompute the basis functions for all entries of the dataset (opt-in).
+       *  For these entries the evaluation is reduced to the scalar product 
+       *  of the cached basis values with the current coefficients, 
+       *  for all other points the function is evaluated directly 
+       *  @param data      the dataset 
+       *  @param single    store the basis values in single precision 
+       *  @param maxmemory the memory limit (bytes) 
+       *  @return true if the cache is built 
+       *  @see Ostap::Math::BasisCache
+       */
+      bool cacheBasis 
+      ( const RooAbsData& data                                             , 
+        const bool        single    = false                                , 
+        const std::size_t maxmemory = Ostap::Math::BasisCache::s_MAXMEMORY ) ;
+      /// remove the cache of basis functions 
+      void resetCache () ;
+      /// get the cache of basis functions (if any)
+      const Ostap::Math::BasisCache* basisCache () const { return m_cache.get () ; }
+      // ======================================================================
     protected :
       // ======================================================================
       RooRealProxy m_x    ;
@@ -5447,6 +5492,8 @@ namespace Ostap
       // ======================================================================
       /// the actual function
       mutable Ostap::Math::PositiveSpline m_spline ;            // the function
+      /// the cache of basis functions (if any)
+      std::shared_ptr<const Ostap::Math::BasisCache> m_cache ; //! the cache 
       // ======================================================================
     };
     // ========================================================================
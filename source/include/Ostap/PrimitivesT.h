@@ -0,0 +1,611 @@
+// ============================================================================
+#ifndef OSTAP_PRIMITIVEST_H
+#define OSTAP_PRIMITIVEST_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+// ============================================================================
+/** @file Ostap/PrimitivesT.h
+ *  Compile-time ("expression template") versions of the simple
+ *  combinators from the file Ostap/Primitives.h
+ *
+ *  Unlike Ostap::Math::Linear, Ostap::Math::Compose, ... the
+ *  combinators here keep the concrete types of the components,
+ *  therefore the whole composed function is inlined by compiler
+ *  and there is no indirect call per level.
+ *  Type erasure (<code>std::function</code>) is needed only at
+ *  the outer API boundary, e.g. for Ostap::Math::Integrator
+ *
+ *  If all components support the batch evaluation
+ *  <code>operator() ( const double* x , double* result , std::size_t n )</code>
+ *  the composed function provides it as well,
+ *  otherwise Ostap::Math::Primitives::evaluate
+ *  falls back to the loop over the scalar calls.
+ *
+ *  @code
+ *  using namespace Ostap::Math::Primitives ;
+ *  const auto x = identity () ;
+ *  const auto f = compose ( [] ( double t ) { return std::exp ( t ) ; } , 2 * x + 1 ) ;
+ *  const auto g = f * x - 3.0 ;
+ *  const double v = g ( 0.5 ) ;               // fully inlined
+ *  evaluate ( g , xs , results , n ) ;        // batch evaluation
+ *  std::function<double(double)> h = to_function ( g ) ;  // type erasure
+ *  @endcode
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace  Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    namespace Primitives
+    {
+      // ======================================================================
+      /** @struct Expression
+       *  the empty base class for all compile-time combinators,
+       *  it is used only to enable the arithmetic operators
+       */
+      struct Expression {} ;
+      // ======================================================================
+      /// is it an expression?
+      template <class F>
+      struct is_expression
+        : std::is_base_of<Expression,typename std::decay<F>::type> {} ;
+      // ======================================================================
+      namespace detail
+      {
+        // ====================================================================
+        template <class... >
+        struct make_void { typedef void type ; } ;
+        // ====================================================================
+        /// the size of the chunk for the batch evaluation
+        enum { CHUNK = 256 } ;
+        // ====================================================================
+      }
+      // ======================================================================
+      /** does the function support the batch evaluation
+       *  <code>f ( const double* x , double* result , std::size_t n )</code> ?
+       */
+      template <class F, class = void>
+      struct has_batch : std::false_type {} ;
+      // ======================================================================
+      template <class F>
+      struct has_batch
+      <F,typename detail::make_void<decltype(std::declval<const F&>()
+                                             ( std::declval<const double*>() ,
+                                               std::declval<double*>()       ,
+                                               std::declval<std::size_t>()   ) )>::type>
+        : std::true_type {} ;
+      // ======================================================================
+      /** evaluate the function for the array of points
+       *  - the batch method is used if supported
+       *  - otherwise the loop over the scalar calls is performed
+       *  @param f      the function
+       *  @param x      (INPUT)  the points
+       *  @param result (OUTPUT) the results
+       *  @param n      number of points
+       *  @attention <code>x</code> and <code>result</code> can be the same array
+       */
+      template <class F,
+                typename std::enable_if<has_batch<F>::value,int>::type = 0>
+      inline void evaluate
+      ( const F&          f      ,
+        const double*     x      ,
+        double*           result ,
+        const std::size_t n      )
+      { f ( x , result , n ) ; }
+      // ======================================================================
+      template <class F,
+                typename std::enable_if<!has_batch<F>::value,int>::type = 0>
+      inline void evaluate
+      ( const F&          f      ,
+        const double*     x      ,
+        double*           result ,
+        const std::size_t n      )
+      { for ( std::size_t i = 0 ; i < n ; ++i ) { result [ i ] = f ( x [ i ] ) ; } }
+      // ======================================================================
+
+      // ======================================================================
+      // Leaves
+      // ======================================================================
+
+      // ======================================================================
+      /** @class Identity
+       *  the trivial function \f$ f(x) = x \f$
+       */
+      class Identity : public Expression
+      {
+      public :
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const { return x ; }
+        /// batch evaluation
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        { if ( x != result ) { std::copy ( x , x + n , result ) ; } }
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Constant
+       *  Constant "function": \f$ f(x) \equiv  c \f$
+       */
+      class Constant : public Expression
+      {
+      public :
+        // ====================================================================
+        Constant ( const double c = 0 ) : m_c ( c ) {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double /* x */ ) const { return m_c ; }
+        /// batch evaluation
+        inline void   operator()
+        ( const double*     /* x */ ,
+          double*           result  ,
+          const std::size_t n       ) const
+        { std::fill ( result , result + n , m_c ) ; }
+        // ====================================================================
+      public :
+        // ====================================================================
+        /// the value of the constant
+        double value () const { return m_c ; }
+        // ====================================================================
+      private :
+        //  ===================================================================
+        /// c-parameter
+        double m_c   { 0 } ;  // c-parameter
+        //  ===================================================================
+      } ;
+      // ======================================================================
+      /** @class Function
+       *  keep the arbitrary callable object (by value)
+       *  - batch evaluation is provided if the callable supports it
+       */
+      template <class FUNCTION>
+      class Function : public Expression
+      {
+      public :
+        // ====================================================================
+        Function ( FUNCTION f ) : m_fun ( std::move ( f ) ) {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const { return m_fun ( x ) ; }
+        /// batch evaluation (if supported)
+        template <class F = FUNCTION,
+                  typename std::enable_if<has_batch<F>::value,int>::type = 0>
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        { m_fun ( x , result , n ) ; }
+        // ====================================================================
+      public :
+        // ====================================================================
+        /// the function itself
+        const FUNCTION& function () const { return m_fun ; }
+        // ====================================================================
+      private :
+        // ====================================================================
+        /// the function
+        FUNCTION m_fun ; // the function
+        // ====================================================================
+      } ;
+      // ======================================================================
+      namespace detail
+      {
+        // ====================================================================
+        /// convert the callable into the expression
+        template <class F, bool = is_expression<F>::value>
+        struct Expr
+        {
+          typedef typename std::decay<F>::type      type ;
+          static const type& make ( const type& f ) { return f ; }
+        } ;
+        // ====================================================================
+        template <class F>
+        struct Expr<F,false>
+        {
+          typedef Function<typename std::decay<F>::type> type ;
+          static type make ( const typename std::decay<F>::type& f ) { return type ( f ) ; }
+        } ;
+        // ====================================================================
+      }
+      // ======================================================================
+      /// the expression type for the callable
+      template <class F>
+      using expression_t = typename detail::Expr<F>::type ;
+      // ======================================================================
+      /// convert the callable into the expression
+      template <class F>
+      inline expression_t<F> expression ( const F& f )
+      { return detail::Expr<F>::make ( f ) ; }
+      // ======================================================================
+
+      // ======================================================================
+      // Combinators
+      // ======================================================================
+
+      // ======================================================================
+      /** @class Scale
+       *  Scaled and biased function
+       *   \f[ f(x) =  a f_1(x) + b \f]
+       */
+      template <class FUNCTION>
+      class Scale : public Expression
+      {
+      public :
+        // ====================================================================
+        Scale ( FUNCTION     f     ,
+                const double a = 1 ,
+                const double b = 0 )
+          : m_fun ( std::move ( f ) )
+          , m_a   ( a )
+          , m_b   ( b )
+        {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const
+        { return m_a * m_fun ( x ) + m_b ; }
+        /// batch evaluation (if supported)
+        template <class F = FUNCTION,
+                  typename std::enable_if<has_batch<F>::value,int>::type = 0>
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        {
+          m_fun ( x , result , n ) ;
+          for ( std::size_t i = 0 ; i < n ; ++i )
+          { result [ i ] = m_a * result [ i ] + m_b ; }
+        }
+        // ====================================================================
+      private :
+        // ====================================================================
+        /// the function
+        FUNCTION m_fun     ; // the function
+        /// a-parameter
+        double   m_a { 1 } ; // a-parameter
+        /// b-parameter
+        double   m_b { 0 } ; // b-parameter
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Linear
+       *  Linear combination of two functions
+       *   \f[ f(x) =  c_1 f_1(x) + c_2 f_2 ( x  ) \f]
+       *  @see Ostap::Math::Linear
+       */
+      template <class FUNCTION1, class FUNCTION2>
+      class Linear : public Expression
+      {
+      public :
+        // ====================================================================
+        Linear ( FUNCTION1    f1     ,
+                 const double c1     ,
+                 FUNCTION2    f2     ,
+                 const double c2     )
+          : m_fun1 ( std::move ( f1 ) )
+          , m_fun2 ( std::move ( f2 ) )
+          , m_c1   ( c1 )
+          , m_c2   ( c2 )
+        {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const
+        { return m_c1 * m_fun1 ( x ) + m_c2 * m_fun2 ( x ) ; }
+        /// batch evaluation (if supported)
+        template <class F1 = FUNCTION1 ,
+                  class F2 = FUNCTION2 ,
+                  typename std::enable_if<has_batch<F1>::value &&
+                                          has_batch<F2>::value,int>::type = 0>
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        {
+          double b1 [ detail::CHUNK ] ;
+          double b2 [ detail::CHUNK ] ;
+          for ( std::size_t i = 0 ; i < n ; i += detail::CHUNK )
+          {
+            const std::size_t m = std::min<std::size_t> ( detail::CHUNK , n - i ) ;
+            m_fun1 ( x + i , b1 , m ) ;
+            m_fun2 ( x + i , b2 , m ) ;
+            for ( std::size_t k = 0 ; k < m ; ++k )
+            { result [ i + k ] = m_c1 * b1 [ k ] + m_c2 * b2 [ k ] ; }
+          }
+        }
+        // ====================================================================
+      private :
+        // ====================================================================
+        /// the first function
+        FUNCTION1 m_fun1     ; // the first function
+        /// the second function
+        FUNCTION2 m_fun2     ; // the second function
+        /// c1-parameter
+        double    m_c1 { 1 } ; // c1-parameter
+        /// c2-parameter
+        double    m_c2 { 1 } ; // c2-parameter
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Compose
+       *  Composition of two functions
+       *   \f[ f(x) =  c_1 f_1 ( c_2 f_2(x) ) \f]
+       *  @see Ostap::Math::Compose
+       */
+      template <class FUNCTION1, class FUNCTION2>
+      class Compose : public Expression
+      {
+      public :
+        // ====================================================================
+        Compose ( FUNCTION1    f1     ,
+                  FUNCTION2    f2     ,
+                  const double c1 = 1 ,
+                  const double c2 = 1 )
+          : m_fun1 ( std::move ( f1 ) )
+          , m_fun2 ( std::move ( f2 ) )
+          , m_c1   ( c1 )
+          , m_c2   ( c2 )
+        {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const
+        { return m_c1 * m_fun1 ( m_c2 * m_fun2 ( x ) ) ; }
+        /// batch evaluation (if supported)
+        template <class F1 = FUNCTION1 ,
+                  class F2 = FUNCTION2 ,
+                  typename std::enable_if<has_batch<F1>::value &&
+                                          has_batch<F2>::value,int>::type = 0>
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        {
+          double b [ detail::CHUNK ] ;
+          for ( std::size_t i = 0 ; i < n ; i += detail::CHUNK )
+          {
+            const std::size_t m = std::min<std::size_t> ( detail::CHUNK , n - i ) ;
+            m_fun2 ( x + i , b , m ) ;
+            for ( std::size_t k = 0 ; k < m ; ++k ) { b [ k ] *= m_c2 ; }
+            m_fun1 ( b , result + i , m ) ;
+            for ( std::size_t k = 0 ; k < m ; ++k ) { result [ i + k ] *= m_c1 ; }
+          }
+        }
+        // ====================================================================
+      private :
+        // ====================================================================
+        /// the first (outer) function
+        FUNCTION1 m_fun1     ; // the first (outer) function
+        /// the second (inner) function
+        FUNCTION2 m_fun2     ; // the second (inner) function
+        /// c1-parameter
+        double    m_c1 { 1 } ; // c1-parameter
+        /// c2-parameter
+        double    m_c2 { 1 } ; // c2-parameter
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** @class Binary
+       *  the generic binary operation for two functions
+       *   \f[ f(x) =  \mathrm{op} ( f_1(x) , f_2(x) ) \f]
+       *  where <code>OPERATION</code> is the stateless binary operation
+       */
+      template <class FUNCTION1, class FUNCTION2, class OPERATION>
+      class Binary : public Expression
+      {
+      public :
+        // ====================================================================
+        Binary ( FUNCTION1    f1 ,
+                 FUNCTION2    f2 )
+          : m_fun1 ( std::move ( f1 ) )
+          , m_fun2 ( std::move ( f2 ) )
+        {}
+        // ====================================================================
+        /// the main method
+        inline double operator() ( const double x ) const
+        { return OPERATION::apply ( m_fun1 ( x ) , m_fun2 ( x ) ) ; }
+        /// batch evaluation (if supported)
+        template <class F1 = FUNCTION1 ,
+                  class F2 = FUNCTION2 ,
+                  typename std::enable_if<has_batch<F1>::value &&
+                                          has_batch<F2>::value,int>::type = 0>
+        inline void   operator()
+        ( const double*     x      ,
+          double*           result ,
+          const std::size_t n      ) const
+        {
+          double b1 [ detail::CHUNK ] ;
+          double b2 [ detail::CHUNK ] ;
+          for ( std::size_t i = 0 ; i < n ; i += detail::CHUNK )
+          {
+            const std::size_t m = std::min<std::size_t> ( detail::CHUNK , n - i ) ;
+            m_fun1 ( x + i , b1 , m ) ;
+            m_fun2 ( x + i , b2 , m ) ;
+            for ( std::size_t k = 0 ; k < m ; ++k )
+            { result [ i + k ] = OPERATION::apply ( b1 [ k ] , b2 [ k ] ) ; }
+          }
+        }
+        // ====================================================================
+      private :
+        // ====================================================================
+        /// the first function
+        FUNCTION1 m_fun1 ; // the first function
+        /// the second function
+        FUNCTION2 m_fun2 ; // the second function
+        // ====================================================================
+      } ;
+      // ======================================================================
+      namespace detail
+      {
+        // ====================================================================
+        struct Mul { static inline double apply ( const double a , const double b ) { return a * b ; } } ;
+        struct Div { static inline double apply ( const double a , const double b ) { return a / b ; } } ;
+        struct Max { static inline double apply ( const double a , const double b ) { return std::max ( a , b ) ; } } ;
+        struct Min { static inline double apply ( const double a , const double b ) { return std::min ( a , b ) ; } } ;
+        // ====================================================================
+      }
+      // ======================================================================
+      /// product of two functions \f$ f(x) = f_1(x) f_2(x) \f$
+      template <class FUNCTION1, class FUNCTION2>
+      using Multiply = Binary<FUNCTION1,FUNCTION2,detail::Mul> ;
+      /// ratio of two functions \f$ f(x) = f_1(x) / f_2(x) \f$
+      template <class FUNCTION1, class FUNCTION2>
+      using Divide   = Binary<FUNCTION1,FUNCTION2,detail::Div> ;
+      /// maximum of two functions \f$ f(x) = \max ( f_1(x) , f_2(x) ) \f$
+      template <class FUNCTION1, class FUNCTION2>
+      using Max      = Binary<FUNCTION1,FUNCTION2,detail::Max> ;
+      /// minimum of two functions \f$ f(x) = \min ( f_1(x) , f_2(x) ) \f$
+      template <class FUNCTION1, class FUNCTION2>
+      using Min      = Binary<FUNCTION1,FUNCTION2,detail::Min> ;
+      // ======================================================================
+
+      // ======================================================================
+      // Factories
+      // ======================================================================
+
+      // ======================================================================
+      /// the trivial function \f$ f(x) = x \f$
+      inline Identity identity () { return Identity () ; }
+      /// constant function \f$ f(x) = c \f$
+      inline Constant constant ( const double c ) { return Constant ( c ) ; }
+      // ======================================================================
+      /// scaled and biased function \f$ f(x) = a f_1(x) + b \f$
+      template <class F>
+      inline Scale<expression_t<F> >
+      scale ( const F& f , const double a = 1 , const double b = 0 )
+      { return Scale<expression_t<F> > ( expression ( f ) , a , b ) ; }
+      // ======================================================================
+      /// linear combination \f$ f(x) = c_1 f_1(x) + c_2 f_2(x) \f$
+      template <class F1, class F2>
+      inline Linear<expression_t<F1>,expression_t<F2> >
+      linear ( const F1& f1 , const double c1 , const F2& f2 , const double c2 )
+      {
+        return Linear<expression_t<F1>,expression_t<F2> >
+          ( expression ( f1 ) , c1 , expression ( f2 ) , c2 ) ;
+      }
+      // ======================================================================
+      /// composition \f$ f(x) = c_1 f_1 ( c_2 f_2(x) ) \f$
+      template <class F1, class F2>
+      inline Compose<expression_t<F1>,expression_t<F2> >
+      compose ( const F1& f1 , const F2& f2 , const double c1 = 1 , const double c2 = 1 )
+      {
+        return Compose<expression_t<F1>,expression_t<F2> >
+          ( expression ( f1 ) , expression ( f2 ) , c1 , c2 ) ;
+      }
+      // ======================================================================
+      /// product \f$ f(x) = f_1(x) f_2(x) \f$
+      template <class F1, class F2>
+      inline Multiply<expression_t<F1>,expression_t<F2> >
+      multiply ( const F1& f1 , const F2& f2 )
+      { return Multiply<expression_t<F1>,expression_t<F2> > ( expression ( f1 ) , expression ( f2 ) ) ; }
+      // ======================================================================
+      /// ratio \f$ f(x) = f_1(x) / f_2(x) \f$
+      template <class F1, class F2>
+      inline Divide<expression_t<F1>,expression_t<F2> >
+      divide   ( const F1& f1 , const F2& f2 )
+      { return Divide<expression_t<F1>,expression_t<F2> > ( expression ( f1 ) , expression ( f2 ) ) ; }
+      // ======================================================================
+      /// maximum \f$ f(x) = \max ( f_1(x) , f_2(x) ) \f$
+      template <class F1, class F2>
+      inline Max<expression_t<F1>,expression_t<F2> >
+      maximum  ( const F1& f1 , const F2& f2 )
+      { return Max<expression_t<F1>,expression_t<F2> > ( expression ( f1 ) , expression ( f2 ) ) ; }
+      // ======================================================================
+      /// minimum \f$ f(x) = \min ( f_1(x) , f_2(x) ) \f$
+      template <class F1, class F2>
+      inline Min<expression_t<F1>,expression_t<F2> >
+      minimum  ( const F1& f1 , const F2& f2 )
+      { return Min<expression_t<F1>,expression_t<F2> > ( expression ( f1 ) , expression ( f2 ) ) ; }
+      // ======================================================================
+      /** type erasure at the outer API boundary
+       *  @code
+       *  const auto f = ... ;
+       *  Ostap::Math::Integrator integrator ;
+       *  const double r = integrator.integrate ( to_function ( f ) , 0 , 1 ) ;
+       *  @endcode
+       */
+      template <class F>
+      inline std::function<double(double)> to_function ( const F& f )
+      { return std::function<double(double)> ( f ) ; }
+      // ======================================================================
+
+      // ======================================================================
+      // Operators: only for expressions
+      // ======================================================================
+
+      // ======================================================================
+      template <class E1, class E2,
+                typename std::enable_if<is_expression<E1>::value &&
+                                        is_expression<E2>::value,int>::type = 0>
+      inline Linear<E1,E2> operator+ ( const E1& e1 , const E2& e2 )
+      { return Linear<E1,E2> ( e1 , 1 , e2 ,  1 ) ; }
+      // ======================================================================
+      template <class E1, class E2,
+                typename std::enable_if<is_expression<E1>::value &&
+                                        is_expression<E2>::value,int>::type = 0>
+      inline Linear<E1,E2> operator- ( const E1& e1 , const E2& e2 )
+      { return Linear<E1,E2> ( e1 , 1 , e2 , -1 ) ; }
+      // ======================================================================
+      template <class E1, class E2,
+                typename std::enable_if<is_expression<E1>::value &&
+                                        is_expression<E2>::value,int>::type = 0>
+      inline Multiply<E1,E2> operator* ( const E1& e1 , const E2& e2 )
+      { return Multiply<E1,E2> ( e1 , e2 ) ; }
+      // ======================================================================
+      template <class E1, class E2,
+                typename std::enable_if<is_expression<E1>::value &&
+                                        is_expression<E2>::value,int>::type = 0>
+      inline Divide<E1,E2> operator/ ( const E1& e1 , const E2& e2 )
+      { return Divide<E1,E2> ( e1 , e2 ) ; }
+      // ======================================================================
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator- ( const E& e ) { return Scale<E> ( e , -1 ,  0 ) ; }
+      // ======================================================================
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator+ ( const E& e , const double b ) { return Scale<E> ( e ,  1 ,  b ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator+ ( const double b , const E& e ) { return Scale<E> ( e ,  1 ,  b ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator- ( const E& e , const double b ) { return Scale<E> ( e ,  1 , -b ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator- ( const double b , const E& e ) { return Scale<E> ( e , -1 ,  b ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator* ( const E& e , const double a ) { return Scale<E> ( e ,  a ,  0 ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator* ( const double a , const E& e ) { return Scale<E> ( e ,  a ,  0 ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Scale<E> operator/ ( const E& e , const double a ) { return Scale<E> ( e , 1 / a , 0 ) ; }
+      template <class E,
+                typename std::enable_if<is_expression<E>::value,int>::type = 0>
+      inline Divide<Constant,E> operator/ ( const double a , const E& e )
+      { return Divide<Constant,E> ( Constant ( a ) , e ) ; }
+      // ======================================================================
+    } //                             The end of namespace Ostap::Math::Primitives
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_PRIMITIVEST_H
+// ============================================================================
@@ -0,0 +1,269 @@
+// ============================================================================
+#ifndef OSTAP_READPLAN_H
+#define OSTAP_READPLAN_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+//   STD&STL
+// ============================================================================
+#include <memory>
+#include <string>
+#include <vector>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "RtypesCore.h"
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TTree             ; // ROOT
+class TObject           ; // ROOT
+class TTreePerfStats    ; // ROOT
+class TVirtualPerfStats ; // ROOT
+// ============================================================================
+namespace  Ostap
+{
+  // ==========================================================================
+  class IFuncTree ;
+  // ==========================================================================
+  namespace  Utils
+  {
+    // ========================================================================
+    /** @class ReadPlan Ostap/ReadPlan.h
+     *  Read planning for the loops over TTree/TChain:
+     *
+     *  - the branches, referenced by all formulae (TTreeFormula) and
+     *    tree-functions (Ostap::IFuncTree) of the loop are collected;
+     *  - TTreeCache is configured for these branches only, the learning
+     *    phase is switched off and the entry range is set to the loop range;
+     *  - the cluster prefetching is switched on;
+     *  - for the loops, that read the whole entry with <code>TTree::GetEntry</code>,
+     *    all other branches can be disabled, @see ReadPlan::prune
+     *  - the bytes read, read calls and the time spent in I/O are accounted
+     *
+     *  The previous state of the tree is restored by destructor.
+     *  If some branches are unknown (e.g. the python tree-function is used),
+     *  the cache stays in the learning mode and no branches are disabled.
+     *
+     *  @code
+     *  Ostap::Formula var  ( "pt"     , tree ) ;
+     *  Ostap::Formula cuts ( "pt > 1" , tree ) ;
+     *  Ostap::Utils::Notifier notify ( tree , &var , &cuts ) ;
+     *  Ostap::Utils::ReadPlan plan   ( tree , first , last , &var , &cuts ) ;
+     *  for ( unsigned long entry = first ; entry < last ; ++entry ) { ... }
+     *  @endcode
+     *
+     *  The I/O time is measured with TTreePerfStats, it is switched off
+     *  by default, @see ReadPlan::setMonitor
+     *
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class ReadPlan
+    {
+    public:
+      // ======================================================================
+      /** @struct Statistics
+       *  the I/O statistics for the loop(s)
+       */
+      struct Statistics
+      {
+        /// number of loops
+        unsigned long long loops    {  0 } ; // number of loops
+        /// number of entries in the loop ranges
+        unsigned long long entries  {  0 } ; // number of entries
+        /// number of branches in the cache
+        unsigned long long branches {  0 } ; // number of branches in the cache
+        /// number of bytes read
+        Long64_t           bytes    {  0 } ; // number of bytes read
+        /// number of read calls
+        Long64_t           calls    {  0 } ; // number of read calls
+        /// the real time of the loops (seconds)
+        double             time     {  0 } ; // the real time of the loops
+        /// the time spent in reading (seconds), negative if not monitored
+        double             ioTime   { -1 } ; // the time spent in reading
+        /// the time spent in unzipping (seconds), negative if not monitored
+        double             zipTime  { -1 } ; // the time spent in unzipping
+        /// add statistics
+        Statistics& operator+= ( const Statistics& right ) ;
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor: collect the branches and configure the tree
+       *  @param tree  the tree
+       *  @param first the first entry of the loop
+       *  @param last  the last  entry of the loop
+       *  @param obj0  the formula (TTreeFormula) or tree-function (IFuncTree)
+       */
+      ReadPlan
+      ( TTree*         tree           ,
+        const Long64_t first          ,
+        const Long64_t last           ,
+        const TObject* obj0 = nullptr ,
+        const TObject* obj1 = nullptr ,
+        const TObject* obj2 = nullptr ,
+        const TObject* obj3 = nullptr ,
+        const TObject* obj4 = nullptr ,
+        const TObject* obj5 = nullptr ) ;
+      /// constructor from the sequence of objects
+      ReadPlan
+      ( TTree*                             tree    ,
+        const Long64_t                     first   ,
+        const Long64_t                     last    ,
+        const std::vector<const TObject*>& objects ) ;
+      /// constructor from the sequence of tree-functions
+      ReadPlan
+      ( TTree*                                      tree      ,
+        const Long64_t                              first     ,
+        const Long64_t                              last      ,
+        const std::vector<const Ostap::IFuncTree*>& functions ) ;
+      /// templated constructor
+      template <class ITERATOR>
+      ReadPlan
+      ( ITERATOR       begin ,
+        ITERATOR       end   ,
+        TTree*         tree  ,
+        const Long64_t first ,
+        const Long64_t last  ,
+        const TObject* obj   = nullptr ) ;
+      /// destructor: restore the state of the tree
+      ~ReadPlan () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      ReadPlan ( const ReadPlan& ) ;
+      ReadPlan& operator=( const ReadPlan& ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** disable all branches, that are not used by the loop,
+       *  it helps for the loops, that read the whole entry
+       *  with <code>TTree::GetEntry</code>
+       *  @param keep the branches to be kept enabled (e.g. new branches)
+       *  @return true if branches are disabled
+       */
+      bool prune ( const std::vector<std::string>& keep = {} ) ;
+      /// stop the plan: restore the state of the tree and account the statistics
+      void stop  () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the branches, used by the loop
+      const std::vector<std::string>& branches   () const { return m_branches ; }
+      /// are all used branches known?
+      bool                            known      () const { return m_known    ; }
+      /// the statistics for this loop (complete after stop)
+      const Statistics&               statistics () const { return m_stat     ; }
+      // ======================================================================
+    public: // configuration
+      // ======================================================================
+      /// is read planning enabled?
+      static bool     enabled            () ;
+      /// enable/disable the read planning
+      static bool     setEnabled         ( const bool     value ) ;
+      /// the size of TTreeCache
+      static Long64_t cacheSize          () ;
+      /// set the size of TTreeCache
+      static Long64_t setCacheSize       ( const Long64_t value ) ;
+      /// is the cluster prefetching enabled?
+      static bool     clusterPrefetch    () ;
+      /// enable/disable the cluster prefetching
+      static bool     setClusterPrefetch ( const bool     value ) ;
+      /// is the time spent in I/O monitored (with TTreePerfStats)?
+      static bool     monitor            () ;
+      /// enable/disable the I/O time monitoring (with TTreePerfStats)
+      static bool     setMonitor         ( const bool     value ) ;
+      // ======================================================================
+    public: // total statistics
+      // ======================================================================
+      /** the total statistics for all (finished) loops
+       *  @attention the loops in the worker threads of ThreadPool
+       *  are not accounted
+       */
+      static Statistics total      () ;
+      /// reset the total statistics
+      static void       resetTotal () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// add the object
+      void add   ( const TObject*          object     ) ;
+      /// add the tree-function
+      void add   ( const Ostap::IFuncTree* function   ) ;
+      /// add the expression
+      void add   ( const std::string&      expression ) ;
+      /// add (smart) pointer
+      template <class TYPE>
+      void add   ( const std::unique_ptr<TYPE>& object ) { this->add ( object.get () ) ; }
+      /// configure the tree
+      void start () ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the tree
+      TTree*                          m_tree      { nullptr } ; // the tree
+      /// the first entry
+      Long64_t                        m_first     { 0       } ; // the first entry
+      /// the last entry
+      Long64_t                        m_last      { 0       } ; // the last entry
+      /// the branches
+      std::vector<std::string>        m_branches  {} ; // the branches
+      /// all branches are known?
+      bool                            m_known     { true    } ; // all branches known?
+      /// the branches, disabled before pruning
+      std::vector<std::string>        m_disabled  {} ; // disabled branches
+      /// are branches pruned?
+      bool                            m_pruned    { false   } ; // pruned?
+      /// is the plan active?
+      bool                            m_active    { false   } ; // active?
+      /// account statistics?
+      bool                            m_account   { false   } ; // account?
+      /// the old cache size
+      Long64_t                        m_cache     { 0       } ; // old cache size
+      /// the old cluster prefetch
+      bool                            m_prefetch  { false   } ; // old cluster prefetch
+      /// is the cache configured?
+      bool                            m_cached    { false   } ; // cache configured?
+      /// bytes read at start
+      Long64_t                        m_bytes     { 0       } ; // bytes at start
+      /// read calls at start
+      Long64_t                        m_calls     { 0       } ; // calls at start
+      /// the start time (seconds)
+      double                          m_start     { 0       } ; // the start time
+      /// the performance monitor
+      TTreePerfStats*                 m_perf      { nullptr } ; // the performance monitor
+      /// the previous performance monitor
+      TVirtualPerfStats*              m_old       { nullptr } ; // the previous monitor
+      /// the statistics
+      Statistics                      m_stat      {} ; // the statistics
+      // ======================================================================
+    } ;
+    // ========================================================================
+    // templated constructor
+    // ========================================================================
+    template <class ITERATOR>
+    ReadPlan::ReadPlan
+    ( ITERATOR       begin ,
+      ITERATOR       end   ,
+      TTree*         tree  ,
+      const Long64_t first ,
+      const Long64_t last  ,
+      const TObject* obj   )
+      : m_tree  ( tree  )
+      , m_first ( first )
+      , m_last  ( last  )
+    {
+      for ( ; begin != end ; ++begin ) { this->add ( *begin ) ; }
+      this -> add   ( obj ) ;
+      this -> start () ;
+    }
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                     The END
+// ============================================================================
+#endif // OSTAP_READPLAN_H
+// ============================================================================
@@ -4,6 +4,12 @@
 // =============================================================================
 // Include files
 // =============================================================================
+// STD&STL
+// =============================================================================
+#include <limits>
+#include <string>
+#include <vector>
+// =============================================================================
 // Forward declarations 
 // =============================================================================
 class TTree      ; // ROOT 
@@ -99,6 +105,58 @@ namespace Ostap
     static Ostap::Math::ValueWithError
     sFactor ( const RooAbsData* data ) ;
     // ========================================================================
+  public:
+    // ========================================================================
+    /// the last event 
+    static constexpr unsigned long LAST { std::numeric_limits<unsigned long>::max() } ;
+    // ========================================================================
+    /** Get sums and sums of squares for many weights in one pass, e.g. 
+     *  s-factors for all s-weights from the same sPlot 
+     *  \f$ w_k = c \cdot e_k \f$, where \f$ c \f$ is the (optional) 
+     *  selection/weight and \f$ e_k\f$ are the weight expressions
+     * 
+     *  - all weights are accumulated in a single pass over the data 
+     *  - the data are processed in parallel: each worker thread
+     *    reopens the input files for its own range of entries  
+     *    @see Ostap::Utils::ThreadPool 
+     *  - the workers read only the branches used by weights and cuts, 
+     *    via the tree cache 
+     *  - the in-memory trees, the trees with entry lists and the trees 
+     *    with friends are processed in one thread 
+     *
+     *  @code 
+     *  TChain* chain = ...
+     *  auto sfs = Ostap::SFactor::sFactors ( chain , { "S_sw" , "B_sw" } ) ;
+     *  const double scale = sfs[0].value() / sfs[0].cov2() ; // use in fit! 
+     *  const double neff  = Ostap::SFactor::nEff ( sfs[1] ) ;
+     *  @endcode 
+     *
+     *  @param  tree     (INPUT) the tree or chain 
+     *  @param  weights  (INPUT) weight expressions 
+     *  @param  cuts     (INPUT) selection/weight  
+     *  @param  first    (INPUT) the first  event to process 
+     *  @param  last     (INPUT) the last event to  process
+     *  @param  nthreads (INPUT) number of threads, 0 means ThreadPool default 
+     *  @return s-factors in a form of value +- sqrt(cov2), one per weight 
+     *  @see Ostap::SFactor::nEff 
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    static std::vector<Ostap::Math::ValueWithError>
+    sFactors 
+    ( TTree*                          tree          , 
+      const std::vector<std::string>& weights       , 
+      const std::string&              cuts     = "" , 
+      const unsigned long             first    = 0  , 
+      const unsigned long             last     = LAST , 
+      const unsigned int              nthreads = 0  ) ;
+    // ========================================================================
+    /** get the number of equivalent entries from the s-factor
+     *  \f$ n_{eff} \equiv = \frac{ (\sum w)^2}{ \sum w^2} \f$
+     *  @param sf (INPUT) s-factor from Ostap::SFactor::sFactor(s)
+     */
+    static double nEff ( const Ostap::Math::ValueWithError& sf ) ;
+    // ========================================================================
   } ;
   // ==========================================================================
 } //                                                     end of namespace Ostap
@@ -0,0 +1,157 @@
+// ============================================================================
+#ifndef OSTAP_TABULATEDFUNCTION_H
+#define OSTAP_TABULATEDFUNCTION_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <functional>
+#include <memory>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/BuildLock.h"
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    /** @class TabulatedFunction Ostap/TabulatedFunction.h
+     *  Lazily built interpolation table for expensive 1D functions,
+     *  e.g. running widths \f$ \Gamma(s) \f$ or
+     *  (numerically integrated) phase space functions \f$ \Phi(s)\f$.
+     *
+     *  - the table is built at the first call in the range \f$ [x_{min},x_{max}]\f$
+     *  - nodes are added adaptively till the local cubic interpolation
+     *    reproduces the function at the middle of each interval
+     *    with the requested relative precision
+     *  - the precision is checked only at the middle points of the
+     *    intervals, it is not guaranteed for the narrow structures
+     *    between the nodes
+     *  - outside the range the function is evaluated directly
+     *  - if the key-function is specified, the table is rebuilt
+     *    each time the key changes (e.g. masses or formfactor parameters)
+     *  - the table is shared between the copies and
+     *    the concurrent evaluations are thread-safe;
+     *    each object builds its table under its own lock
+     *
+     *  @code
+     *  const Ostap::Math::PhaseSpace3 ps3 ( 0.139 , 0.139 , 0.139 ) ;
+     *  const Ostap::Math::TabulatedFunction t3 ( ps3 , ps3.lowEdge() , 5.0 , 1.e-6 ) ;
+     *  const double value = t3 ( 1.0 ) ;
+     *  // the table is rebuilt when the masses are changed 
+     *  Ostap::Math::PhaseSpace3 ps ( 0.139 , 0.139 , 0.139 ) ;
+     *  const Ostap::Math::TabulatedFunction t ( std::cref ( ps ) , 0.4 , 5.0 , 1.e-6 , 
+     *      100000 , [&ps] () { return ps.tag () ; } ) ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class TabulatedFunction
+    {
+    public:
+      // ======================================================================
+      /// the function to be tabulated
+      typedef std::function<double(double)> Function ;
+      /// the key function: the table is rebuilt when the key changes
+      typedef std::function<std::size_t()>  Key      ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor from the function and the range
+       *  @param fun       the function
+       *  @param xmin      low  edge of the tabulation range
+       *  @param xmax      high edge of the tabulation range
+       *  @param precision the relative precision of the interpolation
+       *  @param maxpoints maximal number of nodes
+       *  @param key       the key function (if any)
+       */
+      TabulatedFunction
+      ( Function          fun                ,
+        const double      xmin               ,
+        const double      xmax               ,
+        const double      precision = 1.e-7  ,
+        const std::size_t maxpoints = 100000 ,
+        Key               key       = Key () ) ;
+      // ======================================================================
+      /// copy constructor: the table is shared
+      TabulatedFunction ( const TabulatedFunction&  right ) ;
+      /// default constructor (needed for serialization)
+      TabulatedFunction () ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// evaluate the function
+      double operator() ( const double x ) const { return evaluate ( x ) ; }
+      /// evaluate the function
+      double evaluate   ( const double x ) const ;
+      /// evaluate the original function (no interpolation)
+      double exact      ( const double x ) const { return m_fun ( x ) ; }
+      /// the original function
+      const Function& function () const { return m_fun ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// low  edge of the tabulation range
+      double      xmin      () const { return m_xmin      ; }
+      /// high edge of the tabulation range
+      double      xmax      () const { return m_xmax      ; }
+      /// the requested relative precision
+      double      precision () const { return m_precision ; }
+      /// maximal number of nodes
+      std::size_t maxpoints () const { return m_maxpoints ; }
+      /// number of nodes in the table (the table is built if needed)
+      std::size_t size      () const ;
+      /// get the abscissas of the table (the table is built if needed)
+      std::vector<double> abscissas () const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// drop the table, it will be rebuilt at next call
+      void reset () const ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the actual table
+      class Table ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// get the valid table (build it if needed)
+      std::shared_ptr<const Table> table () const ;
+      /// build the new table
+      std::shared_ptr<const Table> build ( const std::size_t key ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the function
+      Function    m_fun       {        } ; // the function
+      /// low edge
+      double      m_xmin      { 0      } ; // low edge
+      /// high edge
+      double      m_xmax      { 1      } ; // high edge
+      /// relative precision
+      double      m_precision { 1.e-7  } ; // relative precision
+      /// maximal number of nodes
+      std::size_t m_maxpoints { 100000 } ; // maximal number of nodes
+      /// the key function
+      Key         m_key       {        } ; // the key function
+      /// the table itself
+      mutable std::shared_ptr<const Table> m_table {} ; //! the table itself
+      /// the lock for the table build
+      mutable Ostap::Utils::BuildLock      m_lock  {} ; //! the lock for the table build
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                         The end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_TABULATEDFUNCTION_H
+// ============================================================================
@@ -0,0 +1,76 @@
+// ============================================================================
+#ifndef OSTAP_THREADPOOL_H
+#define OSTAP_THREADPOOL_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+#include <functional>
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class ThreadPool Ostap/ThreadPool.h
+     *  Simple process-wide pool of worker threads to spread
+     *  the embarrassingly parallel loops over the CPU cores.
+     *
+     *  - the calling thread always participates in the loop
+     *  - nested calls (from inside the worker) are executed serially
+     *  - the first exception from the loop body is rethrown in the caller
+     *
+     *  @code
+     *  Ostap::Utils::ThreadPool::parallel_for
+     *   ( N , [&] ( const std::size_t begin , const std::size_t end )
+     *         { for ( std::size_t i = begin ; i < end ; ++i ) { ... } } ,
+     *     100 ) ;
+     *  @endcode
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class ThreadPool
+    {
+    public:
+      // ======================================================================
+      /// the loop body: process entries [begin,end)
+      typedef std::function<void(std::size_t,std::size_t)> Body ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** execute the loop body for the range [0,n) splitting it into
+       *  the chunks of at least <code>grain</code> entries
+       *  @param n     the size of the range
+       *  @param body  the loop body
+       *  @param grain minimal size of the chunk
+       */
+      static void parallel_for
+      ( const std::size_t n         ,
+        const Body&       body      ,
+        const std::size_t grain = 1 ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// number of threads used for the parallel loops (including the caller)
+      static unsigned int nThreads    () ;
+      /** set number of threads to be used for the parallel loops
+       *  @param n number of threads, 0 means hardware concurrency
+       *  @return the actual number of threads
+       */
+      static unsigned int setNThreads ( const unsigned int n ) ;
+      /// are we inside the worker thread ?
+      static bool         inWorker    () ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_THREADPOOL_H
+// ============================================================================
@@ -0,0 +1,233 @@
+// ============================================================================
+#ifndef OSTAP_TOYRUNNER_H
+#define OSTAP_TOYRUNNER_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <string>
+#include <vector>
+#include <memory>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "RtypesCore.h"
+// ============================================================================
+// Forward declarations
+// ============================================================================
+class TTree      ; // ROOT
+class RooAbsPdf  ; // RooFit
+class RooArgSet  ; // RooFit
+class RooDataSet ; // RooFit
+// ============================================================================
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Utils
+  {
+    // ========================================================================
+    /** @class ToyRunner Ostap/ToyRunner.h
+     *  In-process multi-threaded engine for the fitting toys:
+     *  for each pseudoexperiment the parameters of the model are reset
+     *  to their initial values, the dataset is generated and fitted back
+     *  with the same model.
+     *
+     *  - the model is cloned once per worker
+     *  - the seed for each toy is derived from the global seed and the
+     *    toy index only (counter-based), therefore the results do not
+     *    depend on the number of threads and the order of processing
+     *  - for each toy the fit status, covariance matrix quality,
+     *    minimal NLL, EDM, number of events, the values, errors and
+     *    pulls of all floating parameters are stored; the results are
+     *    available as the columnar TTree or RooDataSet, ordered by the
+     *    toy index
+     *  - the progress bar is printed from C++
+     *
+     *  @code
+     *  RooAbsPdf& pdf = ... ;
+     *  RooArgSet  obs ( x ) ;
+     *  Ostap::Utils::ToyRunner runner ( pdf , obs , 1000 ) ;
+     *  runner.setSeed     ( 12345 ) ;
+     *  runner.setNThreads ( 8     ) ;
+     *  runner.run         ( 10000 ) ;
+     *  TTree* tree = runner.tree () ;
+     *  @endcode
+     *
+     *  @attention RooFit is not designed for the multi-threaded usage.
+     *  The clones still share the global state of RooFit (the name
+     *  registry, the message service, the minimizer plugins), therefore
+     *  all calls to RooFit (cloning, generation, fitting and deletion of
+     *  datasets) are serialized with one lock, and the workers overlap
+     *  only the bookkeeping. For the actual parallel processing of the
+     *  toys use the process-based engine from ostap/parallel/parallel_toys.py.
+     *  The fits are performed with one CPU and without external
+     *  constraints.
+     *  @see ostap/fitting/toys.py
+     *  @author Ostap developers
+     *  @date   2026-10-19
+     */
+    class ToyRunner
+    {
+    public:
+      // ======================================================================
+      /** @struct Result
+       *  the result of one pseudoexperiment
+       */
+      struct Result
+      {
+        /// toy index
+        ULong64_t           toy     { 0 } ;
+        /// the seed used for generation
+        ULong64_t           seed    { 0 } ;
+        /// fit status
+        int                 status  { -1 } ;
+        /// covariance matrix quality
+        int                 covQual { -1 } ;
+        /// minimal NLL
+        double              nll     { 0 } ;
+        /// estimated distance to minimum
+        double              edm     { 0 } ;
+        /// number of generated entries
+        double              nEvents { 0 } ;
+        /// sum of weights
+        double              sumw    { 0 } ;
+        /// fitted values of floating parameters
+        std::vector<double> values  {   } ;
+        /// errors of floating parameters
+        std::vector<double> errors  {   } ;
+      } ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /** constructor
+       *  @param pdf         the model for generation and fitting
+       *  @param observables the observables
+       *  @param nEvents     (mean) number of events per toy
+       *  @param extended    generate Poisson-distributed number of
+       *                     events and make the extended fit
+       */
+      ToyRunner
+      ( const RooAbsPdf&    pdf              ,
+        const RooArgSet&    observables      ,
+        const unsigned long nEvents          ,
+        const bool          extended = false ) ;
+      /// destructor
+      ~ToyRunner () ;
+      // ======================================================================
+    public: // configuration
+      // ======================================================================
+      /** set the initial values of parameters for each toy
+       *  (by default the current values of the model are used)
+       *  @param pars the values of parameters (matched by name)
+       */
+      void setInitial   ( const RooArgSet&     pars       ) ;
+      /// set the global seed
+      void setSeed      ( const ULong64_t      seed       ) { m_seed      = seed     ; }
+      /** set the maximal number of threads
+       *  (0 means all threads of Ostap::Utils::ThreadPool)
+       *  @see Ostap::Utils::ThreadPool::nThreads
+       */
+      void setNThreads  ( const unsigned int   nthreads   ) { m_nthreads  = nthreads ; }
+      /// show the progress bar?
+      void setProgress  ( const bool           progress   ) { m_progress  = progress ; }
+      /// set minimizer type and algorithm
+      void setMinimizer ( const std::string&   type       ,
+                          const std::string&   algo = ""  ) ;
+      /// set minimization strategy
+      void setStrategy  ( const int            strategy   ) { m_strategy  = strategy ; }
+      /// run HESSE after the minimization?
+      void setHesse     ( const bool           hesse      ) { m_hesse     = hesse    ; }
+      /// use offsetting for the likelihood?
+      void setOffset    ( const bool           offset     ) { m_offset    = offset   ; }
+      // ======================================================================
+    public: // the main method
+      // ======================================================================
+      /** run (more) pseudoexperiments
+       *  - the toy indices continue from the previous call,
+       *    therefore <code>run(n1)</code> followed by <code>run(n2)</code>
+       *    is equivalent to <code>run(n1+n2)</code>
+       *  @param nToys number of pseudoexperiments
+       *  @return number of successful fits (status 0)
+       */
+      unsigned long run ( const unsigned long nToys ) ;
+      // ======================================================================
+    public: // results
+      // ======================================================================
+      /// number of processed toys
+      unsigned long nToys       () const { return m_results.size () ; }
+      /// names of floating parameters
+      const std::vector<std::string>& parameters () const { return m_names ; }
+      /// initial values of floating parameters
+      const std::vector<double>&      initial    () const { return m_init  ; }
+      /// get the result of the toy
+      const Result& result ( const unsigned long toy ) const ;
+      /// the seed for the toy
+      ULong64_t     seed   ( const unsigned long toy ) const ;
+      /** get the column:
+       *  - <code>name</code>, <code>name_err</code>, <code>name_pull</code>
+       *    for floating parameters
+       *  - <code>toy</code>, <code>seed</code>, <code>status</code>,
+       *    <code>covQual</code>, <code>nll</code>, <code>edm</code>,
+       *    <code>nEvents</code>, <code>sumw</code>
+       */
+      std::vector<double> column ( const std::string& name ) const ;
+      /// names of all columns
+      std::vector<std::string> columns () const ;
+      // ======================================================================
+      /** create TTree with results (one entry per toy)
+       *  @attention the tree is created in the current directory
+       */
+      TTree*      tree    ( const std::string& name  = "toys" ,
+                            const std::string& title = ""     ) const ;
+      /// create RooDataSet with results (one entry per toy)
+      RooDataSet* dataset ( const std::string& name  = "toys" ,
+                            const std::string& title = ""     ) const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the model
+      std::unique_ptr<RooAbsPdf> m_pdf      ;
+      /// the observables
+      std::unique_ptr<RooArgSet> m_obs      ;
+      /// number of events per toy
+      unsigned long              m_nEvents  { 0     } ;
+      /// extended?
+      bool                       m_extended { false } ;
+      /// names of all parameters
+      std::vector<std::string>   m_all      {       } ;
+      /// initial values of all parameters
+      std::vector<double>        m_all_init {       } ;
+      /// names of floating parameters
+      std::vector<std::string>   m_names    {       } ;
+      /// initial values of floating parameters
+      std::vector<double>        m_init     {       } ;
+      /// the global seed
+      ULong64_t                  m_seed     { 0     } ;
+      /// number of threads
+      unsigned int               m_nthreads { 0     } ;
+      /// progress bar?
+      bool                       m_progress { true  } ;
+      /// minimizer type
+      std::string                m_type     { ""    } ;
+      /// minimizer algorithm
+      std::string                m_algo     { ""    } ;
+      /// strategy
+      int                        m_strategy { 1     } ;
+      /// run HESSE?
+      bool                       m_hesse    { true  } ;
+      /// offset?
+      bool                       m_offset   { false } ;
+      /// the results
+      std::vector<Result>        m_results  {       } ;
+      // ======================================================================
+    } ;
+    // ========================================================================
+  } //                                        The end of namespace Ostap::Utils
+  // ==========================================================================
+} //                                                 The end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_TOYRUNNER_H
+// ============================================================================
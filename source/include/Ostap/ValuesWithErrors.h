@@ -0,0 +1,336 @@
+// ============================================================================
+#ifndef OSTAP_VALUESWITHERRORS_H
+#define OSTAP_VALUESWITHERRORS_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <cstddef>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ValueWithError.h"
+// ============================================================================
+// forward declarations
+// ============================================================================
+class TH1     ; // ROOT
+class TArrayD ; // ROOT
+// ============================================================================
+/** @file Ostap/ValuesWithErrors.h
+ *  Collection of values with associated "covariances",
+ *  stored as two separate arrays ("structure of arrays")
+ *  @see Ostap::Math::ValueWithError
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+namespace Ostap
+{
+  // ==========================================================================
+  namespace Math
+  {
+    // ========================================================================
+    namespace Interpolation { class Table ; } // forward declaration
+    // ========================================================================
+    /** @class ValuesWithErrors Ostap/ValuesWithErrors.h
+     *  Array of values with associated "covariances",
+     *  stored as two separate arrays ("structure of arrays").
+     *
+     *  - elementwise arithmetic and math functions propagate
+     *    the uncertainties exactly in the same way as
+     *    Ostap::Math::ValueWithError does for each element,
+     *    but without creating the objects inside the loops
+     *  - long arrays are split into chunks and processed in parallel
+     *    @see Ostap::Utils::ThreadPool
+     *  - the collection either owns its data, or it is a (non-owning)
+     *    view of the external arrays, e.g. bin contents and
+     *    sums of squared weights of the histogram: the in-place
+     *    operations modify the histogram directly
+     *  - the in-place operations on the histogram view modify only
+     *    the bin contents and the sums of squared weights: the number
+     *    of entries and the statistics (fTsumw, fTsumw2, ...) are
+     *    not updated, use <code>TH1::ResetStats</code> if needed
+     *  - the operations with the same object (e.g. <code>a+a</code>,
+     *    <code>a-a</code>, <code>a*a</code>, <code>a/a</code>) take into
+     *    account the full correlation, as for Ostap::Math::ValueWithError
+     *
+     *  @code
+     *  TH1D h = ... ;
+     *  ValuesWithErrors view ( h ) ;   // no copy!
+     *  view *= 2 ;                     // scale the histogram
+     *  const ValueWithError total = view.sum () ;
+     *  const ValuesWithErrors r   = sqrt ( view ) ;
+     *  @endcode
+     *  @see Ostap::Math::ValueWithError
+     *  @author Ostap developers
+     *  @date 2026-10-19
+     */
+    class ValuesWithErrors
+    {
+    public:
+      // ======================================================================
+      typedef std::vector<double>  Data ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// constructor: n elements with the same value and covariance
+      explicit ValuesWithErrors
+      ( const std::size_t n     = 0 ,
+        const double      value = 0 ,
+        const double      cov2  = 0 ) ;
+      /** constructor from the values and covariances
+       *  - if vector of covariances is shorter than vector of values,
+       *    missing entries are assumed to be zero
+       */
+      ValuesWithErrors
+      ( const Data& values        ,
+        const Data& cov2 = Data() ) ;
+      /// constructor from the vector of values with errors
+      ValuesWithErrors ( const ValueWithError::Vector& values ) ;
+      // ======================================================================
+      /** constructor of the (non-owning) view of the external arrays
+       *  @param n      number of elements
+       *  @param values the array of values
+       *  @param cov2   the array of covariances
+       *  @attention the arrays must be different
+       */
+      ValuesWithErrors
+      ( const std::size_t n      ,
+        double*           values ,
+        double*           cov2   ) ;
+      /** constructor of the (non-owning) view of the histogram
+       *  - all bins, including underflow and overflow bins, are viewed
+       *    in the order of the global bin numbers
+       *  - only histograms with double content (TH1D,TH2D,TH3D) are supported
+       *  - if the histogram has no structure for the sum of squared weights,
+       *    it is created (@see TH1::Sumw2)
+       */
+      ValuesWithErrors ( TH1& histo ) ;
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// number of elements
+      std::size_t size  () const { return m_vv ? m_n : m_values.size () ; }
+      /// empty collection?
+      bool        empty () const { return 0 == size () ; }
+      /// is it the view of the external arrays ?
+      bool        view  () const { return nullptr != m_vv ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// the array of values
+      const double* values () const { return m_vv ? m_vv : m_values.data () ; }
+      /// the array of values
+      double*       values ()       { return m_vv ? m_vv : m_values.data () ; }
+      /// the array of covariances
+      const double* cov2s  () const { return m_cv ? m_cv : m_cov2  .data () ; }
+      /// the array of covariances
+      double*       cov2s  ()       { return m_cv ? m_cv : m_cov2  .data () ; }
+      // ======================================================================
+    public:
+      // ======================================================================
+      /// get the value of i-th element (no check)
+      double value ( const std::size_t i ) const { return values () [ i ] ; }
+      /// get the covariance of i-th element (no check)
+      double cov2  ( const std::size_t i ) const { return cov2s  () [ i ] ; }
+      /// get the error of i-th element (no check)
+      double error ( const std::size_t i ) const
+      { return ValueWithError ( value ( i ) , cov2 ( i ) ).error () ; }
+      /// get i-th element (no check)
+      ValueWithError operator[] ( const std::size_t i ) const
+      { return ValueWithError ( value ( i ) , cov2 ( i ) ) ; }
+      /// get i-th element (with check)
+      ValueWithError at         ( const std::size_t i ) const ;
+      /// set i-th element (with check)
+      void           set
+      ( const std::size_t     i ,
+        const ValueWithError& v ) ;
+      /// convert to the vector of values with errors
+      ValueWithError::Vector vector () const ;
+      /// get the owning copy (the copy of the view is the view)
+      ValuesWithErrors       clone  () const ;
+      // ======================================================================
+    public: // in-place elementwise operations
+      // ======================================================================
+      ValuesWithErrors& operator+= ( const ValuesWithErrors& right ) ;
+      ValuesWithErrors& operator-= ( const ValuesWithErrors& right ) ;
+      ValuesWithErrors& operator*= ( const ValuesWithErrors& right ) ;
+      ValuesWithErrors& operator/= ( const ValuesWithErrors& right ) ;
+      // ======================================================================
+      ValuesWithErrors& operator+= ( const ValueWithError&   right ) ;
+      ValuesWithErrors& operator-= ( const ValueWithError&   right ) ;
+      ValuesWithErrors& operator*= ( const ValueWithError&   right ) ;
+      ValuesWithErrors& operator/= ( const ValueWithError&   right ) ;
+      // ======================================================================
+      ValuesWithErrors& operator+= ( const double            right ) ;
+      ValuesWithErrors& operator-= ( const double            right ) ;
+      ValuesWithErrors& operator*= ( const double            right ) ;
+      ValuesWithErrors& operator/= ( const double            right ) ;
+      // ======================================================================
+    public: // python
+      // ======================================================================
+      ValuesWithErrors __add__      ( const ValuesWithErrors& right ) const ;
+      ValuesWithErrors __sub__      ( const ValuesWithErrors& right ) const ;
+      ValuesWithErrors __mul__      ( const ValuesWithErrors& right ) const ;
+      ValuesWithErrors __truediv__  ( const ValuesWithErrors& right ) const ;
+      ValuesWithErrors __div__      ( const ValuesWithErrors& right ) const { return __truediv__ ( right ) ; }
+      // ======================================================================
+      ValuesWithErrors __add__      ( const ValueWithError&   right ) const ;
+      ValuesWithErrors __sub__      ( const ValueWithError&   right ) const ;
+      ValuesWithErrors __mul__      ( const ValueWithError&   right ) const ;
+      ValuesWithErrors __truediv__  ( const ValueWithError&   right ) const ;
+      ValuesWithErrors __div__      ( const ValueWithError&   right ) const { return __truediv__ ( right ) ; }
+      // ======================================================================
+      ValuesWithErrors __add__      ( const double            right ) const ;
+      ValuesWithErrors __sub__      ( const double            right ) const ;
+      ValuesWithErrors __mul__      ( const double            right ) const ;
+      ValuesWithErrors __truediv__  ( const double            right ) const ;
+      ValuesWithErrors __div__      ( const double            right ) const { return __truediv__  ( right ) ; }
+      ValuesWithErrors __radd__     ( const double            right ) const { return __add__      ( right ) ; }
+      ValuesWithErrors __rsub__     ( const double            right ) const ;
+      ValuesWithErrors __rmul__     ( const double            right ) const { return __mul__      ( right ) ; }
+      ValuesWithErrors __rtruediv__ ( const double            right ) const ;
+      ValuesWithErrors __rdiv__     ( const double            right ) const { return __rtruediv__ ( right ) ; }
+      // ======================================================================
+      ValuesWithErrors& __iadd__     ( const ValuesWithErrors& right ) { (*this) += right ; return *this ; }
+      ValuesWithErrors& __isub__     ( const ValuesWithErrors& right ) { (*this) -= right ; return *this ; }
+      ValuesWithErrors& __imul__     ( const ValuesWithErrors& right ) { (*this) *= right ; return *this ; }
+      ValuesWithErrors& __itruediv__ ( const ValuesWithErrors& right ) { (*this) /= right ; return *this ; }
+      ValuesWithErrors& __iadd__     ( const ValueWithError&   right ) { (*this) += right ; return *this ; }
+      ValuesWithErrors& __isub__     ( const ValueWithError&   right ) { (*this) -= right ; return *this ; }
+      ValuesWithErrors& __imul__     ( const ValueWithError&   right ) { (*this) *= right ; return *this ; }
+      ValuesWithErrors& __itruediv__ ( const ValueWithError&   right ) { (*this) /= right ; return *this ; }
+      ValuesWithErrors& __iadd__     ( const double            right ) { (*this) += right ; return *this ; }
+      ValuesWithErrors& __isub__     ( const double            right ) { (*this) -= right ; return *this ; }
+      ValuesWithErrors& __imul__     ( const double            right ) { (*this) *= right ; return *this ; }
+      ValuesWithErrors& __itruediv__ ( const double            right ) { (*this) /= right ; return *this ; }
+      // ======================================================================
+      ValuesWithErrors __neg__  () const ;
+      ValuesWithErrors __pos__  () const { return *this ; }
+      ValuesWithErrors __abs__  () const ;
+      ValuesWithErrors __pow__  ( const int    e ) const ;
+      ValuesWithErrors __pow__  ( const double e ) const ;
+      ValuesWithErrors __exp__  () const ;
+      ValuesWithErrors __log__  () const ;
+      ValuesWithErrors __sqrt__ () const ;
+      // ======================================================================
+    public: // reductions
+      // ======================================================================
+      /** get the sum of all elements
+       *  @see Ostap::Math::sum ( const ValueWithError::Vector& )
+       */
+      ValueWithError sum  () const ;
+      /// get the arithmetic mean of all elements: sum/n
+      ValueWithError mean () const ;
+      /** get the weighted average of all elements
+       *  with weights \f$ w_i = 1/\sigma^2_i\f$.
+       *  As for ValueWithError::mean, the elements with
+       *  non-positive covariances dominate: if they exist,
+       *  the result is their arithmetic mean without uncertainty
+       *  @see Ostap::Math::ValueWithError::mean
+       */
+      ValueWithError weighted_average () const ;
+      // ======================================================================
+    private:
+      // ======================================================================
+      /// the owned values
+      Data        m_values {         } ; // the owned values
+      /// the owned covariances
+      Data        m_cov2   {         } ; // the owned covariances
+      /// the size of the view
+      std::size_t m_n      { 0       } ; //! the size of the view
+      /// the viewed values (if any)
+      double*     m_vv     { nullptr } ; //! the viewed values
+      /// the viewed covariances (if any)
+      double*     m_cv     { nullptr } ; //! the viewed covariances
+      // ======================================================================
+    } ;
+    // ========================================================================
+    // elementwise operations
+    // ========================================================================
+    inline ValuesWithErrors operator+
+    ( const ValuesWithErrors& a , const ValuesWithErrors& b ) { return a.__add__      ( b ) ; }
+    inline ValuesWithErrors operator-
+    ( const ValuesWithErrors& a , const ValuesWithErrors& b ) { return a.__sub__      ( b ) ; }
+    inline ValuesWithErrors operator*
+    ( const ValuesWithErrors& a , const ValuesWithErrors& b ) { return a.__mul__      ( b ) ; }
+    inline ValuesWithErrors operator/
+    ( const ValuesWithErrors& a , const ValuesWithErrors& b ) { return a.__truediv__  ( b ) ; }
+    // ========================================================================
+    inline ValuesWithErrors operator+
+    ( const ValuesWithErrors& a , const ValueWithError&   b ) { return a.__add__      ( b ) ; }
+    inline ValuesWithErrors operator-
+    ( const ValuesWithErrors& a , const ValueWithError&   b ) { return a.__sub__      ( b ) ; }
+    inline ValuesWithErrors operator*
+    ( const ValuesWithErrors& a , const ValueWithError&   b ) { return a.__mul__      ( b ) ; }
+    inline ValuesWithErrors operator/
+    ( const ValuesWithErrors& a , const ValueWithError&   b ) { return a.__truediv__  ( b ) ; }
+    // ========================================================================
+    inline ValuesWithErrors operator+
+    ( const ValuesWithErrors& a , const double            b ) { return a.__add__      ( b ) ; }
+    inline ValuesWithErrors operator-
+    ( const ValuesWithErrors& a , const double            b ) { return a.__sub__      ( b ) ; }
+    inline ValuesWithErrors operator*
+    ( const ValuesWithErrors& a , const double            b ) { return a.__mul__      ( b ) ; }
+    inline ValuesWithErrors operator/
+    ( const ValuesWithErrors& a , const double            b ) { return a.__truediv__  ( b ) ; }
+    inline ValuesWithErrors operator+
+    ( const double            b , const ValuesWithErrors& a ) { return a.__radd__     ( b ) ; }
+    inline ValuesWithErrors operator-
+    ( const double            b , const ValuesWithErrors& a ) { return a.__rsub__     ( b ) ; }
+    inline ValuesWithErrors operator*
+    ( const double            b , const ValuesWithErrors& a ) { return a.__rmul__     ( b ) ; }
+    inline ValuesWithErrors operator/
+    ( const double            b , const ValuesWithErrors& a ) { return a.__rtruediv__ ( b ) ; }
+    // ========================================================================
+    inline ValuesWithErrors operator-
+    ( const ValuesWithErrors& a ) { return a.__neg__ () ; }
+    // ========================================================================
+    // elementwise math functions
+    // ========================================================================
+    /// elementwise abs(a)   @see Ostap::Math::abs   ( const ValueWithError& )
+    ValuesWithErrors abs   ( const ValuesWithErrors& a ) ;
+    /// elementwise exp(a)   @see Ostap::Math::exp   ( const ValueWithError& )
+    ValuesWithErrors exp   ( const ValuesWithErrors& a ) ;
+    /// elementwise log(a)   @see Ostap::Math::log   ( const ValueWithError& )
+    ValuesWithErrors log   ( const ValuesWithErrors& a ) ;
+    /// elementwise log10(a) @see Ostap::Math::log10 ( const ValueWithError& )
+    ValuesWithErrors log10 ( const ValuesWithErrors& a ) ;
+    /// elementwise sqrt(a)  @see Ostap::Math::sqrt  ( const ValueWithError& )
+    ValuesWithErrors sqrt  ( const ValuesWithErrors& a ) ;
+    /// elementwise pow(a,b) @see Ostap::Math::pow   ( const ValueWithError& , int )
+    ValuesWithErrors pow   ( const ValuesWithErrors& a , const int    b ) ;
+    /// elementwise pow(a,b) @see Ostap::Math::pow   ( const ValueWithError& , double )
+    ValuesWithErrors pow   ( const ValuesWithErrors& a , const double b ) ;
+    // ========================================================================
+    // reductions
+    // ========================================================================
+    /// sum of all elements
+    inline ValueWithError sum  ( const ValuesWithErrors& a ) { return a.sum  () ; }
+    /// arithmetic mean of all elements
+    inline ValueWithError mean ( const ValuesWithErrors& a ) { return a.mean () ; }
+    /// weighted average of all elements
+    inline ValueWithError weighted_average ( const ValuesWithErrors& a )
+    { return a.weighted_average () ; }
+    // ========================================================================
+    /** interpolate the table for all elements of <code>x</code>
+     *  the uncertainties of <code>x</code> are propagated via
+     *  the derivative of the interpolation polynomial
+     *  @see Ostap::Math::interpolate ( const std::vector<double>& , const std::vector<double>& , const ValueWithError& )
+     *  @param table the interpolation table
+     *  @param x     the points with uncertainties
+     *  @return the interpolated values with uncertainties
+     */
+    ValuesWithErrors interpolate
+    ( const Ostap::Math::Interpolation::Table& table ,
+      const ValuesWithErrors&                  x     ) ;
+    // ========================================================================
+  } //                                             end of namespace Ostap::Math
+  // ==========================================================================
+} //                                                     end of namespace Ostap
+// ============================================================================
+//                                                                      The END
+// ============================================================================
+#endif // OSTAP_VALUESWITHERRORS_H
+// ============================================================================
@@ -4,6 +4,10 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <cstddef>
+// ============================================================================
 // ROOT 
 // ============================================================================
 #include "RVersion.h"
@@ -16,6 +20,12 @@ namespace Ostap
     // ========================================================================
     /** @class WorkSpace Ostap/Workspace.h
      *  helper utility to keep the integration workspace for GSL integration
+     *
+     *  The object itself keeps only the requested size of the workspace.
+     *  The actual GSL-workspaces are taken on demand from the 
+     *  thread-local pool and returned back to the pool after the integration.
+     *  It makes the objects cheap to copy and allows the concurrent 
+     *  integration with the same object from different threads.
      *  @author Vanya Belyaev Ivan.Belyaev@itep.ru
      *  @date 2011-12-03
      */
@@ -25,17 +35,24 @@ namespace Ostap
       // ======================================================================
       /// constructor
       WorkSpace  ( const std::size_t size  = 0 ) ;
-      /// (fictive) copy constructor
-      WorkSpace  ( const WorkSpace&  right ) ;
+      /// copy constructor
+      WorkSpace  ( const WorkSpace&  right ) = default ;
       /// move constructor 
-      WorkSpace  (       WorkSpace&& right ) ;
+      WorkSpace  (       WorkSpace&& right ) = default ;
       /// destructor
-      ~WorkSpace () ;
+      ~WorkSpace () = default ;
       // ======================================================================
     public:
       // ======================================================================
-      /// get the integration workspace
-      void* workspace () const ;               // get the integration workspace
+      /** get the integration workspace from the thread-local pool 
+       *  @attention it must be returned back to the pool using <code>release</code>
+       *  @see Ostap::Math::WorkSpace::release 
+       */
+      void* acquire () const ;                // get the integration workspace
+      /** return the integration workspace back to the thread-local pool 
+       *  @see Ostap::Math::WorkSpace::acquire
+       */
+      static void release ( void* ws ) ;
       // ======================================================================
       /// get the size of allocated workspace 
       // ======================================================================
@@ -48,25 +65,28 @@ namespace Ostap
       // ======================================================================
     public:
       // ======================================================================
-      /// (fictive) assignement operator
-      WorkSpace& operator= ( const WorkSpace&  right ) ;
-      /// move      assignement operator
-      WorkSpace& operator= (       WorkSpace&& right ) ;
+      /// copy assignement operator
+      WorkSpace& operator= ( const WorkSpace&  right ) = default ;
+      /// move assignement operator
+      WorkSpace& operator= (       WorkSpace&& right ) = default ;
       // ======================================================================
     public:
       // ======================================================================
       void swap ( WorkSpace& right ) ;
       // ======================================================================
-    private:
+    public:
+      // ======================================================================
+      /// number of free workspaces in the pool for the current thread 
+      static std::size_t pool_size () ;
+      /** clear the pool for the current thread 
+       *  @return number of released workspaces 
+       */
+      static std::size_t pool_clear () ;
       // ======================================================================
-      /// the actual GSL-workspace
-      /// mutable char*  m_workspace ;  /// the actual GSL-workspace
-      // char* here to please dictionary generator...
-      /// mutable char* m_workspace  { nullptr } ; //! the actual GSL-workspace
-      mutable void* m_workspace  { nullptr } ; //! the actual GSL-workspace
+    private:
       // ======================================================================
-      /// size of the allocated workspace 
-      std::size_t   m_size       { 0 } ;   /// size of the allocated workspace 
+      /// size of the workspace 
+      std::size_t   m_size       { 0 } ;   /// size of the workspace 
       // ======================================================================
     } ;
     // ========================================================================
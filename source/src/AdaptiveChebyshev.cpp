@@ -0,0 +1,488 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+#include <mutex>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/AdaptiveChebyshev.h"
+#include "Ostap/Integrator.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_math.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::AdaptiveChebyshev
+ *  @see Ostap::Math::AdaptiveChebyshev
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Math::AdaptiveChebyshev::Table
+ *  the actual (immutable) piecewise Chebyshev approximation
+ */
+class Ostap::Math::AdaptiveChebyshev::Table
+{
+public:
+  // ==========================================================================
+  /// the key
+  std::size_t              key    { 0 } ;
+  /// the edges of the pieces
+  std::vector<double>      edges  {   } ;
+  /// the coefficients of all pieces, one after another
+  std::vector<double>      coeffs {   } ;
+  /// the offsets of the coefficients for each piece (+1 extra)
+  std::vector<std::size_t> index  {   } ;
+  // ==========================================================================
+public:
+  // ==========================================================================
+  /// find the piece
+  inline std::size_t piece ( const double x ) const
+  {
+    const std::size_t n = edges.size () - 1 ;
+    std::size_t i = std::upper_bound ( edges.begin () , edges.end () , x ) - edges.begin () ;
+    i = 0 < i ? i - 1 : 0 ;
+    return std::min ( i , n - 1 ) ;
+  }
+  // ==========================================================================
+  /// the value of the approximation (Clenshaw recurrence)
+  inline double operator() ( const double x ) const
+  {
+    const std::size_t i = piece ( x ) ;
+    const double a = edges [ i     ] ;
+    const double b = edges [ i + 1 ] ;
+    const double t = ( 2 * x - a - b ) / ( b - a ) ;
+    return clenshaw ( coeffs.data () + index [ i ] , index [ i + 1 ] - index [ i ] , t ) ;
+  }
+  // ==========================================================================
+  /// Clenshaw summation of \f$ \sum_j c_j T_j(t) \f$
+  static inline double clenshaw
+  ( const double*     c ,
+    const std::size_t n ,
+    const double      t )
+  {
+    if ( 0 == n ) { return 0 ; }
+    const double t2 = 2 * t ;
+    double b1 = 0 ;
+    double b2 = 0 ;
+    for ( std::size_t j = n - 1 ; 0 < j ; --j )
+    {
+      const double b0 = c [ j ] + t2 * b1 - b2 ;
+      b2 = b1 ;
+      b1 = b0 ;
+    }
+    return c [ 0 ] + t * b1 - b2 ;
+  }
+  // ==========================================================================
+  /// the integral of the piece from the (local) t1 to the (local) t2
+  inline double integral
+  ( const std::size_t i  ,
+    const double      t1 ,
+    const double      t2 ) const
+  {
+    const double*     c = coeffs.data () + index [ i ] ;
+    const std::size_t n = index [ i + 1 ] - index [ i ] ;
+    //
+    // coefficients of the antiderivative
+    std::vector<double> C ( n + 1 , 0.0 ) ;
+    for ( std::size_t k = 1 ; k <= n ; ++k )
+    {
+      const double cm = c [ k - 1 ] ;
+      const double cp = k + 1 < n ? c [ k + 1 ] : 0.0 ;
+      C [ k ] = 1 == k ? cm - 0.5 * cp : 0.5 * ( cm - cp ) / k ;
+    }
+    //
+    const double h = 0.5 * ( edges [ i + 1 ] - edges [ i ] ) ;
+    return h * ( clenshaw ( C.data () , C.size () , t2 ) -
+                 clenshaw ( C.data () , C.size () , t1 ) ) ;
+  }
+  // ==========================================================================
+  /// the integral over the range [low,high] inside the approximation range
+  double integral ( const double low , const double high ) const
+  {
+    const std::size_t i1 = piece ( low  ) ;
+    const std::size_t i2 = piece ( high ) ;
+    double result = 0 ;
+    for ( std::size_t i = i1 ; i <= i2 ; ++i )
+    {
+      const double a  = edges [ i     ] ;
+      const double b  = edges [ i + 1 ] ;
+      const double xl = i == i1 ? low  : a ;
+      const double xh = i == i2 ? high : b ;
+      result += integral ( i ,
+                           ( 2 * xl - a - b ) / ( b - a ) ,
+                           ( 2 * xh - a - b ) / ( b - a ) ) ;
+    }
+    return result ;
+  }
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** @var s_mutex
+   *  the mutex to protect the building of the approximations,
+   *  recursive: the approximated function can use other approximations
+   */
+  std::recursive_mutex s_mutex ;
+  // ==========================================================================
+  /// the initial order of the polynomial
+  const unsigned int s_NINIT   = 16   ;
+  /// the minimal relative width of the piece
+  const double       s_MINWIDTH = 1.e-10 ;
+  /// the grain for the parallel batch evaluation
+  const std::size_t  s_GRAIN   = 4096 ;
+  // ==========================================================================
+  /** Chebyshev coefficients from the values at Chebyshev-Lobatto points,
+   *  \f$ f_k = f(\cos \pi k / N ) \f$, via the discrete cosine transform (DCT-I)
+   */
+  void dct
+  ( const std::vector<double>& f ,
+    std::vector<double>&       c )
+  {
+    const std::size_t N = f.size () - 1 ;
+    //
+    // the table of cosines: cos ( pi * m / N ) for m = 0 ... 2N-1
+    std::vector<double> cs ( 2 * N ) ;
+    for ( std::size_t m = 0 ; m < 2 * N ; ++m )
+    { cs [ m ] = std::cos ( M_PI * m / N ) ; }
+    //
+    c.assign ( N + 1 , 0.0 ) ;
+    for ( std::size_t j = 0 ; j <= N ; ++j )
+    {
+      double s = 0.5 * ( f [ 0 ] + ( j % 2 ? -f [ N ] : f [ N ] ) ) ;
+      for ( std::size_t k = 1 ; k < N ; ++k )
+      { s += f [ k ] * cs [ ( j * k ) % ( 2 * N ) ] ; }
+      c [ j ] = 2 * s / N ;
+    }
+    c [ 0 ] *= 0.5 ;
+    c [ N ] *= 0.5 ;
+  }
+  // ==========================================================================
+  /// one piece of the approximation
+  struct Piece
+  {
+    double              a      ;
+    double              b      ;
+    std::vector<double> coeffs ;
+  } ;
+  // ==========================================================================
+  /** try to approximate the function in [a,b]
+   *  @param fun      the function
+   *  @param a        low edge
+   *  @param b        high edge
+   *  @param prec     the relative precision
+   *  @param vscale   (update) the global scale of the function
+   *  @param maxorder the maximal order
+   *  @param coeffs   (output) the coefficients
+   *  @return true if the expansion has converged
+   */
+  bool approximate
+  ( const Ostap::Math::AdaptiveChebyshev::Function& fun      ,
+    const double                                    a        ,
+    const double                                    b        ,
+    const double                                    prec     ,
+    double&                                         vscale   ,
+    const unsigned int                              maxorder ,
+    std::vector<double>&                            coeffs   )
+  {
+    const double m = 0.5 * ( a + b ) ;
+    const double h = 0.5 * ( b - a ) ;
+    //
+    std::vector<double> f ;
+    std::vector<double> c ;
+    for ( unsigned int N = s_NINIT ; N <= maxorder ; N *= 2 )
+    {
+      // the new samples, reuse the previous ones at even points
+      std::vector<double> fn ( N + 1 ) ;
+      for ( std::size_t k = 0 ; k <= N ; ++k )
+      {
+        if ( !f.empty () && 0 == k % 2 ) { fn [ k ] = f [ k / 2 ] ; continue ; }
+        const double x = 0 == k ? b : N == k ? a : m + h * std::cos ( M_PI * k / N ) ;
+        fn [ k ] = fun ( x ) ;
+      }
+      f.swap ( fn ) ;
+      //
+      for ( const double v : f ) { vscale = std::max ( vscale , std::abs ( v ) ) ; }
+      //
+      dct ( f , c ) ;
+      //
+      // local scale: protect relative precision for tiny values
+      double lscale = 0 ;
+      for ( const double v : f ) { lscale = std::max ( lscale , std::abs ( v ) ) ; }
+      const double tol = prec * std::max ( lscale , 1.e-6 * vscale ) ;
+      //
+      // the tail: the last three coefficients
+      const double tail = std::abs ( c [ N ] ) + std::abs ( c [ N - 1 ] ) + std::abs ( c [ N - 2 ] ) ;
+      //
+      if ( 0 == vscale || tail <= tol )
+      {
+        // chop the negligible trailing coefficients
+        std::size_t n   = N + 1 ;
+        double      sum = 0 ;
+        while ( 1 < n && sum + std::abs ( c [ n - 1 ] ) <= 0.5 * tol )
+        { sum += std::abs ( c [ n - 1 ] ) ; --n ; }
+        c.resize ( n ) ;
+        coeffs.swap ( c ) ;
+        return true ;                                                  // RETURN
+      }
+    }
+    coeffs.swap ( c ) ;
+    return false ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor from the function and the range
+ *  @param fun       the function
+ *  @param xmin      low  edge of the approximation range
+ *  @param xmax      high edge of the approximation range
+ *  @param precision the relative precision of the approximation
+ *  @param maxorder  maximal order of the polynomial in one piece
+ *  @param maxpieces maximal number of pieces
+ *  @param key       the key function (if any)
+ */
+// ============================================================================
+Ostap::Math::AdaptiveChebyshev::AdaptiveChebyshev
+( Ostap::Math::AdaptiveChebyshev::Function fun       ,
+  const double                             xmin      ,
+  const double                             xmax      ,
+  const double                             precision ,
+  const unsigned int                       maxorder  ,
+  const std::size_t                        maxpieces ,
+  Ostap::Math::AdaptiveChebyshev::Key      key       )
+  : m_fun       ( fun  )
+  , m_xmin      ( std::min ( xmin , xmax ) )
+  , m_xmax      ( std::max ( xmin , xmax ) )
+  , m_precision ( std::abs ( precision ) )
+  , m_maxorder  ( std::max ( maxorder  , s_NINIT ) )
+  , m_maxpieces ( std::max ( maxpieces , std::size_t ( 1 ) ) )
+  , m_key       ( key  )
+  , m_table     ()
+{
+  Ostap::Assert ( m_xmin < m_xmax                    ,
+                  "Invalid approximation range!"     ,
+                  "Ostap::Math::AdaptiveChebyshev"   ) ;
+  Ostap::Assert ( 0 < m_precision                    ,
+                  "Invalid precision!"               ,
+                  "Ostap::Math::AdaptiveChebyshev"   ) ;
+}
+// ============================================================================
+// copy constructor: the approximation is shared
+// ============================================================================
+Ostap::Math::AdaptiveChebyshev::AdaptiveChebyshev
+( const Ostap::Math::AdaptiveChebyshev& right )
+  : m_fun       ( right.m_fun       )
+  , m_xmin      ( right.m_xmin      )
+  , m_xmax      ( right.m_xmax      )
+  , m_precision ( right.m_precision )
+  , m_maxorder  ( right.m_maxorder  )
+  , m_maxpieces ( right.m_maxpieces )
+  , m_key       ( right.m_key       )
+  , m_table     ( std::atomic_load ( &right.m_table ) )
+{}
+// ============================================================================
+// default constructor (needed for serialization)
+// ============================================================================
+Ostap::Math::AdaptiveChebyshev::AdaptiveChebyshev () = default ;
+// ============================================================================
+// drop the approximation, it will be rebuilt at next call
+// ============================================================================
+void Ostap::Math::AdaptiveChebyshev::reset () const
+{ std::atomic_store ( &m_table , std::shared_ptr<const Table> () ) ; }
+// ============================================================================
+// get the valid approximation (build it if needed)
+// ============================================================================
+std::shared_ptr<const Ostap::Math::AdaptiveChebyshev::Table>
+Ostap::Math::AdaptiveChebyshev::table () const
+{
+  const std::size_t key = m_key ? m_key () : 0 ;
+  //
+  std::shared_ptr<const Table> t = std::atomic_load ( &m_table ) ;
+  if ( t && key == t->key ) { return t ; }                           // RETURN
+  //
+  std::lock_guard<std::recursive_mutex> lock ( s_mutex ) ;
+  //
+  // somebody else could build it already
+  t = std::atomic_load ( &m_table ) ;
+  if ( t && key == t->key ) { return t ; }                           // RETURN
+  //
+  const double dxmin  = ( m_xmax - m_xmin ) * s_MINWIDTH ;
+  double       vscale = 0 ;
+  //
+  // the pieces to be processed (the last one is the leftmost)
+  std::vector<std::pair<double,double> > todo { { m_xmin , m_xmax } } ;
+  std::vector<Piece>                     done {} ;
+  //
+  while ( !todo.empty () )
+  {
+    const std::pair<double,double> ab = todo.back () ;
+    todo.pop_back () ;
+    //
+    Piece p { ab.first , ab.second , {} } ;
+    const bool ok = approximate ( m_fun , p.a , p.b , m_precision , vscale , m_maxorder , p.coeffs ) ;
+    //
+    if ( ok || p.b - p.a <= 2 * dxmin || m_maxpieces <= done.size () + todo.size () + 1 )
+    { done.push_back ( std::move ( p ) ) ; continue ; }
+    //
+    // split it into two halves, the left half is processed first
+    const double xm = 0.5 * ( p.a + p.b ) ;
+    todo.emplace_back ( xm   , p.b ) ;
+    todo.emplace_back ( p.a  , xm  ) ;
+  }
+  //
+  auto nt = std::make_shared<Table> () ;
+  nt -> key = key ;
+  nt -> edges.reserve ( done.size () + 1 ) ;
+  nt -> index.reserve ( done.size () + 1 ) ;
+  std::size_t ncoeffs = 0 ;
+  for ( const Piece& p : done ) { ncoeffs += p.coeffs.size () ; }
+  nt -> coeffs.reserve ( ncoeffs ) ;
+  //
+  for ( const Piece& p : done )
+  {
+    nt -> edges .push_back ( p.a ) ;
+    nt -> index .push_back ( nt -> coeffs.size () ) ;
+    nt -> coeffs.insert    ( nt -> coeffs.end () , p.coeffs.begin () , p.coeffs.end () ) ;
+  }
+  nt -> edges .push_back ( m_xmax ) ;
+  nt -> index .push_back ( nt -> coeffs.size () ) ;
+  //
+  t = nt ;
+  std::atomic_store ( &m_table , t ) ;
+  return t ;
+}
+// ============================================================================
+// evaluate the function
+// ============================================================================
+double Ostap::Math::AdaptiveChebyshev::evaluate ( const double x ) const
+{
+  if ( x < m_xmin || m_xmax < x ) { return m_fun ( x ) ; }
+  return (*table ()) ( x ) ;
+}
+// ============================================================================
+/*  evaluate the function for the array of points
+ *  @param n      number of points
+ *  @param x      (input)  the points
+ *  @param result (output) the values
+ */
+// ============================================================================
+void Ostap::Math::AdaptiveChebyshev::evaluate
+( const std::size_t n      ,
+  const double*     x      ,
+  double*           result ) const
+{
+  if ( 0 == n ) { return ; }
+  Ostap::Assert ( x && result                        ,
+                  "Invalid input/output arrays!"     ,
+                  "Ostap::Math::AdaptiveChebyshev"   ) ;
+  //
+  // get the table once, outside of the loop
+  std::shared_ptr<const Table> t  = table () ;
+  const Table&                 tt = *t ;
+  const double                 x1 = m_xmin ;
+  const double                 x2 = m_xmax ;
+  //
+  auto kernel = [&tt,x,result,x1,x2] ( const std::size_t begin , const std::size_t end )
+    {
+      for ( std::size_t i = begin ; i < end ; ++i )
+      {
+        const double v = x [ i ] ;
+        if ( v < x1 || x2 < v ) { continue ; }
+        result [ i ] = tt ( v ) ;
+      }
+    } ;
+  //
+  if ( n < s_GRAIN ) { kernel ( 0 , n ) ; }
+  else { Ostap::Utils::ThreadPool::parallel_for ( n , kernel , s_GRAIN ) ; }
+  //
+  // the original function is not guaranteed to be thread-safe
+  for ( std::size_t i = 0 ; i < n ; ++i )
+  {
+    const double v = x [ i ] ;
+    if ( v < x1 || x2 < v ) { result [ i ] = m_fun ( v ) ; }
+  }
+}
+// ============================================================================
+// evaluate the function for the vector of points
+// ============================================================================
+std::vector<double>
+Ostap::Math::AdaptiveChebyshev::evaluate
+( const std::vector<double>& x ) const
+{
+  std::vector<double> result ( x.size () , 0.0 ) ;
+  evaluate ( x.size () , x.data () , result.data () ) ;
+  return result ;
+}
+// ============================================================================
+// get the integral over the whole approximation range
+// ============================================================================
+double Ostap::Math::AdaptiveChebyshev::integral () const
+{ return table () -> integral ( m_xmin , m_xmax ) ; }
+// ============================================================================
+// get the integral between low and high
+// ============================================================================
+double Ostap::Math::AdaptiveChebyshev::integral
+( const double low  ,
+  const double high ) const
+{
+  if      ( s_equal ( low , high ) ) { return  0 ; }
+  else if ( high < low             ) { return -integral ( high , low ) ; }
+  //
+  double result = 0 ;
+  //
+  // the parts outside the approximation range
+  if ( low < m_xmin || m_xmax < high )
+  {
+    const Ostap::Math::Integrator integrator {} ;
+    if ( low  < m_xmin ) { result += integrator.integrate ( std::cref ( m_fun ) , low , std::min ( high , m_xmin ) ) ; }
+    if ( m_xmax < high ) { result += integrator.integrate ( std::cref ( m_fun ) , std::max ( low , m_xmax ) , high ) ; }
+  }
+  //
+  const double xl = std::max ( low  , m_xmin ) ;
+  const double xh = std::min ( high , m_xmax ) ;
+  if ( xl < xh ) { result += table () -> integral ( xl , xh ) ; }
+  //
+  return result ;
+}
+// ============================================================================
+// number of pieces (the approximation is built if needed)
+// ============================================================================
+std::size_t Ostap::Math::AdaptiveChebyshev::npieces () const
+{ return table () -> edges.size () - 1 ; }
+// ============================================================================
+// total number of coefficients (the approximation is built if needed)
+// ============================================================================
+std::size_t Ostap::Math::AdaptiveChebyshev::size () const
+{ return table () -> coeffs.size () ; }
+// ============================================================================
+// get the edges of the pieces (the approximation is built if needed)
+// ============================================================================
+std::vector<double> Ostap::Math::AdaptiveChebyshev::edges () const
+{ return table () -> edges ; }
+// ============================================================================
+// get the coefficients for the given piece
+// ============================================================================
+std::vector<double>
+Ostap::Math::AdaptiveChebyshev::coefficients ( const std::size_t piece ) const
+{
+  std::shared_ptr<const Table> t = table () ;
+  Ostap::Assert ( piece + 1 < t -> edges.size ()     ,
+                  "Invalid piece index!"             ,
+                  "Ostap::Math::AdaptiveChebyshev"   ) ;
+  return std::vector<double> ( t -> coeffs.begin () + t -> index [ piece     ] ,
+                               t -> coeffs.begin () + t -> index [ piece + 1 ] ) ;
+}
+// ============================================================================
+
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -18,6 +18,7 @@
 #include "Ostap/AddBranch.h"
 #include "Ostap/Funcs.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/ReadPlan.h"
 // ============================================================================
 /** @file
  *  Implementation file for function Ostap::Trees::add_branch 
@@ -71,6 +72,11 @@ Ostap::Trees::add_branch
   notifier.Notify() ;
   //
   const Long64_t nentries = tree->GetEntries(); 
+  //
+  // read only the branches, used by the function 
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nentries , std::vector<const Ostap::IFuncTree*> { &func } ) ;
+  plan.prune ( { name } ) ;
+  //
   for ( Long64_t i = 0 ; i < nentries ; ++i )
   {
     if ( tree->GetEntry ( i ) < 0 ) { break ; };
@@ -213,6 +219,13 @@ Ostap::Trees::add_branch
   notifier.Notify() ;
   //
   const Long64_t nentries = tree->GetEntries(); 
+  //
+  // read only the branches, used by the functions 
+  std::vector<std::string> names ;
+  for ( const auto& entry : branches ) { names.push_back ( entry.first ) ; }
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nentries , functions ) ;
+  plan.prune ( names ) ;
+  //
   for ( Long64_t i = 0 ; i < nentries ; ++i )
   {
     if ( tree->GetEntry ( i ) < 0 ) { break ; };
@@ -251,6 +264,11 @@ Ostap::Trees::add_branch
   if ( !branch ) { return Ostap::StatusCode ( CANNOT_CREATE_BRANCH ) ; }
   //
   const Long64_t nentries = tree->GetEntries(); 
+  //
+  // no existing branches are needed 
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nentries ) ;
+  plan.prune ( { name } ) ;
+  //
   for ( Long64_t i = 0 ; i < nentries ; ++i )
   {
     if ( tree->GetEntry ( i ) < 0 ) { break ; };
@@ -296,6 +314,11 @@ Ostap::Trees::add_branch
   TH2& h = const_cast<TH2&> ( histo ) ;
   //
   const Long64_t nentries = tree->GetEntries(); 
+  //
+  // no existing branches are needed 
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nentries ) ;
+  plan.prune ( { namex , namey } ) ;
+  //
   for ( Long64_t i = 0 ; i < nentries ; ++i )
   {
     if ( tree->GetEntry ( i ) < 0 ) { break ; };
@@ -344,6 +367,11 @@ Ostap::Trees::add_branch
   TH3& h = const_cast<TH3&> ( histo ) ;
   //
   const Long64_t nentries = tree->GetEntries(); 
+  //
+  // no existing branches are needed 
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nentries ) ;
+  plan.prune ( { namex , namey , namez } ) ;
+  //
   for ( Long64_t i = 0 ; i < nentries ; ++i )
   {
     if ( tree->GetEntry ( i ) < 0 ) { break ; };
@@ -0,0 +1,298 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+// ============================================================================
+// ROOT/RooFit
+// ============================================================================
+#include "RooAbsData.h"
+#include "RooAbsReal.h"
+#include "RooArgSet.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/BasisCache.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_hash.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::BasisCache
+ *  @see Ostap::Math::BasisCache
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Math::BasisCache::Values
+ *  the function values for certain coefficients
+ */
+class Ostap::Math::BasisCache::Values
+{
+public:
+  // ==========================================================================
+  /// the coefficients
+  std::vector<double> pars   {} ;
+  /// the function values
+  std::vector<double> values {} ;
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// invalid index
+  const std::size_t s_npos = std::size_t ( -1 ) ;
+  // ==========================================================================
+  /// the minimal number of rows for one chunk of parallel loop
+  const std::size_t s_GRAIN = 4096 ;
+  // ==========================================================================
+  /** matrix-vector product for the rows [begin,end)
+   *  (independent accumulators allow the vectorisation of the loop)
+   */
+  template <class TYPE>
+  void matvec ( const TYPE*       matrix ,
+                const double*     pars   ,
+                const std::size_t nbasis ,
+                const std::size_t begin  ,
+                const std::size_t end    ,
+                double*           result )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    {
+      const TYPE* row = matrix + i * nbasis ;
+      double s0 = 0 ;
+      double s1 = 0 ;
+      double s2 = 0 ;
+      double s3 = 0 ;
+      std::size_t k = 0 ;
+      for ( ; k + 4 <= nbasis ; k += 4 )
+      {
+        s0 += row [ k     ] * pars [ k     ] ;
+        s1 += row [ k + 1 ] * pars [ k + 1 ] ;
+        s2 += row [ k + 2 ] * pars [ k + 2 ] ;
+        s3 += row [ k + 3 ] * pars [ k + 3 ] ;
+      }
+      for ( ; k < nbasis ; ++k ) { s0 += row [ k ] * pars [ k ] ; }
+      result [ i ] = ( s0 + s1 ) + ( s2 + s3 ) ;
+    }
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// default memory limit: 512MB
+// ============================================================================
+const std::size_t Ostap::Math::BasisCache::s_MAXMEMORY = 512 * 1024 * 1024 ;
+// ============================================================================
+// hash for the point
+// ============================================================================
+std::size_t Ostap::Math::BasisCache::PointHash::operator()
+  ( const Ostap::Math::BasisCache::Point& p ) const
+{ return std::hash_combine ( p [ 0 ] , p [ 1 ] , p [ 2 ] , p [ 3 ] ) ; }
+// ============================================================================
+/*  constructor
+ *  @param nbasis    number of basis functions
+ *  @param single    store the basis values in single precision
+ *  @param maxmemory the memory limit (bytes) for the basis values
+ *  @param key       the key of the basis, e.g. from key1D/key2D/key3D
+ */
+// ============================================================================
+Ostap::Math::BasisCache::BasisCache
+( const unsigned short nbasis    ,
+  const bool           single    ,
+  const std::size_t    maxmemory ,
+  const std::size_t    key       )
+  : m_nbasis    ( nbasis    )
+  , m_single    ( single    )
+  , m_maxmemory ( maxmemory )
+  , m_key       ( key       )
+  , m_points    ()
+  , m_double    ()
+  , m_float     ()
+  , m_index     ()
+  , m_last      ( 0 )
+  , m_values    ()
+{}
+// ============================================================================
+/*  the key of the basis
+ *  @param nbasis number of basis functions
+ *  @param begin  start of the parameters that define the basis (range, knots,...)
+ *  @param end    end   of the parameters that define the basis (range, knots,...)
+ */
+// ============================================================================
+std::size_t Ostap::Math::BasisCache::key
+( const std::size_t nbasis ,
+  const double*     begin  ,
+  const double*     end    )
+{ return std::hash_combine ( nbasis , std::hash_range ( begin , end ) ) ; }
+// ============================================================================
+// the memory used for the basis values
+// ============================================================================
+std::size_t Ostap::Math::BasisCache::memory () const
+{ return m_double.size () * sizeof ( double ) + m_float.size () * sizeof ( float ) ; }
+// ============================================================================
+/*  add the point
+ *  @param point the point
+ *  @param basis the values of basis functions at this point
+ *  @return false if the memory limit is exceeded
+ */
+// ============================================================================
+bool Ostap::Math::BasisCache::add
+( const Ostap::Math::BasisCache::Point& point ,
+  const double*                         basis )
+{
+  if ( m_index.end () != m_index.find ( point ) ) { return true ; }  // already here
+  //
+  const std::size_t row = m_nbasis * ( m_single ? sizeof ( float ) : sizeof ( double ) ) ;
+  if ( m_maxmemory < memory () + row ) { return false ; }
+  //
+  m_index [ point ] = m_points.size () ;
+  m_points.push_back ( point ) ;
+  if ( m_single ) { m_float .insert ( m_float .end () , basis , basis + m_nbasis ) ; }
+  else            { m_double.insert ( m_double.end () , basis , basis + m_nbasis ) ; }
+  //
+  std::atomic_store ( &m_values , std::shared_ptr<const Values> () ) ;
+  return true ;
+}
+// ============================================================================
+/*  fill the cache from the dataset
+ *  @param data        the dataset
+ *  @param observables the names of observables (at most 4)
+ *  @param basis       the basis
+ *  @return false if observables are not in dataset or memory limit is exceeded
+ */
+// ============================================================================
+bool Ostap::Math::BasisCache::fill
+( const RooAbsData&                     data        ,
+  const std::vector<std::string>&       observables ,
+  Ostap::Math::BasisCache::Basis        basis       )
+{
+  Ostap::Assert ( !observables.empty () && observables.size () <= 4 ,
+                  "Invalid number of observables!"                  ,
+                  "Ostap::Math::BasisCache"                         ) ;
+  //
+  const RooArgSet* vars = data.get () ;
+  if ( nullptr == vars ) { return false ; }
+  std::vector<const RooAbsReal*> vs ;
+  for ( const std::string& name : observables )
+  {
+    const RooAbsReal* v = dynamic_cast<const RooAbsReal*> ( vars->find ( name.c_str () ) ) ;
+    if ( nullptr == v ) { return false ; }                             // RETURN
+    vs.push_back ( v ) ;
+  }
+  //
+  const std::size_t nentries = data.numEntries () ;
+  const std::size_t row      = m_nbasis * ( m_single ? sizeof ( float ) : sizeof ( double ) ) ;
+  // NB: if it does not fit, there could be many duplicates, add will check the limit
+  if ( memory () + nentries * row <= m_maxmemory ) 
+  {
+    if ( m_single ) { m_float .reserve ( m_float .size () + nentries * m_nbasis ) ; }
+    else            { m_double.reserve ( m_double.size () + nentries * m_nbasis ) ; }
+  }
+  //
+  std::vector<double> buffer ( m_nbasis , 0.0 ) ;
+  for ( std::size_t entry = 0 ; entry < nentries ; ++entry )
+  {
+    const RooArgSet* item = data.get ( entry ) ;
+    if ( nullptr == item ) { continue ; }
+    Point point { { 0 , 0 , 0 , 0 } } ;
+    for ( std::size_t k = 0 ; k < vs.size () ; ++k ) { point [ k ] = vs [ k ]->getVal () ; }
+    if ( m_index.end () != m_index.find ( point ) ) { continue ; }
+    basis ( point , buffer.data () ) ;
+    if ( !add ( point , buffer.data () ) ) { return false ; }        // RETURN
+  }
+  //
+  return true ;
+}
+// ============================================================================
+// find the point
+// ============================================================================
+std::size_t Ostap::Math::BasisCache::index
+( const Ostap::Math::BasisCache::Point& point ) const
+{
+  // the points are usually requested in the order of the dataset
+  const std::size_t last = m_last.load ( std::memory_order_relaxed ) ;
+  if ( last < m_points.size () && point == m_points [ last ] ) { return last ; }
+  if ( last + 1 < m_points.size () && point == m_points [ last + 1 ] )
+  {
+    m_last.store ( last + 1 , std::memory_order_relaxed ) ;
+    return last + 1 ;
+  }
+  //
+  auto it = m_index.find ( point ) ;
+  if ( m_index.end () == it ) { return s_npos ; }
+  //
+  m_last.store ( it->second , std::memory_order_relaxed ) ;
+  return it->second ;
+}
+// ============================================================================
+// get the function values for all points
+// ============================================================================
+std::shared_ptr<const Ostap::Math::BasisCache::Values>
+Ostap::Math::BasisCache::values ( const std::vector<double>& pars ) const
+{
+  std::shared_ptr<const Values> v = std::atomic_load ( &m_values ) ;
+  if ( v && v->pars == pars ) { return v ; }                         // RETURN
+  //
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  //
+  // somebody else could calculate it already
+  v = std::atomic_load ( &m_values ) ;
+  if ( v && v->pars == pars ) { return v ; }                         // RETURN
+  //
+  auto nv = std::make_shared<Values> () ;
+  nv -> pars = pars ;
+  nv -> values.resize ( m_points.size () ) ;
+  //
+  double*       result = nv->values.data () ;
+  const double* p      = pars.data () ;
+  const std::size_t nb = m_nbasis ;
+  if ( m_single )
+  {
+    const float* matrix = m_float.data () ;
+    Ostap::Utils::ThreadPool::parallel_for
+      ( m_points.size () ,
+        [=] ( const std::size_t begin , const std::size_t end )
+        { matvec ( matrix , p , nb , begin , end , result ) ; } , s_GRAIN ) ;
+  }
+  else
+  {
+    const double* matrix = m_double.data () ;
+    Ostap::Utils::ThreadPool::parallel_for
+      ( m_points.size () ,
+        [=] ( const std::size_t begin , const std::size_t end )
+        { matvec ( matrix , p , nb , begin , end , result ) ; } , s_GRAIN ) ;
+  }
+  //
+  v = nv ;
+  std::atomic_store ( &m_values , v ) ;
+  return v ;
+}
+// ============================================================================
+/*  get the function value for the point from the cache
+ *  @param point  the point
+ *  @param pars   the coefficients
+ *  @param result (OUTPUT) the function value
+ *  @return false if the point is not in the cache
+ */
+// ============================================================================
+bool Ostap::Math::BasisCache::value
+( const Ostap::Math::BasisCache::Point& point  ,
+  const std::vector<double>&            pars   ,
+  double&                               result ) const
+{
+  if ( pars.size () != m_nbasis || m_points.empty () ) { return false ; }
+  //
+  const std::size_t i = index ( point ) ;
+  if ( s_npos == i ) { return false ; }
+  //
+  result = values ( pars ) -> values [ i ] ;
+  return true ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -19,6 +19,7 @@
 #include "Exception.h"
 #include "local_math.h"
 #include "local_hash.h"
+#include "bernstein_utils.h"
 // ============================================================================
 /** @file 
  *  Implementation file for functions, related to Bernstein's polynomnials 
@@ -158,15 +159,14 @@ void Ostap::Math::Bernstein2D::swap ( Ostap::Math::Bernstein2D& right )
 // helper function to make calculations
 // ============================================================================
 double Ostap::Math::Bernstein2D::calculate
-( const std::vector<double>& fx , 
-  const std::vector<double>& fy ) const 
+( const double* fx , 
+  const double* fy ) const 
 {
-  double       result = 0 ;
-  for  ( unsigned short ix = 0 ; ix <= m_nx ; ++ix )
-  {
-    for  ( unsigned short iy = 0 ; iy <= m_ny ; ++iy )
-    { result += par ( ix , iy ) * fx[ix] * fy[iy] ; } 
-  }
+  const unsigned short ny     = m_ny + 1 ;
+  const double*        pars   = m_pars.data () ;
+  double               result = 0 ;
+  for  ( unsigned short ix = 0 ; ix <= m_nx ; ++ix , pars += ny )
+  { result += fx [ ix ] * Ostap::Math::Utils::b_dot ( pars , fy , ny ) ; }
   //
   const double scalex = ( m_nx + 1 ) / ( xmax () - xmin () ) ;
   const double scaley = ( m_ny + 1 ) / ( ymax () - ymin () ) ;
@@ -193,15 +193,40 @@ double Ostap::Math::Bernstein2D::evaluate
     return m_pars [0] * scalex * scaley ; 
   }
   //
-  std::vector<double> fx ( m_nx + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= m_nx ; ++i )
-  { fx[i] = m_bx[i] ( x )  ; }
+  Ostap::Math::Utils::b_buffer fx ( m_nx + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( m_ny + 1 ) ;
+  Ostap::Math::Utils::bernstein_basis ( m_nx , tx ( x ) , fx.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( m_ny , ty ( y ) , fy.data () ) ;
   //
-  std::vector<double> fy ( m_ny + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= m_ny ; ++i )
-  { fy[i] = m_by[i] ( y )  ; }
+  return calculate ( fx.data () , fy.data () ) ;
+}
+// ============================================================================
+// evaluate the polynomial for the batch of points 
+// ============================================================================
+void Ostap::Math::Bernstein2D::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  double*           result ) const 
+{
+  if ( npars () <= 1 ) 
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) { result [ i ] = evaluate ( x [ i ] , y [ i ] ) ; }
+    return ;
+  }
   //
-  return calculate ( fx  ,  fy ) ;
+  Ostap::Math::Utils::b_buffer fx ( m_nx + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( m_ny + 1 ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    if ( xi < m_xmin || xi > m_xmax || yi < m_ymin || yi > m_ymax ) 
+    { result [ i ] = 0 ; continue ; }
+    Ostap::Math::Utils::bernstein_basis ( m_nx , tx ( xi ) , fx.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( m_ny , ty ( yi ) , fy.data () ) ;
+    result [ i ] = calculate ( fx.data () , fy.data () ) ;
+  }
 }
 // ============================================================================
 /** get the integral over 2D-region 
@@ -515,8 +540,8 @@ void Ostap::Math::Bernstein2DSym::swap( Ostap::Math::Bernstein2DSym& right )
 // helper function to make calculations
 // ============================================================================
 double Ostap::Math::Bernstein2DSym::calculate
-( const std::vector<double>& fx , 
-  const std::vector<double>& fy ) const 
+( const double* fx , 
+  const double* fy ) const 
 {
   double       result = 0 ;
   for  ( unsigned short ix = 0 ; ix <= m_n ; ++ix )
@@ -549,15 +574,40 @@ double Ostap::Math::Bernstein2DSym::evaluate
     return m_pars [0] * ( scale * scale ) ;
   }
   ///
-  std::vector<double> fy ( m_n + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= m_n ; ++i )
-  { fy[i] = m_b[i] ( y ) ; }
+  Ostap::Math::Utils::b_buffer fx ( m_n + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( m_n + 1 ) ;
+  Ostap::Math::Utils::bernstein_basis ( m_n , tx ( x ) , fx.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( m_n , ty ( y ) , fy.data () ) ;
   //
-  std::vector<double> fx ( m_n + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= m_n ; ++i )
-  { fx[i] = m_b[i] ( x ) ; }
+  return calculate ( fx.data () , fy.data () ) ;
+}
+// ============================================================================
+// evaluate the polynomial for the batch of points 
+// ============================================================================
+void Ostap::Math::Bernstein2DSym::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  double*           result ) const 
+{
+  if ( npars () <= 1 ) 
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) { result [ i ] = evaluate ( x [ i ] , y [ i ] ) ; }
+    return ;
+  }
   //
-  return calculate ( fx , fy ) ;
+  Ostap::Math::Utils::b_buffer fx ( m_n + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( m_n + 1 ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    if ( xi < xmin () || xi > xmax () || yi < ymin () || yi > ymax () ) 
+    { result [ i ] = 0 ; continue ; }
+    Ostap::Math::Utils::bernstein_basis ( m_n , tx ( xi ) , fx.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( m_n , ty ( yi ) , fy.data () ) ;
+    result [ i ] = calculate ( fx.data () , fy.data () ) ;
+  }
 }
 // ============================================================================
 /* get the integral over 2D-region 
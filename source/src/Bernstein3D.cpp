@@ -14,6 +14,7 @@
 // ============================================================================
 #include "local_math.h"
 #include "local_hash.h"
+#include "bernstein_utils.h"
 // ============================================================================
 /** @file
  *  Implementation file for functions, related to Bernstein's polynomnials
@@ -221,20 +222,19 @@ void Ostap::Math::Bernstein3D::swap ( Ostap::Math::Bernstein3D&  right )
 // helper function to make calculations
 // ============================================================================
 double Ostap::Math::Bernstein3D::calculate
-( const std::vector<double>& fx , 
-  const std::vector<double>& fy , 
-  const std::vector<double>& fz ) const 
+( const double* fx , 
+  const double* fy , 
+  const double* fz ) const 
 {
-  double       result = 0 ;
+  const unsigned short nz     = nZ () + 1 ;
+  const double*        pars   = m_pars.data () ;
+  double               result = 0 ;
   for  ( unsigned short ix = 0 ; ix <= nX () ; ++ix )
   {
-    for  ( unsigned short iy = 0 ; iy <= nY () ; ++iy )
-    { 
-      for  ( unsigned short iz = 0 ; iz <= nZ () ; ++iz )
-      { 
-        result += par ( ix , iy , iz ) * fx[ix] * fy[iy] * fz[iz]; 
-      }
-    }
+    double r = 0 ;
+    for  ( unsigned short iy = 0 ; iy <= nY () ; ++iy , pars += nz )
+    { r += fy [ iy ] * Ostap::Math::Utils::b_dot ( pars , fz , nz ) ; }
+    result += fx [ ix ] * r ;
   }
   //
   const double scalex = ( nX () + 1 ) / ( xmax() - xmin() ) ;
@@ -266,19 +266,48 @@ double Ostap::Math::Bernstein3D::evaluate
     return m_pars [0] * scalex * scaley * scalez ;
   }
   ///
-  std::vector<double> fx ( nX () + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nX ()  ; ++i )
-  { fx[i] = m_bx[i] ( x )  ; }
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  Ostap::Math::Utils::bernstein_basis ( nX () , tx ( x ) , fx.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nY () , ty ( y ) , fy.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( z ) , fz.data () ) ;
   //
-  std::vector<double> fy ( nY ()  + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= nY ()  ; ++i )
-  { fy[i] = m_by[i] ( y )  ; }
-  //
-  std::vector<double> fz ( nZ () + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nZ () ; ++i )
-  { fz[i] = m_bz[i] ( z )  ; }
+  return calculate ( fx.data () , fy.data () , fz.data () ) ;
+}
+// ============================================================================
+// evaluate the polynomial for the batch of points 
+// ============================================================================
+void Ostap::Math::Bernstein3D::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  const double*     z      , 
+  double*           result ) const 
+{
+  if ( npars () <= 1 ) 
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) 
+    { result [ i ] = evaluate ( x [ i ] , y [ i ] , z [ i ] ) ; }
+    return ;
+  }
   //
-  return calculate ( fx , fy , fz ) ;
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    const double zi = z [ i ] ;
+    if ( xi < xmin () || xi > xmax () || 
+         yi < ymin () || yi > ymax () || 
+         zi < zmin () || zi > zmax () ) { result [ i ] = 0 ; continue ; }
+    Ostap::Math::Utils::bernstein_basis ( nX () , tx ( xi ) , fx.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nY () , ty ( yi ) , fy.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( zi ) , fz.data () ) ;
+    result [ i ] = calculate ( fx.data () , fy.data () , fz.data () ) ;
+  }
 }
 
 // ============================================================================
@@ -897,9 +926,9 @@ void Ostap::Math::Bernstein3DSym::swap
 // helper function to make calculations
 // ============================================================================
 double Ostap::Math::Bernstein3DSym::calculate
-( const std::vector<double>& fx , 
-  const std::vector<double>& fy , 
-  const std::vector<double>& fz ) const 
+( const double* fx , 
+  const double* fy , 
+  const double* fz ) const 
 {
   double       result = 0 ;
   for  ( unsigned short ix = 0 ; ix <= nX ()  ; ++ix )
@@ -967,19 +996,48 @@ double Ostap::Math::Bernstein3DSym::evaluate
     return m_pars [0] * scale * scale * scale ;
   }
   ///
-  std::vector<double> fx ( nX () + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= nX () ; ++i )
-  { fx[i] = m_b [i] ( x )  ; }
-  //
-  std::vector<double> fy ( nY () + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= nY ()  ; ++i )
-  { fy[i] = m_b [i] ( y )  ; }
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  Ostap::Math::Utils::bernstein_basis ( nX () , tx ( x ) , fx.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nY () , ty ( y ) , fy.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( z ) , fz.data () ) ;
   //
-  std::vector<double> fz ( nZ () + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nZ () ; ++i )
-  { fz[i] = m_b [i] ( z )  ; }
+  return calculate ( fx.data () , fy.data () , fz.data () ) ;
+}
+// ============================================================================
+// evaluate the polynomial for the batch of points 
+// ============================================================================
+void Ostap::Math::Bernstein3DSym::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  const double*     z      , 
+  double*           result ) const 
+{
+  if ( npars () <= 1 ) 
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) 
+    { result [ i ] = evaluate ( x [ i ] , y [ i ] , z [ i ] ) ; }
+    return ;
+  }
   //
-  return calculate ( fx , fy , fz ) ;
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    const double zi = z [ i ] ;
+    if ( xi < xmin () || xi > xmax () || 
+         yi < ymin () || yi > ymax () || 
+         zi < zmin () || zi > zmax () ) { result [ i ] = 0 ; continue ; }
+    Ostap::Math::Utils::bernstein_basis ( nX () , tx ( xi ) , fx.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nY () , ty ( yi ) , fy.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( zi ) , fz.data () ) ;
+    result [ i ] = calculate ( fx.data () , fy.data () , fz.data () ) ;
+  }
 }
 // ============================================================================
 /** get the integral over 3D-region
@@ -1396,9 +1454,9 @@ void Ostap::Math::Bernstein3DMix::swap
 // helper function to make calculations
 // ============================================================================
 double Ostap::Math::Bernstein3DMix::calculate
-( const std::vector<double>& fx , 
-  const std::vector<double>& fy , 
-  const std::vector<double>& fz ) const 
+( const double* fx , 
+  const double* fy , 
+  const double* fz ) const 
 {
   double       result = 0 ;
   for  ( unsigned short ix = 0 ; ix <= nX () ; ++ix )
@@ -1452,19 +1510,48 @@ double Ostap::Math::Bernstein3DMix::evaluate
     return m_pars [0] * scalex * scaley * scalez ;
   }
   ///
-  std::vector<double> fx ( nX () + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nX () ; ++i )
-  { fx[i] = m_b [i] ( x )  ; }
-  //
-  std::vector<double> fy ( nY () + 1 , 0 ) ;
-  for ( unsigned short i = 0 ; i <= nY () ; ++i )
-  { fy[i] = m_b [i] ( y )  ; }
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  Ostap::Math::Utils::bernstein_basis ( nX () , tx ( x ) , fx.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nY () , ty ( y ) , fy.data () ) ;
+  Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( z ) , fz.data () ) ;
   //
-  std::vector<double> fz ( nZ () + 1 , 0 ) ;
-  for  ( unsigned short i = 0 ; i <= nZ () ; ++i )
-  { fz[i] = m_bz[i] ( z )  ; }
+  return calculate ( fx.data () , fy.data () , fz.data () ) ;
+}
+// ============================================================================
+// evaluate the polynomial for the batch of points 
+// ============================================================================
+void Ostap::Math::Bernstein3DMix::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  const double*     z      , 
+  double*           result ) const 
+{
+  if ( npars () <= 1 ) 
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) 
+    { result [ i ] = evaluate ( x [ i ] , y [ i ] , z [ i ] ) ; }
+    return ;
+  }
   //
-  return calculate ( fx , fy , fz ) ;
+  Ostap::Math::Utils::b_buffer fx ( nX () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fy ( nY () + 1 ) ;
+  Ostap::Math::Utils::b_buffer fz ( nZ () + 1 ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    const double zi = z [ i ] ;
+    if ( xi < xmin () || xi > xmax () || 
+         yi < ymin () || yi > ymax () || 
+         zi < zmin () || zi > zmax () ) { result [ i ] = 0 ; continue ; }
+    Ostap::Math::Utils::bernstein_basis ( nX () , tx ( xi ) , fx.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nY () , ty ( yi ) , fy.data () ) ;
+    Ostap::Math::Utils::bernstein_basis ( nZ () , tz ( zi ) , fz.data () ) ;
+    result [ i ] = calculate ( fx.data () , fy.data () , fz.data () ) ;
+  }
 }
 // ============================================================================
 /** get the integral over 3D-region
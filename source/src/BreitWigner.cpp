@@ -16,6 +16,7 @@
 #include "Ostap/DalitzIntegrator.h"
 #include "Ostap/Workspace.h"
 #include "Ostap/Models.h"
+#include "Ostap/TabulatedFunction.h"
 // ============================================================================
 // local
 // ============================================================================
@@ -577,6 +578,28 @@ Ostap::Math::ChannelWidth*
 Ostap::Math::ChannelWidth::clone () const
 { return new Ostap::Math::ChannelWidth ( *this ) ; }
 // ============================================================================
+// get the copy of the channel with the tabulated width 
+// ============================================================================
+Ostap::Math::ChannelWidth*
+Ostap::Math::ChannelWidth::tabulated
+( const double smax      , 
+  const double precision ) const
+{
+  if ( smax <= m_sthreshold ) { return nullptr ; }
+  //
+  typedef Ostap::Math::TabulatedFunction TF ;
+  const TF* tf = m_w.target<TF> () ;
+  // already tabulated in this range ? 
+  if ( tf && smax <= tf->xmax () && tf->precision () <= precision ) { return nullptr ; }
+  //
+  return new Ostap::Math::ChannelWidth 
+    ( gamma0 () , 
+      TF ( tf ? tf->function () : m_w , m_sthreshold , smax , precision ) , 
+      m_sthreshold , 
+      std::hash_combine ( m_tag , smax , precision ) , 
+      m_description ) ;
+}
+// ============================================================================
 // unique tag for this lineshape 
 // ============================================================================
 std::size_t Ostap::Math::ChannelWidth::tag () const
@@ -615,6 +638,28 @@ Ostap::Math::ChannelGamma*
 Ostap::Math::ChannelGamma::clone () const
 { return new Ostap::Math::ChannelGamma ( *this ) ; }
 // ============================================================================
+// get the copy of the channel with the tabulated width 
+// ============================================================================
+Ostap::Math::ChannelGamma*
+Ostap::Math::ChannelGamma::tabulated
+( const double smax      , 
+  const double precision ) const
+{
+  if ( smax <= m_sthreshold ) { return nullptr ; }
+  //
+  typedef Ostap::Math::TabulatedFunction TF ;
+  const TF* tf = m_gamma.target<TF> () ;
+  // already tabulated in this range ? 
+  if ( tf && smax <= tf->xmax () && tf->precision () <= precision ) { return nullptr ; }
+  //
+  return new Ostap::Math::ChannelGamma 
+    ( gamma0 () , 
+      TF ( tf ? tf->function () : m_gamma , m_sthreshold , smax , precision ) , 
+      m_sthreshold , 
+      std::hash_combine ( m_tag , smax , precision ) , 
+      m_description ) ;
+}
+// ============================================================================
 // unique tag for this lineshape 
 // ============================================================================
 std::size_t Ostap::Math::ChannelGamma::tag () const
@@ -1077,6 +1122,9 @@ Ostap::Math::BW::BW
 ( const Ostap::Math::BW& bw ) 
   : m_m0         ( bw.m_m0        ) 
   , m_threshold  ( bw.m_threshold )
+  , m_tab_mmax      ( bw.m_tab_mmax      ) 
+  , m_tab_precision ( bw.m_tab_precision ) 
+  , m_tab_range     ( bw.m_tab_range     ) 
   , m_channels   ( ) 
   , m_workspace  ( 10000 )
 {
@@ -1109,6 +1157,48 @@ std::size_t Ostap::Math::BW::tag() const
   return seed ;
 }
 // ============================================================================
+/*  replace the channels with expensive mass-dependent functions 
+ *  (e.g. running widths from 3-body decays) by their tabulated versions
+ *  @param mmax      the upper edge of the tabulation range in mass 
+ *  @param precision the relative precision of the interpolation 
+ *  @return number of tabulated channels 
+ */
+// ============================================================================
+unsigned int Ostap::Math::BW::tabulate
+( const double mmax      , 
+  const double precision ) 
+{
+  Ostap::Assert ( 0 < precision                 , 
+                  "Invalid precision"           , 
+                  "Ostap::Math::BW::tabulate"   ) ;
+  m_tab_mmax      = std::abs ( mmax ) ;
+  m_tab_precision = precision         ;
+  return retabulate () ;
+}
+// ============================================================================
+/*  (re)build the tables according to the current settings and pole position 
+ *  - the pole position must be inside the tables, since 
+ *    \f$ w(m_0^2)\f$ is used for each evaluation 
+ */
+// ============================================================================
+unsigned int Ostap::Math::BW::retabulate () 
+{
+  if ( m_tab_precision <= 0 ) { return 0 ; }
+  //
+  m_tab_range = m_m0 < m_tab_mmax ? m_tab_mmax : 1.25 * m_m0 ;
+  const double smax = m_tab_range * m_tab_range ;
+  //
+  unsigned int n = 0 ;
+  for ( auto& c : m_channels ) 
+  {
+    std::unique_ptr<ChannelBW> t { c->tabulated ( smax , m_tab_precision ) } ;
+    if ( !t ) { continue ; }
+    c = std::move ( t ) ;
+    ++n ;
+  }
+  return n ;
+}
+// ============================================================================
 // get factor \f$ \varrho(s,m_n^2) \f$ from the main channel 
 // ============================================================================
 double Ostap::Math::BW::rho_s ( const double s ) const
@@ -1164,6 +1254,8 @@ bool Ostap::Math::BW::setM0     ( const double x )
   const double v       = std::abs ( x ) ;
   if ( s_equal ( v , m_m0 ) ) { return false ; } // RETURN
   m_m0   = v ;
+  // the pole is outside the tables? rebuild them 
+  if ( 0 < m_tab_precision && m_tab_range < m_m0 ) { retabulate () ; }
   return true ;
 }
 // ============================================================================
@@ -2157,6 +2249,18 @@ Ostap::Math::Channel23L*
 Ostap::Math::Channel23L::clone () const 
 { return new Ostap::Math::Channel23L(*this) ; }
 // ============================================================================
+// get the copy of the channel with the tabulated original channel 
+// ============================================================================
+Ostap::Math::Channel23L*
+Ostap::Math::Channel23L::tabulated
+( const double smax      , 
+  const double precision ) const
+{
+  std::unique_ptr<Ostap::Math::ChannelBW> ch { m_channel->tabulated ( smax , precision ) } ;
+  if ( !ch ) { return nullptr ; }
+  return new Ostap::Math::Channel23L ( *ch , m_ps ) ;
+}
+// ============================================================================
 // unique tag for this lineshape 
 // ============================================================================
 std::size_t Ostap::Math::Channel23L::tag () const
@@ -2544,6 +2648,35 @@ Ostap::Math::ChannelGLR*
 Ostap::Math::ChannelGLR::clone() const
 { return new ChannelGLR ( *this ) ; }
 // ============================================================================
+// get the copy of the channel with all functions tabulated 
+// ============================================================================
+Ostap::Math::ChannelGLR*
+Ostap::Math::ChannelGLR::tabulated
+( const double smax      , 
+  const double precision ) const
+{
+  if ( smax <= m_sthreshold ) { return nullptr ; }
+  //
+  typedef Ostap::Math::TabulatedFunction TF ;
+  const TF* tf = m_fN2.target<TF> () ;
+  // already tabulated in this range ? 
+  if ( tf && smax <= tf->xmax () && tf->precision () <= precision ) { return nullptr ; }
+  //
+  // the original (not tabulated) function 
+  auto original = [] ( const std::function<double(double)>& f ) -> std::function<double(double)>
+  { const TF* t = f.target<TF> () ; return t ? t->function () : f ; } ;
+  //
+  return new Ostap::Math::ChannelGLR 
+    ( gamma0 () , 
+      TF ( original ( m_fN2  ) , m_sthreshold , smax , precision ) , 
+      TF ( original ( m_fD   ) , m_sthreshold , smax , precision ) , 
+      TF ( original ( m_fL   ) , m_sthreshold , smax , precision ) , 
+      TF ( original ( m_fRho ) , m_sthreshold , smax , precision ) , 
+      m_sthreshold  , 
+      m_description , 
+      std::hash_combine ( m_tag , smax , precision ) ) ;
+}
+// ============================================================================
 // unique tag for this lineshape 
 // ============================================================================
 std::size_t Ostap::Math::ChannelGLR::tag () const
@@ -4,6 +4,7 @@
 // =============================================================================
 // STD & STL
 // =============================================================================
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <sstream>
@@ -21,9 +22,11 @@
 #include "Ostap/Hesse.h"
 #include "Ostap/GSL_utils.h"
 #include "Ostap/Chi2Fit.h"
+#include "Ostap/ThreadPool.h"
 // =============================================================================
 // Local
 // =============================================================================
+#include "Exception.h"
 #include "GSL_sentry.h"
 // =============================================================================
 /** @file  
@@ -263,7 +266,7 @@ namespace
         dh +=   2              / cov2        * drdj * drdk ; 
         dh += - 2 * rv  / cov2 / cov2        * drdj * dsdk ;
         dh += - 2 * rv  / cov2 / cov2        * drdk * dsdj ;
-        dh += - 2 * rv2 / cov2 / cov2 / cov2 * dsdj * dsdk ;
+        dh +=   2 * rv2 / cov2 / cov2 / cov2 * dsdj * dsdk ;
         //
         const double hjk = gsl_matrix_get ( h , j , k ) ;
         //
@@ -831,5 +834,705 @@ std::string Ostap::Math::Chi2Fit::toString () const
   return s.str();
 }
 // ============================================================================
+// Chi2FitBatch
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// maximal number of Newton iterations for the direct solver
+  const std::size_t s_MAXITERS  = 100     ;
+  /// tolerance for the step
+  const double      s_STEP_TOL  = 1.e-10  ;
+  /// tolerance for the function
+  const double      s_CHI2_TOL  = 1.e-12  ;
+  // ==========================================================================
+  /** in-place Cholesky decomposition of the small dense
+   *  symmetric matrix (only the selected rows/columns)
+   *  @param a   (INPUT/OUTPUT) the matrix, row-major
+   *  @param n   the size of matrix
+   *  @param use the selected rows/columns
+   *  @return false if the matrix is not positive definite
+   */
+  bool cholesky
+  ( std::vector<double>&      a   ,
+    const std::size_t         n   ,
+    const std::vector<char>&  use )
+  {
+    for ( std::size_t j = 0 ; j < n ; ++j )
+    {
+      if ( !use [ j ] ) { continue ; }
+      double d = a [ j * n + j ] ;
+      for ( std::size_t k = 0 ; k < j ; ++k )
+      { if ( use [ k ] ) { d -= a [ j * n + k ] * a [ j * n + k ] ; } }
+      if ( !( 0 < d ) ) { return false ; }                          // RETURN
+      d = std::sqrt ( d ) ;
+      a [ j * n + j ] = d ;
+      for ( std::size_t i = j + 1 ; i < n ; ++i )
+      {
+        if ( !use [ i ] ) { continue ; }
+        double v = a [ i * n + j ] ;
+        for ( std::size_t k = 0 ; k < j ; ++k )
+        { if ( use [ k ] ) { v -= a [ i * n + k ] * a [ j * n + k ] ; } }
+        a [ i * n + j ] = v / d ;
+      }
+    }
+    return true ;
+  }
+  // ==========================================================================
+  /// solve L*L^T*x = b for the selected components (in-place)
+  void cholesky_solve
+  ( const std::vector<double>& l   ,
+    const std::size_t          n   ,
+    const std::vector<char>&   use ,
+    std::vector<double>&       b   )
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i )
+    {
+      if ( !use [ i ] ) { continue ; }
+      double v = b [ i ] ;
+      for ( std::size_t k = 0 ; k < i ; ++k )
+      { if ( use [ k ] ) { v -= l [ i * n + k ] * b [ k ] ; } }
+      b [ i ] = v / l [ i * n + i ] ;
+    }
+    for ( std::size_t ii = n ; 0 < ii ; --ii )
+    {
+      const std::size_t i = ii - 1 ;
+      if ( !use [ i ] ) { continue ; }
+      double v = b [ i ] ;
+      for ( std::size_t k = i + 1 ; k < n ; ++k )
+      { if ( use [ k ] ) { v -= l [ k * n + i ] * b [ k ] ; } }
+      b [ i ] = v / l [ i * n + i ] ;
+    }
+  }
+  // ==========================================================================
+  /** @class Problem
+   *  helper class to evaluate chi2, its gradient and hessian for
+   *  one problem from Ostap::Math::Chi2FitBatch
+   */
+  class Problem
+  {
+  public:
+    // ========================================================================
+    Problem
+    ( const std::size_t npoints ,
+      const std::size_t ncmps   ,
+      const double*     values  ,
+      const double*     cov2    ,
+      const double*     cvalues ,
+      const double*     ccov2   ,
+      const bool        exact   )
+      : m_npoints ( npoints )
+      , m_ncmps   ( ncmps   )
+      , m_values  ( values  )
+      , m_cov2    ( cov2    )
+      , m_cvalues ( cvalues )
+      , m_ccov2   ( ccov2   )
+      , m_exact   ( exact   )
+    {}
+    // ========================================================================
+    /// the function value
+    double f ( const std::vector<double>& a , std::size_t& points ) const
+    {
+      double chi2 = 0 ;
+      points      = 0 ;
+      for ( std::size_t i = 0 ; i < m_npoints ; ++i )
+      {
+        double r = m_values [ i ] ;
+        double s = m_cov2   [ i ] ;
+        for ( std::size_t j = 0 ; j < m_ncmps ; ++j )
+        {
+          r -= a [ j ] * m_cvalues [ j * m_npoints + i ] ;
+          if ( !m_exact ) { s += a [ j ] * a [ j ] * m_ccov2 [ j * m_npoints + i ] ; }
+        }
+        if ( 0 >= s ) { continue ; }                                // CONTINUE
+        chi2 += r * r / s ;
+        ++points ;
+      }
+      return chi2 ;
+    }
+    // ========================================================================
+    /** the function, gradient, exact hessian and Gauss-Newton hessian
+     *  @see term_grad
+     *  @see term_hesse
+     */
+    double fdfddf
+    ( const std::vector<double>& a      ,
+      std::vector<double>&       g      ,
+      std::vector<double>&       h      ,
+      std::vector<double>&       hgn    ,
+      std::size_t&               points ) const
+    {
+      const std::size_t n = m_ncmps ;
+      std::fill ( g  .begin () , g  .end () , 0.0 ) ;
+      std::fill ( h  .begin () , h  .end () , 0.0 ) ;
+      std::fill ( hgn.begin () , hgn.end () , 0.0 ) ;
+      //
+      double chi2 = 0 ;
+      points      = 0 ;
+      for ( std::size_t i = 0 ; i < m_npoints ; ++i )
+      {
+        double r = m_values [ i ] ;
+        double s = m_cov2   [ i ] ;
+        for ( std::size_t j = 0 ; j < n ; ++j )
+        {
+          r -= a [ j ] * m_cvalues [ j * m_npoints + i ] ;
+          if ( !m_exact ) { s += a [ j ] * a [ j ] * m_ccov2 [ j * m_npoints + i ] ; }
+        }
+        if ( 0 >= s ) { continue ; }                                // CONTINUE
+        //
+        const double r2 = r * r ;
+        chi2 += r2 / s ;
+        ++points ;
+        //
+        for ( std::size_t j = 0 ; j < n ; ++j )
+        {
+          const double drdj = - m_cvalues [ j * m_npoints + i ] ;
+          const double sj   = m_exact ? 0.0 : m_ccov2 [ j * m_npoints + i ] ;
+          const double dsdj = 2 * a [ j ] * sj ;
+          //
+          g [ j ] += 2 * r / s * drdj - r2 / ( s * s ) * dsdj ;
+          //
+          for ( std::size_t k = j ; k < n ; ++k )
+          {
+            const double drdk = - m_cvalues [ k * m_npoints + i ] ;
+            const double dsdk = m_exact ? 0.0 : 2 * a [ k ] * m_ccov2 [ k * m_npoints + i ] ;
+            const double gn   = 2 / s * drdj * drdk ;
+            //
+            double dh = gn ;
+            if ( !m_exact )
+            {
+              if ( j == k ) { dh -= r2 / ( s * s ) * 2 * sj ; }
+              dh -= 2 * r  / ( s * s )     * ( drdj * dsdk + drdk * dsdj ) ;
+              dh += 2 * r2 / ( s * s * s ) * dsdj * dsdk ;
+            }
+            //
+            h   [ j * n + k ] += dh ;
+            hgn [ j * n + k ] += gn ;
+          }
+        }
+      }
+      // symmetrize
+      for ( std::size_t j = 0 ; j < n ; ++j )
+      {
+        for ( std::size_t k = j + 1 ; k < n ; ++k )
+        {
+          h   [ k * n + j ] = h   [ j * n + k ] ;
+          hgn [ k * n + j ] = hgn [ j * n + k ] ;
+        }
+      }
+      return chi2 ;
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    std::size_t   m_npoints ;
+    std::size_t   m_ncmps   ;
+    const double* m_values  ;
+    const double* m_cov2    ;
+    const double* m_cvalues ;
+    const double* m_ccov2   ;
+    bool          m_exact   ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** minimize the quadratic model
+   *  \f$ q(x) = g^T(x-a) + \frac{1}{2}(x-a)^T H (x-a) \f$
+   *  within the box \f$ l \le x \le h \f$ using the primal active-set method
+   *  @param a    the current point (feasible)
+   *  @param g    the gradient at the current point
+   *  @param h    the (positive definite) hessian
+   *  @param low  the low  limits
+   *  @param high the high limits
+   *  @param x    (OUTPUT) the minimum of the model
+   *  @param free (OUTPUT) the parameters that are not at the limits
+   *  @return false if the reduced hessian is not positive definite
+   */
+  bool box_qp
+  ( const std::vector<double>& a    ,
+    const std::vector<double>& g    ,
+    const std::vector<double>& h    ,
+    const std::vector<double>& low  ,
+    const std::vector<double>& high ,
+    std::vector<double>&       x    ,
+    std::vector<char>&         free )
+  {
+    const std::size_t n = a.size () ;
+    x = a ;
+    // the initial active set: at the limit and the gradient points outside
+    for ( std::size_t j = 0 ; j < n ; ++j )
+    {
+      free [ j ] = !( ( x [ j ] <= low  [ j ] && 0 < g [ j ] ) ||
+                      ( x [ j ] >= high [ j ] && 0 > g [ j ] ) ) ;
+    }
+    //
+    std::vector<double> gq ( n ) ;
+    std::vector<double> p  ( n ) ;
+    std::vector<double> l  ( n * n ) ;
+    //
+    auto model_gradient = [&] ()
+    {
+      for ( std::size_t j = 0 ; j < n ; ++j )
+      {
+        double v = g [ j ] ;
+        for ( std::size_t k = 0 ; k < n ; ++k ) { v += h [ j * n + k ] * ( x [ k ] - a [ k ] ) ; }
+        gq [ j ] = v ;
+      }
+    } ;
+    //
+    for ( std::size_t iter = 0 ; iter < 10 * n + 10 ; ++iter )
+    {
+      model_gradient () ;
+      //
+      bool any = false ;
+      for ( std::size_t j = 0 ; j < n ; ++j ) { any = any || free [ j ] ; }
+      //
+      if ( any )
+      {
+        l = h ;
+        if ( !cholesky ( l , n , free ) ) { return false ; }        // RETURN
+        for ( std::size_t j = 0 ; j < n ; ++j ) { p [ j ] = free [ j ] ? -gq [ j ] : 0.0 ; }
+        cholesky_solve ( l , n , free , p ) ;
+        //
+        // the longest feasible step
+        double      alpha = 1      ;
+        std::size_t block = n      ;
+        bool        upper = false  ;
+        for ( std::size_t j = 0 ; j < n ; ++j )
+        {
+          if ( !free [ j ] ) { continue ; }
+          if      ( 0 > p [ j ] && x [ j ] + alpha * p [ j ] < low  [ j ] )
+          { alpha = ( low  [ j ] - x [ j ] ) / p [ j ] ; block = j ; upper = false ; }
+          else if ( 0 < p [ j ] && x [ j ] + alpha * p [ j ] > high [ j ] )
+          { alpha = ( high [ j ] - x [ j ] ) / p [ j ] ; block = j ; upper = true  ; }
+        }
+        alpha = std::max ( alpha , 0.0 ) ;
+        for ( std::size_t j = 0 ; j < n ; ++j )
+        { if ( free [ j ] ) { x [ j ] = std::min ( std::max ( x [ j ] + alpha * p [ j ] , low [ j ] ) , high [ j ] ) ; } }
+        //
+        if ( block < n )
+        {
+          x    [ block ] = upper ? high [ block ] : low [ block ] ;
+          free [ block ] = false ;
+          continue ;                                                // CONTINUE
+        }
+        model_gradient () ;
+      }
+      //
+      // check the multipliers for the active constraints
+      std::size_t release = n ;
+      double      worst   = 0 ;
+      for ( std::size_t j = 0 ; j < n ; ++j )
+      {
+        if ( free [ j ] ) { continue ; }
+        const double v = x [ j ] <= low [ j ] ? -gq [ j ] : gq [ j ] ;
+        if ( v > worst ) { worst = v ; release = j ; }
+      }
+      if ( n == release ) { return true ; }                         // RETURN
+      free [ release ] = true ;
+    }
+    //
+    return true ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor
+ *  @param npoints number of points in each data vector
+ *  @param ncmps   number of components
+ */
+// ============================================================================
+Ostap::Math::Chi2FitBatch::Chi2FitBatch
+( const unsigned int   npoints ,
+  const unsigned short ncmps   )
+  : m_npoints  ( npoints )
+  , m_ncmps    ( ncmps   )
+  , m_low      ( ncmps , -s_Inf )
+  , m_high     ( ncmps ,  s_Inf )
+  , m_values   ()
+  , m_cov2     ()
+  , m_cvalues  ()
+  , m_ccov2    ()
+  , m_exact    ()
+  , m_status   ()
+  , m_solu     ()
+  , m_covs     ()
+  , m_chi2     ()
+  , m_iters    ()
+  , m_points   ()
+  , m_fallback ()
+{
+  Ostap::Assert ( 0 < npoints && 0 < ncmps                ,
+                  "Invalid number of points/components!"  ,
+                  "Ostap::Math::Chi2FitBatch"             ) ;
+}
+// ============================================================================
+/*  add the problem
+ *  @param data the data vector
+ *  @param cmps the components
+ *  @return the index of the problem
+ */
+// ============================================================================
+std::size_t Ostap::Math::Chi2FitBatch::add
+( const Ostap::Math::Chi2FitBatch::DATA& data ,
+  const Ostap::Math::Chi2FitBatch::CMPS& cmps )
+{
+  Ostap::Assert ( data.size () == m_npoints && cmps.size () == m_ncmps ,
+                  "Invalid size of data/components!"                   ,
+                  "Ostap::Math::Chi2FitBatch"                          ) ;
+  //
+  std::vector<double> values  ( m_npoints           ) ;
+  std::vector<double> cov2    ( m_npoints           ) ;
+  std::vector<double> cvalues ( m_npoints * m_ncmps ) ;
+  std::vector<double> ccov2   ( m_npoints * m_ncmps ) ;
+  //
+  for ( std::size_t i = 0 ; i < m_npoints ; ++i )
+  {
+    values [ i ] = data [ i ].value () ;
+    cov2   [ i ] = data [ i ].cov2  () ;
+  }
+  for ( std::size_t j = 0 ; j < m_ncmps ; ++j )
+  {
+    const DATA& cmp = cmps [ j ] ;
+    Ostap::Assert ( cmp.size () == m_npoints       ,
+                    "Invalid size of component!"   ,
+                    "Ostap::Math::Chi2FitBatch"    ) ;
+    for ( std::size_t i = 0 ; i < m_npoints ; ++i )
+    {
+      cvalues [ j * m_npoints + i ] = cmp [ i ].value () ;
+      ccov2   [ j * m_npoints + i ] = cmp [ i ].cov2  () ;
+    }
+  }
+  //
+  return add ( values.data () , cov2.data () , cvalues.data () , ccov2.data () ) ;
+}
+// ============================================================================
+/*  add the problem (SoA)
+ *  @param values  the data values            [npoints]
+ *  @param cov2    the data cov2              [npoints]
+ *  @param cvalues the component values       [ncmps*npoints], component by component
+ *  @param ccov2   the component cov2         [ncmps*npoints], nullptr for exact templates
+ *  @return the index of the problem
+ */
+// ============================================================================
+std::size_t Ostap::Math::Chi2FitBatch::add
+( const double* values  ,
+  const double* cov2    ,
+  const double* cvalues ,
+  const double* ccov2   )
+{
+  Ostap::Assert ( nullptr != values && nullptr != cov2 && nullptr != cvalues ,
+                  "Invalid data!"                                           ,
+                  "Ostap::Math::Chi2FitBatch"                               ) ;
+  //
+  const std::size_t nc = m_npoints * std::size_t ( m_ncmps ) ;
+  //
+  m_values .insert ( m_values .end () , values  , values  + m_npoints ) ;
+  m_cov2   .insert ( m_cov2   .end () , cov2    , cov2    + m_npoints ) ;
+  m_cvalues.insert ( m_cvalues.end () , cvalues , cvalues + nc        ) ;
+  //
+  // the negative uncertainties of templates are ignored (as for VE::operator-=)
+  bool exact = true ;
+  if ( nullptr == ccov2 ) { m_ccov2.insert ( m_ccov2.end () , nc , 0.0 ) ; }
+  else
+  {
+    for ( std::size_t k = 0 ; k < nc ; ++k )
+    {
+      const double c2 = std::max ( ccov2 [ k ] , 0.0 ) ;
+      exact = exact && 0 == c2 ;
+      m_ccov2.push_back ( c2 ) ;
+    }
+  }
+  m_exact.push_back ( exact ) ;
+  //
+  m_status  .push_back ( Ostap::StatusCode ( 500 ) ) ;
+  m_solu    .insert    ( m_solu.end () , m_ncmps           , 0.0 ) ;
+  m_covs    .insert    ( m_covs.end () , m_ncmps * m_ncmps , 0.0 ) ;
+  m_chi2    .push_back ( s_Inf ) ;
+  m_iters   .push_back ( 0     ) ;
+  m_points  .push_back ( 0     ) ;
+  m_fallback.push_back ( false ) ;
+  //
+  return m_chi2.size () - 1 ;
+}
+// ============================================================================
+/*  set the limits for the parameter (for all problems)
+ *  @param index the parameter index
+ *  @param low   the low  limit
+ *  @param high  the high limit
+ */
+// ============================================================================
+void Ostap::Math::Chi2FitBatch::setLimits
+( const unsigned short index ,
+  const double         low   ,
+  const double         high  )
+{
+  Ostap::Assert ( index < m_ncmps && low <= high        ,
+                  "Invalid parameter index or limits!"  ,
+                  "Ostap::Math::Chi2FitBatch"           ) ;
+  m_low  [ index ] = low  ;
+  m_high [ index ] = high ;
+}
+// ============================================================================
+// remove all problems
+// ============================================================================
+void Ostap::Math::Chi2FitBatch::clear ()
+{
+  m_values  .clear () ;
+  m_cov2    .clear () ;
+  m_cvalues .clear () ;
+  m_ccov2   .clear () ;
+  m_exact   .clear () ;
+  m_status  .clear () ;
+  m_solu    .clear () ;
+  m_covs    .clear () ;
+  m_chi2    .clear () ;
+  m_iters   .clear () ;
+  m_points  .clear () ;
+  m_fallback.clear () ;
+}
+// ============================================================================
+/*  fit all problems
+ *  @return number of failed fits
+ */
+// ============================================================================
+std::size_t Ostap::Math::Chi2FitBatch::fit ()
+{
+  const std::size_t nprob = size () ;
+  // (1) direct solvers: in parallel
+  Ostap::Utils::ThreadPool::parallel_for
+    ( nprob ,
+      [this] ( const std::size_t begin , const std::size_t end )
+      { for ( std::size_t i = begin ; i < end ; ++i ) { m_status [ i ] = solve ( i ) ; } } ,
+      std::max ( std::size_t ( 1 ) , 2048 / ( m_npoints * std::size_t ( m_ncmps ) + 1 ) ) ) ;
+  //
+  // (2) the iterative minimiser for the unconstrained problems
+  //     (sequentially: the GSL error handler is global)
+  bool constrained = false ;
+  for ( std::size_t j = 0 ; j < m_ncmps ; ++j )
+  { constrained = constrained || -s_Inf < m_low [ j ] || m_high [ j ] < s_Inf ; }
+  //
+  std::size_t nfail = 0 ;
+  for ( std::size_t i = 0 ; i < nprob ; ++i )
+  {
+    if ( m_status [ i ].isFailure () && !constrained ) { m_status [ i ] = iterate ( i ) ; }
+    if ( m_status [ i ].isFailure () ) { ++nfail ; }
+  }
+  //
+  return nfail ;
+}
+// ============================================================================
+// solve one problem directly
+// ============================================================================
+Ostap::StatusCode Ostap::Math::Chi2FitBatch::solve ( const std::size_t i )
+{
+  const std::size_t n  = m_ncmps   ;
+  const std::size_t np = m_npoints ;
+  //
+  const Problem problem ( np , n                    ,
+                          &m_values  [ i * np     ] ,
+                          &m_cov2    [ i * np     ] ,
+                          &m_cvalues [ i * np * n ] ,
+                          &m_ccov2   [ i * np * n ] ,
+                          m_exact    [ i          ] ) ;
+  //
+  // start from zero (or the closest limit)
+  std::vector<double> a ( n ) ;
+  for ( std::size_t j = 0 ; j < n ; ++j )
+  { a [ j ] = std::min ( std::max ( 0.0 , m_low [ j ] ) , m_high [ j ] ) ; }
+  //
+  std::vector<double> g    ( n     ) ;
+  std::vector<double> h    ( n * n ) ;
+  std::vector<double> hgn  ( n * n ) ;
+  std::vector<double> x    ( n     ) ;
+  std::vector<double> t    ( n     ) ;
+  std::vector<char>   free ( n     ) ;
+  //
+  std::size_t points    = 0     ;
+  bool        converged = false ;
+  std::size_t iter      = 0     ;
+  double      chi2      = s_Inf ;
+  //
+  while ( !converged && iter < s_MAXITERS )
+  {
+    ++iter ;
+    chi2 = problem.fdfddf ( a , g , h , hgn , points ) ;
+    if ( 0 == points ) { return Ostap::StatusCode ( 501 ) ; }      // RETURN
+    //
+    // the Newton step with the exact hessian or the Gauss-Newton step
+    double slope = 0 ;
+    bool   ok    = box_qp ( a , g , h , m_low , m_high , x , free ) ;
+    if ( ok )
+    {
+      for ( std::size_t j = 0 ; j < n ; ++j ) { slope += g [ j ] * ( x [ j ] - a [ j ] ) ; }
+      ok = 0 > slope ;
+    }
+    if ( !ok && !m_exact [ i ] )
+    {
+      ok    = box_qp ( a , g , hgn , m_low , m_high , x , free ) ;
+      slope = 0 ;
+      for ( std::size_t j = 0 ; ok && j < n ; ++j ) { slope += g [ j ] * ( x [ j ] - a [ j ] ) ; }
+    }
+    if ( !ok ) { return Ostap::StatusCode ( 501 ) ; }               // RETURN
+    //
+    bool small = true ;
+    for ( std::size_t j = 0 ; j < n ; ++j )
+    { small = small && std::abs ( x [ j ] - a [ j ] ) <= s_STEP_TOL * ( 1 + std::abs ( a [ j ] ) ) ; }
+    if ( small || 0 <= slope ) { converged = true ; break ; }       // BREAK
+    //
+    // backtracking line search
+    double      step  = 1     ;
+    double      fnew  = s_Inf ;
+    std::size_t pnew  = 0     ;
+    bool        found = false ;
+    for ( unsigned short k = 0 ; k < 40 ; ++k )
+    {
+      for ( std::size_t j = 0 ; j < n ; ++j ) { t [ j ] = a [ j ] + step * ( x [ j ] - a [ j ] ) ; }
+      fnew  = problem.f ( t , pnew ) ;
+      found = 0 < pnew && fnew <= chi2 + 1.e-4 * step * slope ;
+      if ( found ) { break ; }                                      // BREAK
+      step *= 0.5 ;
+    }
+    if ( !found )
+    {
+      // no further progress: accept the current point if it is stationary
+      converged = std::abs ( slope ) <= s_CHI2_TOL * ( 1 + chi2 ) ;
+      break ;                                                       // BREAK
+    }
+    //
+    a.swap ( t ) ;
+    //
+    // the quadratic function: one full Newton step gives the exact minimum
+    if      ( m_exact [ i ] && 1 == step ) { converged = true ; }
+    else if ( std::abs ( chi2 - fnew ) <= s_CHI2_TOL * ( 1 + fnew ) ) { converged = true ; }
+  }
+  //
+  if ( !converged ) { return Ostap::StatusCode ( 500 ) ; }          // RETURN
+  //
+  // the final hessian and the covariance matrix for the free parameters
+  chi2 = problem.fdfddf ( a , g , h , hgn , points ) ;
+  for ( std::size_t j = 0 ; j < n ; ++j )
+  {
+    free [ j ] = !( ( a [ j ] <= m_low  [ j ] && 0 <= g [ j ] ) ||
+                    ( a [ j ] >= m_high [ j ] && 0 >= g [ j ] ) ) ;
+  }
+  if ( !cholesky ( h , n , free ) ) { return Ostap::StatusCode ( 501 ) ; } // RETURN
+  //
+  double* cov = &m_covs [ i * n * n ] ;
+  std::fill ( cov , cov + n * n , 0.0 ) ;
+  for ( std::size_t k = 0 ; k < n ; ++k )
+  {
+    if ( !free [ k ] ) { continue ; }
+    for ( std::size_t j = 0 ; j < n ; ++j ) { x [ j ] = k == j ? 1.0 : 0.0 ; }
+    cholesky_solve ( h , n , free , x ) ;
+    for ( std::size_t j = 0 ; j < n ; ++j )
+    { if ( free [ j ] ) { cov [ j * n + k ] = 2 * x [ j ] ; } }
+  }
+  //
+  std::copy ( a.begin () , a.end () , m_solu.begin () + i * n ) ;
+  m_chi2   [ i ] = chi2   ;
+  m_iters  [ i ] = iter   ;
+  m_points [ i ] = points ;
+  //
+  return Ostap::StatusCode::SUCCESS ;
+}
+// ============================================================================
+// solve one problem with the iterative minimiser
+// ============================================================================
+Ostap::StatusCode Ostap::Math::Chi2FitBatch::iterate ( const std::size_t i )
+{
+  const std::size_t n  = m_ncmps   ;
+  const std::size_t np = m_npoints ;
+  //
+  DATA data ;
+  data.reserve ( np ) ;
+  for ( std::size_t k = 0 ; k < np ; ++k )
+  { data.push_back ( VE ( m_values [ i * np + k ] , m_cov2 [ i * np + k ] ) ) ; }
+  //
+  CMPS cmps ( n ) ;
+  for ( std::size_t j = 0 ; j < n ; ++j )
+  {
+    cmps [ j ].reserve ( np ) ;
+    const std::size_t offset = ( i * n + j ) * np ;
+    for ( std::size_t k = 0 ; k < np ; ++k )
+    { cmps [ j ].push_back ( VE ( m_cvalues [ offset + k ] , m_ccov2 [ offset + k ] ) ) ; }
+  }
+  //
+  const Chi2Fit fit ( data , cmps ) ;
+  m_fallback [ i ] = true ;
+  if ( fit.status ().isFailure () ) { return fit.status () ; }          // RETURN
+  //
+  for ( std::size_t j = 0 ; j < n ; ++j )
+  {
+    m_solu [ i * n + j ] = fit.param ( j ).value () ;
+    for ( std::size_t k = 0 ; k < n ; ++k )
+    { m_covs [ ( i * n + j ) * n + k ] = fit.cov2 ( j , k ) ; }
+  }
+  m_chi2   [ i ] = fit.chi2   () ;
+  m_iters  [ i ] = fit.niters () ;
+  m_points [ i ] = fit.points () ;
+  //
+  return fit.status () ;
+}
+// ============================================================================
+// the status of the fit
+// ============================================================================
+Ostap::StatusCode Ostap::Math::Chi2FitBatch::status ( const std::size_t i ) const
+{ return i < size () ? m_status [ i ] : Ostap::StatusCode ( 500 ) ; }
+// ============================================================================
+// get the parameter
+// ============================================================================
+Ostap::Math::Chi2FitBatch::VE
+Ostap::Math::Chi2FitBatch::param
+( const std::size_t  i     ,
+  const unsigned int index ) const
+{
+  if ( size () <= i || m_ncmps <= index ) { return VE ( -s_Inf , -s_Inf ) ; }
+  if ( m_status [ i ].isFailure ()      ) { return VE ( -s_Inf , -s_Inf ) ; }
+  return VE ( m_solu [ i * m_ncmps + index ] , cov2 ( i , index , index ) ) ;
+}
+// ============================================================================
+// get the covariance matrix elements
+// ============================================================================
+double Ostap::Math::Chi2FitBatch::cov2
+( const std::size_t  i  ,
+  const unsigned int i1 ,
+  const unsigned int i2 ) const
+{
+  if ( size () <= i || m_ncmps <= i1 || m_ncmps <= i2 ) { return -s_Inf ; }
+  if ( m_status [ i ].isFailure ()                    ) { return -s_Inf ; }
+  return m_covs [ ( i * m_ncmps + i1 ) * m_ncmps + i2 ] ;
+}
+// ============================================================================
+// the function at minimum
+// ============================================================================
+double Ostap::Math::Chi2FitBatch::chi2 ( const std::size_t i ) const
+{ return i < size () ? m_chi2 [ i ] : s_Inf ; }
+// ============================================================================
+// number of iterations
+// ============================================================================
+std::size_t Ostap::Math::Chi2FitBatch::niters ( const std::size_t i ) const
+{ return i < size () ? m_iters [ i ] : 0 ; }
+// ============================================================================
+// number of points
+// ============================================================================
+std::size_t Ostap::Math::Chi2FitBatch::points ( const std::size_t i ) const
+{ return i < size () ? m_points [ i ] : 0 ; }
+// ============================================================================
+// was the iterative minimiser used?
+// ============================================================================
+bool Ostap::Math::Chi2FitBatch::fallback ( const std::size_t i ) const
+{ return i < size () && m_fallback [ i ] ; }
+// ============================================================================
+// get all parameters at once
+// ============================================================================
+Ostap::Math::Chi2FitBatch::DATA
+Ostap::Math::Chi2FitBatch::params ( const std::size_t i ) const
+{
+  DATA pars ;
+  if ( size () <= i || m_status [ i ].isFailure () ) { return pars ; }
+  for ( unsigned int j = 0 ; j < m_ncmps ; ++j ) { pars.push_back ( param ( i , j ) ) ; }
+  return pars ;
+}
+// ============================================================================
 // The END 
 // ============================================================================
@@ -0,0 +1,386 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Polynomials.h"
+#include "Ostap/ThreadPool.h"
+#include "Ostap/DalitzNormalization.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::DalitzNormalization
+ *  @see Ostap::Math::DalitzNormalization
+ *  @author Ostap developers
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /** the size of the chunk for the sums over the grid:
+   *  the fixed chunks make the result independent on the number of threads
+   */
+  const std::size_t s_CHUNK = 512 ;
+  // ==========================================================================
+  /// Gauss-Legendre nodes and weights at [-1,1]
+  void gauss_legendre
+  ( const unsigned short n ,
+    std::vector<double>& x ,
+    std::vector<double>& w )
+  {
+    const Ostap::Math::Legendre lp ( n ) ;
+    x = lp.roots () ;
+    w.resize ( n ) ;
+    for ( unsigned short i = 0 ; i < n ; ++i )
+    {
+      const double xi = x [ i ] ;
+      const double d  = lp.derivative ( xi ) ;
+      w [ i ] = 2.0 / ( ( 1 - xi ) * ( 1 + xi ) * d * d ) ;
+    }
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// constructor from the Dalitz configuration
+// ============================================================================
+Ostap::Math::DalitzNormalization::DalitzNormalization
+( const Ostap::Kinematics::Dalitz& dalitz ,
+  const unsigned short             n1     ,
+  const unsigned short             n2     )
+  : m_dalitz ( dalitz )
+  , m_n1     ( std::max ( n1 , (unsigned short) 2 ) )
+  , m_n2     ( std::max ( n2 , (unsigned short) 2 ) )
+{
+  build () ;
+}
+// ============================================================================
+// constructor from the Dalitz configuration
+// ============================================================================
+Ostap::Math::DalitzNormalization::DalitzNormalization
+( const Ostap::Kinematics::Dalitz0& dalitz ,
+  const double                      M      ,
+  const unsigned short              n1     ,
+  const unsigned short              n2     )
+  : DalitzNormalization ( Ostap::Kinematics::Dalitz ( M , dalitz ) , n1 , n2 )
+{}
+// ============================================================================
+// copy constructor
+// ============================================================================
+Ostap::Math::DalitzNormalization::DalitzNormalization
+( const Ostap::Math::DalitzNormalization& right )
+  : m_dalitz     ( right.m_dalitz     )
+  , m_n1         ( right.m_n1         )
+  , m_n2         ( right.m_n2         )
+  , m_s1         ( right.m_s1         )
+  , m_s2         ( right.m_s2         )
+  , m_w          ( right.m_w          )
+  , m_amplitudes ( right.m_amplitudes )
+  , m_tags       ( right.m_tags       )
+  , m_values     ( right.m_values     )
+{
+  std::lock_guard<std::mutex> lock ( right.m_mutex ) ;
+  m_matrix   = right.m_matrix   ;
+  m_modified = right.m_modified ;
+}
+// ============================================================================
+// build the grid
+// ============================================================================
+void Ostap::Math::DalitzNormalization::build ()
+{
+  std::vector<double> x1 , w1 , x2 , w2 ;
+  gauss_legendre ( m_n1 , x1 , w1 ) ;
+  gauss_legendre ( m_n2 , x2 , w2 ) ;
+  //
+  const double s      = m_dalitz.s      () ;
+  const double s1_min = m_dalitz.s1_min () ;
+  const double s1_max = m_dalitz.s1_max () ;
+  const double c1     = 0.5 * ( s1_max + s1_min ) ;
+  const double h1     = 0.5 * ( s1_max - s1_min ) ;
+  //
+  m_s1.clear () ; m_s1.reserve ( m_n1 * m_n2 ) ;
+  m_s2.clear () ; m_s2.reserve ( m_n1 * m_n2 ) ;
+  m_w .clear () ; m_w .reserve ( m_n1 * m_n2 ) ;
+  //
+  for ( unsigned short i = 0 ; i < m_n1 ; ++i )
+  {
+    // boundary-adapted variable: s1 = c1 - h1 * cos ( theta )
+    const double theta = 0.5 * M_PI * ( 1 + x1 [ i ] ) ;
+    const double st    = std::sin ( theta ) ;
+    const double s1    = c1 - h1 * std::cos ( theta ) ;
+    const double ws1   = 0.5 * M_PI * w1 [ i ] * h1 * st ;
+    //
+    const std::pair<double,double> r = m_dalitz.s2_minmax_for_s_s1 ( s , s1 ) ;
+    if ( !( r.first < r.second ) ) { continue ; }
+    //
+    const double c2 = 0.5 * ( r.second + r.first ) ;
+    const double h2 = 0.5 * ( r.second - r.first ) ;
+    for ( unsigned short j = 0 ; j < m_n2 ; ++j )
+    {
+      m_s1.push_back ( s1 ) ;
+      m_s2.push_back ( c2 + h2 * x2 [ j ] ) ;
+      m_w .push_back ( ws1 * h2 * w2 [ j ] ) ;
+    }
+  }
+}
+// ============================================================================
+// the area of the Dalitz plot: sum of all weights
+// ============================================================================
+double Ostap::Math::DalitzNormalization::area () const
+{
+  double result = 0 ;
+  for ( const double w : m_w ) { result += w ; }
+  return result ;
+}
+// ============================================================================
+// integrate the real function over the grid
+// ============================================================================
+double Ostap::Math::DalitzNormalization::integrate
+( const Ostap::Math::DalitzNormalization::function2& f ) const
+{
+  double result = 0 ;
+  const std::size_t n = size () ;
+  for ( std::size_t k = 0 ; k < n ; ++k ) { result += m_w [ k ] * f ( m_s1 [ k ] , m_s2 [ k ] ) ; }
+  return result ;
+}
+// ============================================================================
+// add new component
+// ============================================================================
+std::size_t Ostap::Math::DalitzNormalization::add
+( Ostap::Math::DalitzNormalization::Amplitude amplitude ,
+  const std::size_t                           tag       )
+{
+  Ostap::Assert ( bool ( amplitude )                  ,
+                  "Invalid amplitude!"                ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  //
+  const std::size_t index = m_amplitudes.size () ;
+  m_amplitudes.push_back ( amplitude ) ;
+  m_tags      .push_back ( tag       ) ;
+  m_values    .emplace_back () ;
+  evaluate ( index ) ;
+  //
+  return index ;
+}
+// ============================================================================
+// update the component if the tag is changed
+// ============================================================================
+bool Ostap::Math::DalitzNormalization::update
+( const std::size_t index ,
+  const std::size_t tag   )
+{
+  Ostap::Assert ( index < m_amplitudes.size ()        ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  if ( tag == m_tags [ index ] ) { return false ; }
+  //
+  m_tags [ index ] = tag ;
+  evaluate ( index ) ;
+  return true ;
+}
+// ============================================================================
+// replace the component
+// ============================================================================
+void Ostap::Math::DalitzNormalization::update
+( const std::size_t                           index     ,
+  Ostap::Math::DalitzNormalization::Amplitude amplitude ,
+  const std::size_t                           tag       )
+{
+  Ostap::Assert ( index < m_amplitudes.size ()        ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  Ostap::Assert ( bool ( amplitude )                  ,
+                  "Invalid amplitude!"                ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  //
+  m_amplitudes [ index ] = amplitude ;
+  m_tags       [ index ] = tag       ;
+  evaluate ( index ) ;
+}
+// ============================================================================
+// force the recalculation of the component
+// ============================================================================
+void Ostap::Math::DalitzNormalization::refresh ( const std::size_t index )
+{
+  Ostap::Assert ( index < m_amplitudes.size ()        ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  evaluate ( index ) ;
+}
+// ============================================================================
+// the tag of the component
+// ============================================================================
+std::size_t Ostap::Math::DalitzNormalization::tag ( const std::size_t index ) const
+{
+  Ostap::Assert ( index < m_tags.size ()              ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  return m_tags [ index ] ;
+}
+// ============================================================================
+// calculate the values of the component on the grid
+// ============================================================================
+void Ostap::Math::DalitzNormalization::evaluate ( const std::size_t index )
+{
+  // the amplitude is not guaranteed to be thread-safe: sequential loop
+  const Amplitude&      a = m_amplitudes [ index ] ;
+  std::vector<complex>& v = m_values     [ index ] ;
+  const std::size_t     n = size () ;
+  v.resize ( n ) ;
+  for ( std::size_t k = 0 ; k < n ; ++k ) { v [ k ] = a ( m_s1 [ k ] , m_s2 [ k ] ) ; }
+  //
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  m_modified.resize ( m_amplitudes.size () , true ) ;
+  m_modified [ index ] = true ;
+}
+// ============================================================================
+// recalculate the modified rows of the matrix (the lock is already acquired)
+// ============================================================================
+void Ostap::Math::DalitzNormalization::update_matrix () const
+{
+  const std::size_t nc = m_amplitudes.size () ;
+  m_modified.resize ( nc , true ) ;
+  if ( m_matrix.size () != nc )
+  {
+    m_matrix.resize ( nc ) ;
+    for ( auto& row : m_matrix ) { row.resize ( nc ) ; }
+  }
+  //
+  std::vector<std::size_t> rows ;
+  for ( std::size_t i = 0 ; i < nc ; ++i ) { if ( m_modified [ i ] ) { rows.push_back ( i ) ; } }
+  if ( rows.empty () ) { return ; }
+  //
+  const std::size_t nr      = rows.size () ;
+  const std::size_t n       = size () ;
+  const std::size_t nchunks = ( n + s_CHUNK - 1 ) / s_CHUNK ;
+  //
+  // partial sums per chunk: [chunk][row][column]
+  std::vector<complex> partial ( nchunks * nr * nc ) ;
+  //
+  const std::vector<std::vector<complex>>& values = m_values ;
+  const std::vector<double>&               w      = m_w      ;
+  auto kernel = [&] ( const std::size_t begin , const std::size_t end )
+    {
+      for ( std::size_t c = begin ; c < end ; ++c )
+      {
+        const std::size_t k1 = c * s_CHUNK ;
+        const std::size_t k2 = std::min ( n , k1 + s_CHUNK ) ;
+        complex* result = partial.data () + c * nr * nc ;
+        for ( std::size_t r = 0 ; r < nr ; ++r )
+        {
+          const complex* ai = values [ rows [ r ] ].data () ;
+          for ( std::size_t j = 0 ; j < nc ; ++j )
+          {
+            const complex* aj = values [ j ].data () ;
+            double re = 0 ;
+            double im = 0 ;
+            for ( std::size_t k = k1 ; k < k2 ; ++k )
+            {
+              // w * a_i * conj ( a_j )
+              const double xr = ai [ k ].real () ;
+              const double xi = ai [ k ].imag () ;
+              const double yr = aj [ k ].real () ;
+              const double yi = aj [ k ].imag () ;
+              re += w [ k ] * ( xr * yr + xi * yi ) ;
+              im += w [ k ] * ( xi * yr - xr * yi ) ;
+            }
+            result [ r * nc + j ] = complex ( re , im ) ;
+          }
+        }
+      }
+    } ;
+  //
+  if ( nchunks < 2 ) { kernel ( 0 , nchunks ) ; }
+  else { Ostap::Utils::ThreadPool::parallel_for ( nchunks , kernel , 1 ) ; }
+  //
+  for ( std::size_t r = 0 ; r < nr ; ++r )
+  {
+    const std::size_t i = rows [ r ] ;
+    for ( std::size_t j = 0 ; j < nc ; ++j )
+    {
+      complex s = 0 ;
+      for ( std::size_t c = 0 ; c < nchunks ; ++c ) { s += partial [ ( c * nr + r ) * nc + j ] ; }
+      m_matrix [ i ][ j ] = s ;
+      m_matrix [ j ][ i ] = std::conj ( s ) ;
+    }
+    m_modified [ i ] = false ;
+  }
+}
+// ============================================================================
+// the integral M_ij
+// ============================================================================
+Ostap::Math::DalitzNormalization::complex
+Ostap::Math::DalitzNormalization::integral
+( const std::size_t i ,
+  const std::size_t j ) const
+{
+  Ostap::Assert ( i < m_amplitudes.size () && j < m_amplitudes.size () ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  update_matrix () ;
+  return m_matrix [ i ][ j ] ;
+}
+// ============================================================================
+// get the full matrix (row-major)
+// ============================================================================
+std::vector<Ostap::Math::DalitzNormalization::complex>
+Ostap::Math::DalitzNormalization::matrix () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  update_matrix () ;
+  std::vector<complex> result ;
+  result.reserve ( m_matrix.size () * m_matrix.size () ) ;
+  for ( const auto& row : m_matrix ) { result.insert ( result.end () , row.begin () , row.end () ) ; }
+  return result ;
+}
+// ============================================================================
+// the normalization for the given coefficients
+// ============================================================================
+double Ostap::Math::DalitzNormalization::norm
+( const Ostap::Math::DalitzNormalization::Coefficients& c ) const
+{
+  const std::size_t nc = m_amplitudes.size () ;
+  Ostap::Assert ( c.size () == nc                     ,
+                  "Invalid number of coefficients!"   ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  //
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  update_matrix () ;
+  //
+  double result = 0 ;
+  for ( std::size_t i = 0 ; i < nc ; ++i )
+  {
+    result += std::norm ( c [ i ] ) * m_matrix [ i ][ i ].real () ;
+    for ( std::size_t j = i + 1 ; j < nc ; ++j )
+    { result += 2 * ( c [ i ] * std::conj ( c [ j ] ) * m_matrix [ i ][ j ] ).real () ; }
+  }
+  return result ;
+}
+// ============================================================================
+// the fraction of the component
+// ============================================================================
+double Ostap::Math::DalitzNormalization::fraction
+( const Ostap::Math::DalitzNormalization::Coefficients& c ,
+  const std::size_t                                     i ) const
+{
+  Ostap::Assert ( i < m_amplitudes.size ()            ,
+                  "Invalid component index!"          ,
+                  "Ostap::Math::DalitzNormalization"  ) ;
+  const double n = norm ( c ) ;
+  if ( !n ) { return 0 ; }
+  //
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return std::norm ( c [ i ] ) * m_matrix [ i ][ i ].real () / n ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -64,6 +64,44 @@ void ROOT::Detail::RDF::WStatVar::Finalize()
   *m_result = sum ;
 }
 // ============================================================================
+// constructor 
+// ============================================================================
+ROOT::Detail::RDF::StatCov::StatCov ()
+  : m_result ( std::make_shared<Result_t>() ) 
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,22,0)
+  , m_N      ( ROOT::IsImplicitMTEnabled() ? std::max ( 1u , ROOT::GetThreadPoolSize     () ) : 1u )
+#else 
+  , m_N      ( ROOT::IsImplicitMTEnabled() ? std::max ( 1u , ROOT::GetImplicitMTPoolSize () ) : 1u )
+#endif
+  , m_slots  ( this->m_N ) 
+{}
+// ============================================================================
+// Finalize: the same normalization as for Ostap::StatVar::statCov 
+// ============================================================================
+void ROOT::Detail::RDF::StatCov::Finalize() 
+{ 
+  Result_t sum { m_slots [0] } ;
+  for ( unsigned int i = 1 ; i < m_N ; ++i ) 
+  {
+    sum.stat1 += m_slots [ i ].stat1 ;
+    sum.stat2 += m_slots [ i ].stat2 ;
+    sum.cov2  += m_slots [ i ].cov2  ;
+  }
+  //
+  const unsigned long long n = sum.stat1.nEntries () ;
+  if ( n ) 
+  {
+    sum.cov2 /= n ;
+    const double v1_mean = sum.stat1.mean () ;
+    const double v2_mean = sum.stat2.mean () ;
+    sum.cov2 ( 0 , 0 ) -= v1_mean * v1_mean ;
+    sum.cov2 ( 0 , 1 ) -= v1_mean * v2_mean ;
+    sum.cov2 ( 1 , 1 ) -= v2_mean * v2_mean ;
+  }
+  //
+  *m_result = sum ;
+}
+// ============================================================================
 
 
 
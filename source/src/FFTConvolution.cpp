@@ -0,0 +1,279 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// GSL
+// ============================================================================
+#include "gsl/gsl_fft_real.h"
+#include "gsl/gsl_fft_halfcomplex.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/FFTConvolution.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_math.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::FFTConvolution
+ *  @see Ostap::Math::FFTConvolution
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Math::FFTConvolution::Table
+ *  the actual (immutable) tabulated convolution
+ */
+class Ostap::Math::FFTConvolution::Table
+{
+public:
+  // ==========================================================================
+  /// the key
+  std::size_t         key    { 0 } ;
+  /// the values at the uniform grid
+  std::vector<double> values {   } ;
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the smallest power of two that is not less than n
+  inline std::size_t pow2 ( const std::size_t n )
+  {
+    std::size_t p = 1 ;
+    while ( p < n ) { p <<= 1 ; }
+    return p ;
+  }
+  // ==========================================================================
+  /** the window function
+   *  @param w the window type
+   *  @param t relative position \f$ -1 \le t \le 1 \f$
+   */
+  inline double window_function
+  ( const Ostap::Math::FFTConvolution::Window w ,
+    const double                              t )
+  {
+    const double a = std::abs ( t ) ;
+    switch ( w )
+    {
+    case Ostap::Math::FFTConvolution::Hann    :
+      return 0.5  * ( 1 + std::cos ( M_PI * a ) ) ;
+    case Ostap::Math::FFTConvolution::Hamming :
+      return 0.54 + 0.46 * std::cos ( M_PI * a ) ;
+    case Ostap::Math::FFTConvolution::Tukey   :
+      {
+        static const double s_alpha = 0.25 ;
+        return a <= 1 - s_alpha ? 1.0 :
+          0.5 * ( 1 + std::cos ( M_PI * ( a - 1 + s_alpha ) / s_alpha ) ) ;
+      }
+    default:
+      return 1.0 ;
+    }
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor from the signal, resolution and the range
+ *  @param signal     the signal function
+ *  @param resolution the resolution function
+ *  @param xmin       low  edge of the range
+ *  @param xmax       high edge of the range
+ *  @param width      the half-width of the resolution function
+ *  @param N          number of grid points in the range
+ *  @param padding    the padding factor for the signal
+ *  @param window     the window function for the resolution
+ *  @param normalize  normalize the sampled resolution function?
+ *  @param key        the key function (if any)
+ */
+// ============================================================================
+Ostap::Math::FFTConvolution::FFTConvolution
+( Ostap::Math::FFTConvolution::Function signal     ,
+  Ostap::Math::FFTConvolution::Function resolution ,
+  const double                          xmin       ,
+  const double                          xmax       ,
+  const double                          width      ,
+  const std::size_t                     N          ,
+  const double                          padding    ,
+  const Ostap::Math::FFTConvolution::Window window ,
+  const bool                            normalize  ,
+  Ostap::Math::FFTConvolution::Key      key        )
+  : m_signal     ( signal     )
+  , m_resolution ( resolution )
+  , m_xmin       ( std::min ( xmin , xmax ) )
+  , m_xmax       ( std::max ( xmin , xmax ) )
+  , m_width      ( std::abs ( width   ) )
+  , m_N          ( std::max ( N , std::size_t ( 4 ) ) )
+  , m_padding    ( std::abs ( padding ) )
+  , m_window     ( window     )
+  , m_normalize  ( normalize  )
+  , m_key        ( key        )
+  , m_table      ()
+{
+  Ostap::Assert ( m_xmin < m_xmax                 ,
+                  "Invalid range!"                ,
+                  "Ostap::Math::FFTConvolution"   ) ;
+  Ostap::Assert ( 0 < m_width                     ,
+                  "Invalid resolution width!"     ,
+                  "Ostap::Math::FFTConvolution"   ) ;
+}
+// ============================================================================
+// copy constructor: the cached result is shared
+// ============================================================================
+Ostap::Math::FFTConvolution::FFTConvolution
+( const Ostap::Math::FFTConvolution& right )
+  : m_signal     ( right.m_signal     )
+  , m_resolution ( right.m_resolution )
+  , m_xmin       ( right.m_xmin       )
+  , m_xmax       ( right.m_xmax       )
+  , m_width      ( right.m_width      )
+  , m_N          ( right.m_N          )
+  , m_padding    ( right.m_padding    )
+  , m_window     ( right.m_window     )
+  , m_normalize  ( right.m_normalize  )
+  , m_key        ( right.m_key        )
+  , m_table      ( std::atomic_load ( &right.m_table ) )
+  , m_lock       ()
+{}
+// ============================================================================
+// default constructor (needed for serialization)
+// ============================================================================
+Ostap::Math::FFTConvolution::FFTConvolution () = default ;
+// ============================================================================
+// drop the cached result, it will be recalculated at next call
+// ============================================================================
+void Ostap::Math::FFTConvolution::reset () const
+{ std::atomic_store ( &m_table , std::shared_ptr<const Table> () ) ; }
+// ============================================================================
+// get the valid table (calculate it if needed)
+// ============================================================================
+std::shared_ptr<const Ostap::Math::FFTConvolution::Table>
+Ostap::Math::FFTConvolution::table () const
+{
+  const std::size_t key = m_key ? m_key () : 0 ;
+  return m_lock.get ( m_table ,
+                      [key]      ( const Table& t ) { return key == t.key ; } ,
+                      [this,key] () { return build ( key ) ; } ) ;
+}
+// ============================================================================
+// calculate the new table
+// ============================================================================
+std::shared_ptr<const Ostap::Math::FFTConvolution::Table>
+Ostap::Math::FFTConvolution::build ( const std::size_t key ) const
+{
+  const double      h  = step () ;
+  const std::size_t M  = static_cast<std::size_t> ( std::ceil ( m_width             / h ) ) ;
+  const std::size_t P  = static_cast<std::size_t> ( std::ceil ( m_padding * m_width / h ) ) ;
+  const std::size_t NS = m_N + 2 * P ;
+  const std::size_t L  = pow2 ( NS + 2 * M ) ;
+  //
+  // (1) sample the signal in the extended range
+  std::vector<double> fs ( L , 0.0 ) ;
+  for ( std::size_t i = 0 ; i < NS ; ++i )
+  {
+    const double x = m_xmin + ( double ( i ) - double ( P ) ) * h ;
+    fs [ i ] = m_signal ( x ) ;
+  }
+  //
+  // (2) sample the resolution function in [-w,w] in wrap-around order
+  std::vector<double> rs ( L , 0.0 ) ;
+  double sum = 0 ;
+  for ( std::size_t j = 0 ; j <= M ; ++j )
+  {
+    const double tj = j * h ;
+    const double wj = 0 < M ? window_function ( m_window , double ( j ) / M ) : 1.0 ;
+    rs [ j ] = wj * m_resolution ( tj ) ;
+    sum     += rs [ j ] ;
+    if ( 0 == j ) { continue ; }
+    rs [ L - j ] = wj * m_resolution ( -tj ) ;
+    sum         += rs [ L - j ] ;
+  }
+  //
+  const double scale = m_normalize && !s_zero ( sum ) ? 1.0 / sum : h ;
+  //
+  // (3) forward transforms
+  gsl_fft_real_radix2_transform ( fs.data () , 1 , L ) ;
+  gsl_fft_real_radix2_transform ( rs.data () , 1 , L ) ;
+  //
+  // (4) multiply in half-complex representation
+  fs [ 0     ] *= rs [ 0     ] ;
+  fs [ L / 2 ] *= rs [ L / 2 ] ;
+  for ( std::size_t k = 1 ; k < L / 2 ; ++k )
+  {
+    const double ar = fs [ k     ] ;
+    const double ai = fs [ L - k ] ;
+    const double br = rs [ k     ] ;
+    const double bi = rs [ L - k ] ;
+    fs [ k     ] = ar * br - ai * bi ;
+    fs [ L - k ] = ar * bi + ai * br ;
+  }
+  //
+  // (5) inverse transform
+  gsl_fft_halfcomplex_radix2_inverse ( fs.data () , 1 , L ) ;
+  //
+  auto nt = std::make_shared<Table> () ;
+  nt -> key = key ;
+  nt -> values.resize ( m_N ) ;
+  for ( std::size_t i = 0 ; i < m_N ; ++i )
+  { nt->values [ i ] = scale * fs [ P + i ] ; }
+  //
+  return nt ;
+}
+// ============================================================================
+// evaluate the convolution
+// ============================================================================
+double Ostap::Math::FFTConvolution::evaluate ( const double x ) const
+{
+  if ( x < m_xmin || m_xmax < x ) { return 0 ; }
+  //
+  const std::shared_ptr<const Table> t = table () ;
+  const std::vector<double>&         v = t->values ;
+  //
+  const double      h = step () ;
+  const double      u = ( x - m_xmin ) / h ;
+  std::size_t       i = std::min ( static_cast<std::size_t> ( u ) , m_N - 2 ) ;
+  //
+  // the stencil of four points
+  const std::size_t j = std::min ( 0 < i ? i - 1 : 0 , m_N - 4 ) ;
+  const double      d = u - j ;
+  //
+  // cubic Lagrange interpolation at the points 0,1,2,3
+  const double w0 = -       ( d - 1 ) * ( d - 2 ) * ( d - 3 ) / 6 ;
+  const double w1 =   d               * ( d - 2 ) * ( d - 3 ) / 2 ;
+  const double w2 = - d     * ( d - 1 )           * ( d - 3 ) / 2 ;
+  const double w3 =   d     * ( d - 1 ) * ( d - 2 )           / 6 ;
+  //
+  return w0 * v [ j ] + w1 * v [ j + 1 ] + w2 * v [ j + 2 ] + w3 * v [ j + 3 ] ;
+}
+// ============================================================================
+// get the integral over the range (the convolution is calculated if needed)
+// ============================================================================
+double Ostap::Math::FFTConvolution::integral () const
+{
+  const std::shared_ptr<const Table> t = table () ;
+  const std::vector<double>&         v = t->values ;
+  //
+  // trapezoidal rule with the end-point correction
+  long double result = 0.5L * ( v.front () + v.back () ) ;
+  for ( std::size_t i = 1 ; i + 1 < v.size () ; ++i ) { result += v [ i ] ; }
+  result -= ( v [ 2 ] - 4 * v [ 1 ] + 3 * v [ 0 ]
+              + v [ m_N - 3 ] - 4 * v [ m_N - 2 ] + 3 * v [ m_N - 1 ] ) / 24.0L ;
+  //
+  return result * step () ;
+}
+// ============================================================================
+// get the convolution at the grid (the convolution is calculated if needed)
+// ============================================================================
+std::vector<double> Ostap::Math::FFTConvolution::values () const
+{ return table () -> values ; }
+// ============================================================================
+
+// ============================================================================
+//                                                                      The END
+// ============================================================================
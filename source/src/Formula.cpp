@@ -15,6 +15,7 @@
 // Ostap
 // ============================================================================
 #include "Ostap/Formula.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 // Local
 // ============================================================================
@@ -36,6 +37,9 @@ namespace
                              const TTree*       tree       ) 
   { return Ostap::tmp_name ( prefix , expression , tree , true ) ; }
   // ==========================================================================
+  /// number of formula evaluations 
+  const Ostap::Utils::Instrumentation::Counter s_EVALUATE { "Formula::evaluate" } ;
+  // ==========================================================================
 } //                                             The end of anonymous namespace 
 // ============================================================================
 ClassImp(Ostap::Formula)
@@ -80,6 +84,7 @@ Ostap::Formula::~Formula()
 // ============================================================================
 double Ostap::Formula::evaluate () // evaluate the formula 
 { 
+  s_EVALUATE.add () ;
   const Int_t d = GetNdata() ; 
   Ostap::Assert ( 1 == d , 
                   "evaluate: scalar call for GetNdata()!=1 function" , 
@@ -92,6 +97,7 @@ double Ostap::Formula::evaluate () // evaluate the formula
 // ============================================================================
 double Ostap::Formula::evaluate ( const unsigned short i ) // evaluate the formula 
 { 
+  s_EVALUATE.add () ;
   const Int_t d = GetNdata() ; 
   Ostap::Assert ( i  < d ,
                   "evaluate: invalid instance counter" , 
@@ -105,6 +111,7 @@ double Ostap::Formula::evaluate ( const unsigned short i ) // evaluate the formu
 Int_t Ostap::Formula::evaluate ( std::vector<double>& results ) 
 { 
   const Int_t d = GetNdata() ; 
+  s_EVALUATE.add () ;
   results.resize ( d ) ;
   for ( Int_t i = 0 ; i < d ; ++i ) { results [ i ] = EvalInstance ( i ) ; }
   return d ;  
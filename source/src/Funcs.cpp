@@ -1,6 +1,11 @@
 // ============================================================================
 // Include files
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <set>
+#include <algorithm>
+// ============================================================================
 // local
 // ============================================================================
 #include "Ostap/Funcs.h"
@@ -13,6 +18,8 @@
 // Root
 // ============================================================================
 #include "TTree.h"
+#include "TLeaf.h"
+#include "TBranch.h"
 #include "RooArgList.h"
 #include "RooArgSet.h"
 #include "RooAbsData.h"
@@ -32,6 +39,7 @@ ClassImp(Ostap::Functions::FuncFormula)
 ClassImp(Ostap::Functions::Func1D)
 ClassImp(Ostap::Functions::Func2D)
 ClassImp(Ostap::Functions::Func3D)
+ClassImp(Ostap::Functions::FuncKinematics)
 ClassImp(Ostap::Functions::FuncTH1)
 ClassImp(Ostap::Functions::FuncTH2)
 ClassImp(Ostap::Functions::FuncTH3)
@@ -126,6 +134,15 @@ double Ostap::Functions::FuncFormula::operator() ( const TTree* tree ) const
   //
   return m_formula->evaluate() ;
 }
+// ============================================================================
+// the expressions, used by the function
+// ============================================================================
+bool Ostap::Functions::FuncFormula::expressions
+( std::vector<std::string>& result ) const 
+{
+  result.push_back ( m_expression ) ;
+  return true ;
+}
 // ===========================================================================
 /* constructor from the formula expression 
  *  @param expression the formula expression 
@@ -286,6 +303,15 @@ double Ostap::Functions::Func1D::operator() ( const TTree* tree ) const
   return m_fun ( xvar ) ;
 }
 // ============================================================================
+// the expressions, used by the function
+// ============================================================================
+bool Ostap::Functions::Func1D::expressions
+( std::vector<std::string>& result ) const 
+{
+  result.push_back ( m_xvar_exp ) ;
+  return true ;
+}
+// ============================================================================
 // copy constructor 
 // ============================================================================
 Ostap::Functions::Func2D::Func2D
@@ -389,6 +415,16 @@ double Ostap::Functions::Func2D::operator() ( const TTree* tree ) const
   return m_fun ( xvar , yvar ) ;
 }
 // ============================================================================
+// the expressions, used by the function
+// ============================================================================
+bool Ostap::Functions::Func2D::expressions
+( std::vector<std::string>& result ) const 
+{
+  result.push_back ( m_xvar_exp ) ;
+  result.push_back ( m_yvar_exp ) ;
+  return true ;
+}
+// ============================================================================
 
 // ============================================================================
 // Func3D 
@@ -521,6 +557,257 @@ double Ostap::Functions::Func3D::operator() ( const TTree* tree ) const
   //
   return m_fun ( xvar , yvar , zvar ) ;
 }
+// ============================================================================
+// the expressions, used by the function
+// ============================================================================
+bool Ostap::Functions::Func3D::expressions
+( std::vector<std::string>& result ) const 
+{
+  result.push_back ( m_xvar_exp ) ;
+  result.push_back ( m_yvar_exp ) ;
+  result.push_back ( m_zvar_exp ) ;
+  return true ;
+}
+// ============================================================================
+/*  constructor
+ *  @param variable    the kinematical variable
+ *  @param expressions the components of four-vectors: (px,py,pz,E) for each
+ *  @param tree        the tree
+ *  @param block       the size of the block
+ */
+// ============================================================================
+Ostap::Functions::FuncKinematics::FuncKinematics
+( const Ostap::Kinematics::Batch::Variable variable    ,
+  const std::vector<std::string>&          expressions ,
+  const TTree*                             tree        ,
+  const unsigned int                       block       )
+  : TObject          () 
+  , Ostap::IFuncTree () 
+  , m_variable       ( variable    )
+  , m_expressions    ( expressions )
+  , m_block          ( block       )
+  , m_formulae       ()
+  , m_tree           ( tree        )
+{
+  const std::size_t nv = m_expressions.size () / 4 ;
+  Ostap::Assert ( 0 == m_expressions.size () % 4                                  &&
+                  Ostap::Kinematics::Batch::nVectorsMin ( m_variable ) <= nv      &&
+                  nv <= Ostap::Kinematics::Batch::nVectors ( m_variable )          ,
+                  "Invalid number of components"                                   ,
+                  "Ostap::Function::FuncKinematics"                                ) ;
+  if ( m_tree && !make_formulae () )
+  { throw Ostap::Exception ( "Invalid formulae"                 ,
+                             "Ostap::Function::FuncKinematics"  ,
+                             Ostap::StatusCode(700)             ) ; }
+}
+// ============================================================================
+// copy constructor 
+// ============================================================================
+Ostap::Functions::FuncKinematics::FuncKinematics
+( const Ostap::Functions::FuncKinematics& right ) 
+  : TObject          ( right               ) 
+  , Ostap::IFuncTree ( right               ) 
+  , m_variable       ( right.m_variable    )
+  , m_expressions    ( right.m_expressions )
+  , m_block          ( right.m_block       )
+  , m_formulae       ()
+  , m_tree           ( nullptr             ) 
+{}
+// ===========================================================================
+// clone :
+// ===========================================================================
+Ostap::Functions::FuncKinematics* 
+Ostap::Functions::FuncKinematics::Clone ( const char* /* newname */ ) const
+{ return new FuncKinematics ( *this ) ; }
+// ===========================================================================
+// notify 
+// ============================================================================
+Bool_t Ostap::Functions::FuncKinematics::Notify () 
+{  
+  /// attention! here  we delete the formulae & leaves instead of notify/reset 
+  reset () ;
+  return false ;
+}
+// ============================================================================
+// reset the transient data 
+// ============================================================================
+void Ostap::Functions::FuncKinematics::reset () const 
+{
+  m_formulae.clear () ;
+  m_leaves  .clear () ;
+  m_columns .clear () ;
+  m_results .clear () ;
+  m_plain   = -1      ;
+  m_local   = nullptr ;
+  m_number  = -1      ;
+  m_first   = -1      ;
+}
+// ============================================================================
+/* get the plain leaves for the components:
+ * all components must be the scalar numerical leaves of the 
+ * (local) tree itself, not from the friend trees 
+ */
+// ============================================================================
+bool Ostap::Functions::FuncKinematics::make_leaves () const
+{
+  m_leaves.clear () ;
+  m_first  = -1      ;
+  m_local  = nullptr ;
+  m_number = -1      ;
+  if ( nullptr == m_tree ) { return false ; }
+  //
+  const TTree* local = const_cast<TTree*> ( m_tree )->GetTree () ;
+  if ( nullptr == local  ) { return false ; }
+  //
+  static const std::set<std::string> s_types = {
+    "Double_t" , "Float_t"  ,
+    "Char_t"   , "UChar_t"  , "Short_t"   , "UShort_t"  , "Bool_t" , 
+    "Int_t"    , "UInt_t"   , "Long_t"    , "ULong_t"   , 
+    "Long64_t" , "ULong64_t" } ;
+  //
+  for ( const auto& e : m_expressions ) 
+  {
+    TLeaf* leaf = const_cast<TTree*> ( local )->GetLeaf ( e.c_str () ) ;
+    if ( nullptr == leaf                               ||
+         nullptr != leaf->GetLeafCount ()              ||
+         1       != leaf->GetLen       ()              ||
+         nullptr == leaf->GetBranch    ()              ||
+         local   != leaf->GetBranch    ()->GetTree ()  ||  // no friends!
+         s_types.end () == s_types.find ( leaf->GetTypeName () ) ) 
+    { m_leaves.clear () ; return false ; }                     // RETURN
+    m_leaves.push_back ( leaf ) ;
+  }
+  //
+  m_local  = local ;
+  m_number = m_tree->GetTreeNumber () ;
+  return true ;
+}
+// ============================================================================
+/*  read the block of entries, starting from the given (local) one,
+ *  column-by-column and evaluate the variable for the whole block 
+ */
+// ============================================================================
+void Ostap::Functions::FuncKinematics::read_block
+( const TTree*    tree  ,
+  const long long entry ) const
+{
+  const long long   nentries = tree->GetEntries () ;
+  Ostap::Assert ( 0 <= entry && entry < nentries ,
+                  "Invalid entry"                , 
+                  "Ostap::Function::FuncKinematics" ) ;
+  const std::size_t n        = std::min ( (long long) m_block , nentries - entry ) ;
+  //
+  const std::size_t nc = m_leaves.size () ;
+  m_columns.resize ( nc * n ) ;
+  for ( std::size_t j = 0 ; j < nc ; ++j ) 
+  {
+    TLeaf*   leaf   = m_leaves [ j ] ;
+    TBranch* branch = leaf->GetBranch () ;
+    double*  column = m_columns.data () + j * n ;
+    for ( std::size_t k = 0 ; k < n ; ++k ) 
+    {
+      branch->GetEntry ( entry + k , 1 ) ;
+      column [ k ] = leaf->GetValue () ;
+    }
+    // restore the current entry for all other clients of this branch 
+    if ( 1 < n ) { branch->GetEntry ( entry , 1 ) ; }
+  }
+  //
+  const unsigned short nv = nVectors () ;
+  std::vector<Ostap::Kinematics::LorentzColumns> columns ; columns.reserve ( nv ) ;
+  for ( unsigned short i = 0 ; i < nv ; ++i ) 
+  {
+    const double* c = m_columns.data () + 4 * i * n ;
+    columns.emplace_back ( c , c + n , c + 2 * n , c + 3 * n ) ;
+  }
+  //
+  m_results.resize ( n ) ;
+  Ostap::Kinematics::Batch::evaluate ( m_variable , n , columns , m_results.data () ) ;
+  m_first = entry ;
+}
+// ============================================================================
+// make the formulae
+// ============================================================================
+bool Ostap::Functions::FuncKinematics::make_formulae () const
+{
+  m_formulae.clear () ;
+  if ( nullptr == m_tree ) { return false ; }
+  TTree* t = const_cast<TTree*> ( m_tree ) ;
+  for ( const auto& e : m_expressions ) 
+  {
+    auto f = std::make_unique<Ostap::Formula> ( e , t ) ;
+    if ( !f || !f->ok () ) { m_formulae.clear () ; return false ; }
+    f->Notify () ;
+    m_formulae.push_back ( std::move ( f ) ) ;
+  }
+  return true ;
+}
+// ============================================================================
+//  evaluate the function for  TTree
+// ============================================================================
+double Ostap::Functions::FuncKinematics::operator() ( const TTree* tree ) const
+{
+  //
+  // the tree 
+  if ( tree != m_tree )
+  { 
+    m_tree = tree  ;
+    reset () ;
+  }
+  //
+  Ostap::Assert ( nullptr != m_tree , 
+                  "Invalid Tree"    , 
+                  "Ostap::Function::FuncKinematics" ) ;
+  //
+  // (1) block mode: plain leaves of the tree 
+  if ( m_plain < 0 ) { m_plain = ( 1 < m_block && make_leaves () ) ? 1 : 0 ; }
+  if ( 0 < m_plain ) 
+  {
+    const TTree* local = const_cast<TTree*> ( m_tree )->GetTree () ;
+    // new tree in the chain? 
+    if ( ( local != m_local || m_tree->GetTreeNumber () != m_number ) && !make_leaves () ) 
+    { m_plain = 0 ; }
+    else 
+    {
+      const long long entry = local->GetReadEntry () ;
+      if ( m_first < 0 || entry < m_first || 
+           (long long) m_results.size () <= entry - m_first ) 
+      { read_block ( local , entry ) ; }
+      return m_results [ entry - m_first ] ;                     // RETURN 
+    }
+  }
+  //
+  // (2) entry-by-entry mode: the formulae 
+  // check consistency
+  if ( !m_formulae.empty () && m_formulae.front ()->GetTree () != m_tree ) 
+  { m_formulae.clear () ; }
+  //
+  if ( m_formulae.empty () ) { make_formulae () ; }
+  Ostap::Assert ( m_formulae.size () == m_expressions.size () , 
+                  "Invalid formulae"                          , 
+                  "Ostap::Function::FuncKinematics"           ) ;
+  //
+  Ostap::LorentzVector vectors [ 4 ] ;
+  const unsigned short nv = nVectors () ;
+  for ( unsigned short i = 0 ; i < nv ; ++i ) 
+  {
+    vectors [ i ].SetPxPyPzE ( m_formulae [ 4 * i     ]->evaluate () ,
+                               m_formulae [ 4 * i + 1 ]->evaluate () ,
+                               m_formulae [ 4 * i + 2 ]->evaluate () ,
+                               m_formulae [ 4 * i + 3 ]->evaluate () ) ;
+  }
+  //
+  return Ostap::Kinematics::Batch::evaluate ( m_variable , vectors , nv ) ;
+}
+// ============================================================================
+// the expressions, used by the function
+// ============================================================================
+bool Ostap::Functions::FuncKinematics::expressions
+( std::vector<std::string>& result ) const 
+{
+  result.insert ( result.end () , m_expressions.begin () , m_expressions.end () ) ;
+  return true ;
+}
 
 
 
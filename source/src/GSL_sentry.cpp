@@ -12,6 +12,7 @@
 // Ostap 
 // ============================================================================
 #include "Ostap/Error2Exception.h"
+#include "Ostap/Instrumentation.h"
 #include "Ostap/ToStream.h"
 // ============================================================================
 // local
@@ -140,6 +141,9 @@ namespace
    */
   Cache s_cache ;
   // ==========================================================================
+  /// number of GSL errors (for all handlers)
+  const Ostap::Utils::Instrumentation::Counter s_ERRORS { "GSL::errors" } ;
+  // ==========================================================================
 
 
   // ==========================================================================
@@ -150,6 +154,7 @@ namespace
     int          line      ,
     int          gsl_errno ) 
   {
+    s_ERRORS.add () ;
     std::cerr 
       << " GSL_ERROR : "   
       << gsl_errno << "/'" << gsl_strerror ( gsl_errno ) << "'"
@@ -165,7 +170,7 @@ namespace
   ( const char * /* reason    */ ,
     const char * /* file      */ ,
     int          /* line      */ ,
-    int          /* gsl_errno */ ) {}
+    int          /* gsl_errno */ ) { s_ERRORS.add () ; }
   // ==========================================================================
   /// convert errors to exceptions 
   void GSL_exception_error
@@ -174,6 +179,7 @@ namespace
     int          line      ,
     int          gsl_errno ) 
   {
+    s_ERRORS.add () ;
     std::string tag = "GSL/Error" ;
     std::ostringstream ss ;
     ss << gsl_strerror ( gsl_errno ) << "(" << gsl_errno << ") "
@@ -191,6 +197,7 @@ namespace
     int          line      ,
     int          gsl_errno ) 
   {
+    s_ERRORS.add () ;
     s_cache.add ( reason , file , line , gsl_errno ) ;
   }
   // ==========================================================================
@@ -0,0 +1,270 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TAxis.h"
+#include "TArrayD.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/HistoFill.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_math.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::HistoFill
+ *  @see Ostap::Utils::HistoFill
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// can the histogram be filled in batch mode?
+  bool batch_ok ( const TH1* histo )
+  {
+    const TClass* c = histo->IsA () ;
+    if ( c != TH1D::Class () && c != TH1F::Class () &&
+         c != TH2D::Class () && c != TH2F::Class () &&
+         c != TH3D::Class () && c != TH3F::Class () ) { return false ; }
+    //
+    if ( nullptr != histo->GetBuffer () ) { return false ; }
+    //
+    if ( histo->GetXaxis ()->CanExtend () ) { return false ; }
+    if ( 2 <= histo->GetDimension () && histo->GetYaxis ()->CanExtend () ) { return false ; }
+    if ( 3 <= histo->GetDimension () && histo->GetZaxis ()->CanExtend () ) { return false ; }
+    //
+    return true ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// constructor
+// ============================================================================
+Ostap::Utils::HistoFill::HistoFill
+( TH1*              histo ,
+  const std::size_t block )
+  : m_histo     ( histo )
+  , m_h2        ( dynamic_cast<TH2*> ( histo ) )
+  , m_h3        ( dynamic_cast<TH3*> ( histo ) )
+  , m_block     ( std::max ( block , std::size_t ( 1 ) ) )
+{
+  Ostap::Assert ( nullptr != m_histo             ,
+                  "Invalid histogram!"           ,
+                  "Ostap::Utils::HistoFill"      ) ;
+  //
+  m_dimension = m_histo->GetDimension () ;
+  m_direct    = !batch_ok ( m_histo ) ;
+  if ( m_direct ) { return ; }
+  //
+  m_float     = nullptr != dynamic_cast<const TArrayF*> ( m_histo ) ;
+  m_overflows = m_histo->GetStatOverflowsBehaviour () ;
+  //
+  m_x  .resize ( m_block ) ;
+  m_y  .resize ( m_block ) ;
+  m_z  .resize ( m_block ) ;
+  m_w  .resize ( m_block ) ;
+  m_w2 .resize ( m_block ) ;
+  m_ix .resize ( m_block ) ;
+  if ( 2 <= m_dimension ) { m_iy.resize ( m_block ) ; }
+  if ( 3 <= m_dimension ) { m_iz.resize ( m_block ) ; }
+  //
+  const std::size_t ncells = m_histo->GetNcells () ;
+  if ( m_float ) { m_sumwf.resize ( ncells , 0.0f ) ; }
+  else           { m_sumw .resize ( ncells , 0.0  ) ; }
+  m_sumw2.resize ( ncells , 0.0 ) ;
+}
+// ============================================================================
+// destructor: flush the accumulated data
+// ============================================================================
+Ostap::Utils::HistoFill::~HistoFill () { flush () ; }
+// ============================================================================
+/*  compute the bin indices, exactly as TAxis::FindFixBin
+ *  @param axis the axis
+ *  @param n    number of values
+ *  @param x    (INPUT)  the values
+ *  @param bins (OUTPUT) the bin indices
+ */
+// ============================================================================
+void Ostap::Utils::HistoFill::find_bins
+( const TAxis&      axis ,
+  const std::size_t n    ,
+  const double*     x    ,
+  int*              bins )
+{
+  // non-uniform binning: binary search
+  if ( 0 < axis.GetXbins ()->GetSize () )
+  {
+    for ( std::size_t i = 0 ; i < n ; ++i ) { bins [ i ] = axis.FindFixBin ( x [ i ] ) ; }
+    return ;
+  }
+  //
+  const int    nb    = axis.GetNbins () ;
+  const double xmin  = axis.GetXmin  () ;
+  const double xmax  = axis.GetXmax  () ;
+  const double delta = xmax - xmin      ;
+  //
+  // uniform binning: branch-free (vectorisable) loop with the same arithmetic
+  // as TAxis::FindFixBin; underflows (overflows and NaNs) are mapped to
+  // -1 (nbins) before the conversion to int
+  const double under = -1 ;
+  const double over  = nb ;
+  for ( std::size_t i = 0 ; i < n ; ++i )
+  {
+    const double v = x [ i ] ;
+    const double t = nb * ( v - xmin ) / delta ;
+    const double s = v < xmin ? under : ( v < xmax ? t : over ) ;
+    bins [ i ] = 1 + int ( s ) ;
+  }
+}
+// ============================================================================
+// process the block
+// ============================================================================
+void Ostap::Utils::HistoFill::process ()
+{
+  if ( 0 == m_size ) { return ; }
+  //
+  const TAxis* xaxis = m_histo->GetXaxis () ;
+  const TAxis* yaxis = m_histo->GetYaxis () ;
+  const TAxis* zaxis = m_histo->GetZaxis () ;
+  //
+  find_bins (   *xaxis , m_size , m_x.data () , m_ix.data () ) ;
+  if ( 2 <= m_dimension ) { find_bins ( *yaxis , m_size , m_y.data () , m_iy.data () ) ; }
+  if ( 3 <= m_dimension ) { find_bins ( *zaxis , m_size , m_z.data () , m_iz.data () ) ; }
+  //
+  const int nx = xaxis->GetNbins () ;
+  const int ny = yaxis->GetNbins () ;
+  const int nz = zaxis->GetNbins () ;
+  //
+  // accumulate in the same order and with the same expressions as TH[123]::Fill
+  for ( std::size_t i = 0 ; i < m_size ; ++i )
+  {
+    const int bx = m_ix [ i ] ;
+    const int by = 2 <= m_dimension ? m_iy [ i ] : 0 ;
+    const int bz = 3 <= m_dimension ? m_iz [ i ] : 0 ;
+    const int bin = bx + ( nx + 2 ) * ( by + ( ny + 2 ) * bz ) ;
+    //
+    const double w  = m_w  [ i ] ;
+    const double w2 = m_w2 [ i ] ;
+    if ( 1.0    != w  ) { m_need_w2  = true ; }
+    if ( w * w  != w2 ) { m_force_w2 = true ; }
+    //
+    ++m_entries ;
+    if ( m_float ) { m_sumwf [ bin ] += float ( w ) ; }
+    else           { m_sumw  [ bin ] +=         w   ; }
+    m_sumw2 [ bin ] += w2 ;
+    //
+    // statistics: only for in-range bins (unless overflows are requested)
+    if ( !m_overflows &&
+         ( 0 == bx || nx < bx ||
+           ( 2 <= m_dimension && ( 0 == by || ny < by ) ) ||
+           ( 3 <= m_dimension && ( 0 == bz || nz < bz ) ) ) ) { continue ; }
+    //
+    const double x = m_x [ i ] ;
+    m_stats [ 0 ] += w       ;
+    m_stats [ 1 ] += w * w   ;
+    m_stats [ 2 ] += w * x   ;
+    m_stats [ 3 ] += w * x * x ;
+    if ( 2 <= m_dimension )
+    {
+      const double y = m_y [ i ] ;
+      m_stats [ 4 ] += w * y     ;
+      m_stats [ 5 ] += w * y * y ;
+      m_stats [ 6 ] += w * x * y ;
+      if ( 3 <= m_dimension )
+      {
+        const double z = m_z [ i ] ;
+        m_stats [ 7  ] += w * z     ;
+        m_stats [ 8  ] += w * z * z ;
+        m_stats [ 9  ] += w * x * z ;
+        m_stats [ 10 ] += w * y * z ;
+      }
+    }
+  }
+  //
+  m_size = 0 ;
+}
+// ============================================================================
+// write the accumulated data into the histogram
+// ============================================================================
+void Ostap::Utils::HistoFill::flush ()
+{
+  if ( m_direct ) { return ; }
+  //
+  process () ;
+  if ( 0 == m_entries ) { return ; }
+  //
+  // activate Sumw2 exactly when TH1::Fill/TH1::SetBinError would do it
+  if ( 0 == m_histo->GetSumw2N () &&
+       ( m_force_w2 || ( m_need_w2 && !m_histo->TestBit ( TH1::kIsNotW ) ) ) )
+  { m_histo->Sumw2 () ; }
+  //
+  const std::size_t ncells = m_histo->GetNcells () ;
+  for ( std::size_t bin = 0 ; bin < ncells ; ++bin )
+  {
+    const double value = m_float ? double ( m_sumwf [ bin ] ) : m_sumw [ bin ] ;
+    if ( value ) { m_histo->AddBinContent ( bin , value ) ; }
+  }
+  //
+  if ( 0 < m_histo->GetSumw2N () )
+  {
+    TArrayD* sumw2 = m_histo->GetSumw2 () ;
+    for ( std::size_t bin = 0 ; bin < ncells ; ++bin )
+    { sumw2->fArray [ bin ] += m_sumw2 [ bin ] ; }
+  }
+  //
+  double stats [ 11 ] = { 0 } ;
+  if ( 0 != m_histo->GetEntries () ) { m_histo->GetStats ( stats ) ; }
+  for ( unsigned int k = 0 ; k < 11 ; ++k ) { stats [ k ] += m_stats [ k ] ; }
+  m_histo->PutStats   ( stats ) ;
+  m_histo->SetEntries ( m_histo->GetEntries () + m_entries ) ;
+  //
+  // reset the accumulators
+  std::fill ( m_sumw  .begin () , m_sumw  .end () , 0.0  ) ;
+  std::fill ( m_sumwf .begin () , m_sumwf .end () , 0.0f ) ;
+  std::fill ( m_sumw2 .begin () , m_sumw2 .end () , 0.0  ) ;
+  std::fill ( m_stats , m_stats + 11 , 0.0 ) ;
+  m_entries  = 0     ;
+  m_need_w2  = false ;
+  m_force_w2 = false ;
+}
+// ============================================================================
+// fill the histogram directly
+// ============================================================================
+void Ostap::Utils::HistoFill::fill_direct
+( const double x  ,
+  const double y  ,
+  const double z  ,
+  const double w  ,
+  const double w2 )
+{
+  if      ( 3 == m_dimension && m_h3 ) { m_h3    -> Fill ( x , y , z , w ) ; }
+  else if ( 2 == m_dimension && m_h2 ) { m_h2    -> Fill ( x , y     , w ) ; }
+  else                                 { m_histo -> Fill ( x         , w ) ; }
+  //
+  if ( s_equal ( w2 , w * w ) ) { return ; }
+  //
+  // correct the sum of squared weights
+  const int    bin    =
+    3 == m_dimension ? m_histo -> FindBin ( x , y , z ) :
+    2 == m_dimension ? m_histo -> FindBin ( x , y     ) : m_histo -> FindBin ( x ) ;
+  const double binerr = m_histo -> GetBinError ( bin ) ;
+  const double err2   = binerr * binerr - w * w + w2 ;
+  m_histo -> SetBinError ( bin , std::sqrt ( std::max ( err2 , 0.0 ) ) ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
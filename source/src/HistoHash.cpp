@@ -2,13 +2,23 @@
 // ============================================================================
 // STD&STL
 // ============================================================================
+#include <cstdint>
+#include <cstring>
 #include <functional>
 // ============================================================================
 // ROOT 
 // ============================================================================
 #include "TH1.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfile3D.h"
 #include "TGraph.h"
 #include "TAxis.h"
+#include "TArrayC.h"
+#include "TArrayS.h"
+#include "TArrayI.h"
+#include "TArrayF.h"
+#include "TArrayD.h"
 // ============================================================================
 // Ostap
 // ============================================================================
@@ -23,6 +33,137 @@
  *  @date  2021-04-09 
  *  @author Vanya Belyaev Ivan.Belyaev@itep.ru
  */
+namespace 
+{
+  // ==========================================================================
+  // xxHash64 
+  // ==========================================================================
+  const std::uint64_t s_P1 = 0x9E3779B185EBCA87ULL ;
+  const std::uint64_t s_P2 = 0xC2B2AE3D27D4EB4FULL ;
+  const std::uint64_t s_P3 = 0x165667B19E3779F9ULL ;
+  const std::uint64_t s_P4 = 0x85EBCA77C2B2AE63ULL ;
+  const std::uint64_t s_P5 = 0x27D4EB2F165667C5ULL ;
+  // ==========================================================================
+  inline std::uint64_t rotl   ( const std::uint64_t x , const int r ) 
+  { return ( x << r ) | ( x >> ( 64 - r ) ) ; }
+  inline std::uint64_t read64 ( const unsigned char* p ) 
+  { std::uint64_t v ; std::memcpy ( &v , p , sizeof ( v ) ) ; return v ; }
+  inline std::uint32_t read32 ( const unsigned char* p ) 
+  { std::uint32_t v ; std::memcpy ( &v , p , sizeof ( v ) ) ; return v ; }
+  inline std::uint64_t xxround ( std::uint64_t acc , const std::uint64_t input ) 
+  {
+    acc += input * s_P2 ;
+    acc  = rotl ( acc , 31 ) ;
+    return acc * s_P1 ;
+  }
+  inline std::uint64_t xxmerge ( std::uint64_t acc , const std::uint64_t val ) 
+  {
+    acc ^= xxround ( 0 , val ) ;
+    return acc * s_P1 + s_P4 ;
+  }
+  // ==========================================================================
+  /** xxHash64: four independent lanes over 32-byte stripes 
+   *  @see https://github.com/Cyan4973/xxHash
+   */
+  std::uint64_t xxhash64 
+  ( const unsigned char* p    , 
+    const std::size_t    len  , 
+    const std::uint64_t  seed ) 
+  {
+    const unsigned char* const end = p + len ;
+    std::uint64_t h ;
+    if ( 32 <= len ) 
+    {
+      std::uint64_t v1 = seed + s_P1 + s_P2 ;
+      std::uint64_t v2 = seed + s_P2 ;
+      std::uint64_t v3 = seed ;
+      std::uint64_t v4 = seed - s_P1 ;
+      const unsigned char* const limit = end - 32 ;
+      do 
+      {
+        v1 = xxround ( v1 , read64 ( p      ) ) ;
+        v2 = xxround ( v2 , read64 ( p +  8 ) ) ;
+        v3 = xxround ( v3 , read64 ( p + 16 ) ) ;
+        v4 = xxround ( v4 , read64 ( p + 24 ) ) ;
+        p += 32 ;
+      } while ( p <= limit ) ;
+      h = rotl ( v1 , 1 ) + rotl ( v2 , 7 ) + rotl ( v3 , 12 ) + rotl ( v4 , 18 ) ;
+      h = xxmerge ( h , v1 ) ;
+      h = xxmerge ( h , v2 ) ;
+      h = xxmerge ( h , v3 ) ;
+      h = xxmerge ( h , v4 ) ;
+    }
+    else { h = seed + s_P5 ; }
+    //
+    h += len ;
+    for ( ; p + 8 <= end ; p += 8 ) 
+    {
+      h ^= xxround ( 0 , read64 ( p ) ) ;
+      h  = rotl ( h , 27 ) * s_P1 + s_P4 ;
+    }
+    if ( p + 4 <= end ) 
+    {
+      h ^= std::uint64_t ( read32 ( p ) ) * s_P1 ;
+      h  = rotl ( h , 23 ) * s_P2 + s_P3 ;
+      p += 4 ;
+    }
+    for ( ; p < end ; ++p ) 
+    {
+      h ^= ( *p ) * s_P5 ;
+      h  = rotl ( h , 11 ) * s_P1 ;
+    }
+    // avalanche 
+    h ^= h >> 33 ;
+    h *= s_P2 ;
+    h ^= h >> 29 ;
+    h *= s_P3 ;
+    h ^= h >> 32 ;
+    return h ;
+  }
+  // ==========================================================================
+  /// get the raw array of bin contents for the ordinary histogram 
+  template <class ARRAY>
+  bool raw_array ( const TH1* histo , const void*& data , std::size_t& size ) 
+  {
+    const ARRAY* a = dynamic_cast<const ARRAY*> ( histo ) ;
+    if ( nullptr == a || nullptr == a->GetArray () ) { return false ; }
+    data = a->GetArray () ;
+    size = a->GetSize  () * sizeof ( *a->GetArray () ) ;
+    return true ;
+  }
+  // ==========================================================================
+  bool raw_content ( const TH1* histo , const void*& data , std::size_t& size ) 
+  {
+    // the bin content of profiles is not the stored array 
+    if ( nullptr != dynamic_cast<const TProfile*>   ( histo ) || 
+         nullptr != dynamic_cast<const TProfile2D*> ( histo ) || 
+         nullptr != dynamic_cast<const TProfile3D*> ( histo ) ) { return false ; }
+    //
+    return 
+      raw_array<TArrayD> ( histo , data , size ) || 
+      raw_array<TArrayF> ( histo , data , size ) || 
+      raw_array<TArrayI> ( histo , data , size ) || 
+      raw_array<TArrayS> ( histo , data , size ) || 
+      raw_array<TArrayC> ( histo , data , size ) ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  get the fast (xxHash64) hash for the raw memory buffer 
+ *  @param data the buffer 
+ *  @param size the size of buffer in bytes 
+ *  @param seed the seed 
+ *  @return hash value 
+ */
+// ============================================================================
+std::size_t Ostap::Utils::hash_buffer 
+( const void*       data , 
+  const std::size_t size , 
+  const std::size_t seed ) 
+{
+  if ( nullptr == data || 0 == size ) { return seed ; }
+  return xxhash64 ( static_cast<const unsigned char*> ( data ) , size , seed ) ;
+}
 // ============================================================================
 /* get hash for the given graph 
  *  @param graph the graphs 
@@ -38,40 +179,40 @@ std::size_t Ostap::Utils::hash_graph
   std::size_t seed = N ;
   //
   const Double_t*  X    = graph->GetX       () ;
-  if ( X    ) { seed = std::hash_combine ( seed , std::hash_range ( X    , X    + N ) ) ; }
+  if ( X    ) { seed = hash_buffer ( X    , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  Y    = graph->GetY       () ;
-  if ( Y    ) { seed = std::hash_combine ( seed , std::hash_range ( Y    , Y    + N ) ) ; }
+  if ( Y    ) { seed = hash_buffer ( Y    , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EX   = graph->GetEX     () ;
-  if ( EX   ) { seed = std::hash_combine ( seed , std::hash_range ( EX   , EX   + N ) ) ; }
+  if ( EX   ) { seed = hash_buffer ( EX   , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EY   = graph->GetEY      () ;
-  if ( EY   ) { seed = std::hash_combine ( seed , std::hash_range ( EY   , EY   + N ) ) ; }
+  if ( EY   ) { seed = hash_buffer ( EY   , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EXh  = graph->GetEXhigh  () ;
-  if ( EXh  ) { seed = std::hash_combine ( seed , std::hash_range ( EXh  , EXh  + N ) ) ; }
+  if ( EXh  ) { seed = hash_buffer ( EXh  , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EXl  = graph->GetEXlow   () ;
-  if ( EXl  ) { seed = std::hash_combine ( seed , std::hash_range ( EXl  , EXl  + N ) ) ; }
+  if ( EXl  ) { seed = hash_buffer ( EXl  , N * sizeof ( Double_t ) , seed ) ; }
   //  
   const Double_t*  EYh  = graph->GetEYhigh  () ;
-  if ( EYh  ) { seed = std::hash_combine ( seed , std::hash_range ( EYh  , EYh  + N ) ) ; }
+  if ( EYh  ) { seed = hash_buffer ( EYh  , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EYl  = graph->GetEYlow   () ;
-  if ( EYl  ) { seed = std::hash_combine ( seed , std::hash_range ( EYl  , EYl  + N ) ) ; }
+  if ( EYl  ) { seed = hash_buffer ( EYl  , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EXhd = graph->GetEXhighd () ;
-  if ( EXhd ) { seed = std::hash_combine ( seed , std::hash_range ( EXhd , EXhd + N ) ) ; }
+  if ( EXhd ) { seed = hash_buffer ( EXhd , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EXld = graph->GetEXlowd  () ;
-  if ( EXld ) { seed = std::hash_combine ( seed , std::hash_range ( EXld , EXld + N ) ) ; }
+  if ( EXld ) { seed = hash_buffer ( EXld , N * sizeof ( Double_t ) , seed ) ; }
   //  
   const Double_t*  EYhd = graph->GetEYhighd () ;
-  if ( EYhd ) { seed = std::hash_combine ( seed , std::hash_range ( EYhd , EYhd + N ) ) ; }
+  if ( EYhd ) { seed = hash_buffer ( EYhd , N * sizeof ( Double_t ) , seed ) ; }
   //
   const Double_t*  EYld = graph->GetEYlowd  () ;
-  if ( EYld ) { seed = std::hash_combine ( seed , std::hash_range ( EYld , EYld + N ) ) ; }
+  if ( EYld ) { seed = hash_buffer ( EYld , N * sizeof ( Double_t ) , seed ) ; }
   //
   return seed ;
 }
@@ -94,7 +235,7 @@ std::size_t Ostap::Utils::hash_axis
   if ( A ) 
   {
     const Double_t* a = A->GetArray() ;
-    if ( a ) {  seed = std::hash_combine ( seed , a , a + A ->GetSize () ) ; }
+    if ( a ) {  seed = hash_buffer ( a , A->GetSize () * sizeof ( Double_t ) , seed ) ; }
   }
   //
   return seed ;
@@ -120,6 +261,19 @@ std::size_t Ostap::Utils::hash_histo
   seed = std::hash_combine ( seed , hash_axis ( histo->GetYaxis() ) ) ;
   seed = std::hash_combine ( seed , hash_axis ( histo->GetZaxis() ) ) ;
   //
+  // (1) the ordinary histograms: hash the raw arrays 
+  const void* data = nullptr ;
+  std::size_t size = 0       ;
+  if ( raw_content ( histo , data , size ) ) 
+  {
+    seed = hash_buffer ( data , size , seed ) ;
+    const TArrayD* sumw2 = histo->GetSumw2 () ;
+    if ( nullptr != sumw2 && 0 < sumw2->GetSize () ) 
+    { seed = hash_buffer ( sumw2->GetArray () , sumw2->GetSize () * sizeof ( Double_t ) , seed ) ; }
+    return seed ;                                                      // RETURN 
+  }
+  //
+  // (2) profiles: bin-by-bin 
   for ( int ix = 1 ; ix <= NX ; ++ix ) 
   { for ( int iy = 1 ; iy <= NY ; ++iy ) 
     { for ( int iz = 1 ; iz <= NZ ; ++iz ) 
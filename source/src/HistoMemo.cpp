@@ -0,0 +1,378 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TObject.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+#include "TH1.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/HistoHash.h"
+#include "Ostap/HistoMemo.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "local_hash.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::HistoMemo
+ *  @see Ostap::Utils::HistoMemo
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// default memory limit: 256MB
+  const std::size_t s_MAXMEMORY = 256 * 1024 * 1024 ;
+  /// default maximal number of objects
+  const std::size_t s_MAXSIZE   = 1000 ;
+  // ==========================================================================
+  /// the estimated memory for ROOT objects
+  std::size_t cost ( const TObject& object )
+  {
+    const TH1* h = dynamic_cast<const TH1*> ( &object ) ;
+    if ( nullptr == h ) { return sizeof ( TObject ) ; }
+    const std::size_t ncells = h->GetNcells () ;
+    return sizeof ( TH1 ) + ncells * sizeof ( double ) * ( 0 < h->GetSumw2N () ? 2 : 1 ) ;
+  }
+  // ==========================================================================
+  /// add the binning of the axis to the identity of the histogram
+  void add_axis ( const TAxis* axis , std::vector<double>& identity )
+  {
+    if ( nullptr == axis ) { return ; }
+    identity.push_back ( axis->GetNbins () ) ;
+    identity.push_back ( axis->GetXmin  () ) ;
+    identity.push_back ( axis->GetXmax  () ) ;
+    const TArrayD* edges = axis->GetXbins () ;
+    if ( nullptr != edges && 0 < edges->GetSize () )
+    { identity.insert ( identity.end () , edges->GetArray () , edges->GetArray () + edges->GetSize () ) ; }
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  the key from the hash (no histogram identity)
+ *  @param hash      the hash of the histogram
+ *  @param operation the name of the operation
+ *  @param params    the hash of the parameters
+ */
+// ============================================================================
+Ostap::Utils::HistoMemo::Key::Key
+( const std::size_t  hash      ,
+  const std::string& operation ,
+  const std::size_t  params    )
+  : m_hash      ( std::hash_combine ( hash , operation , params ) )
+  , m_content   ( hash      )
+  , m_operation ( operation )
+  , m_params    ( params    )
+  , m_type      ()
+  , m_identity  ()
+{}
+// ============================================================================
+/*  the key for the histogram
+ *  @param histo     the histogram
+ *  @param operation the name of the operation
+ *  @param params    the hash of the parameters
+ */
+// ============================================================================
+Ostap::Utils::HistoMemo::Key::Key
+( const TH1*         histo     ,
+  const std::string& operation ,
+  const std::size_t  params    )
+  : Key ( Ostap::Utils::hash_histo ( histo ) , operation , params )
+{
+  if ( nullptr == histo ) { return ; }
+  //
+  m_type = histo->ClassName () ;
+  //
+  const int dim = histo->GetDimension () ;
+  m_identity.push_back ( dim ) ;
+  add_axis (                histo->GetXaxis () , m_identity ) ;
+  if ( 2 <= dim ) { add_axis ( histo->GetYaxis () , m_identity ) ; }
+  if ( 3 <= dim ) { add_axis ( histo->GetZaxis () , m_identity ) ; }
+  m_identity.push_back ( histo->GetEntries      () ) ;
+  m_identity.push_back ( histo->GetSumOfWeights () ) ;
+}
+// ============================================================================
+// the estimated memory of the key
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::Key::memory () const
+{
+  return sizeof ( Key )
+    + m_operation.capacity ()
+    + m_type     .capacity ()
+    + m_identity .capacity () * sizeof ( double ) ;
+}
+// ============================================================================
+// compare all the components
+// ============================================================================
+bool Ostap::Utils::HistoMemo::Key::operator==
+( const Ostap::Utils::HistoMemo::Key& right ) const
+{
+  return
+    m_hash      == right.m_hash      &&
+    m_content   == right.m_content   &&
+    m_params    == right.m_params    &&
+    m_operation == right.m_operation &&
+    m_type      == right.m_type      &&
+    m_identity  == right.m_identity  ;
+}
+// ============================================================================
+// get the (process-wide) instance
+// ============================================================================
+Ostap::Utils::HistoMemo& Ostap::Utils::HistoMemo::instance ()
+{
+  static HistoMemo s_memo ;
+  return s_memo ;
+}
+// ============================================================================
+// constructor
+// ============================================================================
+Ostap::Utils::HistoMemo::HistoMemo ()
+  : m_mutex     ()
+  , m_lru       ()
+  , m_index     ()
+  , m_memory    ( 0           )
+  , m_maxmemory ( s_MAXMEMORY )
+  , m_maxsize   ( s_MAXSIZE   )
+  , m_hits      ( 0           )
+  , m_misses    ( 0           )
+  , m_collisions ( 0          )
+{}
+// ============================================================================
+/*  build the key
+ *  @param hash      the hash of the histogram
+ *  @param operation the name of the operation
+ *  @param params    the hash of the parameters
+ */
+// ============================================================================
+Ostap::Utils::HistoMemo::Key
+Ostap::Utils::HistoMemo::key
+( const std::size_t  hash      ,
+  const std::string& operation ,
+  const std::size_t  params    )
+{ return Key ( hash , operation , params ) ; }
+// ============================================================================
+/*  build the key
+ *  @param histo     the histogram
+ *  @param operation the name of the operation
+ *  @param params    the hash of the parameters
+ */
+// ============================================================================
+Ostap::Utils::HistoMemo::Key
+Ostap::Utils::HistoMemo::key
+( const TH1*         histo     ,
+  const std::string& operation ,
+  const std::size_t  params    )
+{ return Key ( histo , operation , params ) ; }
+// ============================================================================
+// find the object (and mark it as the most recently used)
+// ============================================================================
+std::shared_ptr<const void>
+Ostap::Utils::HistoMemo::find
+( const Ostap::Utils::HistoMemo::Key& key  ,
+  const std::type_info&               type )
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  auto it = m_index.find ( key.hash () ) ;
+  if ( m_index.end () == it || *it->second->type != type )
+  { ++m_misses ; return std::shared_ptr<const void> () ; }             // RETURN
+  //
+  // the same hash, but different key: the collision
+  if ( it->second->key != key )
+  { ++m_misses ; ++m_collisions ; return std::shared_ptr<const void> () ; } // RETURN
+  //
+  m_lru.splice ( m_lru.begin () , m_lru , it->second ) ;
+  ++m_hits ;
+  return it->second->object ;
+}
+// ============================================================================
+// insert the object, return the object in the memo
+// ============================================================================
+std::shared_ptr<const void>
+Ostap::Utils::HistoMemo::insert
+( const Ostap::Utils::HistoMemo::Key& key    ,
+  const std::type_info&               type   ,
+  std::shared_ptr<const void>         object ,
+  const std::size_t                   cost   )
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  //
+  auto it = m_index.find ( key.hash () ) ;
+  if ( m_index.end () != it )
+  {
+    // somebody else created it already
+    if ( *it->second->type == type && it->second->key == key )
+    { return it->second->object ; }                                    // RETURN
+    // different type or the collision: replace the entry
+    m_memory -= it->second->cost ;
+    m_lru.erase   ( it->second ) ;
+    m_index.erase ( it         ) ;
+  }
+  //
+  const std::size_t total = cost + key.memory () ;
+  //
+  // too large object: do not keep it
+  if ( m_maxmemory < total || 0 == m_maxsize ) { return object ; }     // RETURN
+  //
+  m_lru.push_front ( Entry { key , &type , object , total } ) ;
+  m_index [ key.hash () ] = m_lru.begin () ;
+  m_memory += total ;
+  //
+  shrink () ;
+  return object ;
+}
+// ============================================================================
+// drop the least recently used objects (lock must be held)
+// ============================================================================
+void Ostap::Utils::HistoMemo::shrink ()
+{
+  while ( !m_lru.empty () && ( m_maxmemory < m_memory || m_maxsize < m_lru.size () ) )
+  {
+    const Entry& last = m_lru.back () ;
+    m_memory -= last.cost ;
+    m_index.erase ( last.key.hash () ) ;
+    m_lru.pop_back () ;
+  }
+}
+// ============================================================================
+/*  store the copy of the object
+ *  @param key    the key
+ *  @param object the object
+ */
+// ============================================================================
+void Ostap::Utils::HistoMemo::store
+( const Ostap::Utils::HistoMemo::Key& key    ,
+  const TObject&                      object )
+{
+  TObject* c = object.Clone () ;
+  if ( nullptr == c ) { return ; }
+  TH1* h = dynamic_cast<TH1*> ( c ) ;
+  if ( nullptr != h ) { h->SetDirectory ( nullptr ) ; }
+  //
+  erase  ( key ) ;
+  insert ( key , typeid ( TObject ) , std::shared_ptr<const TObject> ( c ) , cost ( *c ) ) ;
+}
+// ============================================================================
+/*  get the new copy of the object from the memo
+ *  @param key    the key
+ *  @return the copy of the object (to be deleted by the caller) or nullptr
+ */
+// ============================================================================
+TObject* Ostap::Utils::HistoMemo::clone ( const Ostap::Utils::HistoMemo::Key& key )
+{
+  std::shared_ptr<const void> found = find ( key , typeid ( TObject ) ) ;
+  if ( !found ) { return nullptr ; }
+  //
+  TObject* c = static_cast<const TObject*> ( found.get () ) -> Clone () ;
+  TH1*     h = dynamic_cast<TH1*> ( c ) ;
+  if ( nullptr != h ) { h->SetDirectory ( nullptr ) ; }
+  return c ;
+}
+// ============================================================================
+// remove all objects
+// ============================================================================
+void Ostap::Utils::HistoMemo::clear ()
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  m_index.clear () ;
+  m_lru  .clear () ;
+  m_memory = 0 ;
+  m_hits       = 0 ;
+  m_misses     = 0 ;
+  m_collisions = 0 ;
+}
+// ============================================================================
+// remove the object
+// ============================================================================
+bool Ostap::Utils::HistoMemo::erase ( const Ostap::Utils::HistoMemo::Key& key )
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  auto it = m_index.find ( key.hash () ) ;
+  if ( m_index.end () == it || it->second->key != key ) { return false ; }
+  m_memory -= it->second->cost ;
+  m_lru.erase   ( it->second ) ;
+  m_index.erase ( it         ) ;
+  return true ;
+}
+// ============================================================================
+// number of objects
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::size () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_lru.size () ;
+}
+// ============================================================================
+// the estimated memory used by the objects
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::memory () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_memory ;
+}
+// ============================================================================
+// the memory limit (bytes)
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::maxMemory () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_maxmemory ;
+}
+// ============================================================================
+// the maximal number of objects
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::maxSize () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_maxsize ;
+}
+// ============================================================================
+// set the memory limit (bytes)
+// ============================================================================
+void Ostap::Utils::HistoMemo::setMaxMemory ( const std::size_t value )
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  m_maxmemory = value ;
+  shrink () ;
+}
+// ============================================================================
+// set the maximal number of objects
+// ============================================================================
+void Ostap::Utils::HistoMemo::setMaxSize ( const std::size_t value )
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  m_maxsize = value ;
+  shrink () ;
+}
+// ============================================================================
+// number of hits
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::hits () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_hits ;
+}
+// ============================================================================
+// number of misses
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::misses () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_misses ;
+}
+// ============================================================================
+// number of hash collisions (counted also as misses)
+// ============================================================================
+std::size_t Ostap::Utils::HistoMemo::collisions () const
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  return m_collisions ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
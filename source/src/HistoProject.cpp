@@ -14,7 +14,9 @@
 #include "Ostap/Formula.h"
 #include "Ostap/FormulaVar.h"
 #include "Ostap/HistoProject.h"
+#include "Ostap/HistoFill.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 #include "OstapDataFrame.h"
 #include "local_math.h"
@@ -33,6 +35,11 @@ namespace
   static_assert (std::numeric_limits<unsigned long>::is_specialized   , 
                  "Numeric_limist<unsigned long> are not specialized!" ) ;
   // ========================================================================== 
+  /// instrumentation: the loops over RooAbsData 
+  const Ostap::Utils::Instrumentation::Timer s_DATA_LOOP  { "HistoProject/RooAbsData" } ;
+  /// instrumentation: the event loops for DataFrame 
+  const Ostap::Utils::Instrumentation::Timer s_FRAME_LOOP { "HistoProject/DataFrame"  } ;
+  // ========================================================================== 
   /// get variable by name from RooArgSet
   RooAbsReal* get_var ( const RooArgSet&   aset , 
                         const std::string& name ) 
@@ -73,6 +80,10 @@ Ostap::HistoProject::project
   const double xmin = histo->GetXaxis()->GetXmin () ;
   const double xmax = histo->GetXaxis()->GetXmax () ;
   //
+  // batch filler: the histogram is updated once, at the end 
+  Ostap::Utils::HistoFill filler ( histo ) ;
+  //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , nEntries - first ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )   
   {
     //
@@ -96,23 +107,21 @@ Ostap::HistoProject::project
     // check the range 
     if ( xmax <= xvalue || xvalue < xmin ) { continue ; }
     //
-    // fill the histogram  (only for non-zero weights and in-range entries!)
-    histo -> Fill ( xvalue , w ) ; 
-    //
+    // the sum of squared weights 
+    double w2 = w * w ;
     if  ( weighted )
     {
       const double dwe = data -> weightError ( RooAbsData::SumW2 ) ;
       const double we  = ( dwe ? dwe : dw ) * sw ;
-      if  ( !s_equal ( we , w ) )
-      {
-        const int    bin    = histo -> FindBin     ( xvalue ) ;
-        const double binerr = histo -> GetBinError ( bin    ) ;
-        const double err2   = binerr * binerr - w * w + we * we  ;
-        histo -> SetBinError ( bin , std::sqrt ( err2 ) ) ;  
-      }
+      if  ( !s_equal ( we , w ) ) { w2 = we * we ; }
     }
+    //
+    // fill the histogram  (only for non-zero weights and in-range entries!)
+    filler.fill  ( xvalue , w , w2 ) ;
   }
   //
+  filler.flush () ;
+  //
   return StatusCode::SUCCESS ;  
 }
 // ============================================================================
@@ -150,6 +159,10 @@ Ostap::HistoProject::project2
   const double ymin = histo -> GetYaxis () -> GetXmin () ;
   const double ymax = histo -> GetYaxis () -> GetXmax () ;
   //
+  // batch filler: the histogram is updated once, at the end 
+  Ostap::Utils::HistoFill filler ( histo ) ;
+  //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , nEntries - first ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )   
   {
     //
@@ -176,23 +189,21 @@ Ostap::HistoProject::project2
     // check the range 
     if ( ymax <= yvalue || yvalue < ymin ) { continue ; }
     //
-    // fill the histogram  (only for non-zero weights)
-    histo->Fill ( xvalue , yvalue , w ) ; 
-    //
+    // the sum of squared weights 
+    double w2 = w * w ;
     if  ( weighted )
     {
       const double dwe = data -> weightError ( RooAbsData::SumW2 ) ;
       const double we  = ( dwe ? dwe : dw ) * sw ;
-      if  ( !s_equal ( we , w ) ) 
-      {
-        const int    bin    = histo -> FindBin     ( xvalue , yvalue ) ;
-        const double binerr = histo -> GetBinError ( bin    ) ;
-        const double err2   = binerr * binerr - w * w + we * we  ;
-        histo -> SetBinError ( bin , std::sqrt ( err2 ) ) ;  
-      }
+      if  ( !s_equal ( we , w ) ) { w2 = we * we ; }
     }
+    //
+    // fill the histogram  (only for non-zero weights and in-range entries!)
+    filler.fill2 ( xvalue , yvalue , w , w2 ) ;
   }
   //
+  filler.flush () ;
+  //
   return StatusCode::SUCCESS ;  
 }
 // ============================================================================
@@ -234,6 +245,10 @@ Ostap::HistoProject::project3
   const double zmin = histo -> GetZaxis () -> GetXmin () ;
   const double zmax = histo -> GetZaxis () -> GetXmax () ;
   //
+  // batch filler: the histogram is updated once, at the end 
+  Ostap::Utils::HistoFill filler ( histo ) ;
+  //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , nEntries - first ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )   
   {
     //
@@ -261,23 +276,21 @@ Ostap::HistoProject::project3
     const double zvalue = zexpression.getVal()  ;
     if ( zmax <= zvalue || zvalue < zmin ) { continue ; }
     //
-    // fill the histogram  (only for non-zero weights)
-    histo->Fill ( xvalue , yvalue , zvalue , w ) ; 
-    //
+    // the sum of squared weights 
+    double w2 = w * w ;
     if  ( weighted )
     {
       const double dwe = data -> weightError ( RooAbsData::SumW2 ) ;
       const double we  = ( dwe ? dwe : dw ) * sw ;
-      if  ( !s_equal ( we , w ) )
-      {
-        const int    bin    = histo -> FindBin     ( xvalue , yvalue , zvalue ) ;
-        const double binerr = histo -> GetBinError ( bin    ) ;
-        const double err2   = binerr * binerr - w * w + we * we  ;
-        histo -> SetBinError ( bin , std::sqrt ( err2 ) ) ;  
-      }
+      if  ( !s_equal ( we , w ) ) { w2 = we * we ; }
     }
+    //
+    // fill the histogram  (only for non-zero weights and in-range entries!)
+    filler.fill3 ( xvalue , yvalue , zvalue , w , w2 ) ;
   }
   //
+  filler.flush () ;
+  //
   return StatusCode::SUCCESS ;  
 }
 // ============================================================================
@@ -512,6 +525,7 @@ Ostap::StatusCode Ostap::HistoProject::project
   const std::string xvar   = Ostap::tmp_name ( "vx_" , expression ) ;
   const std::string weight = Ostap::tmp_name ( "w_"  , selection  ) ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_FRAME_LOOP ) ;
   auto h = data
     .Define  ( xvar   ,                   "1.0*(" + expression + ")" )
     .Define  ( weight , no_cuts ? "1.0" : "1.0*(" + selection  + ")" ) 
@@ -550,6 +564,7 @@ Ostap::StatusCode Ostap::HistoProject::project2
   //
   TH2D model {} ; histo->Copy ( model ) ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_FRAME_LOOP ) ;
   auto h = data
     .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
     .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
@@ -586,12 +601,13 @@ Ostap::StatusCode Ostap::HistoProject::project3
   //
   const std::string xvar   = Ostap::tmp_name ( "vx_" , xexpression ) ;
   const std::string yvar   = Ostap::tmp_name ( "vy_" , yexpression ) ;
-  const std::string zvar   = Ostap::tmp_name ( "vz_" , yexpression ) ;
+  const std::string zvar   = Ostap::tmp_name ( "vz_" , zexpression ) ;
   const std::string weight = Ostap::tmp_name ( "w_"  , selection   ) ;
   //
   //
   TH3D model {} ; histo->Copy ( model ) ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_FRAME_LOOP ) ;
   auto h = data
     .Define  ( xvar   ,                   "1.0*(" + xexpression + ")" )
     .Define  ( yvar   ,                   "1.0*(" + yexpression + ")" )
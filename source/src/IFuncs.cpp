@@ -15,6 +15,11 @@
 // ============================================================================
 Ostap::IFuncTree::~IFuncTree(){}
 // ============================================================================
+// the expressions are unknown by default 
+// ============================================================================
+bool Ostap::IFuncTree::expressions ( std::vector<std::string>& /* result */ ) const 
+{ return false ; }
+// ============================================================================
 // desructor
 // ============================================================================
 Ostap::IFuncData::~IFuncData (){}
@@ -0,0 +1,236 @@
+// ============================================================================
+// Include files
+// ============================================================================
+//   STD&STL
+// ============================================================================
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Instrumentation.h"
+// ============================================================================
+/** @file
+ *  Implementation file for the instrumentation utilities
+ *  @see Ostap/Instrumentation.h
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// maximal number of counters and timers, the last slot collects overflows
+  const unsigned int s_MAXSLOTS = 512 ;
+  // ==========================================================================
+  /** @struct Slot
+   *  the storage for the counter/timer:
+   *  written only by the owner thread, read by the snapshot
+   */
+  struct Slot
+  {
+    std::atomic<unsigned long long> count { 0 } ;
+    std::atomic<unsigned long long> items { 0 } ;
+    std::atomic<long long>          ns    { 0 } ;
+  } ;
+  // ==========================================================================
+  /// the per-thread storage
+  typedef std::array<Slot,s_MAXSLOTS> Slots ;
+  // ==========================================================================
+  /// single-writer increment: no need for the atomic read-modify-write
+  template <class TYPE>
+  inline void bump ( std::atomic<TYPE>& a , const TYPE value )
+  { a.store ( a.load ( std::memory_order_relaxed ) + value , std::memory_order_relaxed ) ; }
+  // ==========================================================================
+  /** @class Registry
+   *  the registry of names and per-thread storages
+   */
+  class Registry
+  {
+  public:
+    // ========================================================================
+    static Registry& instance ()
+    {
+      static Registry s_registry ;
+      return s_registry ;
+    }
+    // ========================================================================
+    /// get the slot index for the name
+    unsigned int index ( const std::string& name , const bool timer )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      auto it = m_indices.find ( name ) ;
+      if ( m_indices.end () != it ) { return it->second ; }
+      if ( s_MAXSLOTS - 1 <= m_names.size () ) { return s_MAXSLOTS - 1 ; }
+      const unsigned int i = m_names.size () ;
+      m_names  .push_back ( name  ) ;
+      m_timers .push_back ( timer ) ;
+      m_indices [ name ] = i ;
+      return i ;
+    }
+    // ========================================================================
+    std::string name ( const unsigned int index )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      return index < m_names.size () ? m_names [ index ] : "<overflow>" ;
+    }
+    // ========================================================================
+    void attach ( Slots* slots )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      m_live.insert ( slots ) ;
+    }
+    // ========================================================================
+    /// the thread is finished: keep its counts
+    void detach ( Slots* slots )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      m_live.erase ( slots ) ;
+      for ( unsigned int i = 0 ; i < s_MAXSLOTS ; ++i )
+      {
+        bump ( m_retired [ i ].count , (*slots) [ i ].count.load ( std::memory_order_relaxed ) ) ;
+        bump ( m_retired [ i ].items , (*slots) [ i ].items.load ( std::memory_order_relaxed ) ) ;
+        bump ( m_retired [ i ].ns    , (*slots) [ i ].ns   .load ( std::memory_order_relaxed ) ) ;
+      }
+    }
+    // ========================================================================
+    std::vector<Ostap::Utils::Instrumentation::Record> snapshot ( const bool all )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      std::vector<Ostap::Utils::Instrumentation::Record> result ;
+      const unsigned int n = m_names.size () ;
+      for ( unsigned int i = 0 ; i < s_MAXSLOTS ; ++i )
+      {
+        if ( n <= i && s_MAXSLOTS - 1 != i ) { continue ; }
+        Ostap::Utils::Instrumentation::Record r ;
+        r.name  = i < n ? m_names  [ i ] : "<overflow>" ;
+        r.timer = i < n ? m_timers [ i ] : false        ;
+        long long ns = m_retired [ i ].ns.load ( std::memory_order_relaxed ) ;
+        r.count = m_retired [ i ].count.load ( std::memory_order_relaxed ) ;
+        r.items = m_retired [ i ].items.load ( std::memory_order_relaxed ) ;
+        for ( const Slots* s : m_live )
+        {
+          r.count += (*s) [ i ].count.load ( std::memory_order_relaxed ) ;
+          r.items += (*s) [ i ].items.load ( std::memory_order_relaxed ) ;
+          ns      += (*s) [ i ].ns   .load ( std::memory_order_relaxed ) ;
+        }
+        r.time = 1.e-9 * ns ;
+        if ( all || 0 < r.count ) { result.push_back ( r ) ; }
+      }
+      return result ;
+    }
+    // ========================================================================
+    void reset ()
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      for ( unsigned int i = 0 ; i < s_MAXSLOTS ; ++i )
+      {
+        clear ( m_retired [ i ] ) ;
+        for ( Slots* s : m_live ) { clear ( (*s) [ i ] ) ; }
+      }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    static void clear ( Slot& s )
+    {
+      s.count.store ( 0 , std::memory_order_relaxed ) ;
+      s.items.store ( 0 , std::memory_order_relaxed ) ;
+      s.ns   .store ( 0 , std::memory_order_relaxed ) ;
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    std::mutex                         m_mutex   {} ;
+    std::vector<std::string>           m_names   {} ;
+    std::vector<bool>                  m_timers  {} ;
+    std::map<std::string,unsigned int> m_indices {} ;
+    std::set<Slots*>                   m_live    {} ;
+    Slots                              m_retired {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** @struct Local
+   *  the per-thread storage, allocated at the first use
+   */
+  struct Local
+  {
+    Local  () : m_slots ( new Slots () ) { Registry::instance ().attach ( m_slots.get () ) ; }
+    ~Local ()                            { Registry::instance ().detach ( m_slots.get () ) ; }
+    std::unique_ptr<Slots> m_slots ;
+  } ;
+  // ==========================================================================
+  /// get the slots for the current thread
+  inline Slots& local ()
+  {
+    static thread_local Local s_local ;
+    return *s_local.m_slots ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// the global switch
+// ============================================================================
+std::atomic<bool> Ostap::Utils::Instrumentation::details::s_enabled { false } ;
+// ============================================================================
+// enable/disable the instrumentation, return the previous value
+// ============================================================================
+bool Ostap::Utils::Instrumentation::setEnabled ( const bool value )
+{ return details::s_enabled.exchange ( value ) ; }
+// ============================================================================
+// get the snapshot of all counters and timers
+// ============================================================================
+std::vector<Ostap::Utils::Instrumentation::Record>
+Ostap::Utils::Instrumentation::snapshot ( const bool all )
+{ return Registry::instance ().snapshot ( all ) ; }
+// ============================================================================
+// reset all counters and timers
+// ============================================================================
+void Ostap::Utils::Instrumentation::reset () { Registry::instance ().reset () ; }
+// ============================================================================
+// Counter
+// ============================================================================
+Ostap::Utils::Instrumentation::Counter::Counter ( const std::string& name )
+  : m_index ( Registry::instance ().index ( name , false ) )
+{}
+// ============================================================================
+std::string Ostap::Utils::Instrumentation::Counter::name () const
+{ return Registry::instance ().name ( m_index ) ; }
+// ============================================================================
+void Ostap::Utils::Instrumentation::Counter::increment
+( const unsigned int       index ,
+  const unsigned long long n     )
+{ bump ( local () [ index ].count , n ) ; }
+// ============================================================================
+// Timer
+// ============================================================================
+Ostap::Utils::Instrumentation::Timer::Timer ( const std::string& name )
+  : m_index ( Registry::instance ().index ( name , true ) )
+{}
+// ============================================================================
+std::string Ostap::Utils::Instrumentation::Timer::name () const
+{ return Registry::instance ().name ( m_index ) ; }
+// ============================================================================
+// Scope
+// ============================================================================
+long long Ostap::Utils::Instrumentation::Scope::now ()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>
+    ( std::chrono::steady_clock::now ().time_since_epoch () ).count () ;
+}
+// ============================================================================
+void Ostap::Utils::Instrumentation::Scope::stop ()
+{
+  Slot& s = local () [ m_index ] ;
+  bump ( s.count , 1ULL              ) ;
+  bump ( s.items , m_items           ) ;
+  bump ( s.ns    , now () - m_start  ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -12,6 +12,7 @@
 // Ostap
 // ============================================================================
 #include "Ostap/GSL_utils.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 // GSL
 // ============================================================================
@@ -107,6 +108,7 @@ namespace Ostap
           //
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -153,6 +155,7 @@ namespace Ostap
           //
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -199,6 +202,7 @@ namespace Ostap
           //
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -245,6 +249,7 @@ namespace Ostap
                                                      line       ) ; }
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -296,6 +301,7 @@ namespace Ostap
           
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -350,6 +356,7 @@ namespace Ostap
                                                     line       ) ; }
           // setup GSL 
           Ostap::Math::GSL::GSL_Error_Handler sentry ;
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
           //
           double    result =  1.0 ;
           double    error  = -1.0 ;
@@ -398,10 +405,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical integration using GSL 
           Result result = gaq_integrate ( func ,
                                           xlow ,  xhigh , 
@@ -445,10 +453,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical inntegration using GSL 
           Result result = gaqi_integrate ( func       ,
                                            workspace  , 
@@ -492,10 +501,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical inntegration using GSL 
           Result result = gaqiu_integrate ( func       ,
                                             xlow       ,
@@ -540,10 +550,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical inntegration using GSL 
           Result result = gaqil_integrate ( func       ,
                                             xhigh      ,
@@ -590,10 +601,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical inntegration using GSL 
           Result result = gaqp_integrate ( func       ,
                                            xlow       ,
@@ -645,10 +657,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find  ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform numerical integration using GSL 
           Result result = gawc_integrate ( func       ,
                                            xlow       ,
@@ -683,6 +696,22 @@ namespace Ostap
           return (*f) ( x ) ;
         }
         // ====================================================================
+      private:
+        // ====================================================================
+        /// instrumentation: the timer for integrations 
+        static const Ostap::Utils::Instrumentation::Timer& timer () 
+        {
+          static const Ostap::Utils::Instrumentation::Timer s_timer { "Integrator1D::integrate" } ;
+          return s_timer ;
+        }
+        /// instrumentation: count cache hits and misses 
+        static void count_cache ( const bool hit ) 
+        {
+          static const Ostap::Utils::Instrumentation::Counter s_hits   { "Integrator1D::cache-hit"  } ;
+          static const Ostap::Utils::Instrumentation::Counter s_misses { "Integrator1D::cache-miss" } ;
+          ( hit ? s_hits : s_misses ).add () ;
+        }
+        // ====================================================================
       private:
         // ====================================================================
         typedef std::map<std::size_t,Result>  MAP   ;
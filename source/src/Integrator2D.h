@@ -7,6 +7,14 @@
 // STD&STL
 // ============================================================================
 #include <map>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Instrumentation.h"
+#include "Ostap/ThreadPool.h" // parallel loops 
 // ============================================================================
 // Local 
 // ============================================================================
@@ -25,6 +33,22 @@ namespace Ostap
     namespace GSL 
     {
       // ======================================================================
+      /** @struct HasBatch2D 
+       *  does the function have the batch kernel 
+       *  <code>void evaluate ( n , x , y , result ) const</code> ?
+       */
+      template <class FUNCTION, class = void>
+      struct HasBatch2D : std::false_type {} ;
+      template <class FUNCTION>
+      struct HasBatch2D
+      < FUNCTION , 
+        decltype ( std::declval<const FUNCTION&> ().evaluate 
+                   ( std::size_t () , 
+                     static_cast<const double*> ( nullptr ) , 
+                     static_cast<const double*> ( nullptr ) , 
+                     static_cast<double*>       ( nullptr ) ) ) > 
+        : std::true_type {} ;
+      // ======================================================================
       /** @class Integrator2D  Integrator2D.h 
        *  Helper class to simplify operations with integration of 2D-functions 
        *  @see https://www.gnu.org/software/gsl/doc/html/integration.html
@@ -38,19 +62,42 @@ namespace Ostap
         // ====================================================================
         struct Fun 
         {
-          integrand  fun     ;
-          void*      fdata   ;
-          double     min [2] ;
-          double     max [2] ;
+          integrand   fun     ;
+          integrand_v funv    ; // vectorized integrand 
+          void*       fdata   ;
+          double      min [2] ;
+          double      max [2] ;
         } ;  
         // ====================================================================
+        /** create the integrand 
+         *  @param f        the function 
+         *  @param xmin     lower integration edge in x 
+         *  @param xmax     upper integration edge in x 
+         *  @param ymin     lower integration edge in y 
+         *  @param ymax     upper integration edge in y 
+         *  @param parallel evaluate large batches of points in parallel?
+         *  @attention for <code>parallel=true</code> the function 
+         *             is copied for each chunk of points, 
+         *             and the copies are used concurrently, 
+         *             it is used only for the <code>PS2DPol*</code> models;
+         *             <code>DalitzIntegrator</code> and 
+         *             <code>Integrator::integrate2</code> stay serial, 
+         *             since their integrands can wrap python callables 
+         *  If the function has the batch kernel 
+         *  <code>evaluate ( n , x , y , result )</code>, 
+         *  the batches of points from cubature are passed to it, 
+         *  otherwise the function is called point-by-point 
+         *  @see Ostap::Math::GSL::HasBatch2D 
+         */
         Fun make_function ( const FUNCTION* f                     , 
                             const double xmin , const double xmax , 
-                            const double ymin , const double ymax ) const 
+                            const double ymin , const double ymax , 
+                            const bool   parallel = false         ) const 
         {
           Fun F ;
           F.fdata   = const_cast<FUNCTION*>( f ) ;
           F.fun     = &adapter2d ;
+          F.funv    = parallel ? &adapter2d_vp : &adapter2d_v ;
           F.min [0] = xmin ;
           F.min [1] = ymin ;
           F.max [0] = xmax ;
@@ -79,9 +126,20 @@ namespace Ostap
                                               file       , 
                                               line       ) ; }
           //
+          const Ostap::Utils::Instrumentation::Scope scope ( timer () ) ;
+          //
           double result =  1 ;        
           double error  = -1 ;
-          const int ierror = hcubature 
+          const int ierror = nullptr != fun -> funv ? 
+            hcubature_v 
+            ( 1 , fun -> funv  , fun->fdata , // f-dimension, function  & data 
+              2 , fun -> min   , fun->max   , // dimension and integration range 
+              maxcalls         ,              // maximal number of  function calls 
+              aprecision       ,              // absolute precision 
+              rprecision       ,              // relative precision
+              ERROR_INDIVIDUAL ,              // error norm 
+              &result, &error  ) :            // output: result&error
+            hcubature 
             ( 1 , fun -> fun   , fun->fdata , // f-dimension, function  & data 
               2 , fun -> min   , fun->max   , // dimension and integration range 
               maxcalls         ,              // maximal number of  function calls 
@@ -114,10 +172,11 @@ namespace Ostap
           { // look into the cache ============================================
             CACHE::Lock lock { s_cache.mutex() } ;
             auto it = s_cache->find ( key ) ;
-            if ( s_cache->end() != it ) {  return it->second ; }  // AVOID calculation
+            if ( s_cache->end() != it ) { count_cache ( true ) ; return it->second ; }  // AVOID calculation
             // ================================================================
           } // ================================================================
           // ==================================================================
+          count_cache ( false ) ;
           // perform the numerical integration via the cubature method 
           Result result = cubature ( fun      , 
                                      maxcalls , aprecision , rprecision  , 
@@ -155,6 +214,128 @@ namespace Ostap
           return 0 ;
         }
         // ====================================================================
+        /// the actual vectorized adapter for cubature: batch of npt points 
+        static int adapter2d_v
+        ( unsigned      ndim  , 
+          std::size_t   npt   , 
+          const double* x     , 
+          void*         fdata ,
+          unsigned      fdim  , 
+          double*       fval  )   
+        {
+          if ( 1       != fdim  || 
+               2       != ndim  || 
+               nullptr == x     || 
+               nullptr == fdata || 
+               nullptr == fval  ) { return 1 ; }
+          const FUNCTION* f = (FUNCTION*) fdata  ;
+          evaluate ( *f , 0 , npt , x , fval ) ;
+          return 0 ;
+        }
+        // ====================================================================
+        /** the actual vectorized adapter for cubature: batch of npt points, 
+         *  large batches are spread over the threads, 
+         *  each chunk is evaluated with its own copy of the function
+         *  @see Ostap::Utils::ThreadPool 
+         */
+        static int adapter2d_vp
+        ( unsigned      ndim  , 
+          std::size_t   npt   , 
+          const double* x     , 
+          void*         fdata ,
+          unsigned      fdim  , 
+          double*       fval  )   
+        {
+          if ( 1       != fdim  || 
+               2       != ndim  || 
+               nullptr == x     || 
+               nullptr == fdata || 
+               nullptr == fval  ) { return 1 ; }
+          const FUNCTION* f = (FUNCTION*) fdata  ;
+          //
+          if ( npt < 2 * s_GRAIN || 
+               Ostap::Utils::ThreadPool::inWorker () || 
+               Ostap::Utils::ThreadPool::nThreads () <= 1 ) 
+          { evaluate ( *f , 0 , npt , x , fval ) ; return 0 ; }
+          //
+          Ostap::Utils::ThreadPool::parallel_for 
+            ( npt , 
+              [f,x,fval] ( const std::size_t begin , const std::size_t end )
+              {
+                const FUNCTION fc { *f } ; // local copy  
+                evaluate ( fc , begin , end , x , fval ) ;
+              } , s_GRAIN ) ;
+          //
+          return 0 ;
+        }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// evaluate the function for points [begin,end) 
+        static inline void evaluate 
+        ( const FUNCTION&   f     , 
+          const std::size_t begin , 
+          const std::size_t end   , 
+          const double*     x     , 
+          double*           fval  ) 
+        { evaluate ( f , begin , end , x , fval , HasBatch2D<FUNCTION> () ) ; }
+        // ====================================================================
+        /// evaluate the function for points [begin,end): point-by-point 
+        static inline void evaluate 
+        ( const FUNCTION&   f     , 
+          const std::size_t begin , 
+          const std::size_t end   , 
+          const double*     x     , 
+          double*           fval  , 
+          std::false_type         ) 
+        {
+          for ( std::size_t i = begin ; i < end ; ++i ) 
+          { fval [ i ] = f ( x [ 2 * i ] , x [ 2 * i + 1 ] ) ; }
+        }
+        // ====================================================================
+        /** evaluate the function for points [begin,end): batch kernel,
+         *  the interleaved points from cubature are split into 
+         *  the blocks of x- and y-values
+         */
+        static inline void evaluate 
+        ( const FUNCTION&   f     , 
+          const std::size_t begin , 
+          const std::size_t end   , 
+          const double*     x     , 
+          double*           fval  , 
+          std::true_type          ) 
+        {
+          const std::size_t block = 256 ;
+          double xs [ block ] ;
+          double ys [ block ] ;
+          for ( std::size_t i = begin ; i < end ; i += block ) 
+          {
+            const std::size_t n = std::min ( end - i , block ) ;
+            for ( std::size_t k = 0 ; k < n ; ++k ) 
+            {
+              xs [ k ] = x [ 2 * ( i + k )     ] ;
+              ys [ k ] = x [ 2 * ( i + k ) + 1 ] ;
+            }
+            f.evaluate ( n , xs , ys , fval + i ) ;
+          }
+        }
+        // ====================================================================
+      private:
+        // ====================================================================
+        /// instrumentation: the timer for integrations 
+        static const Ostap::Utils::Instrumentation::Timer& timer () 
+        {
+          static const Ostap::Utils::Instrumentation::Timer s_timer { "Integrator2D::integrate" } ;
+          return s_timer ;
+        }
+        /// instrumentation: count cache hits and misses 
+        static void count_cache ( const bool hit ) 
+        {
+          static const Ostap::Utils::Instrumentation::Counter s_hits   { "Integrator2D::cache-hit"  } ;
+          static const Ostap::Utils::Instrumentation::Counter s_misses { "Integrator2D::cache-miss" } ;
+          ( hit ? s_hits : s_misses ).add () ;
+        }
+        // ====================================================================
       private:
         // ====================================================================
         typedef std::map<std::size_t,Result>  MAP   ;
@@ -162,6 +343,8 @@ namespace Ostap
         /// the actual integration cache 
         static CACHE              s_cache     ; // integration cache 
         static const unsigned int s_CACHESIZE ; // cache size 
+        /// minimal number of points per thread for parallel evaluation 
+        static const std::size_t  s_GRAIN     ; // minimal chunk size 
         // ====================================================================
       };  
       // ======================================================================
@@ -172,6 +355,9 @@ namespace Ostap
       template <class FUNCTION>
       const unsigned int Integrator2D<FUNCTION>::s_CACHESIZE = 50000 ;
       // ======================================================================
+      template <class FUNCTION>
+      const std::size_t  Integrator2D<FUNCTION>::s_GRAIN     = 64    ;
+      // ======================================================================
     } //                                  The end of namespace Ostap::Math::GSL 
     // ========================================================================
   } //                                         The end of namespace Ostap::Math
@@ -22,6 +22,7 @@
 // Local
 // ============================================================================
 #include "local_math.h"
+#include "local_kinematics.h"
 // ============================================================================
 /** @file 
  *  Implementation file for functions from the file Ostap/Kinematics.h
@@ -29,16 +30,6 @@
  *  @author Vanya BELYAEV Ivan.Belyaev@itep.ru
  */
 // ============================================================================
-namespace 
-{ 
-  // ==========================================================================
-  static_assert ( std::numeric_limits<float> ::is_specialized      ,
-                  "std::numeric_limits<float>  is not specialized" ) ;
-  /// large negative number 
-  constexpr double s_INVALID = -0.9 * std::numeric_limits<float>::max () ;
-  static_assert (  s_INVALID <  0   , "invalid negative number"    ) ;
-  // ==========================================================================
-}
 // ============================================================================
 /*  calculate the triangle function
  *  \f$ \lambda ( a , b, c ) = a^2 + b^2 + c^2 - 2ab - 2bc - 2 ca \f$
@@ -51,7 +42,7 @@ double Ostap::Kinematics::triangle
 ( const double a ,
   const double b ,
   const double c )
-{ return a * a + b * b + c * c - 2 * a * b - 2 * b * c - 2 * a * c ; }
+{ return triangle_ ( a , b , c ) ; }
 // ============================================================================
 /*  universal four-particle kinematical function 
  *  @see E.Byckling, K.Kajantie, "Particle kinematics", John Wiley & Sons,
@@ -113,8 +104,7 @@ double Ostap::Kinematics::Gram::Delta
 {
   //  return -0.25 * Ostap::Kinematics::triangle 
   //  ( ( p1 + p2 ) . M2 () , p1.M2 () , p2. M2 () ) ;
-  const long double p1p2 = p1 * p2 ;
-  return p1.M2() * 1.0L * p2.M2() - p1p2 * p1p2 ;
+  return gram_delta ( p1 , p2 ) ;
 }
 // ============================================================================
 /* symmetric Gram determinant
@@ -313,14 +303,7 @@ Ostap::Kinematics::boost
 double Ostap::Kinematics::restMomentum
 ( const Ostap::LorentzVector& v ,
   const Ostap::LorentzVector& M )
-{
-  const double M2 = M.M2 ( ) ;
-  if ( 0 >= M2 ) { return s_INVALID ; } //   ATTENTION!
-  const double vM = v.Dot(M) ;
-  const double P2 = vM * vM / M2 - v.M2() ;
-  if ( 0 >  P2 ) { return s_INVALID ; } //   ATTENTION!
-  return 0 <= P2 ? std::sqrt ( P2 ) : -std::sqrt ( std::abs ( P2 ) ) ;
-}
+{ return rest_momentum ( v , M ) ; }
 // ============================================================================
 /*  simple function which evaluates the energy
  *  of particle "v" in the rest system of particle "M"
@@ -338,12 +321,7 @@ double Ostap::Kinematics::restMomentum
 double Ostap::Kinematics::restEnergy
 ( const Ostap::LorentzVector& v ,
   const Ostap::LorentzVector& M )
-{
-  const double M2 = M.M2 () ;
-  if ( 0 >= M2 ) { return s_INVALID ;  } //  RETURN 
-  // evaluate the energy
-  return v.Dot( M ) / std::sqrt ( M2 ) ;
-}
+{ return rest_energy ( v , M ) ; }
 // ============================================================================
 /*  simple function for evaluation of the euclidian norm
  *  for LorentzVectors
@@ -375,12 +353,7 @@ double Ostap::Kinematics::euclidianNorm2
 double Ostap::Kinematics::transverseMomentumDir
 ( const Ostap::Vector3D& mom , 
   const Ostap::Vector3D& dir ) 
-{
-  const double dmag2 = dir.Mag2();
-  if ( 0 == dmag2 ) { return mom.R(); }
-  const Ostap::Vector3D perp = mom - dir * ( mom.Dot( dir ) / dmag2 );
-  return perp.R();
-}
+{ return pt_dir ( mom.X () , mom.Y () , mom.Z () , dir.X () , dir.Y () , dir.Z () ) ; }
 // ============================================================================
 /*  This routine returns the cosine angle theta
  *  The decay angle calculated  is that between
@@ -417,19 +390,7 @@ double Ostap::Kinematics::decayAngle
 ( const Ostap::LorentzVector& P , 
   const Ostap::LorentzVector& Q ,
   const Ostap::LorentzVector& D ) 
-{
-  //
-  const double pd  = P.Dot ( D ) ; // P * D
-  const double pq  = P.Dot ( Q ) ; // P * Q
-  const double qd  = Q.Dot ( D ) ; // D * Q
-  const double mq2 = Q.M2  (   ) ; // Q^2
-  const double mp2 = P.M2  (   ) ; // P^2
-  const double md2 = D.M2  (   ) ; // D^2
-  //
-  const double value = ( pq * pq - mq2 * mp2 ) * ( qd * qd - mq2 * md2 ) ;
-  //
-  return 0 <= value ? ( pd * mq2 - pq * qd ) / std::sqrt( value ) : s_INVALID ;
-}
+{ return decay_angle ( P , Q , D ) ; }
 // ============================================================================
 /*  This routine returns the cosine angle theta
  *  The decay angle calculated  is that between
@@ -456,7 +417,7 @@ double Ostap::Kinematics::decayAngle
 double Ostap::Kinematics::decayAngle
 ( const Ostap::LorentzVector& D , 
   const Ostap::LorentzVector& M ) 
-{ return decayAngle( Ostap::LorentzVector ( 0, 0, 0, 10 * M.E() ) , M , D ); }
+{ return decay_angle ( D , M ) ; }
 // ============================================================================
 /*  simple function to evaluate the cosine angle between
  *  two directions (v1 and v2) in the rest system of M
@@ -496,31 +457,7 @@ double Ostap::Kinematics::cosThetaRest
 ( const Ostap::LorentzVector& v1 , 
   const Ostap::LorentzVector& v2 ,
   const Ostap::LorentzVector& M  ) 
-{
-  //
-  const double M2 = M.M2();
-  if ( 0 >= M2 ) { return s_INVALID ; }     // RETURN
-  ///
-  const double v1M  = v1.Dot( M );
-  const double v2M  = v2.Dot( M );
-  const double m1_2 = v1.M2();
-  const double m2_2 = v2.M2();
-  
-  // calculate e1*e2
-  const double e1e2 = v1M * v2M / M2; // calculate e1*e2
-  
-  // calculate (|p1|*|p2|)^2
-  const double p1p2_ = ( ( v1M * v1M ) / M2 - m1_2 ) * ( ( v2M * v2M ) / M2 - m2_2 ); // calculate (|p1|*|p2|)^2
-  //
-  if ( 0 >= p1p2_ ) { return s_INVALID ; }   // RETURN
-  //
-  const double p1p2 = ::sqrt( p1p2_ ); // |p1|*|p2|
-  //
-  const double var = ( v1 + v2 ).M2() - m1_2 - m2_2;
-  //
-  // finally evaluate the cosine
-  return ( e1e2 - 0.5 * var ) / p1p2;
-}
+{ return cos_theta_rest ( v1 , v2 , M ) ; }
 // ============================================================================
 /*  Cosine of the angle between p1 and p2 in the rest frame of M
  *  \f$ \cos \theta = - \frac 
@@ -592,16 +529,7 @@ double Ostap::Kinematics::decayAngleChi
   const Ostap::LorentzVector& d2 ,
   const Ostap::LorentzVector& h1 , 
   const Ostap::LorentzVector& h2 )
-{
-  //
-  const double cosChi = cosDecayAngleChi ( d1 , d2 , h1 , h2 ) ;
-  if ( std::abs ( cosChi ) > 1  ) { return s_INVALID ; }
-  //
-  const double sinChi = sinDecayAngleChi ( d1 , d2 , h1 , h2 ) ;
-  if ( std::abs ( sinChi ) > 1  ) { return s_INVALID ; }
-  //
-  return std::atan2 ( sinChi , cosChi ) ;
-}
+{ return decay_angle_chi ( d1 , d2 , h1 , h2 ) ; }
 // ============================================================================
 /*  evaluate \f$\cos \chi\f$, where \f$\chi\f$ if the angle
  *  beween two decay planes, formed by particles d1&d2
@@ -647,23 +575,7 @@ double Ostap::Kinematics::cosDecayAngleChi
   const Ostap::LorentzVector& d2 ,
   const Ostap::LorentzVector& h1 , 
   const Ostap::LorentzVector& h2 ) 
-{
-  // get the intermediate particles D & H
-  const Ostap::LorentzVector D( d1 + d2 );
-  const Ostap::LorentzVector H( h1 + h2 );
-  //
-  // Evaluator of various tensor expressions:
-  Ostap::Math::Tensors::Epsilon e;
-  //
-  // evaluate the length of normales :
-  const double l1 = e.mag2( d1, d2, H ); // == | [d1,d2,M] |
-  const double l2 = e.mag2( h1, h2, D ); // == | [h1,h2,M] |
-  //
-  if ( 0 <= l1 ) { return s_INVALID ; }
-  if ( 0 <= l2 ) { return s_INVALID ; }
-  //
-  return -e.epsilon( d1, d2, H, h1, h2, D ) / std::sqrt( l1 * l2 );
-}
+{ return cos_chi ( d1 , d2 , h1 , h2 ) ; }
 // ============================================================================
 /*  evaluate \f$\sin\chi\f$, where \f$\chi\f$ is the angle
  *  beween two decay planes,
@@ -717,40 +629,7 @@ double Ostap::Kinematics::sinDecayAngleChi
   const Ostap::LorentzVector& d2 ,
   const Ostap::LorentzVector& h1 , 
   const Ostap::LorentzVector& h2 ) 
-{
-  // ========================================================================
-  //  reconstrcut the intermediate particles
-  const Ostap::LorentzVector D( d1 + d2 );
-  const Ostap::LorentzVector H( h1 + h2 );
-  /// Mother Particle
-  const Ostap::LorentzVector M( D + H );
-  // ========================================================================
-  const double M2 = M.M2();
-  if ( 0 >= M2 ) { return s_INVALID ; }
-  // ========================================================================
-  // evaluator of various tensor expressions
-  Ostap::Math::Tensors::Epsilon e;
-  // ========================================================================
-  // get the length of 4-normales
-  const double l1 = e.mag2( d1, d2, H ); // == | [d1,d2,M] |
-  const double l2 = e.mag2( h1, h2, D ); // == | [h1,h2,M] |
-  //
-  if ( 0 <= l1 ) { return s_INVALID ; }
-  if ( 0 <= l2 ) { return s_INVALID ; }
-  //
-  // try to get the sine
-  //
-  const double DH = D.Dot( H );
-  //
-  const double var = e( d1, d2, h1, h2 ) * ( DH * DH - D.M2() * H.M2() );
-  //
-  const double HM  = H.Dot( M );
-  const double p_H = HM * HM - H.M2() * M2;
-  //
-  if ( 0 >= p_H ) { return s_INVALID ; }
-  //
-  return var / std::sqrt( l1 * l2 * p_H );
-}
+{ return sin_chi ( d1 , d2 , h1 , h2 ) ; }
 // ============================================================================
 /*  evaluate the Armenteros-Podolanski variable \f$\mathbf{\alpha}\f$,
  *  defined as:
@@ -791,7 +670,7 @@ double Ostap::Kinematics::sinDecayAngleChi
 double Ostap::Kinematics::armenterosPodolanskiX 
 ( const Ostap::Vector3D& d1 , 
   const Ostap::Vector3D& d2 )
-{ return ( d1.Mag2() - d2.Mag2() ) / ( d1 + d2 ).Mag2(); }
+{ return armenteros ( d1.X () , d1.Y () , d1.Z () , d2.X () , d2.Y () , d2.Z () ) ; }
 // ============================================================================
 /*  trivial functon to get the component of "a", transverse to "b"
  *  @param a (INPUT)  three vector
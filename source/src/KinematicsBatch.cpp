@@ -0,0 +1,410 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Kinematics.h"
+#include "Ostap/KinematicsBatch.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_kinematics.h"
+// ============================================================================
+/** @file
+ *  Implementation file for the batch kinematical functions
+ *  @see Ostap::Kinematics::Batch
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// minimal size of the chunk for the parallel processing
+  const std::size_t s_GRAIN  = 8192 ;
+  // ==========================================================================
+  typedef Ostap::LorentzVector             LV      ;
+  typedef Ostap::Kinematics::LorentzColumns Columns ;
+  // ==========================================================================
+  /** run the kernel for the range [0,n),
+   *  split into chunks for long arrays
+   */
+  template <class KERNEL>
+  inline void run
+  ( const std::size_t n      ,
+    KERNEL            kernel )
+  {
+    if      ( 0 == n      ) { return ; }
+    else if ( n < s_GRAIN ) { kernel ( 0 , n ) ; }
+    else { Ostap::Utils::ThreadPool::parallel_for ( n , kernel , s_GRAIN ) ; }
+  }
+  // ==========================================================================
+  /// check the arguments
+  inline void check
+  ( const std::size_t  n        ,
+    const double*      result   ,
+    const std::string& method   )
+  {
+    Ostap::Assert ( 0 == n || nullptr != result    ,
+                    "Invalid output array"          ,
+                    "Ostap::Kinematics::Batch::" + method ) ;
+  }
+  /// check the arguments
+  inline void check
+  ( const Columns&     c        ,
+    const std::string& method   )
+  {
+    Ostap::Assert ( c.valid ()                    ,
+                    "Invalid columns"             ,
+                    "Ostap::Kinematics::Batch::" + method ) ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// number of four-vectors, required for the variable
+// ============================================================================
+unsigned short
+Ostap::Kinematics::Batch::nVectors ( const Ostap::Kinematics::Batch::Variable v )
+{
+  switch ( v )
+  {
+  case DecayAngle            : return 3 ;
+  case DecayAngleLab         : return 2 ;
+  case CosThetaRest          : return 3 ;
+  case DecayAngleChi         : return 4 ;
+  case CosDecayAngleChi      : return 4 ;
+  case SinDecayAngleChi      : return 4 ;
+  case ArmenterosPodolanskiX : return 2 ;
+  case RestMomentum          : return 2 ;
+  case RestEnergy            : return 2 ;
+  case TransverseMomentumDir : return 2 ;
+  case GramDelta2            : return 2 ;
+  case GramDelta3            : return 3 ;
+  case Mass2                 : return 4 ;
+  case Mass                  : return 4 ;
+  default                    : break    ;
+  }
+  Ostap::Assert ( false , "Invalid variable" , "Ostap::Kinematics::Batch::nVectors" ) ;
+  return 0 ;
+}
+// ============================================================================
+// minimal number of four-vectors, accepted for the variable
+// ============================================================================
+unsigned short
+Ostap::Kinematics::Batch::nVectorsMin ( const Ostap::Kinematics::Batch::Variable v )
+{ return Mass2 == v || Mass == v ? 1 : nVectors ( v ) ; }
+// ============================================================================
+/*  evaluate the variable for the given four-vectors
+ *  @param variable the variable
+ *  @param vectors  the four-vectors
+ *  @param nvectors number of four-vectors
+ */
+// ============================================================================
+double Ostap::Kinematics::Batch::evaluate
+( const Ostap::Kinematics::Batch::Variable variable ,
+  const Ostap::LorentzVector*              v        ,
+  const unsigned short                     nvectors )
+{
+  Ostap::Assert ( nullptr != v                     &&
+                  nVectorsMin ( variable ) <= nvectors &&
+                  nvectors <= nVectors ( variable ) ,
+                  "Invalid number of four-vectors"  ,
+                  "Ostap::Kinematics::Batch::evaluate" ) ;
+  //
+  switch ( variable )
+  {
+  case DecayAngle            : return decay_angle     ( v [ 0 ] , v [ 1 ] , v [ 2 ] ) ;
+  case DecayAngleLab         : return decay_angle     ( v [ 0 ] , v [ 1 ] ) ;
+  case CosThetaRest          : return cos_theta_rest  ( v [ 0 ] , v [ 1 ] , v [ 2 ] ) ;
+  case DecayAngleChi         : return decay_angle_chi ( v [ 0 ] , v [ 1 ] , v [ 2 ] , v [ 3 ] ) ;
+  case CosDecayAngleChi      : return cos_chi         ( v [ 0 ] , v [ 1 ] , v [ 2 ] , v [ 3 ] ) ;
+  case SinDecayAngleChi      : return sin_chi         ( v [ 0 ] , v [ 1 ] , v [ 2 ] , v [ 3 ] ) ;
+  case ArmenterosPodolanskiX :
+    return armenteros ( v [ 0 ].Px () , v [ 0 ].Py () , v [ 0 ].Pz () ,
+                        v [ 1 ].Px () , v [ 1 ].Py () , v [ 1 ].Pz () ) ;
+  case RestMomentum          : return rest_momentum   ( v [ 0 ] , v [ 1 ] ) ;
+  case RestEnergy            : return rest_energy     ( v [ 0 ] , v [ 1 ] ) ;
+  case TransverseMomentumDir :
+    return pt_dir     ( v [ 0 ].Px () , v [ 0 ].Py () , v [ 0 ].Pz () ,
+                        v [ 1 ].Px () , v [ 1 ].Py () , v [ 1 ].Pz () ) ;
+  case GramDelta2            : return gram_delta      ( v [ 0 ] , v [ 1 ] ) ;
+  case GramDelta3            : return Ostap::Kinematics::Gram::Delta ( v [ 0 ] , v [ 1 ] , v [ 2 ] ) ;
+  default                    : break ;
+  }
+  // Mass & Mass2
+  LV sum { v [ 0 ] } ;
+  for ( unsigned short i = 1 ; i < nvectors ; ++i ) { sum += v [ i ] ; }
+  return Mass2 == variable ? sum.M2 () : sum.M () ;
+}
+// ============================================================================
+/*  evaluate the variable for the columns of four-vectors
+ *  @param variable the variable
+ *  @param n        the length of columns
+ *  @param columns  the columns
+ *  @param result   the output array
+ */
+// ============================================================================
+void Ostap::Kinematics::Batch::evaluate
+( const Ostap::Kinematics::Batch::Variable                 variable ,
+  const std::size_t                                        n        ,
+  const std::vector<Ostap::Kinematics::LorentzColumns>&    c        ,
+  double*                                                  result   )
+{
+  const unsigned short nv = c.size () ;
+  Ostap::Assert ( nVectorsMin ( variable ) <= c.size () && c.size () <= nVectors ( variable ) ,
+                  "Invalid number of columns"          ,
+                  "Ostap::Kinematics::Batch::evaluate" ) ;
+  //
+  switch ( variable )
+  {
+  case DecayAngle            : return decayAngle            ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , result ) ;
+  case DecayAngleLab         : return decayAngle            ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case CosThetaRest          : return cosThetaRest          ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , result ) ;
+  case DecayAngleChi         : return decayAngleChi         ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , c [ 3 ] , result ) ;
+  case CosDecayAngleChi      : return cosDecayAngleChi      ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , c [ 3 ] , result ) ;
+  case SinDecayAngleChi      : return sinDecayAngleChi      ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , c [ 3 ] , result ) ;
+  case ArmenterosPodolanskiX : return armenterosPodolanskiX ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case RestMomentum          : return restMomentum          ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case RestEnergy            : return restEnergy            ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case TransverseMomentumDir : return transverseMomentumDir ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case GramDelta2            : return gramDelta             ( n , c [ 0 ] , c [ 1 ] , result ) ;
+  case GramDelta3            : return gramDelta             ( n , c [ 0 ] , c [ 1 ] , c [ 2 ] , result ) ;
+  default                    : break ;
+  }
+  // Mass & Mass2
+  check ( n , result , "evaluate" ) ;
+  for ( const auto& cc : c ) { check ( cc , "evaluate" ) ; }
+  const bool squared = Mass2 == variable ;
+  run ( n , [&c,nv,squared,result] ( const std::size_t begin , const std::size_t end )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    {
+      LV sum { c [ 0 ] [ i ] } ;
+      for ( unsigned short k = 1 ; k < nv ; ++k ) { sum += c [ k ] [ i ] ; }
+      result [ i ] = squared ? sum.M2 () : sum.M () ;
+    }
+  } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::decayAngle ( P , Q , D )
+// ============================================================================
+void Ostap::Kinematics::Batch::decayAngle
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  P      ,
+  const Ostap::Kinematics::LorentzColumns&  Q      ,
+  const Ostap::Kinematics::LorentzColumns&  D      ,
+  double*                                   result )
+{
+  check ( n , result , "decayAngle" ) ;
+  check ( P , "decayAngle" ) ; check ( Q , "decayAngle" ) ; check ( D , "decayAngle" ) ;
+  run ( n , [&P,&Q,&D,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = decay_angle ( P [ i ] , Q [ i ] , D [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::decayAngle ( D , M )
+// ============================================================================
+void Ostap::Kinematics::Batch::decayAngle
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  D      ,
+  const Ostap::Kinematics::LorentzColumns&  M      ,
+  double*                                   result )
+{
+  check ( n , result , "decayAngle" ) ;
+  check ( D , "decayAngle" ) ; check ( M , "decayAngle" ) ;
+  run ( n , [&D,&M,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = decay_angle ( D [ i ] , M [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::cosThetaRest ( v1 , v2 , M )
+// ============================================================================
+void Ostap::Kinematics::Batch::cosThetaRest
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  v1     ,
+  const Ostap::Kinematics::LorentzColumns&  v2     ,
+  const Ostap::Kinematics::LorentzColumns&  M      ,
+  double*                                   result )
+{
+  check ( n , result , "cosThetaRest" ) ;
+  check ( v1 , "cosThetaRest" ) ; check ( v2 , "cosThetaRest" ) ; check ( M , "cosThetaRest" ) ;
+  run ( n , [&v1,&v2,&M,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = cos_theta_rest  ( v1 [ i ] , v2 [ i ] , M [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::decayAngleChi ( d1 , d2 , h1 , h2 )
+// ============================================================================
+void Ostap::Kinematics::Batch::decayAngleChi
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  d1     ,
+  const Ostap::Kinematics::LorentzColumns&  d2     ,
+  const Ostap::Kinematics::LorentzColumns&  h1     ,
+  const Ostap::Kinematics::LorentzColumns&  h2     ,
+  double*                                   result )
+{
+  check ( n , result , "decayAngleChi" ) ;
+  check ( d1 , "decayAngleChi" ) ; check ( d2 , "decayAngleChi" ) ;
+  check ( h1 , "decayAngleChi" ) ; check ( h2 , "decayAngleChi" ) ;
+  run ( n , [&d1,&d2,&h1,&h2,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = decay_angle_chi ( d1 [ i ] , d2 [ i ] , h1 [ i ] , h2 [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::cosDecayAngleChi ( d1 , d2 , h1 , h2 )
+// ============================================================================
+void Ostap::Kinematics::Batch::cosDecayAngleChi
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  d1     ,
+  const Ostap::Kinematics::LorentzColumns&  d2     ,
+  const Ostap::Kinematics::LorentzColumns&  h1     ,
+  const Ostap::Kinematics::LorentzColumns&  h2     ,
+  double*                                   result )
+{
+  check ( n , result , "cosDecayAngleChi" ) ;
+  check ( d1 , "cosDecayAngleChi" ) ; check ( d2 , "cosDecayAngleChi" ) ;
+  check ( h1 , "cosDecayAngleChi" ) ; check ( h2 , "cosDecayAngleChi" ) ;
+  run ( n , [&d1,&d2,&h1,&h2,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = cos_chi ( d1 [ i ] , d2 [ i ] , h1 [ i ] , h2 [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::sinDecayAngleChi ( d1 , d2 , h1 , h2 )
+// ============================================================================
+void Ostap::Kinematics::Batch::sinDecayAngleChi
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  d1     ,
+  const Ostap::Kinematics::LorentzColumns&  d2     ,
+  const Ostap::Kinematics::LorentzColumns&  h1     ,
+  const Ostap::Kinematics::LorentzColumns&  h2     ,
+  double*                                   result )
+{
+  check ( n , result , "sinDecayAngleChi" ) ;
+  check ( d1 , "sinDecayAngleChi" ) ; check ( d2 , "sinDecayAngleChi" ) ;
+  check ( h1 , "sinDecayAngleChi" ) ; check ( h2 , "sinDecayAngleChi" ) ;
+  run ( n , [&d1,&d2,&h1,&h2,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = sin_chi ( d1 [ i ] , d2 [ i ] , h1 [ i ] , h2 [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::armenterosPodolanskiX ( d1 , d2 )
+// ============================================================================
+void Ostap::Kinematics::Batch::armenterosPodolanskiX
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  d1     ,
+  const Ostap::Kinematics::LorentzColumns&  d2     ,
+  double*                                   result )
+{
+  check ( n , result , "armenterosPodolanskiX" ) ;
+  check ( d1 , "armenterosPodolanskiX" ) ; check ( d2 , "armenterosPodolanskiX" ) ;
+  const double* x1 = d1.px () ; const double* y1 = d1.py () ; const double* z1 = d1.pz () ;
+  const double* x2 = d2.px () ; const double* y2 = d2.py () ; const double* z2 = d2.pz () ;
+  run ( n , [=] ( const std::size_t begin , const std::size_t end )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    { result [ i ] = armenteros ( x1 [ i ] , y1 [ i ] , z1 [ i ] , x2 [ i ] , y2 [ i ] , z2 [ i ] ) ; }
+  } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::restMomentum ( v , M )
+// ============================================================================
+void Ostap::Kinematics::Batch::restMomentum
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  v      ,
+  const Ostap::Kinematics::LorentzColumns&  M      ,
+  double*                                   result )
+{
+  check ( n , result , "restMomentum" ) ;
+  check ( v , "restMomentum" ) ; check ( M , "restMomentum" ) ;
+  run ( n , [&v,&M,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = rest_momentum ( v [ i ] , M [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::restEnergy ( v , M )
+// ============================================================================
+void Ostap::Kinematics::Batch::restEnergy
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  v      ,
+  const Ostap::Kinematics::LorentzColumns&  M      ,
+  double*                                   result )
+{
+  check ( n , result , "restEnergy" ) ;
+  check ( v , "restEnergy" ) ; check ( M , "restEnergy" ) ;
+  run ( n , [&v,&M,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = rest_energy ( v [ i ] , M [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::transverseMomentumDir ( mom , dir )
+// ============================================================================
+void Ostap::Kinematics::Batch::transverseMomentumDir
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  mom    ,
+  const Ostap::Kinematics::LorentzColumns&  dir    ,
+  double*                                   result )
+{
+  check ( n , result , "transverseMomentumDir" ) ;
+  check ( mom , "transverseMomentumDir" ) ; check ( dir , "transverseMomentumDir" ) ;
+  const double* px = mom.px () ; const double* py = mom.py () ; const double* pz = mom.pz () ;
+  const double* dx = dir.px () ; const double* dy = dir.py () ; const double* dz = dir.pz () ;
+  run ( n , [=] ( const std::size_t begin , const std::size_t end )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    { result [ i ] = pt_dir ( px [ i ] , py [ i ] , pz [ i ] , dx [ i ] , dy [ i ] , dz [ i ] ) ; }
+  } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::Gram::Delta ( p1 , p2 )
+// ============================================================================
+void Ostap::Kinematics::Batch::gramDelta
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  p1     ,
+  const Ostap::Kinematics::LorentzColumns&  p2     ,
+  double*                                   result )
+{
+  check ( n , result , "gramDelta" ) ;
+  check ( p1 , "gramDelta" ) ; check ( p2 , "gramDelta" ) ;
+  run ( n , [&p1,&p2,result] ( const std::size_t begin , const std::size_t end )
+  { for ( std::size_t i = begin ; i < end ; ++i ) { result [ i ] = gram_delta ( p1 [ i ] , p2 [ i ] ) ; } } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::Gram::Delta ( p1 , p2 , p3 )
+// ============================================================================
+void Ostap::Kinematics::Batch::gramDelta
+( const std::size_t                         n      ,
+  const Ostap::Kinematics::LorentzColumns&  p1     ,
+  const Ostap::Kinematics::LorentzColumns&  p2     ,
+  const Ostap::Kinematics::LorentzColumns&  p3     ,
+  double*                                   result )
+{
+  check ( n , result , "gramDelta" ) ;
+  check ( p1 , "gramDelta" ) ; check ( p2 , "gramDelta" ) ; check ( p3 , "gramDelta" ) ;
+  run ( n , [&p1,&p2,&p3,result] ( const std::size_t begin , const std::size_t end )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    { result [ i ] = Ostap::Kinematics::Gram::Delta ( p1 [ i ] , p2 [ i ] , p3 [ i ] ) ; }
+  } ) ;
+}
+// ============================================================================
+// @see Ostap::Kinematics::triangle ( a , b , c )
+// ============================================================================
+void Ostap::Kinematics::Batch::triangle
+( const std::size_t n      ,
+  const double*     a      ,
+  const double*     b      ,
+  const double*     c      ,
+  double*           result )
+{
+  check ( n , result , "triangle" ) ;
+  Ostap::Assert ( 0 == n || ( a && b && c ) ,
+                  "Invalid input arrays"    ,
+                  "Ostap::Kinematics::Batch::triangle" ) ;
+  run ( n , [=] ( const std::size_t begin , const std::size_t end )
+  {
+    for ( std::size_t i = begin ; i < end ; ++i )
+    { result [ i ] = triangle_ ( a [ i ] , b [ i ] , c [ i ] ) ; }
+  } ) ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -3,10 +3,19 @@
 // =============================================================================
 // Incldue files 
 // =============================================================================
+// STD&STL
+// =============================================================================
+#include <cmath>
+#include <limits>
+// =============================================================================
 // Ostap
 // =============================================================================
 #include "Ostap/KramersKronig.h"
 // =============================================================================
+// local
+// =============================================================================
+#include "Exception.h"
+// =============================================================================
 /** @file 
  *  Implementation file for class Ostap::Math::KramersKronig
  *  @date 2020-09-01 
@@ -25,9 +34,86 @@
  */
 // =============================================================================
 double Ostap::Math::KramersKronig::operator() ( const double x ) const
+{
+  if ( m_table && m_table->xmin () <= x && x <= m_table->xmax () ) 
+  {
+    const double r = (*m_table) ( x ) - 
+      threshold ( m_rho , m_omega0 , m_n ) * std::log ( std::abs ( x - m_omega0 ) ) / M_PI ;
+    return 0 < m_n ? m_scale * std::pow ( x , m_n ) * r : m_scale * r ;
+  }
+  return exact ( x ) ;
+}
+// =============================================================================
+// evaluate the integral directly (no tabulation)
+// =============================================================================
+double Ostap::Math::KramersKronig::exact ( const double x ) const
 { return m_scale * m_integrator.kramers_kronig 
     ( std::cref ( m_rho ) , x , m_omega0 , m_n , m_tag , m_rescale ) ; }
 // =============================================================================
+/*  the coefficient of the logarithmic singularity at the threshold 
+ *  \f$ \frac{\rho(\omega_0)}{\omega_0^n} \f$
+ */
+// =============================================================================
+double Ostap::Math::KramersKronig::threshold
+( const std::function<double(double)>& rho    , 
+  const double                         omega0 , 
+  const unsigned short                 n      ) 
+{
+  const double r = 0 < n ? rho ( omega0 ) / std::pow ( omega0 , n ) : rho ( omega0 ) ;
+  return std::isfinite ( r ) ? r : 0.0 ;
+}
+// =============================================================================
+/*  tabulate the integral in the range \f$ [x_{min},x_{max}]\f$
+ *  @param xmin      low  edge of the tabulation range 
+ *  @param xmax      high edge of the tabulation range 
+ *  @param precision the relative precision of the interpolation
+ *  @param maxpoints maximal number of nodes
+ *  @param key       the key function (if any)
+ */
+// =============================================================================
+void Ostap::Math::KramersKronig::tabulate 
+( const double                            xmin      , 
+  const double                            xmax      , 
+  const double                            precision , 
+  const std::size_t                       maxpoints ,
+  Ostap::Math::KramersKronig::Key         key       ) 
+{
+  double low  = std::max ( std::min ( xmin , xmax ) , m_omega0 ) ;
+  double high = std::max ( xmin , xmax ) ;
+  Ostap::Assert ( low < high                      , 
+                  "Invalid tabulation range!"     , 
+                  "Ostap::Math::KramersKronig"    ) ;
+  //
+  // the integral itself is infinite at the threshold:
+  // leave the tiny interval near it for the direct evaluation 
+  if ( low == m_omega0 ) { low += 1.e-8 * ( high - low ) ; }
+  //
+  const std::function<double(double)> rho       = m_rho        ;
+  const Ostap::Math::Integrator       integrator = m_integrator ;
+  const double                        omega0    = m_omega0     ;
+  const unsigned short                n         = m_n          ;
+  const std::size_t                   tag       = m_tag        ;
+  const unsigned short                rescale   = m_rescale    ;
+  //
+  // the regular part of the integral without the subtraction factor 
+  auto regular = [rho,integrator,omega0,n,tag,rescale] ( const double x ) -> double 
+  {
+    const double c0 = threshold ( rho , omega0 , n ) ;
+    double r = 0 ;
+    if ( 0 < n ) 
+    {
+      auto rho_n = [&rho,n] ( const double y ) -> double { return rho ( y ) / std::pow ( y , n ) ; } ;
+      r = integrator.kramers_kronig ( std::cref ( rho_n ) , x , omega0 , 0 , tag , rescale ) ;
+    }
+    else { r = integrator.kramers_kronig ( std::cref ( rho ) , x , omega0 , 0 , tag , rescale ) ; }
+    //
+    return r + c0 * std::log ( std::abs ( x - omega0 ) ) / M_PI ;
+  } ;
+  //
+  m_table = std::make_shared<const Ostap::Math::TabulatedFunction> 
+    ( regular , low , high , precision , maxpoints , key ) ;
+}
+// =============================================================================
 
 
 // =============================================================================
@@ -0,0 +1,440 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "RVersion.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/LazyFrame.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "OstapDataFrame.h"
+#include "local_utils.h"
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::LazyFrame
+ *  @see Ostap::LazyFrame
+ *  @author Ostap developers
+ *  @date   2026-10-19
+ */
+// ============================================================================
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// the generic node
+  typedef ROOT::RDF::RNode           Node      ;
+  /// the finalizer: copy the result to the handle
+  typedef std::function<void()>      Finalizer ;
+  // ==========================================================================
+  /// unique identifier of the lazy frame (to avoid the clashes of columns)
+  std::atomic<unsigned long> s_ID { 0 } ;
+  // ==========================================================================
+  /** @struct Graph
+   *  the (temporary) computation graph for one event loop:
+   *  all temporary columns are defined once and shared
+   */
+  struct Graph
+  {
+    // ========================================================================
+    /// column name for the expression
+    const std::string& column    ( const std::string& expression ) const
+    { return m_columns.find ( expression )->second ; }
+    /// column name for the weight
+    const std::string& weight    ( const std::string& cuts       ) const
+    { return m_weights.find ( cuts       )->second ; }
+    /// the filtered node for the given selection
+    Node&              filtered  ( const std::string& cuts       )
+    { return m_filtered.find ( cuts      )->second ; }
+    // ========================================================================
+    /// expression -> column name
+    std::map<std::string,std::string> m_columns  {} ;
+    /// selection  -> boolean column name
+    std::map<std::string,std::string> m_booleans {} ;
+    /// selection  -> weight  column name
+    std::map<std::string,std::string> m_weights  {} ;
+    /// selection  -> filtered node
+    std::map<std::string,Node>        m_filtered {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /// book the action and get the finalizer
+  typedef std::function<Finalizer(Graph&)> Booker ;
+  // ==========================================================================
+  /// the pending request
+  struct Request
+  {
+    /// all expressions, used for the request
+    std::vector<std::string> expressions {} ;
+    /// the selection/weight
+    std::string              cuts        {} ;
+    /// book the action
+    Booker                   book        {} ;
+  } ;
+  // ==========================================================================
+  /// normalize the selection: all trivial selections are the same
+  inline std::string normalize ( const std::string& cuts )
+  { return Ostap::trivial ( cuts ) ? std::string () : cuts ; }
+  // ==========================================================================
+}
+// ============================================================================
+/** @class Ostap::LazyFrame::Impl
+ *  The actual (shared) state of the lazy frame
+ */
+// ============================================================================
+class Ostap::LazyFrame::Impl
+{
+public:
+  // ==========================================================================
+  Impl ( DataFrame frame )
+    : m_frame ( frame )
+    , m_id    ( s_ID++ )
+  {}
+  // ==========================================================================
+public:
+  // ==========================================================================
+  /// the input frame
+  DataFrame            m_frame    ;
+  /// unique identifier
+  unsigned long        m_id       { 0 } ;
+  /// number of event loops
+  unsigned long        m_runs     { 0 } ;
+  /// pending requests
+  std::vector<Request> m_requests {   } ;
+  /// lock
+  mutable std::mutex   m_mutex    {   } ;
+  // ==========================================================================
+public:
+  // ==========================================================================
+  /// add the request
+  void add ( Request&& request )
+  {
+    std::lock_guard<std::mutex> lock ( m_mutex ) ;
+    m_requests.push_back ( std::move ( request ) ) ;
+  }
+  // ==========================================================================
+  /// the unique name for the temporary column
+  std::string name ( const std::string& prefix ,
+                     const std::string& expr   ) const
+  {
+    return Ostap::tmp_name ( prefix , expr , false )
+      + "_" + std::to_string ( m_id   )
+      + "_" + std::to_string ( m_runs ) ;
+  }
+  // ==========================================================================
+  /// build the graph, book all actions and run the event loop
+  unsigned long run () ;
+  // ==========================================================================
+} ;
+// ============================================================================
+// build the graph, book all actions and run the event loop
+// ============================================================================
+unsigned long Ostap::LazyFrame::Impl::run ()
+{
+  std::lock_guard<std::mutex> lock ( m_mutex ) ;
+  if ( m_requests.empty() ) { return 0 ; }
+  //
+  Graph graph {} ;
+  //
+  // (1) collect all unique expressions and selections
+  for ( const Request& r : m_requests )
+  {
+    for ( const std::string& e : r.expressions )
+    { if ( graph.m_columns.end() == graph.m_columns.find ( e ) )
+        { graph.m_columns [ e ] = name ( "v_" , e ) ; } }
+    if ( graph.m_weights.end() == graph.m_weights.find ( r.cuts ) )
+    {
+      graph.m_booleans [ r.cuts ] = name ( "b_" , r.cuts ) ;
+      graph.m_weights  [ r.cuts ] = name ( "w_" , r.cuts ) ;
+    }
+  }
+  //
+  // (2) define all temporary columns only once
+  Node root ( m_frame ) ;
+  for ( const auto& c : graph.m_columns )
+  { root = root.Define ( c.second , "1.0*(" + c.first + ")" ) ; }
+  for ( const auto& w : graph.m_weights )
+  {
+    const bool no_cuts = w.first.empty() ;
+    if ( !no_cuts ) 
+    { root = root.Define ( graph.m_booleans [ w.first ] , "(bool)   ( " + w.first + " ) ;" ) ; }
+    root = root.Define ( w.second , no_cuts ? "1.0"  : "1.0*(" + w.first + ")" ) ;
+  }
+  //
+  // (3) one filter per selection
+  for ( const auto& b : graph.m_booleans )
+  {
+    if ( b.first.empty() ) { graph.m_filtered.emplace ( b.first , root ) ; }
+    else { graph.m_filtered.emplace ( b.first , Node ( root.Filter ( b.second ) ) ) ; }
+  }
+  //
+  // (4) book all actions
+  std::vector<Finalizer> finalizers ;
+  finalizers.reserve ( m_requests.size() ) ;
+  for ( const Request& r : m_requests ) { finalizers.push_back ( r.book ( graph ) ) ; }
+  //
+  const unsigned long n = m_requests.size() ;
+  m_requests.clear() ;
+  ++m_runs ;
+  //
+  // (5) the first finalizer triggers the (only) event loop
+  for ( Finalizer& f : finalizers ) { f () ; }
+  //
+  return n ;
+}
+// ============================================================================
+// constructor from the frame
+// ============================================================================
+Ostap::LazyFrame::LazyFrame ( Ostap::DataFrame frame )
+  : m_impl ( std::make_shared<Impl> ( frame ) )
+{}
+// ============================================================================
+// run one event loop for all pending actions
+// ============================================================================
+unsigned long Ostap::LazyFrame::run () const { return m_impl->run () ; }
+// ============================================================================
+// number of pending actions
+// ============================================================================
+unsigned long Ostap::LazyFrame::pending () const
+{
+  std::lock_guard<std::mutex> lock ( m_impl->m_mutex ) ;
+  return m_impl->m_requests.size() ;
+}
+// ============================================================================
+// number of event loops, run so far
+// ============================================================================
+unsigned long Ostap::LazyFrame::nRuns () const
+{
+  std::lock_guard<std::mutex> lock ( m_impl->m_mutex ) ;
+  return m_impl->m_runs ;
+}
+// ============================================================================
+/*  book the number of equivalent entries
+ *  \f$ n_{eff} \equiv = \frac{ (\sum w)^2}{ \sum w^2} \f$
+ *  @param cuts  (INPUT) selection criteria/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<double>
+Ostap::LazyFrame::nEff ( const std::string& cuts )
+{
+  Handle<double> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( cuts ) ;
+  //
+  Request request ;
+  request.cuts = cut ;
+  request.book = [slot,cut] ( Graph& g ) -> Finalizer
+    {
+      const std::string& w = g.weight ( cut ) ;
+      auto r = g.filtered ( cut ).Book<double,double> ( Ostap::Actions::WStatVar() , { w , w } ) ;
+      return [slot,r] () mutable { slot->value = r->nEff () ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+/*  book the statistic for the expression
+ *  @param expression (INPUT) the expression
+ *  @param cuts       (INPUT) the selection/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<Ostap::LazyFrame::Statistic>
+Ostap::LazyFrame::statVar
+( const std::string& expression ,
+  const std::string& cuts       )
+{
+  Handle<Statistic> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( cuts ) ;
+  //
+  Request request ;
+  request.expressions = { expression } ;
+  request.cuts        = cut ;
+  request.book = [slot,cut,expression] ( Graph& g ) -> Finalizer
+    {
+      auto r = g.filtered ( cut ).Book<double,double>
+        ( Ostap::Actions::WStatVar() , { g.column ( expression ) , g.weight ( cut ) } ) ;
+      return [slot,r] () mutable { slot->value = *r ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+/*  book the covariance for two expressions
+ *  @param exp1  (INPUT) the first  expression
+ *  @param exp2  (INPUT) the second expression
+ *  @param cuts  (INPUT) the selection/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<Ostap::LazyFrame::Covariance>
+Ostap::LazyFrame::statCov
+( const std::string& exp1 ,
+  const std::string& exp2 ,
+  const std::string& cuts )
+{
+  Handle<Covariance> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( cuts ) ;
+  //
+  Request request ;
+  request.expressions = { exp1 , exp2 } ;
+  request.cuts        = cut ;
+  request.book = [slot,cut,exp1,exp2] ( Graph& g ) -> Finalizer
+    {
+      auto r = g.filtered ( cut ).Book<double,double,double>
+        ( Ostap::Actions::StatCov() ,
+          { g.column ( exp1 ) , g.column ( exp2 ) , g.weight ( cut ) } ) ;
+      return [slot,r] () mutable { slot->value = *r ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+/*  book the projection of the frame into 1D-histogram
+ *  @param histo      (UPDATE) the histogram
+ *  @param expression (INPUT)  the expression
+ *  @param selection  (INPUT)  the selection/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<TH1*>
+Ostap::LazyFrame::project
+( TH1*               histo      ,
+  const std::string& expression ,
+  const std::string& selection  )
+{
+  Ostap::Assert ( nullptr != histo && nullptr == dynamic_cast<TH2*> ( histo ) ,
+                  "Invalid 1D-histogram!"  ,
+                  "Ostap::LazyFrame"       ) ;
+  histo->Reset () ;
+  //
+  Handle<TH1*> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( selection ) ;
+  //
+  auto model = std::make_shared<TH1D> () ; histo->Copy ( *model ) ;
+  //
+  Request request ;
+  request.expressions = { expression } ;
+  request.cuts        = cut ;
+  request.book = [slot,cut,expression,model,histo] ( Graph& g ) -> Finalizer
+    {
+      auto h = g.filtered ( cut ).Histo1D<double,double>
+        ( *model , g.column ( expression ) , g.weight ( cut ) ) ;
+      return [slot,h,histo] () mutable
+        { h->Copy ( *histo ) ; slot->value = histo ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+/*  book the projection of the frame into 2D-histogram
+ *  @param histo       (UPDATE) the histogram
+ *  @param xexpression (INPUT)  the expression for x-axis
+ *  @param yexpression (INPUT)  the expression for y-axis
+ *  @param selection   (INPUT)  the selection/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<TH2*>
+Ostap::LazyFrame::project2
+( TH2*               histo       ,
+  const std::string& xexpression ,
+  const std::string& yexpression ,
+  const std::string& selection   )
+{
+  Ostap::Assert ( nullptr != histo && nullptr == dynamic_cast<TH3*> ( histo ) ,
+                  "Invalid 2D-histogram!"  ,
+                  "Ostap::LazyFrame"       ) ;
+  histo->Reset () ;
+  //
+  Handle<TH2*> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( selection ) ;
+  //
+  auto model = std::make_shared<TH2D> () ; histo->Copy ( *model ) ;
+  //
+  Request request ;
+  request.expressions = { xexpression , yexpression } ;
+  request.cuts        = cut ;
+  request.book = [slot,cut,xexpression,yexpression,model,histo] ( Graph& g ) -> Finalizer
+    {
+      auto h = g.filtered ( cut ).Histo2D<double,double,double>
+        ( *model ,
+          g.column ( xexpression ) ,
+          g.column ( yexpression ) , g.weight ( cut ) ) ;
+      return [slot,h,histo] () mutable
+        { h->Copy ( *histo ) ; slot->value = histo ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+/*  book the projection of the frame into 3D-histogram
+ *  @param histo       (UPDATE) the histogram
+ *  @param xexpression (INPUT)  the expression for x-axis
+ *  @param yexpression (INPUT)  the expression for y-axis
+ *  @param zexpression (INPUT)  the expression for z-axis
+ *  @param selection   (INPUT)  the selection/weight
+ */
+// ============================================================================
+Ostap::LazyFrame::Handle<TH3*>
+Ostap::LazyFrame::project3
+( TH3*               histo       ,
+  const std::string& xexpression ,
+  const std::string& yexpression ,
+  const std::string& zexpression ,
+  const std::string& selection   )
+{
+  Ostap::Assert ( nullptr != histo         ,
+                  "Invalid 3D-histogram!"  ,
+                  "Ostap::LazyFrame"       ) ;
+  histo->Reset () ;
+  //
+  Handle<TH3*> handle ( *this ) ;
+  auto slot = handle.m_slot ;
+  const std::string cut = normalize ( selection ) ;
+  //
+  auto model = std::make_shared<TH3D> () ; histo->Copy ( *model ) ;
+  //
+  Request request ;
+  request.expressions = { xexpression , yexpression , zexpression } ;
+  request.cuts        = cut ;
+  request.book = [slot,cut,xexpression,yexpression,zexpression,model,histo] ( Graph& g ) -> Finalizer
+    {
+      auto h = g.filtered ( cut ).Histo3D<double,double,double,double>
+        ( *model ,
+          g.column ( xexpression ) ,
+          g.column ( yexpression ) ,
+          g.column ( zexpression ) , g.weight ( cut ) ) ;
+      return [slot,h,histo] () mutable
+        { h->Copy ( *histo ) ; slot->value = histo ; slot->ready = true ; } ;
+    } ;
+  m_impl->add ( std::move ( request ) ) ;
+  //
+  return handle ;
+}
+// ============================================================================
+#endif // #if ROOT_VERSION_CODE >= ROOT_VERSION(6,16,0)
+// ============================================================================
+//                                                                      The END
+// ============================================================================
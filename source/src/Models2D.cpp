@@ -522,6 +522,38 @@ double Ostap::Math::PS2DPol2::operator ()
     0.5 * ( m_psx ( x ) * m_psy_aux ( y ) + m_psy ( y ) * m_psx_aux ( x ) )  ;  
 }
 // ============================================================================
+/*  evaluate the function for the batch of points 
+ *  (the polynomial is evaluated with the batch kernel)
+ */
+// ============================================================================
+void Ostap::Math::PS2DPol2::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  double*           result ) const 
+{
+  m_positive.evaluate ( n , x , y , result ) ;
+  //
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    //
+    if      ( xi < m_psx. lowEdge() || xi < m_positive.xmin () ) { result [ i ] = 0 ; }
+    else if ( xi > m_psx.highEdge() || xi > m_positive.xmax () ) { result [ i ] = 0 ; }
+    else if ( yi < m_psy. lowEdge() || yi < m_positive.ymin () ) { result [ i ] = 0 ; }
+    else if ( yi > m_psy.highEdge() || yi > m_positive.ymax () ) { result [ i ] = 0 ; }
+    else if ( xi + yi > m_mmax                                 ) { result [ i ] = 0 ; }
+    else 
+    {
+      m_psx_aux.setThresholds ( m_psx.lowEdge() , m_mmax - yi ) ;
+      m_psy_aux.setThresholds ( m_psy.lowEdge() , m_mmax - xi ) ;
+      result [ i ] *= 
+        0.5 * ( m_psx ( xi ) * m_psy_aux ( yi ) + m_psy ( yi ) * m_psx_aux ( xi ) ) ;
+    }
+  }
+}
+// ============================================================================
 double Ostap::Math::PS2DPol2::integral 
 ( const double xlow , const double xhigh , 
   const double ylow , const double yhigh ) const 
@@ -550,7 +582,7 @@ double Ostap::Math::PS2DPol2::integral
   // use cubature   
   static const Ostap::Math::GSL::Integrator2D<PS2DPol2> s_cubature{} ;
   static const char s_message[] = "Integral(PS2DPol2)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high , true ) ;
   //
   int    ierror  =  0 ;
   double  result =  1 ;
@@ -703,6 +735,38 @@ double Ostap::Math::PS2DPol2Sym::operator ()
     ( m_ps ( y ) * m_psx_aux ( x ) + m_ps ( x ) * m_psy_aux ( y ) ) ;
 }
 // ============================================================================
+/*  evaluate the function for the batch of points 
+ *  (the polynomial is evaluated with the batch kernel)
+ */
+// ============================================================================
+void Ostap::Math::PS2DPol2Sym::evaluate 
+( const std::size_t n      , 
+  const double*     x      , 
+  const double*     y      , 
+  double*           result ) const 
+{
+  m_positive.evaluate ( n , x , y , result ) ;
+  //
+  for ( std::size_t i = 0 ; i < n ; ++i ) 
+  {
+    const double xi = x [ i ] ;
+    const double yi = y [ i ] ;
+    //
+    if      ( xi < m_ps. lowEdge() || xi < m_positive.xmin () ) { result [ i ] = 0 ; }
+    else if ( xi > m_ps.highEdge() || xi > m_positive.xmax () ) { result [ i ] = 0 ; }
+    else if ( yi < m_ps. lowEdge() || yi < m_positive.ymin () ) { result [ i ] = 0 ; }
+    else if ( yi > m_ps.highEdge() || yi > m_positive.ymax () ) { result [ i ] = 0 ; }
+    else if ( xi + yi > m_mmax                                ) { result [ i ] = 0 ; }
+    else 
+    {
+      m_psx_aux.setThresholds ( m_ps.lowEdge() , m_mmax - yi ) ;
+      m_psy_aux.setThresholds ( m_ps.lowEdge() , m_mmax - xi ) ;
+      result [ i ] *= 
+        0.5 * ( m_ps ( yi ) * m_psx_aux ( xi ) + m_ps ( xi ) * m_psy_aux ( yi ) ) ;
+    }
+  }
+}
+// ============================================================================
 double Ostap::Math::PS2DPol2Sym::integral 
 ( const double xlow , const double xhigh , 
   const double ylow , const double yhigh ) const 
@@ -731,7 +795,7 @@ double Ostap::Math::PS2DPol2Sym::integral
   // use cubature   
   static const Ostap::Math::GSL::Integrator2D<PS2DPol2Sym> s_cubature{} ;
   static const char s_message[] = "Integral(PS2DPol2Sym)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high , true ) ;
   //
   int    ierror  =  0 ;
   double  result =  1 ;
@@ -924,7 +988,7 @@ double Ostap::Math::PS2DPol3::integral
   // use cubature   
   static const Ostap::Math::GSL::Integrator2D<PS2DPol3> s_cubature{} ;
   static const char s_message[] = "Integral(PS2DPol3)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high , true ) ;
   //
   int    ierror  =  0 ;
   double  result =  1 ;
@@ -1101,7 +1165,7 @@ double Ostap::Math::PS2DPol3Sym::integral
   // use cubature   
   static const Ostap::Math::GSL::Integrator2D<PS2DPol3Sym> s_cubature{} ;
   static const char s_message[] = "Integral(PS2DPol3Sym)" ;
-  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high ) ;
+  const auto F = s_cubature.make_function ( this , x_low , x_high , y_low , y_high , true ) ;
   //
   int    ierror  =  0 ;
   double  result =  1 ;
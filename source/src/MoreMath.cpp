@@ -720,6 +720,30 @@ double Ostap::Math::erfi ( const double x )
 std::complex<double> Ostap::Math::erfi ( const std::complex<double>& x ) 
 { return Faddeeva::erfi ( x ) ; }  
 // ============================================================================
+/* Dawson integral
+ *  \f$ f(x) = \frac{\sqrt{\pi}}{2} e^{-x^2} \mathrm{erfi}(x) \f$
+ *  @param x the argument
+ *  @return the value of the Dawson integral
+ *  The actual implementation is copied from http://ab-initio.mit.edu/Faddeeva
+ *  @see http://ab-initio.mit.edu/Faddeeva
+ *  @see https://en.wikipedia.org/wiki/Dawson_function
+ */
+// ============================================================================
+double Ostap::Math::dowson ( const double x )
+{ return Faddeeva::Dawson ( x ) ; }
+// ============================================================================
+/* Dawson integral
+ *  \f$ f(x) = \frac{\sqrt{\pi}}{2} e^{-z^2} \mathrm{erfi}(z) \f$
+ *  @param x the argument
+ *  @return the value of the Dawson integral
+ *  The actual implementation is copied from http://ab-initio.mit.edu/Faddeeva
+ *  @see http://ab-initio.mit.edu/Faddeeva
+ *  @see https://en.wikipedia.org/wiki/Dawson_function
+ */
+// ============================================================================
+std::complex<double> Ostap::Math::dowson ( const std::complex<double>& x )
+{ return Faddeeva::Dawson ( x ) ; }
+// ============================================================================
 /*  compute sech fuction 
  *  \$f f(x) = \frac{1}{\cosh x} = \frac{2}{ e^{x}+e^{-x} }\f$
  *  @return the value of sech function 
@@ -1,6 +1,13 @@
 // ============================================================================
 // Include files 
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <cassert>
+#include <algorithm>
+#include <map>
+#include <memory>
+// ============================================================================
 // ROOT/RooFit 
 // ============================================================================
 #include "RooAbsReal.h"
@@ -8,6 +15,7 @@
 #include "RooAddition.h"
 #include "RooAbsPdf.h"
 #include "RooGlobalFunc.h"
+#include "RooConstVar.h"
 // ============================================================================
 // Ostap
 // ============================================================================
@@ -19,6 +27,8 @@
 // ============================================================================
 #include "Exception.h"
 #include "local_math.h"
+#include "local_hash.h"
+#include "local_roofit.h"
 // ============================================================================
 /** @file
  *  implementaton of various small additions to RooFit 
@@ -55,6 +65,8 @@ ClassImp(Ostap::MoreRooFit::TwoVars       )
 ClassImp(Ostap::MoreRooFit::FunOneVar     )
 ClassImp(Ostap::MoreRooFit::FunTwoVars    )
 ClassImp(Ostap::MoreRooFit::ProductPdf    )
+ClassImp(Ostap::MoreRooFit::ChebyshevProxy)
+ClassImp(Ostap::MoreRooFit::Fused         )
 // ============================================================================
 namespace 
 {
@@ -101,6 +113,52 @@ namespace
   // ==========================================================================
   inline bool a_zero ( const double x ) { return s_zero ( x ) ; }
   // ==========================================================================
+  /// x**y, used by Power and Fused 
+  inline double power_ ( const double x , const double y ) 
+  {
+    if      ( a_zero ( y )                      ) { return 1.0 ; }
+    else if ( 0 < y && a_zero ( x )             ) { return 0.0 ; }
+    else if ( 0 < y && Ostap::Math::isint ( y ) ) 
+    { 
+      const int ny = Ostap::Math::round ( y ) ;
+      if      ( 0 == ny ) { return 1.0 ; }
+      return std::pow ( x , ny ) ;
+    }
+    return std::pow ( x , y ) ;
+  }
+  // ==========================================================================
+  /// the operation code for the simple two-variable nodes (-1 if not known)
+  inline int op_code_ ( const RooAbsArg& node ) 
+  {
+    namespace M = Ostap::MoreRooFit ;
+    typedef M::Fused F ;
+    if      ( dynamic_cast<const M::Division*>  ( &node ) ) { return F::OpDivide    ; }
+    else if ( dynamic_cast<const M::Fraction*>  ( &node ) ) { return F::OpFraction  ; }
+    else if ( dynamic_cast<const M::Asymmetry*> ( &node ) ) { return F::OpAsymmetry ; }
+    else if ( dynamic_cast<const M::Power*>     ( &node ) ) { return F::OpPower     ; }
+    else if ( dynamic_cast<const M::Abs*>       ( &node ) ) { return F::OpAbs       ; }
+    else if ( dynamic_cast<const M::Exp*>       ( &node ) ) { return F::OpExp       ; }
+    else if ( dynamic_cast<const M::Log*>       ( &node ) ) { return F::OpLog       ; }
+    else if ( dynamic_cast<const M::Log10*>     ( &node ) ) { return F::OpLog10     ; }
+    else if ( dynamic_cast<const M::Erf*>       ( &node ) ) { return F::OpErf       ; }
+    else if ( dynamic_cast<const M::Erfc*>      ( &node ) ) { return F::OpErfc      ; }
+    else if ( dynamic_cast<const M::Gamma*>     ( &node ) ) { return F::OpGamma     ; }
+    else if ( dynamic_cast<const M::LGamma*>    ( &node ) ) { return F::OpLGamma    ; }
+    else if ( dynamic_cast<const M::IGamma*>    ( &node ) ) { return F::OpIGamma    ; }
+    else if ( dynamic_cast<const M::Sin*>       ( &node ) ) { return F::OpSin       ; }
+    else if ( dynamic_cast<const M::Cos*>       ( &node ) ) { return F::OpCos       ; }
+    else if ( dynamic_cast<const M::Tan*>       ( &node ) ) { return F::OpTan       ; }
+    else if ( dynamic_cast<const M::Sinh*>      ( &node ) ) { return F::OpSinh      ; }
+    else if ( dynamic_cast<const M::Cosh*>      ( &node ) ) { return F::OpCosh      ; }
+    else if ( dynamic_cast<const M::Tanh*>      ( &node ) ) { return F::OpTanh      ; }
+    else if ( dynamic_cast<const M::Sech*>      ( &node ) ) { return F::OpSech      ; }
+    else if ( dynamic_cast<const M::Atan2*>     ( &node ) ) { return F::OpAtan2     ; }
+    else if ( dynamic_cast<const M::FunTwoVars*>( &node ) ) { return F::OpFun2      ; }
+    else if ( dynamic_cast<const M::FunOneVar*> ( &node ) ) { return F::OpFun1      ; }
+    else if ( dynamic_cast<const M::Id*>        ( &node ) ) { return F::OpCopy      ; }
+    return -1 ;
+  }
+  // ==========================================================================
 }
 // ============================================================================
 // constructor with two variables 
@@ -574,19 +632,7 @@ Double_t Ostap::MoreRooFit::Asymmetry::evaluate () const
 { const double a = m_x ; const double b = m_y ; return ( a - b ) / ( a + b ) ; }
 // ============================================================================
 Double_t Ostap::MoreRooFit::Power::evaluate () const 
-{ 
-  const double x = m_x ; 
-  const double y = m_y ;
-  if      ( a_zero ( y )                      ) { return 1.0 ; }
-  else if ( 0 < y && a_zero ( x )             ) { return 0.0 ; }
-  else if ( 0 < y && Ostap::Math::isint ( y ) ) 
-  { 
-    const int ny = Ostap::Math::round ( y ) ;
-    if      ( 0 == ny ) { return 1.0 ; }
-    return std::pow ( x , ny ) ;
-  }
-  return std::pow ( x , y ) ;
-}
+{ const double x = m_x ; const double y = m_y ; return power_ ( x , y ) ; }
 // ============================================================================
 Double_t Ostap::MoreRooFit::Abs::evaluate () const 
 { const double a = m_x ; const double b = m_y ; return std::abs    ( a * b ) ; }
@@ -762,6 +808,457 @@ Double_t Ostap::MoreRooFit::ProductPdf::evaluate () const
 }
 // ============================================================================
 
+
+// ============================================================================
+/*  constructor from name, title, the observable and the PDF
+ *  @param name      name 
+ *  @param title     title 
+ *  @param x         the observable
+ *  @param pdf       the PDF to be approximated 
+ *  @param precision the relative precision of the approximation 
+ *  @param maxorder  maximal order of the polynomial in one piece 
+ *  @param maxpieces maximal number of pieces 
+ */
+// ============================================================================
+Ostap::MoreRooFit::ChebyshevProxy::ChebyshevProxy 
+( const char*        name      , 
+  const char*        title     , 
+  RooAbsRealLValue&  x         , 
+  RooAbsPdf&         pdf       , 
+  const double       precision ,
+  const unsigned int maxorder  , 
+  const unsigned int maxpieces ) 
+  : RooAbsPdf  ( name , title ) 
+    //
+  , m_x         ( "x"    , "Observable"     , this , x   ) 
+  , m_pdf       ( "pdf"  , "The PDF"        , this , pdf ) 
+  , m_pars      ( "pars" , "The parameters" , this       ) 
+  , m_precision ( std::abs ( precision ) ) 
+  , m_maxorder  ( maxorder  ) 
+  , m_maxpieces ( maxpieces ) 
+  , m_cheb      () 
+{
+  Ostap::Assert ( pdf.dependsOn ( x )                   , 
+                  "PDF does not depend on observable!"  , 
+                  "Ostap::MoreRooFit::ChebyshevProxy"   ) ;
+  //
+  std::unique_ptr<RooArgSet> pars { pdf.getParameters ( RooArgSet ( x ) ) } ;
+  if ( pars ) 
+  { ::copy_real ( RooArgList ( *pars ) , m_pars , 
+                  "Parameter is not RooAbsReal!" , 
+                  "Ostap::MoreRooFit::ChebyshevProxy" ) ; }
+}
+// ============================================================================
+// "copy" constructor 
+// ============================================================================
+Ostap::MoreRooFit::ChebyshevProxy::ChebyshevProxy 
+( const Ostap::MoreRooFit::ChebyshevProxy& right , 
+  const char*                              name  ) 
+  : RooAbsPdf ( right , name ) 
+    //
+  , m_x         ( "x"    , this , right.m_x    ) 
+  , m_pdf       ( "pdf"  , this , right.m_pdf  )
+  , m_pars      ( "pars" , this , right.m_pars )
+  , m_precision ( right.m_precision ) 
+  , m_maxorder  ( right.m_maxorder  ) 
+  , m_maxpieces ( right.m_maxpieces ) 
+  , m_cheb      () // the approximation is rebuilt for the new object 
+  , m_copy      () // the copy is made for the new object 
+{}
+// ============================================================================
+// destructor 
+// ============================================================================
+Ostap::MoreRooFit::ChebyshevProxy::~ChebyshevProxy(){}
+// ============================================================================
+// clone 
+// ============================================================================
+Ostap::MoreRooFit::ChebyshevProxy*
+Ostap::MoreRooFit::ChebyshevProxy::clone ( const char* newname ) const 
+{ return new Ostap::MoreRooFit::ChebyshevProxy ( *this , newname ) ; }
+// ============================================================================
+// the key: the hash of the current values of the parameters 
+// ============================================================================
+std::size_t Ostap::MoreRooFit::ChebyshevProxy::key () const 
+{
+  std::size_t seed = 0 ;
+  for ( int i = 0 ; i < m_pars.getSize () ; ++i ) 
+  { std::_hash_combine 
+      ( seed , static_cast<const RooAbsReal&> ( m_pars [ i ] ).getVal () ) ; }
+  return seed ;
+}
+// ============================================================================
+// get the private copy of the PDF, synchronized with the parameters 
+// ============================================================================
+const RooAbsReal& Ostap::MoreRooFit::ChebyshevProxy::sampler () const 
+{
+  const RooAbsReal& pdf  = m_pdf.arg () ;
+  const bool        make = !m_copy || &pdf != m_origin ;
+  if ( make ) 
+  {
+    m_xcopy  = nullptr ;
+    m_pcopy.clear () ;
+    m_copy.reset ( static_cast<RooAbsReal*> ( pdf.cloneTree () ) ) ;
+    m_origin = &pdf ;
+    //
+    RooArgSet nodes ;
+    m_copy -> treeNodeServerList ( &nodes ) ;
+    m_xcopy = dynamic_cast<RooAbsRealLValue*> ( nodes.find ( m_x.arg ().GetName () ) ) ;
+    Ostap::Assert ( nullptr != m_xcopy                    , 
+                    "Observable is not lvalue!"           , 
+                    "Ostap::MoreRooFit::ChebyshevProxy"   ) ;
+    for ( int i = 0 ; i < m_pars.getSize () ; ++i ) 
+    { m_pcopy.push_back 
+        ( dynamic_cast<RooAbsRealLValue*> ( nodes.find ( m_pars [ i ].GetName () ) ) ) ; }
+  }
+  //
+  const std::size_t current = key () ;
+  if ( make || current != m_synced ) 
+  {
+    for ( int i = 0 ; i < m_pars.getSize () ; ++i ) 
+    {
+      RooAbsRealLValue* p = m_pcopy [ i ] ;
+      if ( nullptr != p ) 
+      { p -> setVal ( static_cast<const RooAbsReal&> ( m_pars [ i ] ).getVal () ) ; }
+    }
+    m_synced = current ;
+  }
+  //
+  return *m_copy ;
+}
+// ============================================================================
+// the value of the original PDF 
+// ============================================================================
+double Ostap::MoreRooFit::ChebyshevProxy::exact ( const double x ) const 
+{
+  const RooAbsReal& pdf = sampler () ;
+  m_xcopy -> setVal ( x ) ;
+  return pdf.getVal () ;
+}
+// ============================================================================
+// get the approximation (build it if needed)
+// ============================================================================
+const Ostap::Math::AdaptiveChebyshev& 
+Ostap::MoreRooFit::ChebyshevProxy::chebyshev () const 
+{
+  const RooAbsRealLValue* xv = dynamic_cast<const RooAbsRealLValue*> ( &m_x.arg () ) ;
+  Ostap::Assert ( nullptr != xv                         , 
+                  "Observable is not lvalue!"           , 
+                  "Ostap::MoreRooFit::ChebyshevProxy"   ) ;
+  //
+  const double xmin = std::min ( xv -> getMin () , xv -> getMax () ) ;
+  const double xmax = std::max ( xv -> getMin () , xv -> getMax () ) ;
+  // the range of the observable is changed: rebuild the approximation 
+  if ( m_cheb && ( xmin != m_cheb -> xmin () || xmax != m_cheb -> xmax () ) ) 
+  { m_cheb.reset () ; }
+  //
+  if ( !m_cheb ) 
+  {
+    const ChebyshevProxy* self = this ;
+    m_cheb.reset ( new Ostap::Math::AdaptiveChebyshev 
+                   ( [self] ( const double v ) { return self -> exact ( v ) ; } , 
+                     xmin        , 
+                     xmax        , 
+                     m_precision , 
+                     m_maxorder  , 
+                     m_maxpieces , 
+                     [self] () -> std::size_t { return self -> key () ; } ) ) ;
+  }
+  return *m_cheb ;
+}
+// ============================================================================
+// the main method 
+// ============================================================================
+Double_t Ostap::MoreRooFit::ChebyshevProxy::evaluate () const
+{
+  const double x = m_x ;
+  return chebyshev () ( x ) ;
+}
+// ============================================================================
+Int_t Ostap::MoreRooFit::ChebyshevProxy::getAnalyticalIntegral
+( RooArgSet&     allVars      , 
+  RooArgSet&     analVars     ,
+  const char* /* rangename */ ) const 
+{
+  if ( matchArgs ( allVars , analVars , m_x ) ) { return 1 ; }
+  return 0 ;
+}
+// ============================================================================
+Double_t Ostap::MoreRooFit::ChebyshevProxy::analyticalIntegral 
+( Int_t       code      , 
+  const char* rangeName ) const 
+{
+  assert ( code == 1 ) ;
+  if ( 1 != code ) {}
+  //
+  const Ostap::Math::AdaptiveChebyshev& cheb = chebyshev () ;
+  const double low  = m_x.min ( rangeName ) ;
+  const double high = m_x.max ( rangeName ) ;
+  Ostap::Assert ( cheb.xmin () <= low && high <= cheb.xmax () , 
+                  "Integration range is outside the approximation range!" , 
+                  "Ostap::MoreRooFit::ChebyshevProxy" ) ;
+  return cheb.integral ( low , high ) ;
+}
+// ============================================================================
+
+// ============================================================================
+/** @class Ostap::MoreRooFit::Fused::Builder
+ *  helper class to build the tape for the fused expression 
+ */
+class Ostap::MoreRooFit::Fused::Builder
+{
+public:
+  // ==========================================================================
+  /// the kind of operand 
+  enum Kind { Leaf = 0 , Constant = 1 , Instruction = 2 } ;
+  /// the operand: kind & index 
+  typedef std::pair<int,int> Operand ;
+  /// the instruction 
+  struct Instr { int code ; Operand a ; Operand b ; int fun ; } ;
+  // ==========================================================================
+public:
+  // ==========================================================================
+  Builder ( Ostap::MoreRooFit::Fused& fused ) : m_fused ( fused ) {}
+  // ==========================================================================
+  /// build the tape for the node 
+  Operand build ( const RooAbsReal& node ) 
+  {
+    auto found = m_done.find ( &node ) ;
+    if ( m_done.end () != found ) { return found->second ; }      // RETURN
+    //
+    Operand result ;
+    const int code = op_code_ ( node ) ;
+    if      ( const RooConstVar* c = dynamic_cast<const RooConstVar*> ( &node ) ) 
+    { result = constant ( c->getVal () ) ; }
+    else if ( !Ostap::MoreRooFit::Fused::fusable ( node ) ) 
+    { result = leaf     ( node ) ; }
+    else if ( const RooAddition* a = dynamic_cast<const RooAddition*> ( &node ) ) 
+    { result = chain    ( OpAdd      , a->list () , 0 ) ; }
+    else if ( const RooProduct*  p = dynamic_cast<const RooProduct*>  ( &node ) ) 
+    { result = chain    ( OpMultiply , const_cast<RooProduct*> ( p )->components () , 1 ) ; }
+    else if ( OpCopy == code ) 
+    { result = build    ( static_cast<const Ostap::MoreRooFit::OneVar&> ( node ).x () ) ; }
+    else if ( OpFun1 == code ) 
+    {
+      const Ostap::MoreRooFit::FunOneVar& f = static_cast<const Ostap::MoreRooFit::FunOneVar&> ( node ) ;
+      m_fused.m_fun1.push_back ( f.fun () ) ;
+      const Operand x = build ( f.x () ) ;
+      result = add ( OpFun1 , x , x , int ( m_fused.m_fun1.size () ) - 1 ) ;
+    }
+    else 
+    {
+      const Ostap::MoreRooFit::TwoVars& t = static_cast<const Ostap::MoreRooFit::TwoVars&> ( node ) ;
+      int fun = -1 ;
+      if ( OpFun2 == code ) 
+      {
+        m_fused.m_fun2.push_back ( static_cast<const Ostap::MoreRooFit::FunTwoVars&> ( node ).fun2 () ) ;
+        fun = int ( m_fused.m_fun2.size () ) - 1 ;
+      }
+      const Operand x = build ( t.x () ) ;
+      const Operand y = build ( t.y () ) ;
+      result = add ( code , x , y , fun ) ;
+    }
+    //
+    m_done [ &node ] = result ;
+    return result ;
+  }
+  // ==========================================================================
+  /// convert the instructions into the tape 
+  void finalize ( const Operand& result ) 
+  {
+    // the result must be the last instruction 
+    if ( Instruction != result.first || result.second + 1 != int ( m_instr.size () ) ) 
+    { add ( OpCopy , result , result ) ; }
+    //
+    const int nl = m_leaves ;
+    const int nc = m_fused.m_consts.size () ;
+    auto reg = [nl,nc] ( const Operand& o ) -> int 
+      { return Leaf == o.first ? o.second : Constant == o.first ? nl + o.second : nl + nc + o.second ; } ;
+    //
+    m_fused.m_tape.clear   () ;
+    m_fused.m_tape.reserve ( 4 * m_instr.size () ) ;
+    for ( const Instr& i : m_instr ) 
+    {
+      m_fused.m_tape.push_back ( i.code       ) ;
+      m_fused.m_tape.push_back ( reg ( i.a  ) ) ;
+      m_fused.m_tape.push_back ( reg ( i.b  ) ) ;
+      m_fused.m_tape.push_back ( i.fun        ) ;
+    }
+  }
+  // ==========================================================================
+private:
+  // ==========================================================================
+  Operand leaf ( const RooAbsReal& node ) 
+  {
+    m_fused.m_leaves.add ( const_cast<RooAbsReal&> ( node ) ) ;
+    return Operand ( Leaf , m_leaves++ ) ;
+  }
+  // ==========================================================================
+  Operand constant ( const double value ) 
+  {
+    m_fused.m_consts.push_back ( value ) ;
+    return Operand ( Constant , int ( m_fused.m_consts.size () ) - 1 ) ;
+  }
+  // ==========================================================================
+  Operand add ( const int code , const Operand& a , const Operand& b , const int fun = -1 ) 
+  {
+    m_instr.push_back ( Instr { code , a , b , fun } ) ;
+    return Operand ( Instruction , int ( m_instr.size () ) - 1 ) ;
+  }
+  // ==========================================================================
+  /// the sum/product of all items (in order, as for RooAddition/RooProduct)
+  Operand chain ( const int code , const RooArgList& items , const double empty ) 
+  {
+    if ( 0 == items.getSize () ) { return constant ( empty ) ; }
+    Operand result = build ( static_cast<const RooAbsReal&> ( items [ 0 ] ) ) ;
+    for ( int i = 1 ; i < items.getSize () ; ++i ) 
+    { result = add ( code , result , build ( static_cast<const RooAbsReal&> ( items [ i ] ) ) ) ; }
+    return result ;
+  }
+  // ==========================================================================
+private:
+  // ==========================================================================
+  /// the fused expression 
+  Ostap::MoreRooFit::Fused&              m_fused      ;
+  /// number of leaves 
+  int                                    m_leaves { 0 } ;
+  /// the instructions 
+  std::vector<Instr>                     m_instr  {} ;
+  /// already processed nodes 
+  std::map<const RooAbsArg*,Operand>     m_done   {} ;
+  // ==========================================================================
+} ;
+// ============================================================================
+/*  constructor from the expression 
+ *  @param name       the name 
+ *  @param title      the title 
+ *  @param expression the expression to be fused 
+ */
+// ============================================================================
+Ostap::MoreRooFit::Fused::Fused
+( const std::string& name       , 
+  const std::string& title      , 
+  const RooAbsReal&  expression ) 
+  : RooAbsReal 
+    ( name2_  ( name  , "fused" , expression ).c_str() ,
+      title2_ ( title , "fused" , expression ).c_str() )
+  , m_leaves ( "!leaves" , "leaves of the expression" , this ) 
+{
+  Builder builder ( *this ) ;
+  builder.finalize ( builder.build ( expression ) ) ;
+}
+// ============================================================================
+// copy constructor 
+// ============================================================================
+Ostap::MoreRooFit::Fused::Fused
+( const Ostap::MoreRooFit::Fused& right   , 
+  const char*                     newname ) 
+  : RooAbsReal ( right , newname ) 
+  , m_leaves   ( "!leaves" , this , right.m_leaves ) 
+  , m_consts   ( right.m_consts ) 
+  , m_tape     ( right.m_tape   ) 
+  , m_fun1     ( right.m_fun1   ) 
+  , m_fun2     ( right.m_fun2   ) 
+  , m_regs     () 
+{}
+// ============================================================================
+// destructor 
+// ============================================================================
+Ostap::MoreRooFit::Fused::~Fused(){}
+// ============================================================================
+// clone 
+// ============================================================================
+Ostap::MoreRooFit::Fused*
+Ostap::MoreRooFit::Fused::clone ( const char* newname ) const 
+{ return new Ostap::MoreRooFit::Fused ( *this , newname ) ; }
+// ============================================================================
+// can this node be fused?
+// ============================================================================
+bool Ostap::MoreRooFit::Fused::fusable ( const RooAbsArg& node ) 
+{
+  if ( dynamic_cast<const RooAddition*> ( &node ) ) { return true ; }
+  if ( const RooProduct* p = dynamic_cast<const RooProduct*> ( &node ) ) 
+  {
+    // products with categories are not fused 
+    const RooArgList items = const_cast<RooProduct*> ( p )->components () ;
+    for ( int i = 0 ; i < items.getSize () ; ++i ) 
+    { if ( !dynamic_cast<const RooAbsReal*> ( items.at ( i ) ) ) { return false ; } }
+    return true ;
+  }
+  return 0 <= op_code_ ( node ) ;
+}
+// ============================================================================
+// the actual evaluation of the result 
+// ============================================================================
+Double_t Ostap::MoreRooFit::Fused::evaluate () const 
+{
+  const std::size_t nl = m_leaves.getSize () ;
+  const std::size_t nc = m_consts.size    () ;
+  const std::size_t ni = size             () ;
+  //
+  if ( m_regs.size () != nl + nc + ni ) 
+  {
+    for ( std::size_t i = 0 ; i < ni ; ++i ) 
+    {
+      const int code = m_tape [ 4 * i ] ;
+      const int fun  = m_tape [ 4 * i + 3 ] ;
+      Ostap::Assert ( ( OpFun1 != code || ( 0 <= fun && fun < int ( m_fun1.size () ) ) ) &&
+                      ( OpFun2 != code || ( 0 <= fun && fun < int ( m_fun2.size () ) ) ) , 
+                      "The function is not available (not persistent)" , 
+                      "Ostap::MoreRooFit::Fused" ) ;
+    }
+    m_regs.assign ( nl + nc + ni , 0.0 ) ;
+    std::copy ( m_consts.begin () , m_consts.end () , m_regs.begin () + nl ) ;
+  }
+  //
+  double* r = m_regs.data () ;
+  const RooArgSet* nset = m_leaves.nset () ;
+  for ( std::size_t i = 0 ; i < nl ; ++i ) 
+  { r [ i ] = static_cast<const RooAbsReal&> ( m_leaves [ i ] ).getVal ( nset ) ; }
+  //
+  double*    out  = r + nl + nc ;
+  const int* tape = m_tape.data () ;
+  for ( std::size_t i = 0 ; i < ni ; ++i , tape += 4 ) 
+  {
+    const double a = r [ tape [ 1 ] ] ;
+    const double b = r [ tape [ 2 ] ] ;
+    double       v = 0 ;
+    switch ( tape [ 0 ] ) 
+    {
+    case OpCopy      : v = a                                 ; break ;
+    case OpAdd       : v = a + b                             ; break ;
+    case OpMultiply  : v = a * b                             ; break ;
+    case OpDivide    : v = a / b                             ; break ;
+    case OpFraction  : v = a / ( a + b )                     ; break ;
+    case OpAsymmetry : v = ( a - b ) / ( a + b )             ; break ;
+    case OpPower     : v = power_ ( a , b )                  ; break ;
+    case OpAbs       : v = std::abs    ( a * b )             ; break ;
+    case OpExp       : v = std::exp    ( a * b )             ; break ;
+    case OpLog       : v = std::log    ( a * b )             ; break ;
+    case OpLog10     : v = std::log10  ( a * b )             ; break ;
+    case OpErf       : v = std::erf    ( a * b )             ; break ;
+    case OpErfc      : v = std::erfc   ( a * b )             ; break ;
+    case OpGamma     : v = std::tgamma ( a * b )             ; break ;
+    case OpLGamma    : v = std::lgamma ( a * b )             ; break ;
+    case OpIGamma    : v = Ostap::Math::igamma ( a * b )     ; break ;
+    case OpSin       : v = std::sin    ( a * b )             ; break ;
+    case OpCos       : v = std::cos    ( a * b )             ; break ;
+    case OpTan       : v = std::tan    ( a * b )             ; break ;
+    case OpSinh      : v = std::sinh   ( a * b )             ; break ;
+    case OpCosh      : v = std::cosh   ( a * b )             ; break ;
+    case OpTanh      : v = std::tanh   ( a * b )             ; break ;
+    case OpSech      : v = Ostap::Math::sech ( a * b )       ; break ;
+    case OpAtan2     : v = std::atan2  ( a , b )             ; break ;
+    case OpFun1      : v = m_fun1 [ tape [ 3 ] ] ( a )       ; break ;
+    case OpFun2      : v = m_fun2 [ tape [ 3 ] ] ( a , b )   ; break ;
+    default          : v = a                                 ; break ;
+    }
+    out [ i ] = v ;
+  }
+  //
+  return 0 < ni ? out [ ni - 1 ] : 0.0 ;
+}
+// ============================================================================
+
 // ============================================================================
 //                                                                      The END
 // ============================================================================
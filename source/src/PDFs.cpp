@@ -9,9 +9,11 @@
 // ============================================================================
 #include "Ostap/PDFs.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 // ROOT 
 // ============================================================================
+#include "RooAbsData.h"
 #include "RooArgSet.h"
 #include "RooRealVar.h"
 #include "RooConstVar.h"
@@ -220,7 +222,7 @@ void Ostap::Models::BreitWigner::setPars () const
 // the actual evaluation of function 
 // ============================================================================
 Double_t Ostap::Models::BreitWigner::evaluate() const 
-{ setPars() ; return  ( *m_bw ) ( m_x ) ; }
+{ Ostap::Utils::Instrumentation::evaluated ( this ) ; setPars() ; return  ( *m_bw ) ( m_x ) ; }
 // ============================================================================
 Int_t Ostap::Models::BreitWigner::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -390,6 +392,7 @@ std::complex<double> Ostap::Models::BWI::amplitude () const
 // ============================================================================
 Double_t Ostap::Models::BWI::evaluate () const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   const std::complex<double> amp = amplitude() ;
   return m_bw->breit_wigner ( m_x , amp ) ;
 }
@@ -632,7 +635,7 @@ void Ostap::Models::BWPS::setPars () const
 // the actual evaluation of function 
 // ============================================================================
 Double_t Ostap::Models::BWPS::evaluate() const 
-{ setPars() ; return  m_bwps  ( m_x ) ; }
+{ Ostap::Utils::Instrumentation::evaluated ( this ) ; setPars() ; return  m_bwps  ( m_x ) ; }
 // ============================================================================
 Int_t Ostap::Models::BWPS::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -756,7 +759,7 @@ Ostap::Models::BW3L::amplitude () const
 // the actual evaluation of function 
 // ============================================================================
 Double_t Ostap::Models::BW3L::evaluate() const 
-{ setPars() ; return  m_bw3l  ( m_x ) ; }
+{ Ostap::Utils::Instrumentation::evaluated ( this ) ; setPars() ; return  m_bw3l  ( m_x ) ; }
 // ============================================================================
 Int_t Ostap::Models::BW3L::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -845,6 +848,7 @@ void Ostap::Models::Voigt::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Voigt::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars() ;
   //
@@ -940,6 +944,7 @@ void Ostap::Models::PseudoVoigt::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PseudoVoigt::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars() ;
   //
@@ -1037,6 +1042,7 @@ void Ostap::Models::CrystalBall::setPars () const
 // ============================================================================
 Double_t Ostap::Models::CrystalBall::evaluate() const
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1136,6 +1142,7 @@ void Ostap::Models::CrystalBallRS::setPars () const
 // ============================================================================
 Double_t Ostap::Models::CrystalBallRS::evaluate() const
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars() ;
   //
@@ -1241,6 +1248,7 @@ void Ostap::Models::CrystalBallDS::setPars () const
 // ============================================================================
 Double_t Ostap::Models::CrystalBallDS::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1351,6 +1359,7 @@ void Ostap::Models::Needham::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Needham::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1472,6 +1481,7 @@ void Ostap::Models::Apollonios::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Apollonios::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1568,6 +1578,7 @@ void Ostap::Models::Apollonios2::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Apollonios2::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1661,6 +1672,7 @@ void Ostap::Models::BifurcatedGauss::setPars () const
 // ============================================================================
 Double_t Ostap::Models::BifurcatedGauss::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1755,6 +1767,7 @@ void Ostap::Models::GenGaussV1::setPars () const
 // ============================================================================
 Double_t Ostap::Models::GenGaussV1::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1849,6 +1862,7 @@ void Ostap::Models::GenGaussV2::setPars () const
 // ============================================================================
 Double_t Ostap::Models::GenGaussV2::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1943,6 +1957,7 @@ void Ostap::Models::SkewGauss::setPars () const
 // ============================================================================
 Double_t Ostap::Models::SkewGauss::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2044,6 +2059,7 @@ void Ostap::Models::Bukin::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Bukin::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2134,6 +2150,7 @@ void Ostap::Models::StudentT::setPars () const
 // ============================================================================
 Double_t Ostap::Models::StudentT::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2232,6 +2249,7 @@ void Ostap::Models::BifurcatedStudentT::setPars () const
 // ============================================================================
 Double_t Ostap::Models::BifurcatedStudentT::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2330,6 +2348,7 @@ void Ostap::Models::GramCharlierA::setPars () const
 // ============================================================================
 Double_t Ostap::Models::GramCharlierA::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars() ;
   //
@@ -2401,7 +2420,7 @@ Ostap::Models::PhaseSpace2::clone( const char* name ) const
 // the actual evaluation of function 
 // ============================================================================
 Double_t Ostap::Models::PhaseSpace2::evaluate() const 
-{ return m_ps2 ( m_x ) ; }
+{ Ostap::Utils::Instrumentation::evaluated ( this ) ; return m_ps2 ( m_x ) ; }
 // ============================================================================
 Int_t Ostap::Models::PhaseSpace2::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -2585,6 +2604,7 @@ void Ostap::Models::PhaseSpaceLeft::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PhaseSpaceLeft::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2671,6 +2691,7 @@ void Ostap::Models::PhaseSpaceRight::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PhaseSpaceRight::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2758,6 +2779,7 @@ void Ostap::Models::PhaseSpaceNL::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PhaseSpaceNL::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -2826,7 +2848,7 @@ Ostap::Models::PhaseSpace23L::clone( const char* name ) const
 // the actual evaluation of function 
 // ============================================================================
 Double_t Ostap::Models::PhaseSpace23L::evaluate() const 
-{ return m_ps23L ( m_x ) ; }
+{ Ostap::Utils::Instrumentation::evaluated ( this ) ; return m_ps23L ( m_x ) ; }
 // ============================================================================
 Int_t Ostap::Models::PhaseSpace23L::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -3144,6 +3166,7 @@ void Ostap::Models::PhaseSpacePol::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PhaseSpacePol::evaluate () const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3322,6 +3345,7 @@ void Ostap::Models::PhaseSpaceLeftExpoPol::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PhaseSpaceLeftExpoPol::evaluate () const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars () ;
   return m_ps ( m_x ) ;
 }
@@ -3386,6 +3410,7 @@ Ostap::Models::PolyPositive::PolyPositive
   , m_phis     ( "phis"   , this , right.m_phis  ) 
     //
   , m_positive ( right.m_positive ) 
+  , m_cache    ( right.m_cache )
 {
   setPars () ;
 }
@@ -3416,12 +3441,42 @@ void Ostap::Models::PolyPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolyPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
+  double result = 0 ;
+  const auto& f = m_positive.bernstein () ;
+  if ( m_cache && m_cache->valid ( Ostap::Math::BasisCache::key1D ( f ) ) &&
+       m_cache->value ( m_x , f.pars () , result ) ) { return result ; }
+  //
   return m_positive ( m_x ) ; 
 }
 // ============================================================================
+// precompute the basis functions for all entries of the dataset
+// ============================================================================
+bool Ostap::Models::PolyPositive::cacheBasis
+( const RooAbsData& data      , 
+  const bool        single    , 
+  const std::size_t maxmemory ) 
+{
+  //
+  setPars () ;
+  //
+  const auto& f = m_positive.bernstein () ;
+  auto cache = std::make_shared<Ostap::Math::BasisCache> 
+    ( f.npars () , single , maxmemory , Ostap::Math::BasisCache::key1D ( f ) ) ;
+  if ( !cache->fill ( data , { m_x.arg ().GetName () } , Ostap::Math::BasisCache::basis1D ( f ) ) ) 
+  { m_cache.reset () ; return false ; }                           // RETURN 
+  //
+  m_cache = cache ;
+  return true ;
+}
+// ============================================================================
+// remove the cache of basis functions 
+// ============================================================================
+void Ostap::Models::PolyPositive::resetCache () { m_cache.reset () ; }
+// ============================================================================
 Int_t Ostap::Models::PolyPositive::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
   RooArgSet&     analVars     ,
@@ -3512,6 +3567,7 @@ void Ostap::Models::PolyPositiveEven::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolyPositiveEven::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3605,6 +3661,7 @@ void Ostap::Models::PolyMonotonic::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolyMonotonic::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3697,6 +3754,7 @@ void Ostap::Models::PolyConvex::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolyConvex::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3790,6 +3848,7 @@ void Ostap::Models::PolyConvexOnly::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolyConvexOnly::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3888,6 +3947,7 @@ void Ostap::Models::PolySigmoid::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PolySigmoid::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -3956,6 +4016,7 @@ Ostap::Models::PositiveSpline::PositiveSpline
   , m_phis     ( "phis"   , this , right.m_phis  ) 
     //
   , m_spline ( right.m_spline ) 
+  , m_cache    ( right.m_cache )
 {
   setPars () ;
 }
@@ -3986,12 +4047,42 @@ void Ostap::Models::PositiveSpline::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PositiveSpline::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
+  double result = 0 ;
+  const auto& f = m_spline.bspline () ;
+  if ( m_cache && m_cache->valid ( Ostap::Math::BasisCache::keySpline ( f ) ) &&
+       m_cache->value ( m_x , f.pars () , result ) ) { return result ; }
+  //
   return m_spline ( m_x ) ; 
 }
 // ============================================================================
+// precompute the basis functions for all entries of the dataset
+// ============================================================================
+bool Ostap::Models::PositiveSpline::cacheBasis
+( const RooAbsData& data      , 
+  const bool        single    , 
+  const std::size_t maxmemory ) 
+{
+  //
+  setPars () ;
+  //
+  const auto& f = m_spline.bspline () ;
+  auto cache = std::make_shared<Ostap::Math::BasisCache> 
+    ( f.npars () , single , maxmemory , Ostap::Math::BasisCache::keySpline ( f ) ) ;
+  if ( !cache->fill ( data , { m_x.arg ().GetName () } , Ostap::Math::BasisCache::basis1D ( f ) ) ) 
+  { m_cache.reset () ; return false ; }                           // RETURN 
+  //
+  m_cache = cache ;
+  return true ;
+}
+// ============================================================================
+// remove the cache of basis functions 
+// ============================================================================
+void Ostap::Models::PositiveSpline::resetCache () { m_cache.reset () ; }
+// ============================================================================
 Int_t Ostap::Models::PositiveSpline::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
   RooArgSet&     analVars     ,
@@ -4086,6 +4177,7 @@ void Ostap::Models::MonotonicSpline::setPars () const
 // ============================================================================
 Double_t Ostap::Models::MonotonicSpline::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4183,6 +4275,7 @@ void Ostap::Models::ConvexSpline::setPars () const
 // ============================================================================
 Double_t Ostap::Models::ConvexSpline::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4280,6 +4373,7 @@ void Ostap::Models::ConvexOnlySpline::setPars () const
 // ============================================================================
 Double_t Ostap::Models::ConvexOnlySpline::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4379,6 +4473,7 @@ void Ostap::Models::ExpoPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::ExpoPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4484,6 +4579,7 @@ void Ostap::Models::TwoExpoPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::TwoExpoPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4570,6 +4666,7 @@ void Ostap::Models::GammaDist::setPars () const
 // ============================================================================
 Double_t Ostap::Models::GammaDist::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4664,6 +4761,7 @@ void Ostap::Models::GenGammaDist::setPars () const
 // ============================================================================
 Double_t Ostap::Models::GenGammaDist::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4761,6 +4859,7 @@ void Ostap::Models::Amoroso::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Amoroso::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4852,6 +4951,7 @@ void Ostap::Models::LogGammaDist::setPars () const
 // ============================================================================
 Double_t Ostap::Models::LogGammaDist::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -4939,6 +5039,7 @@ void Ostap::Models::Log10GammaDist::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Log10GammaDist::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5029,6 +5130,7 @@ void Ostap::Models::LogGamma::setPars () const
 // ============================================================================
 Double_t Ostap::Models::LogGamma::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5123,6 +5225,7 @@ void Ostap::Models::BetaPrime::setPars () const
 // ============================================================================
 Double_t Ostap::Models::BetaPrime::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5217,6 +5320,7 @@ void Ostap::Models::SinhAsinh::setPars () const
 // ============================================================================
 Double_t Ostap::Models::SinhAsinh::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5311,6 +5415,7 @@ void Ostap::Models::JohnsonSU::setPars () const
 // ============================================================================
 Double_t Ostap::Models::JohnsonSU::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5397,6 +5502,7 @@ void Ostap::Models::Landau::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Landau::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5483,6 +5589,7 @@ void Ostap::Models::Atlas::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Atlas::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5570,6 +5677,7 @@ void Ostap::Models::Sech::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Sech::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5660,6 +5768,7 @@ void Ostap::Models::Losev::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Losev::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5746,6 +5855,7 @@ void Ostap::Models::Logistic::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Logistic::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5837,6 +5947,7 @@ void Ostap::Models::Argus::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Argus::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -5921,6 +6032,7 @@ void Ostap::Models::Slash::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Slash::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars () ;
   return m_slash ( m_x ) ;
 }
@@ -6008,6 +6120,7 @@ void Ostap::Models::AsymmetricLaplace::setPars () const
 // ============================================================================
 Double_t Ostap::Models::AsymmetricLaplace::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars () ;
   return m_laplace( m_x ) ;
 }
@@ -6096,6 +6209,7 @@ void Ostap::Models::Tsallis::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Tsallis::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -6183,6 +6297,7 @@ void Ostap::Models::QGSM::setPars () const
 // ============================================================================
 Double_t Ostap::Models::QGSM::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -6275,6 +6390,7 @@ void Ostap::Models::TwoExpos::setPars () const
 // ============================================================================
 Double_t Ostap::Models::TwoExpos::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -6361,6 +6477,7 @@ void Ostap::Models::DoubleGauss::setPars () const
 // ============================================================================
 Double_t Ostap::Models::DoubleGauss::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars() ;
   return m_2gauss ( m_x ) ;
@@ -6444,6 +6561,7 @@ void Ostap::Models::Gumbel::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Gumbel::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars ();
   return m_gumbel ( m_x ) ;
@@ -6532,6 +6650,7 @@ void Ostap::Models::Weibull::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Weibull::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_weibull ( m_x ) ;
 }
@@ -6614,6 +6733,7 @@ void Ostap::Models::RaisingCosine::setPars () const
 // ============================================================================
 Double_t Ostap::Models::RaisingCosine::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_rcos ( m_x ) ;
 }
@@ -6701,6 +6821,7 @@ void Ostap::Models::QGaussian::setPars () const
 // ============================================================================
 Double_t Ostap::Models::QGaussian::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_qgauss ( m_x ) ;
 }
@@ -6796,6 +6917,7 @@ void Ostap::Models::Hyperbolic::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Hyperbolic::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_hyperbolic ( m_x ) ;
 }
@@ -6893,6 +7015,7 @@ void Ostap::Models::CutOffGauss::setPars () const
 // ============================================================================
 Double_t Ostap::Models::CutOffGauss::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_cutoff ( m_x ) ;
 }
@@ -6997,6 +7120,7 @@ void Ostap::Models::CutOffStudent::setPars () const
 // ============================================================================
 Double_t Ostap::Models::CutOffStudent::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars() ;
   return m_cutoff ( m_x ) ;
 }
@@ -7100,7 +7224,7 @@ Ostap::Models::Uniform::clone ( const char* name ) const
 // ============================================================================
 // the actual evaluation of function
 // ============================================================================
-Double_t Ostap::Models::Uniform::evaluate() const { return 1 ; }
+Double_t Ostap::Models::Uniform::evaluate() const { Ostap::Utils::Instrumentation::evaluated ( this ) ; return 1 ; }
 // ============================================================================
 Int_t Ostap::Models::Uniform::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
@@ -10,10 +10,12 @@
 #include "Ostap/StatusCode.h"
 #include "Ostap/PDFs2D.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 // ROOT 
 // ============================================================================
 #include "RVersion.h"
+#include "RooAbsData.h"
 #include "RooArgSet.h"
 #include "RooRealVar.h"
 // ============================================================================
@@ -67,6 +69,7 @@ Ostap::Models::Poly2DPositive::Poly2DPositive
   , m_phis     ( "phis"   , this , right.m_phis  ) 
 //
   , m_positive ( right.m_positive ) 
+  , m_cache    ( right.m_cache )
 {
   setPars () ;
 }
@@ -88,12 +91,42 @@ void Ostap::Models::Poly2DPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Poly2DPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
+  double result = 0 ;
+  const auto& f = m_positive.bernstein () ;
+  if ( m_cache && m_cache->valid ( Ostap::Math::BasisCache::key2D ( f ) ) &&
+       m_cache->value ( m_x , m_y , f.pars () , result ) ) { return result ; }
+  //
   return m_positive ( m_x , m_y ) ; 
 }
 // ============================================================================
+// precompute the basis functions for all entries of the dataset
+// ============================================================================
+bool Ostap::Models::Poly2DPositive::cacheBasis
+( const RooAbsData& data      , 
+  const bool        single    , 
+  const std::size_t maxmemory ) 
+{
+  //
+  setPars () ;
+  //
+  const auto& f = m_positive.bernstein () ;
+  auto cache = std::make_shared<Ostap::Math::BasisCache> 
+    ( f.npars () , single , maxmemory , Ostap::Math::BasisCache::key2D ( f ) ) ;
+  if ( !cache->fill ( data , { m_x.arg ().GetName () , m_y.arg ().GetName () } , Ostap::Math::BasisCache::basis2D ( f ) ) ) 
+  { m_cache.reset () ; return false ; }                           // RETURN 
+  //
+  m_cache = cache ;
+  return true ;
+}
+// ============================================================================
+// remove the cache of basis functions 
+// ============================================================================
+void Ostap::Models::Poly2DPositive::resetCache () { m_cache.reset () ; }
+// ============================================================================
 Int_t Ostap::Models::Poly2DPositive::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
   RooArgSet&     analVars     ,
@@ -189,6 +222,7 @@ void Ostap::Models::Poly2DSymPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Poly2DSymPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -319,6 +353,7 @@ void Ostap::Models::PS2DPol::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPol::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -450,6 +485,7 @@ void Ostap::Models::PS2DPol2::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPol2::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -584,6 +620,7 @@ void Ostap::Models::PS2DPol3::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPol3::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -712,6 +749,7 @@ void Ostap::Models::PS2DPolSym::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPolSym::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -839,6 +877,7 @@ void Ostap::Models::PS2DPol2Sym::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPol2Sym::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -965,6 +1004,7 @@ void Ostap::Models::PS2DPol3Sym::setPars () const
 // ============================================================================
 Double_t Ostap::Models::PS2DPol3Sym::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1107,6 +1147,7 @@ void Ostap::Models::ExpoPS2DPol::setPars () const
 // ============================================================================
 Double_t Ostap::Models::ExpoPS2DPol::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1224,6 +1265,7 @@ void Ostap::Models::Expo2DPol::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Expo2DPol::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1330,6 +1372,7 @@ void Ostap::Models::Expo2DPolSym::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Expo2DPolSym::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1435,6 +1478,7 @@ void Ostap::Models::Spline2D::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Spline2D::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -1534,6 +1578,7 @@ void Ostap::Models::Spline2DSym::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Spline2DSym::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   //
   setPars () ;
   //
@@ -10,9 +10,11 @@
 #include "Ostap/StatusCode.h"
 #include "Ostap/PDFs3D.h"
 #include "Ostap/Iterator.h"
+#include "Ostap/Instrumentation.h"
 // ============================================================================
 // ROOT 
 // ============================================================================
+#include "RooAbsData.h"
 #include "RooArgSet.h"
 #include "RooRealVar.h"
 // ============================================================================
@@ -74,6 +76,7 @@ Ostap::Models::Poly3DPositive::Poly3DPositive
   , m_phis     ( "phis"   , this , right.m_phis  ) 
     //
   , m_positive ( right.m_positive ) 
+  , m_cache    ( right.m_cache )
 {
   setPars () ;
 }
@@ -95,10 +98,42 @@ void Ostap::Models::Poly3DPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Poly3DPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
+  //
   setPars () ;
+  //
+  double result = 0 ;
+  const auto& f = m_positive.bernstein () ;
+  if ( m_cache && m_cache->valid ( Ostap::Math::BasisCache::key3D ( f ) ) &&
+       m_cache->value ( m_x , m_y , m_z , f.pars () , result ) ) { return result ; }
+  //
   return m_positive ( m_x , m_y , m_z ) ; 
 }
 // ============================================================================
+// precompute the basis functions for all entries of the dataset
+// ============================================================================
+bool Ostap::Models::Poly3DPositive::cacheBasis
+( const RooAbsData& data      , 
+  const bool        single    , 
+  const std::size_t maxmemory ) 
+{
+  //
+  setPars () ;
+  //
+  const auto& f = m_positive.bernstein () ;
+  auto cache = std::make_shared<Ostap::Math::BasisCache> 
+    ( f.npars () , single , maxmemory , Ostap::Math::BasisCache::key3D ( f ) ) ;
+  if ( !cache->fill ( data , { m_x.arg ().GetName () , m_y.arg ().GetName () , m_z.arg ().GetName () } , Ostap::Math::BasisCache::basis3D ( f ) ) ) 
+  { m_cache.reset () ; return false ; }                           // RETURN 
+  //
+  m_cache = cache ;
+  return true ;
+}
+// ============================================================================
+// remove the cache of basis functions 
+// ============================================================================
+void Ostap::Models::Poly3DPositive::resetCache () { m_cache.reset () ; }
+// ============================================================================
 Int_t Ostap::Models::Poly3DPositive::getAnalyticalIntegral
 ( RooArgSet&     allVars      , 
   RooArgSet&     analVars     ,
@@ -221,6 +256,7 @@ void Ostap::Models::Poly3DSymPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Poly3DSymPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars () ;
   return m_positive ( m_x , m_y , m_z ) ; 
 }
@@ -350,6 +386,7 @@ void Ostap::Models::Poly3DMixPositive::setPars () const
 // ============================================================================
 Double_t Ostap::Models::Poly3DMixPositive::evaluate() const 
 {
+  Ostap::Utils::Instrumentation::evaluated ( this ) ;
   setPars () ;
   return m_positive ( m_x , m_y , m_z ) ; 
 }
@@ -0,0 +1,368 @@
+// ============================================================================
+// Include files
+// ============================================================================
+//   STD&STL
+// ============================================================================
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TTree.h"
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TFile.h"
+#include "TTreeFormula.h"
+#include "TTreePerfStats.h"
+#include "TVirtualPerfStats.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/IFuncs.h"
+#include "Ostap/Formula.h"
+#include "Ostap/ReadPlan.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::ReadPlan
+ *  @see Ostap::Utils::ReadPlan
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// is read planning enabled?
+  std::atomic<bool>     s_enabled  { true             } ;
+  /// the cache size
+  std::atomic<Long64_t> s_cache    { 32 * 1024 * 1024 } ;
+  /// cluster prefetch?
+  std::atomic<bool>     s_prefetch { true             } ;
+  /// monitor the time spent in I/O?
+  std::atomic<bool>     s_monitor  { false            } ;
+  /// the total statistics
+  Ostap::Utils::ReadPlan::Statistics s_total {} ;
+  /// the mutex for the total statistics
+  std::mutex                         s_mutex    ;
+  // ==========================================================================
+  /// add the name to the list (if not yet there)
+  inline void add_name
+  ( std::vector<std::string>& names ,
+    const std::string&        name  )
+  {
+    if ( names.end () == std::find ( names.begin () , names.end () , name ) )
+    { names.push_back ( name ) ; }
+  }
+  // ==========================================================================
+  /// the current time (seconds)
+  inline double now ()
+  {
+    return std::chrono::duration<double>
+      ( std::chrono::steady_clock::now ().time_since_epoch () ).count () ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// add statistics
+// ============================================================================
+Ostap::Utils::ReadPlan::Statistics&
+Ostap::Utils::ReadPlan::Statistics::operator+=
+( const Ostap::Utils::ReadPlan::Statistics& right )
+{
+  loops    += right.loops    ;
+  entries  += right.entries  ;
+  branches += right.branches ;
+  bytes    += right.bytes    ;
+  calls    += right.calls    ;
+  time     += right.time     ;
+  if ( 0 <= right.ioTime  ) { ioTime  = std::max ( ioTime  , 0.0 ) + right.ioTime  ; }
+  if ( 0 <= right.zipTime ) { zipTime = std::max ( zipTime , 0.0 ) + right.zipTime ; }
+  return *this ;
+}
+// ============================================================================
+// constructor: collect the branches and configure the tree
+// ============================================================================
+Ostap::Utils::ReadPlan::ReadPlan
+( TTree*         tree  ,
+  const Long64_t first ,
+  const Long64_t last  ,
+  const TObject* obj0  ,
+  const TObject* obj1  ,
+  const TObject* obj2  ,
+  const TObject* obj3  ,
+  const TObject* obj4  ,
+  const TObject* obj5  )
+  : m_tree  ( tree  )
+  , m_first ( first )
+  , m_last  ( last  )
+{
+  add ( obj0 ) ;
+  add ( obj1 ) ;
+  add ( obj2 ) ;
+  add ( obj3 ) ;
+  add ( obj4 ) ;
+  add ( obj5 ) ;
+  //
+  start () ;
+}
+// ============================================================================
+// constructor from the sequence of objects
+// ============================================================================
+Ostap::Utils::ReadPlan::ReadPlan
+( TTree*                             tree    ,
+  const Long64_t                     first   ,
+  const Long64_t                     last    ,
+  const std::vector<const TObject*>& objects )
+  : ReadPlan ( objects.begin () , objects.end () , tree , first , last )
+{}
+// ============================================================================
+// constructor from the sequence of tree-functions
+// ============================================================================
+Ostap::Utils::ReadPlan::ReadPlan
+( TTree*                                      tree      ,
+  const Long64_t                              first     ,
+  const Long64_t                              last      ,
+  const std::vector<const Ostap::IFuncTree*>& functions )
+  : ReadPlan ( functions.begin () , functions.end () , tree , first , last )
+{}
+// ============================================================================
+// destructor: restore the state of the tree
+// ============================================================================
+Ostap::Utils::ReadPlan::~ReadPlan () { stop () ; }
+// ============================================================================
+// add the object
+// ============================================================================
+void Ostap::Utils::ReadPlan::add ( const TObject* object )
+{
+  if ( nullptr == object ) { return ; }
+  //
+  const TTreeFormula* formula = dynamic_cast<const TTreeFormula*> ( object ) ;
+  if ( nullptr != formula )
+  {
+    for ( int i = 0 ; i < formula->GetNcodes () ; ++i )
+    {
+      const TLeaf* leaf = formula->GetLeaf ( i ) ;
+      // e.g. alias: the branches are not known
+      if ( nullptr == leaf || nullptr == leaf->GetBranch () ) { m_known = false ; continue ; }
+      add_name ( m_branches , leaf->GetBranch ()->GetName () ) ;
+      // the counter for the variable-size arrays
+      const TLeaf* count = leaf->GetLeafCount () ;
+      if ( nullptr != count && nullptr != count->GetBranch () )
+      { add_name ( m_branches , count->GetBranch ()->GetName () ) ; }
+    }
+    return ;
+  }
+  //
+  const Ostap::IFuncTree* function = dynamic_cast<const Ostap::IFuncTree*> ( object ) ;
+  if ( nullptr != function ) { add ( function ) ; return ; }
+  //
+  // some unknown object
+  m_known = false ;
+}
+// ============================================================================
+// add the tree-function
+// ============================================================================
+void Ostap::Utils::ReadPlan::add ( const Ostap::IFuncTree* function )
+{
+  if ( nullptr == function ) { return ; }
+  //
+  std::vector<std::string> expressions ;
+  if ( !function->expressions ( expressions ) ) { m_known = false ; return ; }
+  //
+  for ( const auto& e : expressions ) { add ( e ) ; }
+}
+// ============================================================================
+// add the expression
+// ============================================================================
+void Ostap::Utils::ReadPlan::add ( const std::string& expression )
+{
+  if ( nullptr == m_tree || expression.empty () ) { return ; }
+  //
+  // the temporary formula to get the branches
+  Ostap::Formula formula ( expression , m_tree ) ;
+  if ( !formula.ok () ) { m_known = false ; return ; }
+  //
+  add ( &formula ) ;
+}
+// ============================================================================
+// configure the tree
+// ============================================================================
+void Ostap::Utils::ReadPlan::start ()
+{
+  if ( nullptr == m_tree || m_active || !s_enabled ) { return ; }
+  //
+  m_active  = true ;
+  // the loops in the worker threads are not accounted
+  m_account = !Ostap::Utils::ThreadPool::inWorker () ;
+  //
+  m_stat.loops   = 1 ;
+  m_stat.entries = m_first < m_last ? m_last - m_first : 0 ;
+  //
+  if ( nullptr == m_tree->GetTree () ) { m_tree->LoadTree ( m_first ) ; }
+  //
+  // configure the cache (only for the trees from the files)
+  const Long64_t size = s_cache ;
+  if ( 0 < size && nullptr != m_tree->GetCurrentFile () )
+  {
+    m_cache    = m_tree->GetCacheSize () ;
+    m_cached   = true ;
+    m_tree->SetCacheSize ( size ) ;
+    if ( m_known )
+    {
+      const TTree* current = m_tree->GetTree () ;
+      for ( const auto& b : m_branches )
+      {
+        // the branches from friend trees use their own caches
+        const TBranch* branch = m_tree->GetBranch ( b.c_str () ) ;
+        if ( nullptr == branch || branch->GetTree () != current ) { continue ; }
+        m_tree->AddBranchToCache ( b.c_str () , true ) ;
+        ++m_stat.branches ;
+      }
+      m_tree->StopCacheLearningPhase () ;
+    }
+    m_tree->SetCacheEntryRange ( m_first , m_last ) ;
+  }
+  //
+  m_prefetch = m_tree->GetClusterPrefetch () ;
+  if ( s_prefetch ) { m_tree->SetClusterPrefetch ( true ) ; }
+  //
+  if ( m_account )
+  {
+    m_bytes = TFile::GetFileBytesRead () ;
+    m_calls = TFile::GetFileReadCalls () ;
+    if ( s_monitor )
+    {
+      m_old  = gPerfStats ;
+      m_perf = new TTreePerfStats ( "ostap_readplan" , m_tree ) ;
+    }
+  }
+  //
+  m_start = now () ;
+}
+// ============================================================================
+/* disable all branches, that are not used by the loop,
+ *  it helps for the loops, that read the whole entry
+ *  with <code>TTree::GetEntry</code>
+ *  @param keep the branches to be kept enabled (e.g. new branches)
+ *  @return true if branches are disabled
+ */
+// ============================================================================
+bool Ostap::Utils::ReadPlan::prune ( const std::vector<std::string>& keep )
+{
+  if ( !m_active || !m_known || m_pruned ) { return false ; }
+  //
+  // remember the branches, that are disabled already
+  m_disabled.clear () ;
+  const TObjArray* leaves = m_tree->GetListOfLeaves () ;
+  if ( nullptr != leaves )
+  {
+    for ( const TObject* o : *leaves )
+    {
+      const TLeaf*   leaf   = static_cast<const TLeaf*> ( o ) ;
+      const TBranch* branch = nullptr != leaf ? leaf->GetBranch () : nullptr ;
+      if ( nullptr != branch && branch->TestBit ( TBranch::kDoNotProcess ) )
+      { add_name ( m_disabled , branch->GetName () ) ; }
+    }
+  }
+  //
+  m_tree->SetBranchStatus ( "*" , false ) ;
+  for ( const auto& b : m_branches ) { m_tree->SetBranchStatus ( b.c_str () , true ) ; }
+  for ( const auto& b : keep       ) { m_tree->SetBranchStatus ( b.c_str () , true ) ; }
+  //
+  m_pruned = true ;
+  return true ;
+}
+// ============================================================================
+// stop the plan: restore the state of the tree and account the statistics
+// ============================================================================
+void Ostap::Utils::ReadPlan::stop ()
+{
+  if ( !m_active ) { return ; }
+  m_active = false ;
+  //
+  m_stat.time = now () - m_start ;
+  //
+  if ( m_account )
+  {
+    m_stat.bytes = TFile::GetFileBytesRead () - m_bytes ;
+    m_stat.calls = TFile::GetFileReadCalls () - m_calls ;
+    if ( nullptr != m_perf )
+    {
+      m_perf->Finish () ;
+      m_stat.ioTime  = m_perf->GetDiskTime  () ;
+      m_stat.zipTime = m_perf->GetUnzipTime () ;
+      m_tree->SetPerfStats ( nullptr ) ;
+      delete m_perf ;
+      m_perf     = nullptr ;
+      gPerfStats = m_old   ;
+    }
+    std::lock_guard<std::mutex> lock ( s_mutex ) ;
+    s_total += m_stat ;
+  }
+  //
+  // restore the branches
+  if ( m_pruned )
+  {
+    m_tree->SetBranchStatus ( "*" , true ) ;
+    for ( const auto& b : m_disabled ) { m_tree->SetBranchStatus ( b.c_str () , false ) ; }
+    m_pruned = false ;
+  }
+  //
+  // restore the cache: -1 means the default size
+  if ( m_cached )
+  {
+    m_tree->SetCacheSize ( 0 ) ;
+    m_tree->SetCacheSize ( 0 < m_cache ? m_cache : -1 ) ;
+    m_cached = false ;
+  }
+  m_tree->SetClusterPrefetch ( m_prefetch ) ;
+}
+// ============================================================================
+// configuration
+// ============================================================================
+bool     Ostap::Utils::ReadPlan::enabled         () { return s_enabled  ; }
+Long64_t Ostap::Utils::ReadPlan::cacheSize       () { return s_cache    ; }
+bool     Ostap::Utils::ReadPlan::clusterPrefetch () { return s_prefetch ; }
+bool     Ostap::Utils::ReadPlan::monitor         () { return s_monitor  ; }
+// ============================================================================
+// enable/disable the read planning, return the previous value
+// ============================================================================
+bool Ostap::Utils::ReadPlan::setEnabled ( const bool value )
+{ return s_enabled.exchange ( value ) ; }
+// ============================================================================
+// set the size of TTreeCache, return the previous value
+// ============================================================================
+Long64_t Ostap::Utils::ReadPlan::setCacheSize ( const Long64_t value )
+{ return s_cache.exchange ( value ) ; }
+// ============================================================================
+// enable/disable the cluster prefetching, return the previous value
+// ============================================================================
+bool Ostap::Utils::ReadPlan::setClusterPrefetch ( const bool value )
+{ return s_prefetch.exchange ( value ) ; }
+// ============================================================================
+// enable/disable the I/O time monitoring, return the previous value
+// ============================================================================
+bool Ostap::Utils::ReadPlan::setMonitor ( const bool value )
+{ return s_monitor.exchange ( value ) ; }
+// ============================================================================
+// the total statistics for all (finished) loops
+// ============================================================================
+Ostap::Utils::ReadPlan::Statistics Ostap::Utils::ReadPlan::total ()
+{
+  std::lock_guard<std::mutex> lock ( s_mutex ) ;
+  return s_total ;
+}
+// ============================================================================
+// reset the total statistics
+// ============================================================================
+void Ostap::Utils::ReadPlan::resetTotal ()
+{
+  std::lock_guard<std::mutex> lock ( s_mutex ) ;
+  s_total = Statistics () ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -2,14 +2,34 @@
 // ============================================================================
 // Include files 
 // ============================================================================
+// STD&STL
+// ============================================================================
+#include <algorithm>
+#include <memory>
+// ============================================================================
 // ROOT 
 // ============================================================================
+#include "TROOT.h"
 #include "TTree.h"
+#include "TChain.h"
+#include "TChainElement.h"
+#include "TList.h"
+#include "TFile.h"
+#include "TLeaf.h"
+#include "TBranch.h"
 #include "RooAbsData.h"
 // ============================================================================
 // Ostap
 // ============================================================================
 #include "Ostap/SFactor.h"
+#include "Ostap/Formula.h"
+#include "Ostap/Notifier.h"
+#include "Ostap/ReadPlan.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
 // ============================================================================
 /** @file 
  *  Implementation file for class Analysis::SFactor
@@ -69,6 +89,10 @@ Ostap::SFactor::sFactor
   //
   Long64_t nEntries = tree->GetEntries() ;
   //
+  // read only the needed branch 
+  Ostap::Utils::ReadPlan plan ( tree , 0 , nEntries ) ;
+  plan.prune ( { varname } ) ;
+  //
   double sumw  = 0 ;
   double sumw2 = 0 ;
   //
@@ -81,6 +105,7 @@ Ostap::SFactor::sFactor
     //
   }
   // recover the status 
+  plan.stop () ;
   tree -> SetBranchStatus ( varname.c_str() , status ) ;
   //
   return VE ( sumw , sumw2 ) ;
@@ -133,6 +158,233 @@ Ostap::Math::ValueWithError Ostap::SFactor::sFactor ( const RooAbsData* data )
   }
   return VE ( sumw , sumw2 ) ;
 }
+namespace 
+{
+  // ==========================================================================
+  /// minimal number of entries per worker thread 
+  const unsigned long s_MINENTRIES = 100000 ;
+  // ==========================================================================
+  /// the sums of weights and squared weights 
+  struct Sums 
+  {
+    Sums ( const std::size_t n = 0 ) : sumw ( n , 0.0L ) , sumw2 ( n , 0.0L ) {}
+    std::vector<long double> sumw  ;
+    std::vector<long double> sumw2 ;
+  } ;
+  // ==========================================================================
+  /// the input files: ( file name , tree name , number of entries )
+  struct Input 
+  {
+    std::string file    ;
+    std::string tree    ;
+    Long64_t    entries ;
+  } ;
+  // ==========================================================================
+  /** get the input files for the tree/chain 
+   *  @return empty vector for in-memory trees 
+   */
+  std::vector<Input> inputs ( TTree* tree ) 
+  {
+    std::vector<Input> result ;
+    //
+    TChain* chain = dynamic_cast<TChain*> ( tree ) ;
+    if ( chain ) 
+    {
+      const TObjArray* files = chain -> GetListOfFiles () ;
+      if ( !files ) { return result ; }
+      for ( int i = 0 ; i < files -> GetEntries () ; ++i ) 
+      {
+        const TChainElement* e = dynamic_cast<const TChainElement*> ( files -> At ( i ) ) ;
+        if ( !e ) { return std::vector<Input> () ; }
+        result.push_back ( Input { e -> GetTitle () , e -> GetName () , e -> GetEntries () } ) ;
+      }
+      return result ;
+    }
+    //
+    TFile*      file = tree -> GetCurrentFile () ;
+    TDirectory* dir  = tree -> GetDirectory   () ;
+    if ( !file || !dir ) { return result ; }                          // in-memory tree 
+    //
+    // the path of the tree inside the file 
+    std::string path = dir -> GetPath () ;
+    const std::string::size_type pos = path.find ( ":/" ) ;
+    path = std::string::npos == pos ? std::string () : path.substr ( pos + 2 ) ;
+    if ( !path.empty () ) { path += '/' ; }
+    path += tree -> GetName () ;
+    //
+    result.push_back ( Input { file -> GetName () , path , tree -> GetEntries () } ) ;
+    return result ;
+  }
+  // ==========================================================================
+  /** process the range of entries 
+   *  @param tree    the tree 
+   *  @param weights weight expressions
+   *  @param cuts    selection/weight 
+   *  @param first   the first entry 
+   *  @param last    the last entry 
+   *  @param own     is it our own tree? then only needed branches are read 
+   *  @param sums    (UPDATE) the sums 
+   */
+  void process 
+  ( TTree&                          tree    , 
+    const std::vector<std::string>& weights , 
+    const std::string&              cuts    , 
+    const unsigned long             first   , 
+    const unsigned long             last    , 
+    const bool                      own     , 
+    Sums&                           sums    ) 
+  {
+    if ( last <= first ) { return ; }
+    if ( 0 > tree.LoadTree ( first ) ) { return ; }
+    //
+    std::vector<std::unique_ptr<Ostap::Formula> > formulas ;
+    std::vector<TObject*>                         objects  ;
+    for ( const auto& w : weights ) 
+    {
+      formulas.emplace_back ( new Ostap::Formula ( w , &tree ) ) ;
+      Ostap::Assert ( formulas.back () -> ok ()           , 
+                      "Invalid weight:\"" + w + '\"'      ,
+                      "Ostap::SFactor::sFactors"          ) ;
+      objects.push_back ( formulas.back ().get () ) ;
+    }
+    std::unique_ptr<Ostap::Formula> cut ;
+    if ( !cuts.empty () ) 
+    {
+      cut.reset ( new Ostap::Formula ( cuts , &tree ) ) ;
+      Ostap::Assert ( cut -> ok ()                        , 
+                      "Invalid cut:\"" + cuts + '\"'      ,
+                      "Ostap::SFactor::sFactors"          ) ;
+      objects.push_back ( cut.get () ) ;
+    }
+    //
+    Ostap::Utils::Notifier notify ( objects.begin () , objects.end () , &tree ) ;
+    Ostap::Utils::ReadPlan plan   ( objects.begin () , objects.end () , &tree , first , last ) ;
+    // own tree: read only the branches, used by weights and cuts 
+    if ( own ) { plan.prune () ; }
+    //
+    const std::size_t nw = weights.size () ;
+    for ( unsigned long entry = first ; entry < last ; ++entry ) 
+    {
+      long ievent = tree.GetEntryNumber ( entry ) ;
+      if ( 0 > ievent ) { break ; }                               // BREAK
+      //
+      ievent      = tree.LoadTree ( ievent ) ;
+      if ( 0 > ievent ) { break ; }                               // BREAK
+      //
+      const long double c = cut ? cut -> evaluate () : 1.0 ;
+      if ( !c ) { continue ; }                                    // CONTINUE
+      //
+      for ( std::size_t k = 0 ; k < nw ; ++k ) 
+      {
+        const long double w = c * formulas [ k ] -> evaluate () ;
+        sums.sumw  [ k ] += w     ;
+        sums.sumw2 [ k ] += w * w ;
+      }
+    }
+  }
+  // ==========================================================================
+}
+// ============================================================================
+/*  Get sums and sums of squares for many weights in one pass, e.g. 
+ *  s-factors for all s-weights from the same sPlot 
+ *  @param  tree     (INPUT) the tree or chain 
+ *  @param  weights  (INPUT) weight expressions 
+ *  @param  cuts     (INPUT) selection/weight  
+ *  @param  first    (INPUT) the first  event to process 
+ *  @param  last     (INPUT) the last event to  process
+ *  @param  nthreads (INPUT) number of threads, 0 means ThreadPool default 
+ *  @return s-factors in a form of value +- sqrt(cov2), one per weight 
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+std::vector<Ostap::Math::ValueWithError>
+Ostap::SFactor::sFactors 
+( TTree*                          tree     , 
+  const std::vector<std::string>& weights  , 
+  const std::string&              cuts     , 
+  const unsigned long             first    , 
+  const unsigned long             last     , 
+  const unsigned int              nthreads ) 
+{
+  //
+  Ostap::Assert ( nullptr != tree                , 
+                  "Invalid tree!"                , 
+                  "Ostap::SFactor::sFactors"     ) ;
+  //
+  const std::size_t nw = weights.size () ;
+  if ( 0 == nw ) { return std::vector<Ostap::Math::ValueWithError> () ; }
+  //
+  const unsigned long nEntries = std::min ( last , (unsigned long) tree -> GetEntries () ) ;
+  //
+  const unsigned int  nt     = 0 < nthreads ? nthreads : Ostap::Utils::ThreadPool::nThreads () ;
+  const unsigned long nparts = first < nEntries ? 
+    std::min ( (unsigned long) nt , ( nEntries - first ) / s_MINENTRIES ) : 0 ;
+  //
+  // the trees with entry lists or friends are processed serially: 
+  // the worker chains are built from the input files only 
+  const TList* friends = tree -> GetListOfFriends () ;
+  const bool   serial  = 
+    nparts <= 1 || tree -> GetEntryList () || ( friends && 0 < friends -> GetSize () ) ;
+  const std::vector<Input> files = serial ? std::vector<Input> () : inputs ( tree ) ;
+  //
+  Sums total ( nw ) ;
+  //
+  if ( files.empty () || nparts <= 1 )
+  {
+    // serial processing of the original tree 
+    process ( *tree , weights , cuts , first , nEntries , false , total ) ;
+  }
+  else 
+  {
+    ROOT::EnableThreadSafety () ;
+    //
+    std::vector<Sums> partial ( nparts , Sums ( nw ) ) ;
+    const unsigned long chunk = ( nEntries - first + nparts - 1 ) / nparts ;
+    //
+    Ostap::Utils::ThreadPool::parallel_for 
+      ( nparts , 
+        [&] ( const std::size_t begin , const std::size_t end ) 
+        {
+          for ( std::size_t part = begin ; part < end ; ++part ) 
+          {
+            // own chain for each part 
+            TChain chain ( files.front ().tree.c_str () ) ;
+            for ( const auto& f : files ) 
+            { chain.AddFile ( f.file.c_str () , f.entries , f.tree.c_str () ) ; }
+            //
+            const unsigned long i1 = first + part * chunk ;
+            const unsigned long i2 = std::min ( nEntries , i1 + chunk ) ;
+            process ( chain , weights , cuts , i1 , i2 , true , partial [ part ] ) ;
+          }
+        } , 1 ) ;
+    //
+    for ( const auto& p : partial ) 
+    {
+      for ( std::size_t k = 0 ; k < nw ; ++k ) 
+      {
+        total.sumw  [ k ] += p.sumw  [ k ] ;
+        total.sumw2 [ k ] += p.sumw2 [ k ] ;
+      }
+    }
+  }
+  //
+  std::vector<Ostap::Math::ValueWithError> result ; result.reserve ( nw ) ;
+  for ( std::size_t k = 0 ; k < nw ; ++k ) 
+  { result.emplace_back ( total.sumw [ k ] , total.sumw2 [ k ] ) ; }
+  //
+  return result ;
+}
+// ============================================================================
+// get the number of equivalent entries from the s-factor
+// ============================================================================
+double Ostap::SFactor::nEff ( const Ostap::Math::ValueWithError& sf ) 
+{
+  const double sumw  = sf.value () ;
+  const double sumw2 = sf.cov2  () ;
+  return 0 < sumw2 ? sumw * sumw / sumw2 : 0.0 ;
+}
+// ============================================================================
 // ============================================================================
 // The END 
 // ============================================================================
@@ -20,8 +20,10 @@
 // Ostap
 // ============================================================================
 #include "Ostap/Formula.h"
+#include "Ostap/Instrumentation.h"
 #include "Ostap/Iterator.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/ReadPlan.h"
 #include "Ostap/MatrixUtils.h"
 #include "Ostap/StatVar.h"
 #include "Ostap/FormulaVar.h"
@@ -45,6 +47,11 @@ namespace
   static_assert ( std::numeric_limits<unsigned long>::is_specialized   ,
                   "Numeric_limist<unsigned long> are not specialized!" ) ;
   // ==========================================================================
+  /// instrumentation: the loops over TTree 
+  const Ostap::Utils::Instrumentation::Timer s_TREE_LOOP { "StatVar/TTree"      } ;
+  /// instrumentation: the loops over RooAbsData 
+  const Ostap::Utils::Instrumentation::Timer s_DATA_LOOP { "StatVar/RooAbsData" } ;
+  // ==========================================================================
   /// make FormulaVar 
   std::unique_ptr<Ostap::FormulaVar>
   make_formula ( const std::string& expression           , 
@@ -92,6 +99,8 @@ namespace
     long double sumw2 = 0     ;
     bool        empty = false ;
     // 
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -145,6 +154,8 @@ namespace
     bool                empty   = true   ;
     const long double   v0      = center ;
     std::vector<double> results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -190,6 +201,7 @@ namespace
     long double sumw  = 0    ;
     bool        empty = true ;
     //  
+    const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < last ? last - first : 0 ) ;
     for ( unsigned long entry = first ; entry < last ; ++entry )
     {
       const RooArgSet* vars = data.get( entry ) ;
@@ -252,6 +264,8 @@ namespace
     long double         c2    = 0    ;
     double              empty = true ;
     std::vector<double> results {}   ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -333,6 +347,8 @@ namespace
     long double         m2    = 0    ; // moment of 2
     bool                empty = true ;
     std::vector<double> results ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -425,6 +441,8 @@ namespace
     long double          m2    = 0    ; // moment of 2
     bool                 empty = true ;
     std::vector<double>  results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -505,6 +523,8 @@ namespace
     long double         m2    = 0    ; // moment of 2
     bool                empty = true ;
     std::vector<double> results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -580,6 +600,8 @@ namespace
     const bool with_cuts = nullptr != cuts ? true : false ;
     //
     unsigned long num = 0 ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , the_last , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < the_last ? the_last - first : 0 ) ;
     for ( unsigned long entry = first ; entry < the_last ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -660,6 +682,8 @@ namespace
     //
     unsigned long num = 0  ;
     std::vector<double> results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , the_last , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < the_last ? the_last - first : 0 ) ;
     for ( unsigned long entry = first ; entry < the_last ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -705,6 +729,7 @@ namespace
     const bool  weighted = data.isWeighted () ;
     //
     unsigned long num = 0 ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
     for ( unsigned long entry = first ; entry < the_last ; ++entry )
     {
       const RooArgSet* vars = data.get( entry ) ;
@@ -787,6 +812,7 @@ namespace
     std::vector<Ostap::Math::GSL::P2Quantile> qs ( quantiles.begin() , quantiles.end() ) ;
     //
     unsigned long num = 0 ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
     for ( unsigned long entry = first ; entry < the_last ; ++entry )
     {
       const RooArgSet* vars = data.get( entry ) ;
@@ -837,6 +863,8 @@ namespace
     const bool with_cuts = nullptr != cuts ? true : false ;
     //
     std::vector<double> results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -884,6 +912,8 @@ namespace
     const bool with_weight = nullptr != weight ? true : false ;
     //
     std::vector<double> results {} ;
+    Ostap::Utils::ReadPlan plan   ( &tree , first , nEntries , &var , weight , cuts ) ;
+    const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
     for ( unsigned long entry = first ; entry < nEntries ; ++entry ) 
     {      
       long ievent = tree.GetEntryNumber ( entry ) ;
@@ -930,6 +960,8 @@ bool Ostap::StatVar::hasEntry
     std::min ( last , (unsigned long) tree->GetEntries() ) ;
   //
   std::vector<double>  results {} ;
+  Ostap::Utils::ReadPlan plan   ( tree , first , nEntries , &formula ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     long ievent = tree->GetEntryNumber ( entry ) ;
@@ -989,6 +1021,7 @@ bool Ostap::StatVar::hasEntry
   const unsigned long the_last  = std::min ( last , (unsigned long) data->numEntries() ) ;
   //
   // start the loop
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     //
@@ -1090,6 +1123,8 @@ Ostap::StatVar::statVar
     std::min ( last , (unsigned long) tree->GetEntries() ) ;
   //
   std::vector<double>  results {} ;
+  Ostap::Utils::ReadPlan plan   ( tree , first , nEntries , &formula ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1144,6 +1179,8 @@ Ostap::StatVar::statVar
     std::min ( last , (unsigned long) tree->GetEntries() ) ;
   //
   std::vector<double> results {} ;
+  Ostap::Utils::ReadPlan plan   ( tree , first , nEntries , &selection , &formula ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1238,6 +1275,8 @@ unsigned long Ostap::StatVar::statVars
     std::min ( last , (unsigned long) tree->GetEntries() ) ;
   //
   std::vector<double>  results {} ;
+  Ostap::Utils::ReadPlan plan   ( formulas.begin() , formulas.end() , tree , first , nEntries ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1310,6 +1349,8 @@ unsigned long Ostap::StatVar::statVars
     std::min ( last , (unsigned long) tree->GetEntries() ) ;
   //
   std::vector<double>  results {} ;
+  Ostap::Utils::ReadPlan plan   ( formulas.begin() , formulas.end() , tree , first , nEntries , &selection ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1398,6 +1439,8 @@ Ostap::StatVar::statCov
   //
   std::vector<double> results1 {} ;
   std::vector<double> results2 {} ;
+  Ostap::Utils::ReadPlan plan   ( tree , first , nEntries , &formula1 , &formula2 ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1488,6 +1531,8 @@ Ostap::StatVar::statCov
   //
   std::vector<double> results1 {} ;
   std::vector<double> results2 {} ;
+  Ostap::Utils::ReadPlan plan   ( tree , first , nEntries , &formula1 , &formula2 , &selection ) ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_TREE_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1615,6 +1660,7 @@ Ostap::StatVar::statVar
   const unsigned long the_last  = std::min ( last , (unsigned long) data->numEntries() ) ;
   //
   // start the loop
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     //
@@ -1743,6 +1789,7 @@ Ostap::StatVar::statVars
   const unsigned long the_last  = std::min ( last , (unsigned long) data->numEntries() ) ;
   //
   // start the loop
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     //
@@ -1811,6 +1858,7 @@ Ostap::StatVar::statCov
   //
   const unsigned long nEntries = std::min ( last , (unsigned long) data->numEntries() ) ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -1891,6 +1939,7 @@ Ostap::StatVar::statCov
  //
   const unsigned long nEntries = std::min ( last , (unsigned long) data->numEntries() ) ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < nEntries ? nEntries - first : 0 ) ;
   for ( unsigned long entry = first ; entry < nEntries ; ++entry )
   {
     //
@@ -2495,6 +2544,7 @@ double Ostap::StatVar::nEff
   long double sumw  = 0    ;
   long double sumw2 = 0    ;
   bool        empty = true ; //  empty  dataset (after cuts&selection) ? 
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     const RooArgSet* vars = data.get( entry ) ;
@@ -2600,6 +2650,7 @@ Ostap::StatVar::moment
   long double c2    = 0 ;
   //
   bool        empty = true ;
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     const RooArgSet* vars = data.get( entry ) ;
@@ -2689,6 +2740,7 @@ Ostap::StatVar::central_moment
   long double mp1   = 0    ; // moment of   order+1
   long double m2    = 0    ; // moment of 2
   bool        empty = true ;  
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     const RooArgSet* vars = data.get( entry ) ;
@@ -2790,6 +2842,7 @@ Ostap::StatVar::skewness
   //
   bool        empty = true ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     const RooArgSet* vars = data.get( entry ) ;
@@ -2876,6 +2929,7 @@ Ostap::StatVar::kurtosis
   //
   bool        empty = true ;
   //
+  const Ostap::Utils::Instrumentation::Scope scope ( s_DATA_LOOP , first < the_last ? the_last - first : 0 ) ;
   for ( unsigned long entry = first ; entry < the_last ; ++entry )
   {
     const RooArgSet* vars = data.get( entry ) ;
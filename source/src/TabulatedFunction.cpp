@@ -0,0 +1,259 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+#include <algorithm>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/TabulatedFunction.h"
+// ============================================================================
+// local
+// ============================================================================
+#include "Exception.h"
+#include "local_math.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::TabulatedFunction
+ *  @see Ostap::Math::TabulatedFunction
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+/** @class Ostap::Math::TabulatedFunction::Table
+ *  the actual (immutable) interpolation table
+ */
+class Ostap::Math::TabulatedFunction::Table
+{
+public:
+  // ==========================================================================
+  /// the key
+  std::size_t         key { 0 } ;
+  /// abscissas
+  std::vector<double> x   {   } ;
+  /// function values
+  std::vector<double> y   {   } ;
+  // ==========================================================================
+public:
+  // ==========================================================================
+  /// local cubic interpolation
+  double operator() ( const double v ) const
+  {
+    const std::size_t n = x.size () ;
+    if      ( 1 == n ) { return y [ 0 ] ; }
+    else if ( 2 == n )
+    { return y [ 0 ] + ( v - x [ 0 ] ) * ( y [ 1 ] - y [ 0 ] ) / ( x [ 1 ] - x [ 0 ] ) ; }
+    //
+    // find the interval
+    std::size_t i = std::upper_bound ( x.begin () , x.end () , v ) - x.begin () ;
+    i = 0 < i ? i - 1 : 0 ;
+    i = std::min ( i , n - 2 ) ;
+    //
+    // choose the stencil  of four points
+    std::size_t j = 0 < i ? i - 1 : 0 ;
+    if ( n < j + 4 ) { j = 4 <= n ? n - 4 : 0 ; }
+    const std::size_t m = std::min ( n - j , std::size_t ( 4 ) ) ;
+    //
+    // Lagrange interpolation
+    double result = 0 ;
+    for ( std::size_t k = 0 ; k < m ; ++k )
+    {
+      double w = 1 ;
+      const double xk = x [ j + k ] ;
+      for ( std::size_t l = 0 ; l < m ; ++l )
+      {
+        if ( l == k ) { continue ; }
+        const double xl = x [ j + l ] ;
+        w *= ( v - xl ) / ( xk - xl ) ;
+      }
+      result += w * y [ j + k ] ;
+    }
+    return result ;
+  }
+  // ==========================================================================
+} ;
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// number of initial uniform nodes
+  const std::size_t s_NINIT = 33 ;
+  /// the maximal number of refinement passes
+  const std::size_t s_NPASS = 50 ;
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor from the function and the range
+ *  @param fun       the function
+ *  @param xmin      low  edge of the tabulation range
+ *  @param xmax      high edge of the tabulation range
+ *  @param precision the relative precision of the interpolation
+ *  @param maxpoints maximal number of nodes
+ *  @param key       the key function (if any)
+ */
+// ============================================================================
+Ostap::Math::TabulatedFunction::TabulatedFunction
+( Ostap::Math::TabulatedFunction::Function fun       ,
+  const double                             xmin      ,
+  const double                             xmax      ,
+  const double                             precision ,
+  const std::size_t                        maxpoints ,
+  Ostap::Math::TabulatedFunction::Key      key       )
+  : m_fun       ( fun  )
+  , m_xmin      ( std::min ( xmin , xmax ) )
+  , m_xmax      ( std::max ( xmin , xmax ) )
+  , m_precision ( std::abs ( precision ) )
+  , m_maxpoints ( std::max ( maxpoints , s_NINIT ) )
+  , m_key       ( key  )
+  , m_table     ()
+{
+  Ostap::Assert ( m_xmin < m_xmax                    ,
+                  "Invalid tabulation range!"        ,
+                  "Ostap::Math::TabulatedFunction"   ) ;
+  Ostap::Assert ( 0 < m_precision                    ,
+                  "Invalid precision!"               ,
+                  "Ostap::Math::TabulatedFunction"   ) ;
+}
+// ============================================================================
+// copy constructor: the table is shared
+// ============================================================================
+Ostap::Math::TabulatedFunction::TabulatedFunction
+( const Ostap::Math::TabulatedFunction& right )
+  : m_fun       ( right.m_fun       )
+  , m_xmin      ( right.m_xmin      )
+  , m_xmax      ( right.m_xmax      )
+  , m_precision ( right.m_precision )
+  , m_maxpoints ( right.m_maxpoints )
+  , m_key       ( right.m_key       )
+  , m_table     ( std::atomic_load ( &right.m_table ) )
+  , m_lock      ()
+{}
+// ============================================================================
+// default constructor (needed for serialization)
+// ============================================================================
+Ostap::Math::TabulatedFunction::TabulatedFunction () = default ;
+// ============================================================================
+// drop the table, it will be rebuilt at next call
+// ============================================================================
+void Ostap::Math::TabulatedFunction::reset () const
+{ std::atomic_store ( &m_table , std::shared_ptr<const Table> () ) ; }
+// ============================================================================
+// get the valid table (build it if needed)
+// ============================================================================
+std::shared_ptr<const Ostap::Math::TabulatedFunction::Table>
+Ostap::Math::TabulatedFunction::table () const
+{
+  const std::size_t key = m_key ? m_key () : 0 ;
+  return m_lock.get ( m_table ,
+                      [key]   ( const Table& t ) { return key == t.key ; } ,
+                      [this,key] () { return build ( key ) ; } ) ;
+}
+// ============================================================================
+// build the new table
+// ============================================================================
+std::shared_ptr<const Ostap::Math::TabulatedFunction::Table>
+Ostap::Math::TabulatedFunction::build ( const std::size_t key ) const
+{
+  auto nt = std::make_shared<Table> () ;
+  nt -> key = key ;
+  //
+  // (1) initial uniform grid
+  std::vector<double>& xs = nt -> x ;
+  std::vector<double>& ys = nt -> y ;
+  xs.reserve ( s_NINIT ) ;
+  ys.reserve ( s_NINIT ) ;
+  for ( std::size_t i = 0 ; i < s_NINIT ; ++i )
+  {
+    const double xi = ( s_NINIT - 1 == i ) ? m_xmax :
+      m_xmin + i * ( m_xmax - m_xmin ) / ( s_NINIT - 1 ) ;
+    xs.push_back ( xi           ) ;
+    ys.push_back ( m_fun ( xi ) ) ;
+  }
+  //
+  // (2) adaptive refinement
+  const double dxmin = ( m_xmax - m_xmin ) * 1.e-12 ;
+  std::vector<char> ok ( xs.size () - 1 , 0 ) ;
+  for ( std::size_t pass = 0 ; pass < s_NPASS && xs.size () < m_maxpoints ; ++pass )
+  {
+    // the scale of the function: protect relative error for tiny values
+    double fmax = 0 ;
+    for ( const double v : ys ) { fmax = std::max ( fmax , std::abs ( v ) ) ; }
+    const double fmin = fmax * 1.e-6 ;
+    //
+    std::vector<double> xn ; xn.reserve ( 2 * xs.size () ) ;
+    std::vector<double> yn ; yn.reserve ( 2 * xs.size () ) ;
+    std::vector<char>   bad ( ok.size () , 0 ) ;
+    //
+    std::size_t added = 0 ;
+    for ( std::size_t i = 0 ; i + 1 < xs.size () ; ++i )
+    {
+      xn.push_back ( xs [ i ] ) ;
+      yn.push_back ( ys [ i ] ) ;
+      if ( ok [ i ] || xs [ i + 1 ] - xs [ i ] <= dxmin ) { continue ; }
+      if ( m_maxpoints <= xs.size () + added             ) { continue ; }
+      //
+      const double xm = 0.5 * ( xs [ i ] + xs [ i + 1 ] ) ;
+      const double fm = m_fun ( xm ) ;
+      const double fi = (*nt) ( xm ) ;
+      //
+      if ( std::abs ( fi - fm ) <= m_precision * std::max ( std::abs ( fm ) , fmin ) )
+      { ok [ i ] = 1 ; continue ; }
+      //
+      xn.push_back ( xm ) ;
+      yn.push_back ( fm ) ;
+      bad [ i ] = 1 ;
+      ++added ;
+    }
+    xn.push_back ( xs.back () ) ;
+    yn.push_back ( ys.back () ) ;
+    //
+    if ( 0 == added ) { break ; }
+    //
+    // new flags: the intervals near the inserted nodes need to be rechecked
+    std::vector<char> okn ; okn.reserve ( xn.size () ) ;
+    for ( std::size_t i = 0 ; i < ok.size () ; ++i )
+    {
+      bool near = false ;
+      for ( std::size_t k = ( 2 <= i ? i - 2 : 0 ) ; k <= i + 2 && k < ok.size () ; ++k )
+      { if ( bad [ k ] ) { near = true ; break ; } }
+      const char flag = near ? 0 : ok [ i ] ;
+      okn.push_back ( flag ) ;
+      if ( bad [ i ] ) { okn.push_back ( 0 ) ; }
+    }
+    //
+    xs.swap ( xn  ) ;
+    ys.swap ( yn  ) ;
+    ok.swap ( okn ) ;
+  }
+  //
+  xs.shrink_to_fit () ;
+  ys.shrink_to_fit () ;
+  //
+  return nt ;
+}
+// ============================================================================
+// evaluate the function
+// ============================================================================
+double Ostap::Math::TabulatedFunction::evaluate ( const double x ) const
+{
+  if ( x < m_xmin || m_xmax < x ) { return m_fun ( x ) ; }
+  return (*table ()) ( x ) ;
+}
+// ============================================================================
+// number of nodes in the table (the table is built if needed)
+// ============================================================================
+std::size_t Ostap::Math::TabulatedFunction::size () const
+{ return table () -> x.size () ; }
+// ============================================================================
+// get the abscissas of the table (the table is built if needed)
+// ============================================================================
+std::vector<double> Ostap::Math::TabulatedFunction::abscissas () const
+{ return table () -> x ; }
+// ============================================================================
+
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -0,0 +1,274 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::ThreadPool
+ *  @see Ostap::Utils::ThreadPool
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// are we inside the parallel loop?
+  thread_local bool s_in_worker = false ;
+  // ==========================================================================
+  /// helper class to mark the current thread as "worker"
+  class WorkerMark
+  {
+  public:
+    WorkerMark  () : m_old ( s_in_worker ) { s_in_worker = true  ; }
+    ~WorkerMark ()                         { s_in_worker = m_old ; }
+  private:
+    bool m_old ;
+  } ;
+  // ==========================================================================
+  /** @class Job
+   *  one parallel loop, split into chunks
+   */
+  class Job
+  {
+  public:
+    // ========================================================================
+    Job ( const Ostap::Utils::ThreadPool::Body& body    ,
+          const std::size_t                     n       ,
+          const std::size_t                     nchunks )
+      : m_body    ( body    )
+      , m_n       ( n       )
+      , m_nchunks ( nchunks )
+      , m_chunk   ( ( n + nchunks - 1 ) / nchunks )
+    {}
+    // ========================================================================
+    /// process one chunk, return false if there is nothing to process
+    bool run_one ()
+    {
+      const std::size_t i = m_next++ ;
+      if ( m_nchunks <= i ) { return false ; }
+      //
+      const std::size_t begin = i * m_chunk ;
+      const std::size_t end   = std::min ( m_n , begin + m_chunk ) ;
+      //
+      if ( begin < end && !m_failed )
+      {
+        try { m_body ( begin , end ) ; }
+        catch ( ... )
+        {
+          std::lock_guard<std::mutex> lock ( m_mutex ) ;
+          if ( !m_error ) { m_error = std::current_exception () ; }
+          m_failed = true ;
+        }
+      }
+      //
+      if ( m_nchunks == ++m_done )
+      {
+        std::lock_guard<std::mutex> lock ( m_mutex ) ;
+        m_cv.notify_all () ;
+      }
+      return true ;
+    }
+    // ========================================================================
+    /// any chunks to be processed?
+    bool pending () const { return m_next < m_nchunks ; }
+    // ========================================================================
+    /// wait till all chunks are processed and rethrow the exception (if any)
+    void wait ()
+    {
+      std::unique_lock<std::mutex> lock ( m_mutex ) ;
+      m_cv.wait ( lock , [this] () { return m_nchunks <= m_done ; } ) ;
+      if ( m_error ) { std::rethrow_exception ( m_error ) ; }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    const Ostap::Utils::ThreadPool::Body& m_body    ;
+    const std::size_t                     m_n       ;
+    const std::size_t                     m_nchunks ;
+    const std::size_t                     m_chunk   ;
+    std::atomic<std::size_t>              m_next    { 0     } ;
+    std::atomic<std::size_t>              m_done    { 0     } ;
+    std::atomic<bool>                     m_failed  { false } ;
+    std::exception_ptr                    m_error   {} ;
+    std::mutex                            m_mutex   {} ;
+    std::condition_variable               m_cv      {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** @class Pool
+   *  the actual pool of worker threads
+   */
+  class Pool
+  {
+  public:
+    // ========================================================================
+    static Pool& instance ()
+    {
+      static Pool s_pool ;
+      return s_pool ;
+    }
+    // ========================================================================
+    ~Pool () { stop () ; }
+    // ========================================================================
+    unsigned int nThreads () const { return m_nthreads ; }
+    // ========================================================================
+    unsigned int setNThreads ( const unsigned int n )
+    {
+      std::lock_guard<std::mutex> lock ( m_config ) ;
+      const unsigned int nt = 0 < n ? n : hardware () ;
+      if ( nt == m_nthreads ) { return m_nthreads ; }
+      stop () ;
+      m_nthreads = nt ;
+      return m_nthreads ;
+    }
+    // ========================================================================
+    void submit ( const std::shared_ptr<Job>& job )
+    {
+      start () ;
+      {
+        std::lock_guard<std::mutex> lock ( m_mutex ) ;
+        m_jobs.push_back ( job ) ;
+      }
+      m_cv.notify_all () ;
+    }
+    // ========================================================================
+    void remove ( const std::shared_ptr<Job>& job )
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      auto it = std::find ( m_jobs.begin () , m_jobs.end () , job ) ;
+      if ( m_jobs.end () != it ) { m_jobs.erase ( it ) ; }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    Pool () : m_nthreads ( hardware () ) {}
+    // ========================================================================
+    static unsigned int hardware ()
+    {
+      const unsigned int n = std::thread::hardware_concurrency () ;
+      return 0 < n ? n : 1 ;
+    }
+    // ========================================================================
+    /// start the workers (if not yet done)
+    void start ()
+    {
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      if ( !m_workers.empty () ) { return ; }
+      m_stop = false ;
+      for ( unsigned int i = 1 ; i < m_nthreads ; ++i )
+      { m_workers.emplace_back ( [this] () { this->work () ; } ) ; }
+    }
+    // ========================================================================
+    /// stop all workers
+    void stop ()
+    {
+      std::vector<std::thread> workers ;
+      {
+        std::lock_guard<std::mutex> lock ( m_mutex ) ;
+        m_stop = true ;
+        std::swap ( workers , m_workers ) ;
+      }
+      m_cv.notify_all () ;
+      for ( auto& w : workers ) { if ( w.joinable () ) { w.join () ; } }
+    }
+    // ========================================================================
+    /// the worker loop
+    void work ()
+    {
+      WorkerMark mark ;
+      while ( true )
+      {
+        std::shared_ptr<Job> job ;
+        {
+          std::unique_lock<std::mutex> lock ( m_mutex ) ;
+          m_cv.wait ( lock , [this] () { return m_stop || !m_jobs.empty () ; } ) ;
+          if ( m_jobs.empty () ) { return ; }                   // RETURN
+          job = m_jobs.front () ;
+          if ( !job->pending () ) { m_jobs.pop_front () ; continue ; }
+        }
+        while ( job->run_one () ) {}
+      }
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    std::atomic<unsigned int>         m_nthreads ;
+    bool                              m_stop     { false } ;
+    std::vector<std::thread>          m_workers  {} ;
+    std::deque<std::shared_ptr<Job> > m_jobs     {} ;
+    std::mutex                        m_mutex    {} ;
+    std::mutex                        m_config   {} ;
+    std::condition_variable           m_cv       {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+}
+// ============================================================================
+/*  execute the loop body for the range [0,n) splitting it into
+ *  the chunks of at least <code>grain</code> entries
+ *  @param n     the size of the range
+ *  @param body  the loop body
+ *  @param grain minimal size of the chunk
+ */
+// ============================================================================
+void Ostap::Utils::ThreadPool::parallel_for
+( const std::size_t                     n     ,
+  const Ostap::Utils::ThreadPool::Body& body  ,
+  const std::size_t                     grain )
+{
+  if ( 0 == n ) { return ; }
+  //
+  Pool& pool = Pool::instance () ;
+  const std::size_t nt = pool.nThreads () ;
+  const std::size_t gr = std::max ( grain , std::size_t ( 1 ) ) ;
+  //
+  // serial processing
+  if ( s_in_worker || nt <= 1 || n <= gr ) { return body ( 0 , n ) ; }
+  //
+  const std::size_t nchunks = std::min ( ( n + gr - 1 ) / gr , 4 * nt ) ;
+  auto job = std::make_shared<Job> ( body , n , nchunks ) ;
+  pool.submit ( job ) ;
+  {
+    WorkerMark mark ;
+    while ( job->run_one () ) {}
+  }
+  pool.remove ( job ) ;
+  job->wait   () ;
+}
+// ============================================================================
+// number of threads used for the parallel loops (including the caller)
+// ============================================================================
+unsigned int Ostap::Utils::ThreadPool::nThreads ()
+{ return Pool::instance().nThreads () ; }
+// ============================================================================
+/*  set number of threads to be used for the parallel loops
+ *  @param n number of threads, 0 means hardware concurrency
+ *  @return the actual number of threads
+ */
+// ============================================================================
+unsigned int Ostap::Utils::ThreadPool::setNThreads ( const unsigned int n )
+{ return Pool::instance().setNThreads ( n ) ; }
+// ============================================================================
+// are we inside the worker thread ?
+// ============================================================================
+bool Ostap::Utils::ThreadPool::inWorker () { return s_in_worker ; }
+// ============================================================================
+
+// ============================================================================
+//                                                                      The END
+// ============================================================================
@@ -15,6 +15,7 @@
 #include "Ostap/Formula.h"
 #include "Ostap/FormulaVar.h"
 #include "Ostap/Notifier.h"
+#include "Ostap/ReadPlan.h"
 // ============================================================================
 // TMVA
 // ============================================================================
@@ -367,6 +368,7 @@ namespace
     typedef std::vector<Branch>                     Branches ;
     //
     Branches branches { reader.methods().size() } ;
+    std::vector<std::string> bnames ;
     unsigned short index = 0 ;
     for(  auto& branch : branches ) 
     {
@@ -379,12 +381,19 @@ namespace
       //
       if ( !std::get<0>( branch ) ) { return Ostap::TMVA::InvalidBranch ; } 
       //
+      bnames.push_back ( bname ) ;
       ++index ;
     }
     //
     Ostap::Utils::Notifier  notifier { tree } ;
     for ( auto& e : reader.variables () ) { notifier.add ( std::get<1> ( e ) ) ; }
     //
+    // read only the branches, used by TMVA variables 
+    std::vector<const TObject*> objects ;
+    for ( auto& e : reader.variables () ) { objects.push_back ( std::get<1> ( e ) ) ; }
+    Ostap::Utils::ReadPlan plan { tree , 0 , nEntries , objects } ;
+    plan.prune ( bnames ) ;
+    //
     for ( Long64_t entry = 0 ; entry < nEntries ; ++entry ) 
     {
       if ( tree->GetEntry ( entry ) < 0 ) { break ; }
@@ -430,6 +439,7 @@ namespace
     // Variables
     //
     Branches branches {readers[0].methods().size() } ;
+    std::vector<std::string> bnames ;
     unsigned short index = 0 ;
     for(  auto& branch : branches ) 
     {
@@ -442,6 +452,7 @@ namespace
       //
       if ( !std::get<0>( branch ) ) { return Ostap::TMVA::InvalidBranch ; } 
       //
+      bnames.push_back ( bname ) ;
       ++index ;
     }
     //
@@ -459,6 +470,14 @@ namespace
     //
     const unsigned int N = readers.size() ;
     //
+    // read only the branches, used by chopping and TMVA variables 
+    std::vector<const TObject*> objects { &chopping } ;
+    for ( auto&  reader : readers ) 
+    { for ( auto& e : reader.variables () ) { objects.push_back ( std::get<1> ( e ) ) ; } }
+    bnames.push_back ( category ) ;
+    Ostap::Utils::ReadPlan plan { tree , 0 , nEntries , objects } ;
+    plan.prune ( bnames ) ;
+    //
     for ( Long64_t entry = 0 ; entry < nEntries ; ++entry ) 
     {
       if ( tree->GetEntry ( entry ) < 0 ) { break ; }
@@ -0,0 +1,498 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <atomic>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <mutex>
+// ============================================================================
+// ROOT&RooFit
+// ============================================================================
+#include "TROOT.h"
+#include "TTree.h"
+#include "TRandom.h"
+#include "RooAbsPdf.h"
+#include "RooArgSet.h"
+#include "RooCmdArg.h"
+#include "RooDataSet.h"
+#include "RooFitResult.h"
+#include "RooGlobalFunc.h"
+#include "RooLinkedList.h"
+#include "RooMsgService.h"
+#include "RooNumber.h"
+#include "RooRandom.h"
+#include "RooRealVar.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Iterator.h"
+#include "Ostap/ThreadPool.h"
+#include "Ostap/ToyRunner.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Utils::ToyRunner
+ *  @see Ostap::Utils::ToyRunner
+ *  @author Ostap developers
+ *  @date   2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// lock for the global state of RooFit
+  std::mutex s_roofit {} ;
+  // ==========================================================================
+  /// SplitMix64 hash
+  inline ULong64_t splitmix64 ( ULong64_t x )
+  {
+    x += 0x9E3779B97F4A7C15ULL ;
+    x  = ( x ^ ( x >> 30 ) ) * 0xBF58476D1CE4E5B9ULL ;
+    x  = ( x ^ ( x >> 27 ) ) * 0x94D049BB133111EBULL ;
+    return x ^ ( x >> 31 ) ;
+  }
+  // ==========================================================================
+  /// get all RooRealVar from the set, matched by name
+  std::vector<RooRealVar*> get_vars
+  ( const RooArgSet&                set   ,
+    const std::vector<std::string>& names )
+  {
+    std::vector<RooRealVar*> result ( names.size () , nullptr ) ;
+    for ( std::size_t i = 0 ; i < names.size () ; ++i )
+    {
+      result [ i ] = dynamic_cast<RooRealVar*> ( set.find ( names [ i ].c_str () ) ) ;
+      Ostap::Assert ( nullptr != result [ i ]                  ,
+                      "Parameter is not found: " + names [ i ] ,
+                      "Ostap::Utils::ToyRunner"                ) ;
+    }
+    return result ;
+  }
+  // ==========================================================================
+  /** @class Worker
+   *  the clone of the model for one worker
+   */
+  class Worker
+  {
+  public:
+    // ========================================================================
+    Worker ( const RooAbsPdf&                pdf    ,
+             const RooArgSet&                obs    ,
+             const std::vector<std::string>& all    ,
+             const std::vector<std::string>& names  )
+    {
+      std::lock_guard<std::mutex> lock ( s_roofit ) ;
+      m_pdf .reset ( static_cast<RooAbsPdf*> ( pdf.cloneTree () ) ) ;
+      m_obs .reset ( m_pdf->getObservables ( obs     ) ) ;
+      m_pars.reset ( m_pdf->getParameters  ( *m_obs  ) ) ;
+      m_all      = get_vars ( *m_pars , all   ) ;
+      m_floating = get_vars ( *m_pars , names ) ;
+    }
+    // ========================================================================
+    ~Worker ()
+    {
+      std::lock_guard<std::mutex> lock ( s_roofit ) ;
+      m_pars.reset () ;
+      m_obs .reset () ;
+      m_pdf .reset () ;
+    }
+    // ========================================================================
+  public:
+    // ========================================================================
+    std::unique_ptr<RooAbsPdf> m_pdf      {} ;
+    std::unique_ptr<RooArgSet> m_obs      {} ;
+    std::unique_ptr<RooArgSet> m_pars     {} ;
+    std::vector<RooRealVar*>   m_all      {} ;
+    std::vector<RooRealVar*>   m_floating {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** @class Progress
+   *  simple thread-safe progress bar
+   */
+  class Progress
+  {
+  public:
+    // ========================================================================
+    Progress ( const unsigned long n , const bool show )
+      : m_n ( n ) , m_show ( show && 0 < n ) {}
+    // ========================================================================
+    void next ()
+    {
+      if ( !m_show ) { return ; }
+      std::lock_guard<std::mutex> lock ( m_mutex ) ;
+      ++m_done ;
+      const unsigned int percent = m_done * 100 / m_n ;
+      if ( percent == m_last && m_done < m_n ) { return ; }
+      m_last = percent ;
+      const unsigned int nbar = percent / 2 ;
+      std::cout << "\rToys: [" << std::string ( nbar , '#' )
+                << std::string ( 50 - nbar , ' ' ) << "] "
+                << percent << "% (" << m_done << "/" << m_n << ")" ;
+      if ( m_done == m_n ) { std::cout << std::endl ; }
+      std::cout << std::flush ;
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    unsigned long m_n    { 0     } ;
+    bool          m_show { false } ;
+    unsigned long m_done { 0     } ;
+    unsigned int  m_last { 1000  } ;
+    std::mutex    m_mutex {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /// silence RooFit messages below WARNING level
+  class MsgGuard
+  {
+  public:
+    MsgGuard  ()
+      : m_level ( RooMsgService::instance().globalKillBelow () )
+    { RooMsgService::instance().setGlobalKillBelow ( std::max ( m_level , RooFit::WARNING ) ) ; }
+    ~MsgGuard () { RooMsgService::instance().setGlobalKillBelow ( m_level ) ; }
+  private:
+    RooFit::MsgLevel m_level ;
+  } ;
+  // ==========================================================================
+}
+// ============================================================================
+/*  constructor
+ *  @param pdf         the model for generation and fitting
+ *  @param observables the observables
+ *  @param nEvents     (mean) number of events per toy
+ *  @param extended    generate Poisson-distributed number of
+ *                     events and make the extended fit
+ */
+// ============================================================================
+Ostap::Utils::ToyRunner::ToyRunner
+( const RooAbsPdf&    pdf         ,
+  const RooArgSet&    observables ,
+  const unsigned long nEvents     ,
+  const bool          extended    )
+  : m_pdf      ()
+  , m_obs      ()
+  , m_nEvents  ( nEvents  )
+  , m_extended ( extended )
+{
+  Ostap::Assert ( 0 < m_nEvents || m_extended     ,
+                  "Invalid number of events!"     ,
+                  "Ostap::Utils::ToyRunner"       ) ;
+  //
+  std::lock_guard<std::mutex> lock ( s_roofit ) ;
+  m_pdf.reset ( static_cast<RooAbsPdf*> ( pdf.cloneTree () ) ) ;
+  m_obs.reset ( m_pdf->getObservables ( observables ) ) ;
+  Ostap::Assert ( 0 < m_obs->getSize ()           ,
+                  "No observables are specified!" ,
+                  "Ostap::Utils::ToyRunner"       ) ;
+  //
+  std::unique_ptr<RooArgSet> pars ( m_pdf->getParameters ( *m_obs ) ) ;
+  Ostap::Utils::Iterator it ( *pars ) ;
+  while ( RooAbsArg* a = static_cast<RooAbsArg*> ( it.next () ) )
+  {
+    const RooRealVar* v = dynamic_cast<RooRealVar*> ( a ) ;
+    if ( nullptr == v ) { continue ; }
+    m_all     .push_back ( v->GetName () ) ;
+    m_all_init.push_back ( v->getVal  () ) ;
+    if ( v->isConstant () ) { continue ; }
+    m_names   .push_back ( v->GetName () ) ;
+    m_init    .push_back ( v->getVal  () ) ;
+  }
+}
+// ============================================================================
+// destructor
+// ============================================================================
+Ostap::Utils::ToyRunner::~ToyRunner ()
+{
+  std::lock_guard<std::mutex> lock ( s_roofit ) ;
+  m_obs.reset () ;
+  m_pdf.reset () ;
+}
+// ============================================================================
+/*  set the initial values of parameters for each toy
+ *  @param pars the values of parameters (matched by name)
+ */
+// ============================================================================
+void Ostap::Utils::ToyRunner::setInitial ( const RooArgSet& pars )
+{
+  for ( std::size_t i = 0 ; i < m_all.size () ; ++i )
+  {
+    const RooAbsReal* v = dynamic_cast<const RooAbsReal*> ( pars.find ( m_all [ i ].c_str () ) ) ;
+    if ( nullptr == v ) { continue ; }
+    m_all_init [ i ] = v->getVal () ;
+    auto it = std::find ( m_names.begin () , m_names.end () , m_all [ i ] ) ;
+    if ( m_names.end () != it ) { m_init [ it - m_names.begin () ] = m_all_init [ i ] ; }
+  }
+}
+// ============================================================================
+// set minimizer type and algorithm
+// ============================================================================
+void Ostap::Utils::ToyRunner::setMinimizer
+( const std::string& type ,
+  const std::string& algo )
+{
+  m_type = type ;
+  m_algo = algo ;
+}
+// ============================================================================
+// the seed for the toy
+// ============================================================================
+ULong64_t Ostap::Utils::ToyRunner::seed ( const unsigned long toy ) const
+{
+  // TRandom3 uses only 32 bits, and 0 means "random seed"
+  const ULong64_t h = splitmix64 ( m_seed ^ splitmix64 ( toy ) ) ;
+  const ULong64_t s = ( h ^ ( h >> 32 ) ) & 0xFFFFFFFFULL ;
+  return 0 == s ? 1 : s ;
+}
+// ============================================================================
+/*  run (more) pseudoexperiments
+ *  @param nToys number of pseudoexperiments
+ *  @return number of successful fits (status 0)
+ */
+// ============================================================================
+unsigned long Ostap::Utils::ToyRunner::run ( const unsigned long nToys )
+{
+  if ( 0 == nToys ) { return 0 ; }
+  //
+  const unsigned long first = m_results.size () ;
+  m_results.resize ( first + nToys ) ;
+  //
+  unsigned long nworkers = Ostap::Utils::ThreadPool::nThreads () ;
+  if ( 0 < m_nthreads ) { nworkers = std::min<unsigned long> ( nworkers , m_nthreads ) ; }
+  nworkers = std::max ( 1UL , std::min ( nworkers , nToys ) ) ;
+  if ( 1 < nworkers ) { ROOT::EnableThreadSafety () ; }
+  //
+  // the fit options
+  std::vector<RooCmdArg> cmds ;
+  cmds.push_back ( RooFit::Save       ( true       ) ) ;
+  cmds.push_back ( RooFit::PrintLevel ( -1         ) ) ;
+  cmds.push_back ( RooFit::Verbose    ( false      ) ) ;
+  cmds.push_back ( RooFit::NumCPU     ( 1          ) ) ;
+  cmds.push_back ( RooFit::Strategy   ( m_strategy ) ) ;
+  cmds.push_back ( RooFit::Hesse      ( m_hesse    ) ) ;
+  cmds.push_back ( RooFit::Offset     ( m_offset   ) ) ;
+  cmds.push_back ( RooFit::Extended   ( m_extended ) ) ;
+  if ( !m_type.empty () )
+  { cmds.push_back ( RooFit::Minimizer ( m_type.c_str () , m_algo.empty () ? nullptr : m_algo.c_str () ) ) ; }
+  RooLinkedList options ;
+  for ( RooCmdArg& c : cmds ) { options.Add ( &c ) ; }
+  //
+  MsgGuard                   guard    ;
+  Progress                   progress ( nToys , m_progress ) ;
+  std::atomic<unsigned long> next     { 0 } ;
+  std::atomic<unsigned long> good     { 0 } ;
+  //
+  auto work = [&] ()
+  {
+    Worker w ( *m_pdf , *m_obs , m_all , m_names ) ;
+    //
+    for ( unsigned long i = next++ ; i < nToys ; i = next++ )
+    {
+      const unsigned long toy = first + i ;
+      Result& r = m_results [ toy ] ;
+      r.toy  = toy          ;
+      r.seed = seed ( toy ) ;
+      //
+      // 1. reset parameters
+      for ( std::size_t k = 0 ; k < w.m_all.size () ; ++k )
+      { w.m_all [ k ]->setVal ( m_all_init [ k ] ) ; }
+      //
+      // 2. generate the dataset
+      std::unique_ptr<RooDataSet> data ;
+      {
+        std::lock_guard<std::mutex> lock ( s_roofit ) ;
+        RooRandom::randomGenerator()->SetSeed ( r.seed ) ;
+        data.reset ( m_extended ?
+                     w.m_pdf->generate ( *w.m_obs , RooFit::NumEvents ( double ( m_nEvents ) ) , RooFit::Extended () ) :
+                     w.m_pdf->generate ( *w.m_obs , int ( m_nEvents ) ) ) ;
+      }
+      //
+      // 3. fit it
+      if ( data )
+      {
+        r.nEvents = data->numEntries () ;
+        r.sumw    = data->sumEntries () ;
+        //
+        // the clones still share the global state of RooFit
+        // (name registry, message service, minimizer plugins): serialize
+        std::unique_ptr<RooFitResult> fit ;
+        {
+          std::lock_guard<std::mutex> lock ( s_roofit ) ;
+          fit.reset ( w.m_pdf->fitTo ( *data , options ) ) ;
+        }
+        //
+        if ( fit )
+        {
+          r.status  = fit->status  () ;
+          r.covQual = fit->covQual () ;
+          r.nll     = fit->minNll  () ;
+          r.edm     = fit->edm     () ;
+          if ( 0 == r.status ) { ++good ; }
+        }
+        //
+        r.values.resize ( w.m_floating.size () ) ;
+        r.errors.resize ( w.m_floating.size () ) ;
+        for ( std::size_t k = 0 ; k < w.m_floating.size () ; ++k )
+        {
+          r.values [ k ] = w.m_floating [ k ]->getVal   () ;
+          r.errors [ k ] = w.m_floating [ k ]->getError () ;
+        }
+        //
+        std::lock_guard<std::mutex> lock ( s_roofit ) ;
+        data.reset () ;
+      }
+      //
+      progress.next () ;
+    }
+  } ;
+  //
+  Ostap::Utils::ThreadPool::parallel_for
+    ( nworkers ,
+      [&work] ( const std::size_t begin , const std::size_t end )
+      { for ( std::size_t i = begin ; i < end ; ++i ) { work () ; } } , 1 ) ;
+  //
+  return good ;
+}
+// ============================================================================
+// get the result of the toy
+// ============================================================================
+const Ostap::Utils::ToyRunner::Result&
+Ostap::Utils::ToyRunner::result ( const unsigned long toy ) const
+{
+  Ostap::Assert ( toy < m_results.size ()    ,
+                  "Invalid toy index!"       ,
+                  "Ostap::Utils::ToyRunner"  ) ;
+  return m_results [ toy ] ;
+}
+// ============================================================================
+// names of all columns
+// ============================================================================
+std::vector<std::string> Ostap::Utils::ToyRunner::columns () const
+{
+  std::vector<std::string> result {
+    "toy" , "seed" , "status" , "covQual" , "nll" , "edm" , "nEvents" , "sumw" } ;
+  for ( const std::string& n : m_names ) { result.push_back ( n           ) ; }
+  for ( const std::string& n : m_names ) { result.push_back ( n + "_err"  ) ; }
+  for ( const std::string& n : m_names ) { result.push_back ( n + "_pull" ) ; }
+  return result ;
+}
+// ============================================================================
+// get the column
+// ============================================================================
+std::vector<double>
+Ostap::Utils::ToyRunner::column ( const std::string& name ) const
+{
+  std::vector<double> result ;
+  result.reserve ( m_results.size () ) ;
+  //
+  auto get = [this,&result] ( std::function<double(const Result&)> fun )
+  { for ( const Result& r : m_results ) { result.push_back ( fun ( r ) ) ; } } ;
+  //
+  if      ( "toy"     == name ) { get ( [] ( const Result& r ) { return double ( r.toy     ) ; } ) ; return result ; }
+  else if ( "seed"    == name ) { get ( [] ( const Result& r ) { return double ( r.seed    ) ; } ) ; return result ; }
+  else if ( "status"  == name ) { get ( [] ( const Result& r ) { return double ( r.status  ) ; } ) ; return result ; }
+  else if ( "covQual" == name ) { get ( [] ( const Result& r ) { return double ( r.covQual ) ; } ) ; return result ; }
+  else if ( "nll"     == name ) { get ( [] ( const Result& r ) { return r.nll     ; } ) ; return result ; }
+  else if ( "edm"     == name ) { get ( [] ( const Result& r ) { return r.edm     ; } ) ; return result ; }
+  else if ( "nEvents" == name ) { get ( [] ( const Result& r ) { return r.nEvents ; } ) ; return result ; }
+  else if ( "sumw"    == name ) { get ( [] ( const Result& r ) { return r.sumw    ; } ) ; return result ; }
+  //
+  for ( std::size_t k = 0 ; k < m_names.size () ; ++k )
+  {
+    const std::string& n  = m_names [ k ] ;
+    const double       v0 = m_init  [ k ] ;
+    auto value = [k] ( const Result& r ) { return k < r.values.size () ? r.values [ k ] : 0.0 ; } ;
+    auto error = [k] ( const Result& r ) { return k < r.errors.size () ? r.errors [ k ] : 0.0 ; } ;
+    if      ( n           == name ) { get ( value ) ; return result ; }
+    else if ( n + "_err"  == name ) { get ( error ) ; return result ; }
+    else if ( n + "_pull" == name )
+    {
+      get ( [value,error,v0] ( const Result& r )
+            { const double e = error ( r ) ; return 0 < e ? ( value ( r ) - v0 ) / e : 0.0 ; } ) ;
+      return result ;
+    }
+  }
+  //
+  Ostap::Assert ( false                           ,
+                  "Invalid column name: " + name  ,
+                  "Ostap::Utils::ToyRunner"       ) ;
+  return result ;
+}
+// ============================================================================
+/*  create TTree with results (one entry per toy)
+ *  @attention the tree is created in the current directory
+ */
+// ============================================================================
+TTree* Ostap::Utils::ToyRunner::tree
+( const std::string& name  ,
+  const std::string& title ) const
+{
+  const std::vector<std::string> names = columns () ;
+  std::vector<std::vector<double> > data ;
+  for ( const std::string& n : names ) { data.push_back ( column ( n ) ) ; }
+  //
+  TTree* t = new TTree ( name.c_str () , title.empty () ? "Toys" : title.c_str () ) ;
+  //
+  ULong64_t toy     = 0 ;
+  ULong64_t seed    = 0 ;
+  Int_t     status  = 0 ;
+  Int_t     covQual = 0 ;
+  t->Branch ( "toy"     , &toy     , "toy/l"     ) ;
+  t->Branch ( "seed"    , &seed    , "seed/l"    ) ;
+  t->Branch ( "status"  , &status  , "status/I"  ) ;
+  t->Branch ( "covQual" , &covQual , "covQual/I" ) ;
+  // the first four columns are integers
+  std::vector<double> values ( names.size () , 0.0 ) ;
+  for ( std::size_t i = 4 ; i < names.size () ; ++i )
+  { t->Branch ( names [ i ].c_str () , &values [ i ] , ( names [ i ] + "/D" ).c_str () ) ; }
+  //
+  for ( std::size_t j = 0 ; j < m_results.size () ; ++j )
+  {
+    toy     = m_results [ j ].toy     ;
+    seed    = m_results [ j ].seed    ;
+    status  = m_results [ j ].status  ;
+    covQual = m_results [ j ].covQual ;
+    for ( std::size_t i = 4 ; i < names.size () ; ++i ) { values [ i ] = data [ i ][ j ] ; }
+    t->Fill () ;
+  }
+  //
+  t->ResetBranchAddresses () ;
+  return t ;
+}
+// ============================================================================
+// create RooDataSet with results (one entry per toy)
+// ============================================================================
+RooDataSet* Ostap::Utils::ToyRunner::dataset
+( const std::string& name  ,
+  const std::string& title ) const
+{
+  const std::vector<std::string> names = columns () ;
+  std::vector<std::vector<double> > data ;
+  for ( const std::string& n : names ) { data.push_back ( column ( n ) ) ; }
+  //
+  std::vector<std::unique_ptr<RooRealVar> > vars ;
+  RooArgSet varset ;
+  for ( const std::string& n : names )
+  {
+    vars.emplace_back ( new RooRealVar ( n.c_str () , n.c_str () , 0 ,
+                                         -RooNumber::infinity () ,
+                                         +RooNumber::infinity () ) ) ;
+    varset.add ( *vars.back () ) ;
+  }
+  //
+  RooDataSet* ds = new RooDataSet ( name.c_str () , title.empty () ? "Toys" : title.c_str () , varset ) ;
+  for ( std::size_t j = 0 ; j < m_results.size () ; ++j )
+  {
+    for ( std::size_t i = 0 ; i < names.size () ; ++i ) { vars [ i ]->setVal ( data [ i ][ j ] ) ; }
+    ds->add ( varset ) ;
+  }
+  return ds ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
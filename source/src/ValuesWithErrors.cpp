@@ -0,0 +1,694 @@
+// ============================================================================
+// Include files
+// ============================================================================
+// STD & STL
+// ============================================================================
+#include <cmath>
+#include <algorithm>
+// ============================================================================
+// ROOT
+// ============================================================================
+#include "TH1.h"
+#include "TArrayD.h"
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Math.h"
+#include "Ostap/Interpolation.h"
+#include "Ostap/ValueWithError.h"
+#include "Ostap/ValuesWithErrors.h"
+#include "Ostap/ThreadPool.h"
+// ============================================================================
+// Local
+// ============================================================================
+#include "Exception.h"
+// ============================================================================
+/** @file
+ *  Implementation file for class Ostap::Math::ValuesWithErrors
+ *  @see Ostap::Math::ValuesWithErrors
+ *  @date 2026-10-19
+ *  @author Ostap developers
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  /// check if the double value close to zero
+  const Ostap::Math::Zero<double>     s_zero{}  ;
+  /// equality of doubles
+  const Ostap::Math::Equal_To<double> s_equal{} ;
+  /// precomputed value of 1/ln(10)
+  const double s_ln10_i = 1 / std::log ( double ( 10 ) ) ;
+  // ==========================================================================
+  /// minimal size of the chunk for the parallel processing
+  const std::size_t s_GRAIN  = 16384 ;
+  // ==========================================================================
+  typedef Ostap::Math::ValuesWithErrors VEs ;
+  typedef Ostap::Math::ValueWithError   VE  ;
+  // ==========================================================================
+  /// the same as the constructor of ValueWithError does
+  inline double _cov2 ( const double c ) { return s_zero ( c ) ? 0.0 : c ; }
+  /// invalid or small covariance ?
+  inline bool   _null ( const double c ) { return 0 >= c || s_zero ( c ) ; }
+  // ==========================================================================
+  /** run the kernel for the range [0,n),
+   *  split into chunks for long arrays
+   */
+  template <class KERNEL>
+  inline void run
+  ( const std::size_t n      ,
+    KERNEL            kernel )
+  {
+    if      ( 0 == n      ) { return ; }
+    else if ( n < s_GRAIN ) { kernel ( 0 , n ) ; }
+    else { Ostap::Utils::ThreadPool::parallel_for ( n , kernel , s_GRAIN ) ; }
+  }
+  // ==========================================================================
+  /** apply the elementwise operation in place
+   *  @param a  the collection
+   *  @param op the operation <code>op ( double& value , double& cov2 )</code>
+   */
+  template <class OPERATION>
+  inline VEs& apply
+  ( VEs&      a  ,
+    OPERATION op )
+  {
+    double* v = a.values () ;
+    double* c = a.cov2s  () ;
+    run ( a.size () , [v,c,&op] ( const std::size_t begin , const std::size_t end )
+          { for ( std::size_t i = begin ; i < end ; ++i ) { op ( v [ i ] , c [ i ] ) ; } } ) ;
+    return a ;
+  }
+  // ==========================================================================
+  /** apply the elementwise binary operation in place
+   *  @param a  the collection
+   *  @param b  the second collection
+   *  @param op the operation <code>op ( double& va , double& ca , double vb , double cb )</code>
+   */
+  template <class OPERATION>
+  inline VEs& apply
+  ( VEs&               a      ,
+    const VEs&         b      ,
+    const char*        method ,
+    OPERATION          op     )
+  {
+    Ostap::Assert ( a.size () == b.size ()          ,
+                    "Mismatch in the array sizes!"  ,
+                    std::string ( "Ostap::Math::ValuesWithErrors::" ) + method ) ;
+    double*       v  = a.values () ;
+    double*       c  = a.cov2s  () ;
+    const double* bv = b.values () ;
+    const double* bc = b.cov2s  () ;
+    run ( a.size () , [v,c,bv,bc,&op] ( const std::size_t begin , const std::size_t end )
+          { for ( std::size_t i = begin ; i < end ; ++i ) { op ( v [ i ] , c [ i ] , bv [ i ] , bc [ i ] ) ; } } ) ;
+    return a ;
+  }
+  // ==========================================================================
+  /// the same storage ?
+  inline bool _same ( const VEs& a , const VEs& b )
+  { return a.values () == b.values () ; }
+  // ==========================================================================
+  // the elementwise kernels: the same expressions as for ValueWithError
+  // ==========================================================================
+  /// @see Ostap::Math::ValueWithError::operator+=
+  inline void _iadd ( double& v , double& c , const double bv , const double bc )
+  {
+    v += bv ;
+    if ( 0 < bc ) { c += bc ; }
+    c = _cov2 ( c ) ;
+  }
+  /// @see Ostap::Math::ValueWithError::operator-=
+  inline void _isub ( double& v , double& c , const double bv , const double bc )
+  {
+    v -= bv ;
+    if ( 0 < bc ) { c += bc ; }
+    c = _cov2 ( c ) ;
+  }
+  /// @see Ostap::Math::ValueWithError::operator*=
+  inline void _imul ( double& v , double& c , const double bv , const double bc )
+  {
+    const double a2 = v  * v  ;
+    const double b2 = bv * bv ;
+    c *= b2 ;
+    if ( 0 < bc ) { c += a2 * bc ; }
+    v *= bv ;
+    c = _cov2 ( c ) ;
+  }
+  /// @see Ostap::Math::ValueWithError::operator/=
+  inline void _idiv ( double& v , double& c , const double bv , const double bc )
+  {
+    const double a2 = v  * v  ;
+    const double b2 = bv * bv ;
+    const double b4 = b2 * b2 ;
+    c /= b2 ;
+    if ( 0 < bc ) { c += ( a2 / b4 ) * bc ; }
+    v /= bv ;
+    c = _cov2 ( c ) ;
+  }
+  /// @see Ostap::Math::pow ( const ValueWithError& , int )
+  inline void _ipow ( double& v , double& c , const int b )
+  {
+    if      ( 0 == b    ) { v = 1 ; c = 0 ; return ; }
+    else if ( 1 == b    ) { return ; }
+    else if ( _null ( c ) ) { v = std::pow ( v , b ) ; c = 0 ; return ; }
+    const double e1 = b * std::pow ( v , b - 1 ) ;
+    v = std::pow ( v , b ) ;
+    c = _cov2 ( e1 * e1 * c ) ;
+  }
+  // ==========================================================================
+}
+// ============================================================================
+// constructor: n elements with the same value and covariance
+// ============================================================================
+Ostap::Math::ValuesWithErrors::ValuesWithErrors
+( const std::size_t n     ,
+  const double      value ,
+  const double      cov2  )
+  : m_values ( n , value          )
+  , m_cov2   ( n , _cov2 ( cov2 ) )
+{}
+// ============================================================================
+// constructor from the values and covariances
+// ============================================================================
+Ostap::Math::ValuesWithErrors::ValuesWithErrors
+( const Data& values ,
+  const Data& cov2   )
+  : m_values ( values )
+  , m_cov2   ( values.size () , 0.0 )
+{
+  const std::size_t n = std::min ( values.size () , cov2.size () ) ;
+  std::transform ( cov2.begin () , cov2.begin () + n , m_cov2.begin () , _cov2 ) ;
+}
+// ============================================================================
+// constructor from the vector of values with errors
+// ============================================================================
+Ostap::Math::ValuesWithErrors::ValuesWithErrors
+( const Ostap::Math::ValueWithError::Vector& values )
+  : m_values ( values.size () )
+  , m_cov2   ( values.size () )
+{
+  std::transform ( values.begin () , values.end () , m_values.begin () ,
+                   [] ( const VE& v ) { return v.value () ; } ) ;
+  std::transform ( values.begin () , values.end () , m_cov2  .begin () ,
+                   [] ( const VE& v ) { return v.cov2  () ; } ) ;
+}
+// ============================================================================
+// constructor of the (non-owning) view of the external arrays
+// ============================================================================
+Ostap::Math::ValuesWithErrors::ValuesWithErrors
+( const std::size_t n      ,
+  double*           values ,
+  double*           cov2   )
+  : m_values ()
+  , m_cov2   ()
+  , m_n      ( n      )
+  , m_vv     ( values )
+  , m_cv     ( cov2   )
+{
+  Ostap::Assert ( values && cov2                     ,
+                  "Invalid arrays!"                  ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+  Ostap::Assert ( values != cov2 || 0 == n           ,
+                  "Values and covariances must be different arrays!" ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+}
+// ============================================================================
+// constructor of the (non-owning) view of the histogram
+// ============================================================================
+Ostap::Math::ValuesWithErrors::ValuesWithErrors
+( TH1& histo )
+  : m_values ()
+  , m_cov2   ()
+{
+  TArrayD* content = dynamic_cast<TArrayD*> ( &histo ) ;
+  Ostap::Assert ( nullptr != content                 ,
+                  "Only histograms with double content are supported!" ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+  //
+  if ( 0 == histo.GetSumw2N () ) { histo.Sumw2 () ; }
+  TArrayD* sumw2 = histo.GetSumw2 () ;
+  Ostap::Assert ( sumw2 && sumw2->GetSize () == content->GetSize () ,
+                  "Invalid structure of the sum of squared weights!" ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+  //
+  m_n  = content -> GetSize  () ;
+  m_vv = content -> GetArray () ;
+  m_cv = sumw2   -> GetArray () ;
+}
+// ============================================================================
+// get i-th element (with check)
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::ValuesWithErrors::at ( const std::size_t i ) const
+{
+  Ostap::Assert ( i < size ()                        ,
+                  "Index out of range!"              ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+  return (*this) [ i ] ;
+}
+// ============================================================================
+// set i-th element (with check)
+// ============================================================================
+void Ostap::Math::ValuesWithErrors::set
+( const std::size_t                  i ,
+  const Ostap::Math::ValueWithError& v )
+{
+  Ostap::Assert ( i < size ()                        ,
+                  "Index out of range!"              ,
+                  "Ostap::Math::ValuesWithErrors"    ) ;
+  values () [ i ] = v.value () ;
+  cov2s  () [ i ] = v.cov2  () ;
+}
+// ============================================================================
+// convert to the vector of values with errors
+// ============================================================================
+Ostap::Math::ValueWithError::Vector
+Ostap::Math::ValuesWithErrors::vector () const
+{
+  const std::size_t n = size   () ;
+  const double*     v = values () ;
+  const double*     c = cov2s  () ;
+  ValueWithError::Vector result ( n ) ;
+  for ( std::size_t i = 0 ; i < n ; ++i ) { result [ i ] = ValueWithError ( v [ i ] , c [ i ] ) ; }
+  return result ;
+}
+// ============================================================================
+// get the owning copy
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::clone () const
+{
+  if ( !view () ) { return *this ; }
+  ValuesWithErrors result ;
+  result.m_values.assign ( m_vv , m_vv + m_n ) ;
+  result.m_cov2  .assign ( m_cv , m_cv + m_n ) ;
+  return result ;
+}
+// ============================================================================
+// in-place operations with another collection
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator+= ( const Ostap::Math::ValuesWithErrors& right )
+{
+  if ( _same ( *this , right ) )
+  { return apply ( *this , [] ( double& v , double& c ) { v *= 2 ; c *= 4 ; } ) ; }
+  return apply ( *this , right , "operator+=" , _iadd ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator-= ( const Ostap::Math::ValuesWithErrors& right )
+{
+  if ( _same ( *this , right ) )
+  { return apply ( *this , [] ( double& v , double& c ) { v = 0 ; c = 0 ; } ) ; }
+  return apply ( *this , right , "operator-=" , _isub ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator*= ( const Ostap::Math::ValuesWithErrors& right )
+{
+  if ( _same ( *this , right ) )
+  { return apply ( *this , [] ( double& v , double& c )
+                   { const double a = v ; v = a * a ; c = _cov2 ( c * 4 * a * a ) ; } ) ; }
+  return apply ( *this , right , "operator*=" , _imul ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator/= ( const Ostap::Math::ValuesWithErrors& right )
+{
+  if ( _same ( *this , right ) )
+  { return apply ( *this , [] ( double& v , double& c ) { v = 1 ; c = 0 ; } ) ; }
+  return apply ( *this , right , "operator/=" , _idiv ) ;
+}
+// ============================================================================
+// in-place operations with the value with error
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator+= ( const Ostap::Math::ValueWithError& right )
+{
+  const double bv = right.value () ;
+  const double bc = right.cov2  () ;
+  return apply ( *this , [bv,bc] ( double& v , double& c ) { _iadd ( v , c , bv , bc ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator-= ( const Ostap::Math::ValueWithError& right )
+{
+  const double bv = right.value () ;
+  const double bc = right.cov2  () ;
+  return apply ( *this , [bv,bc] ( double& v , double& c ) { _isub ( v , c , bv , bc ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator*= ( const Ostap::Math::ValueWithError& right )
+{
+  const double bv = right.value () ;
+  const double bc = right.cov2  () ;
+  return apply ( *this , [bv,bc] ( double& v , double& c ) { _imul ( v , c , bv , bc ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator/= ( const Ostap::Math::ValueWithError& right )
+{
+  const double bv = right.value () ;
+  const double bc = right.cov2  () ;
+  return apply ( *this , [bv,bc] ( double& v , double& c ) { _idiv ( v , c , bv , bc ) ; } ) ;
+}
+// ============================================================================
+// in-place operations with the constant
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator+= ( const double right )
+{ return apply ( *this , [right] ( double& v , double& /* c */ ) { v += right ; } ) ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator-= ( const double right )
+{ return apply ( *this , [right] ( double& v , double& /* c */ ) { v -= right ; } ) ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator*= ( const double right )
+{
+  const double r2 = right * right ;
+  return apply ( *this , [right,r2] ( double& v , double& c )
+                 { v *= right ; c = _cov2 ( c * r2 ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors&
+Ostap::Math::ValuesWithErrors::operator/= ( const double right )
+{
+  const double r2 = right * right ;
+  return apply ( *this , [right,r2] ( double& v , double& c )
+                 { v /= right ; c = _cov2 ( c / r2 ) ; } ) ;
+}
+// ============================================================================
+// binary operations
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__add__ ( const Ostap::Math::ValuesWithErrors& right ) const
+{
+  // the same as for ValueWithError::__add__
+  if ( _same ( *this , right ) ) { return __mul__ ( 2.0 ) ; }
+  ValuesWithErrors tmp ( clone () ) ;
+  return tmp += right ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__sub__ ( const Ostap::Math::ValuesWithErrors& right ) const
+{
+  // the same as for ValueWithError::__sub__
+  if ( _same ( *this , right ) ) { return ValuesWithErrors ( size () , 0 , 0 ) ; }
+  ValuesWithErrors tmp ( clone () ) ;
+  return tmp -= right ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__mul__ ( const Ostap::Math::ValuesWithErrors& right ) const
+{
+  // the same as for ValueWithError::__mul__
+  if ( _same ( *this , right ) ) { return pow ( *this , 2 ) ; }
+  ValuesWithErrors tmp ( clone () ) ;
+  return tmp *= right ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__truediv__ ( const Ostap::Math::ValuesWithErrors& right ) const
+{
+  // the same as for ValueWithError::__truediv__
+  if ( _same ( *this , right ) ) { return ValuesWithErrors ( size () , 1 , 0 ) ; }
+  ValuesWithErrors tmp ( clone () ) ;
+  return tmp /= right ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__add__ ( const Ostap::Math::ValueWithError& right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp += right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__sub__ ( const Ostap::Math::ValueWithError& right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp -= right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__mul__ ( const Ostap::Math::ValueWithError& right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp *= right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__truediv__ ( const Ostap::Math::ValueWithError& right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp /= right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__add__ ( const double right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp += right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__sub__ ( const double right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp -= right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__mul__ ( const double right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp *= right ; }
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__truediv__ ( const double right ) const
+{ ValuesWithErrors tmp ( clone () ) ; return tmp /= right ; }
+// ============================================================================
+// right - me
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__rsub__ ( const double right ) const
+{
+  ValuesWithErrors tmp ( clone () ) ;
+  return apply ( tmp , [right] ( double& v , double& c ) { v = right - v ; c = _cov2 ( c ) ; } ) ;
+}
+// ============================================================================
+// right / me
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__rtruediv__ ( const double right ) const
+{
+  ValuesWithErrors tmp ( clone () ) ;
+  return apply ( tmp , [right] ( double& v , double& c )
+                 {
+                   double rv = right ;
+                   double rc = 0     ;
+                   _idiv ( rv , rc , v , c ) ;
+                   v = rv ;
+                   c = rc ;
+                 } ) ;
+}
+// ============================================================================
+// -me
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__neg__ () const
+{
+  ValuesWithErrors tmp ( clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c ) { v = -v ; c = _cov2 ( c ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__abs__  () const { return abs  ( *this ) ; }
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__exp__  () const { return exp  ( *this ) ; }
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__log__  () const { return log  ( *this ) ; }
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__sqrt__ () const { return sqrt ( *this ) ; }
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__pow__  ( const int    e ) const { return pow ( *this , e ) ; }
+Ostap::Math::ValuesWithErrors
+Ostap::Math::ValuesWithErrors::__pow__  ( const double e ) const { return pow ( *this , e ) ; }
+// ============================================================================
+// get the sum of all elements
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::ValuesWithErrors::sum () const
+{
+  const std::size_t n = size   () ;
+  const double*     v = values () ;
+  const double*     c = cov2s  () ;
+  //
+  // fixed chunks: the result does not depend on the number of threads
+  const std::size_t nchunks = ( n + s_GRAIN - 1 ) / s_GRAIN ;
+  std::vector<double> sv ( nchunks , 0.0 ) ;
+  std::vector<double> sc ( nchunks , 0.0 ) ;
+  auto kernel = [n,v,c,&sv,&sc] ( const std::size_t begin , const std::size_t end )
+    {
+      for ( std::size_t k = begin ; k < end ; ++k )
+      {
+        const std::size_t i1 = k * s_GRAIN ;
+        const std::size_t i2 = std::min ( n , i1 + s_GRAIN ) ;
+        double s1 = 0 ;
+        double s2 = 0 ;
+        for ( std::size_t i = i1 ; i < i2 ; ++i )
+        {
+          s1 += v [ i ] ;
+          if ( 0 < c [ i ] ) { s2 += c [ i ] ; }
+        }
+        sv [ k ] = s1 ;
+        sc [ k ] = s2 ;
+      }
+    } ;
+  //
+  if ( nchunks < 2 ) { kernel ( 0 , nchunks ) ; }
+  else { Ostap::Utils::ThreadPool::parallel_for ( nchunks , kernel , 1 ) ; }
+  //
+  double s1 = 0 ;
+  double s2 = 0 ;
+  for ( std::size_t k = 0 ; k < nchunks ; ++k ) { s1 += sv [ k ] ; s2 += sc [ k ] ; }
+  //
+  return ValueWithError ( s1 , s2 ) ;
+}
+// ============================================================================
+// get the arithmetic mean of all elements
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::ValuesWithErrors::mean () const
+{
+  const std::size_t n = size () ;
+  if ( 0 == n ) { return ValueWithError () ; }
+  return sum () / double ( n ) ;
+}
+// ============================================================================
+// get the weighted average of all elements
+// ============================================================================
+Ostap::Math::ValueWithError
+Ostap::Math::ValuesWithErrors::weighted_average () const
+{
+  const std::size_t n = size   () ;
+  const double*     v = values () ;
+  const double*     c = cov2s  () ;
+  //
+  double      sw  = 0 ; // sum of weights
+  double      swv = 0 ; // sum of weighted values
+  double      s0  = 0 ; // sum of values without uncertainties
+  std::size_t n0  = 0 ; // number of values without uncertainties
+  for ( std::size_t i = 0 ; i < n ; ++i )
+  {
+    if ( 0 >= c [ i ] ) { s0 += v [ i ] ; ++n0 ; continue ; }
+    const double w = 1.0 / c [ i ] ;
+    sw  += w        ;
+    swv += w * v[i] ;
+  }
+  //
+  if      ( 0 < n0  ) { return s0 / n0 ; }
+  else if ( 0 >= sw ) { return ValueWithError () ; }
+  //
+  const double cov2 = 1.0 / sw ;
+  return ValueWithError ( cov2 * swv , cov2 ) ;
+}
+// ============================================================================
+// elementwise math functions
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::abs ( const Ostap::Math::ValuesWithErrors& a )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c ) { v = std::fabs ( v ) ; c = _cov2 ( c ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::exp ( const Ostap::Math::ValuesWithErrors& a )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c )
+                 {
+                   v = std::exp ( v ) ;
+                   c = _null ( c ) ? 0.0 : _cov2 ( v * v * c ) ;
+                 } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::log ( const Ostap::Math::ValuesWithErrors& a )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c )
+                 {
+                   const double e1 = 1.0 / v ;
+                   v = std::log ( v ) ;
+                   c = _null ( c ) ? 0.0 : _cov2 ( e1 * e1 * c ) ;
+                 } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::log10 ( const Ostap::Math::ValuesWithErrors& a )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c )
+                 {
+                   const double e1 = s_ln10_i / v ;
+                   v = std::log10 ( v ) ;
+                   c = _null ( c ) ? 0.0 : _cov2 ( e1 * e1 * c ) ;
+                 } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::sqrt ( const Ostap::Math::ValuesWithErrors& a )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [] ( double& v , double& c )
+                 {
+                   const double e2 = 0.25 * c / v ;
+                   v = std::sqrt ( v ) ;
+                   c = _null ( c ) ? 0.0 : _cov2 ( e2 ) ;
+                 } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::pow ( const Ostap::Math::ValuesWithErrors& a , const int b )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  return apply ( tmp , [b] ( double& v , double& c ) { _ipow ( v , c , b ) ; } ) ;
+}
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::pow ( const Ostap::Math::ValuesWithErrors& a , const double b )
+{
+  ValuesWithErrors tmp ( a.clone () ) ;
+  const bool b0 = s_zero ( b ) ;
+  const bool b1 = b == 1 || s_equal ( b , 1.0 ) ;
+  return apply ( tmp , [b,b0,b1] ( double& v , double& c )
+                 {
+                   if      ( b0 ) { v = 1 ; c = 0 ; return ; }
+                   else if ( b1 ) { return ; }
+                   else if ( _null ( c ) ) { v = std::pow ( v , b ) ; c = 0 ; return ; }
+                   const double e1 = b * std::pow ( v , b - 1 ) ;
+                   v = std::pow ( v , b ) ;
+                   c = _cov2 ( e1 * e1 * c ) ;
+                 } ) ;
+}
+// ============================================================================
+/* interpolate the table for all elements of x
+ *  the uncertainties of x are propagated via
+ *  the derivative of the interpolation polynomial
+ *  @param table the interpolation table
+ *  @param x     the points with uncertainties
+ *  @return the interpolated values with uncertainties
+ */
+// ============================================================================
+Ostap::Math::ValuesWithErrors
+Ostap::Math::interpolate
+( const Ostap::Math::Interpolation::Table& table ,
+  const Ostap::Math::ValuesWithErrors&     x     )
+{
+  ValuesWithErrors result ( x.size () ) ;
+  if ( table.empty () ) { return result ; }
+  //
+  const double* xv = x     .values () ;
+  const double* xc = x     .cov2s  () ;
+  double*       rv = result.values () ;
+  double*       rc = result.cov2s  () ;
+  //
+  run ( x.size () , [&table,xv,xc,rv,rc] ( const std::size_t begin , const std::size_t end )
+        {
+          for ( std::size_t i = begin ; i < end ; ++i )
+          {
+            const std::pair<double,double> r = table.neville2 ( xv [ i ] ) ;
+            rv [ i ] = r.first ;
+            rc [ i ] = _null ( xc [ i ] ) ? 0.0 : _cov2 ( r.second * r.second * xc [ i ] ) ;
+          }
+        } ) ;
+  //
+  return result ;
+}
+// ============================================================================
+//                                                                      The END
+// ============================================================================
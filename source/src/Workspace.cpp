@@ -1,9 +1,10 @@
 // ============================================================================
-// Include files 
+// Include files
 // ============================================================================
 // STD  & STL
 // ============================================================================
 #include <utility>
+#include <vector>
 // ============================================================================
 // GSL
 // ============================================================================
@@ -17,98 +18,130 @@
 // ============================================================================
 #include "local_gsl.h"
 // ============================================================================
-/** @file 
+/** @file
  *  Implementation file for class Ostap::Math::Workspace
  */
 // ============================================================================
-// constructor
-// ============================================================================
-Ostap::Math::WorkSpace::WorkSpace ( const std::size_t size ) 
-  : m_workspace ( nullptr )
-  , m_size      ( size )
-{}
-// ============================================================================
-// (fictive) copy constructor
-// ============================================================================
-Ostap::Math::WorkSpace::WorkSpace
-( const Ostap::Math::WorkSpace& /* right */ )
-  : m_workspace ( nullptr )
-  , m_size      ( 0       )
-{}
-// ============================================================================
-// move constructor
-// ============================================================================
-Ostap::Math::WorkSpace::WorkSpace
-(       Ostap::Math::WorkSpace&& right  )
-  : m_workspace ( nullptr )
-  , m_size      ( 0       )
-{ 
-  // std::swap ( m_workspace , right.m_workspace ) ; 
-  // std::swap ( m_size      , right.m_size      ) ; 
-}
-// ============================================================================
-// destructor
-// ============================================================================
-Ostap::Math::WorkSpace::~WorkSpace ()
+namespace
 {
-  if ( nullptr != m_workspace )
+  // ==========================================================================
+  /** @var s_POOLSIZE
+   *  maximal number of free workspaces kept in the pool per thread
+   */
+  const std::size_t s_POOLSIZE = 16 ;
+  // ==========================================================================
+  /** @class Pool
+   *  thread-local pool of GSL integration workspaces
+   */
+  class Pool
+  {
+  public:
+    // ========================================================================
+    ~Pool () { clear () ; }
+    // ========================================================================
+    /// get the workspace with at least <code>size</code> subintervals
+    gsl_integration_workspace* acquire ( const std::size_t size )
+    {
+      // find the smallest free workspace of sufficient size
+      auto best = m_free.end () ;
+      for ( auto it = m_free.begin () ; m_free.end () != it ; ++it )
+      {
+        if ( size <= (*it)->limit &&
+             ( m_free.end () == best || (*it)->limit < (*best)->limit ) ) { best = it ; }
+      }
+      if ( m_free.end () != best )
+      {
+        gsl_integration_workspace* ws = *best ;
+        m_free.erase ( best ) ;
+        return ws ;
+      }
+      return gsl_integration_workspace_alloc ( size ) ;
+    }
+    // ========================================================================
+    /// return the workspace to the pool
+    void release ( gsl_integration_workspace* ws )
+    {
+      if ( nullptr == ws ) { return ; }
+      if ( s_POOLSIZE <= m_free.size () )
+      {
+        // remove the smallest workspace
+        auto smallest = m_free.begin () ;
+        for ( auto it = m_free.begin () ; m_free.end () != it ; ++it )
+        { if ( (*it)->limit < (*smallest)->limit ) { smallest = it ; } }
+        if ( ws->limit <= (*smallest)->limit ) { gsl_integration_workspace_free ( ws ) ; return ; }
+        gsl_integration_workspace_free ( *smallest ) ;
+        m_free.erase ( smallest ) ;
+      }
+      m_free.push_back ( ws ) ;
+    }
+    // ========================================================================
+    /// number of free workspaces
+    std::size_t size  () const { return m_free.size () ; }
+    // ========================================================================
+    /// release all free workspaces
+    std::size_t clear ()
+    {
+      const std::size_t n = m_free.size () ;
+      for ( auto ws : m_free ) { gsl_integration_workspace_free ( ws ) ; }
+      m_free.clear () ;
+      return n ;
+    }
+    // ========================================================================
+  private:
+    // ========================================================================
+    /// free workspaces
+    std::vector<gsl_integration_workspace*> m_free {} ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /// the thread-local pool
+  Pool& pool ()
   {
-    gsl_integration_workspace * _ws = (gsl_integration_workspace*) m_workspace ;
-    m_workspace = nullptr ;
-    gsl_integration_workspace_free ( _ws );
+    static thread_local Pool s_pool {} ;
+    return s_pool ;
   }
+  // ==========================================================================
 }
 // ============================================================================
-// get the integration workspace
+// constructor
 // ============================================================================
-void* Ostap::Math::WorkSpace::workspace () const
-{
-  if ( nullptr == m_workspace ) 
-  { m_workspace = (char*) gsl_integration_workspace_alloc ( 0 == m_size ? s_SIZE : m_size ) ; }
-  return m_workspace ;
-}
+Ostap::Math::WorkSpace::WorkSpace ( const std::size_t size )
+  : m_size      ( size )
+{}
 // ============================================================================
-// fictive assignement operator
+// get the integration workspace from the thread-local pool
 // ============================================================================
-Ostap::Math::WorkSpace&
-Ostap::Math::WorkSpace::operator=
-  ( const Ostap::Math::WorkSpace& /* right */ ) { return *this ; }
+void* Ostap::Math::WorkSpace::acquire () const
+{ return pool().acquire ( 0 == m_size ? s_SIZE : m_size ) ; }
 // ============================================================================
-// move assignement operator
+// return the integration workspace back to the thread-local pool
 // ============================================================================
-Ostap::Math::WorkSpace&
-Ostap::Math::WorkSpace::operator=
-(       Ostap::Math::WorkSpace&& /* right */ ) { return *this ; }
+void Ostap::Math::WorkSpace::release ( void* ws )
+{ pool().release ( (gsl_integration_workspace*) ws ) ; }
 // ============================================================================
 // swap
 // ============================================================================
-void Ostap::Math::WorkSpace::swap ( Ostap::Math::WorkSpace& right ) 
-{ 
-  std::swap  ( m_workspace ,  right.m_workspace ) ;
-  std::swap  ( m_size      ,  right.m_size      ) ;
-}
+void Ostap::Math::WorkSpace::swap ( Ostap::Math::WorkSpace& right )
+{ std::swap  ( m_size      ,  right.m_size      ) ; }
 // ============================================================================
-// resize the workspace 
+// resize the workspace
 // ============================================================================
-std::size_t Ostap::Math::WorkSpace::resize ( const std::size_t newsize ) 
+std::size_t Ostap::Math::WorkSpace::resize ( const std::size_t newsize )
 {
-  if      ( m_size  == newsize     ) { return m_size ; }
-  else if ( nullptr != m_workspace ) 
-  {
-    //
-    // free existing workspace:
-    //
-    gsl_integration_workspace * _ws = (gsl_integration_workspace*) m_workspace ;
-    m_workspace = nullptr ;
-    gsl_integration_workspace_free ( _ws );
-  }
-  //
   m_size = newsize ;
   return m_size ;
 }
 // ============================================================================
+// number of free workspaces in the pool for the current thread
+// ============================================================================
+std::size_t Ostap::Math::WorkSpace::pool_size  () { return pool().size  () ; }
+// ============================================================================
+// clear the pool for the current thread
+// ============================================================================
+std::size_t Ostap::Math::WorkSpace::pool_clear () { return pool().clear () ; }
+// ============================================================================
 
 
 // ============================================================================
-//  The END 
+//  The END
 // ============================================================================
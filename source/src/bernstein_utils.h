@@ -3,9 +3,11 @@
 // ============================================================================
 // Inclde files 
 // ============================================================================
+#include <cstddef>
 #include <iterator>
 #include <algorithm>
 #include <array>
+#include <vector>
 // ============================================================================
 // local
 // ============================================================================
@@ -216,7 +218,98 @@ namespace Ostap
         return casteljau ( first , second , t0 , t1 ) ;
       }
       // ======================================================================
-
+      /** evaluate all basic Bernstein polynomials of degree N at point t 
+       *  \f$ b_{i,N}(t) = C^i_N t^i (1-t)^{N-i} \f$ for \f$ 0 \le i \le N \f$ 
+       *  - for moderate degrees it is the direct O(N) product 
+       *  - for high degrees the stable O(N^2) triangular recurrence is used 
+       *  @param N      the degree 
+       *  @param t      the point \f$ 0 \le t \le 1 \f$ 
+       *  @param output (OUTPUT) N+1 values 
+       */
+      template <class OUTPUT>
+      inline void bernstein_basis
+      ( const unsigned short N      , 
+        const long double    t      , 
+        OUTPUT               output ) 
+      {
+        const long double t1 = 1 - t ;
+        if ( N <= 64 ) 
+        {
+          // powers of t 
+          long double ti = 1 ;
+          for ( unsigned short i = 0 ; i <= N ; ++i ) 
+          { output [ i ] = ti ; ti *= t ; }
+          // binomial coefficients and powers of (1-t) from the right end 
+          long double si = 1 ;
+          long double ci = 1 ;
+          for ( unsigned short i = N ; ; --i ) 
+          {
+            output [ i ] = ci * output [ i ] * si ;
+            if ( 0 == i ) { break ; }
+            si *= t1 ;
+            ci  = ci * i / ( N - i + 1 ) ;
+          }
+          return ;
+        }
+        //
+        output [ 0 ] = 1 ;
+        for ( unsigned short k = 1 ; k <= N ; ++k ) 
+        {
+          output [ k ] = t * output [ k - 1 ] ;
+          for ( unsigned short i = k - 1 ; 0 < i ; --i ) 
+          { output [ i ] = t1 * output [ i ] + t * output [ i - 1 ] ; }
+          output [ 0 ] *= t1 ;
+        }
+      }
+      // ======================================================================
+      /** @class b_buffer 
+       *  the buffer for the values of basic polynomials: 
+       *  the stack storage for moderate degrees, heap otherwise 
+       */
+      class b_buffer 
+      {
+      public:
+        // ====================================================================
+        explicit b_buffer ( const std::size_t n ) 
+          : m_heap ( s_size < n ? n : 0 ) 
+        {}
+        // ====================================================================
+        double*       data ()       
+        { return m_heap.empty () ? m_stack.data () : m_heap.data () ; }
+        const double* data () const 
+        { return m_heap.empty () ? m_stack.data () : m_heap.data () ; }
+        // ====================================================================
+      private:
+        // ====================================================================
+        enum { s_size = 65 } ;
+        std::array<double,s_size> m_stack ;
+        std::vector<double>       m_heap  ;
+        // ====================================================================
+      } ;
+      // ======================================================================
+      /** scalar product of two arrays 
+       *  (independent accumulators allow the vectorisation of the loop)
+       */
+      inline double b_dot 
+      ( const double*     a , 
+        const double*     b , 
+        const std::size_t n ) 
+      {
+        double s0 = 0 ;
+        double s1 = 0 ;
+        double s2 = 0 ;
+        double s3 = 0 ;
+        std::size_t i = 0 ;
+        for ( ; i + 4 <= n ; i += 4 ) 
+        {
+          s0 += a [ i     ] * b [ i     ] ;
+          s1 += a [ i + 1 ] * b [ i + 1 ] ;
+          s2 += a [ i + 2 ] * b [ i + 2 ] ;
+          s3 += a [ i + 3 ] * b [ i + 3 ] ;
+        }
+        for ( ; i < n ; ++i ) { s0 += a [ i ] * b [ i ] ; }
+        return ( s0 + s1 ) + ( s2 + s3 ) ;
+      }
       // ======================================================================
     } //                                The end of namespace Ostap::Math::Utils 
     // ========================================================================
@@ -6,10 +6,12 @@
 // ============================================================================
 // Include files
 // ============================================================================
+#include "Ostap/AdaptiveChebyshev.h"
 #include "Ostap/AddBranch.h"
 #include "Ostap/AddVars.h"
 #include "Ostap/BLOB.h"
 #include "Ostap/BSpline.h"
+#include "Ostap/BasisCache.h"
 #include "Ostap/Bernstein.h"
 #include "Ostap/Bernstein1D.h"
 #include "Ostap/Bernstein2D.h"
@@ -25,11 +27,13 @@
 #include "Ostap/Combine.h"
 #include "Ostap/Dalitz.h"
 #include "Ostap/DalitzIntegrator.h"
+#include "Ostap/DalitzNormalization.h"
 #include "Ostap/DataFrameActions.h"
 #include "Ostap/DataFrameUtils.h"
 #include "Ostap/Digit.h"
 #include "Ostap/EigenSystem.h"
 #include "Ostap/Error2Exception.h"
+#include "Ostap/FFTConvolution.h"
 #include "Ostap/Formula.h"
 #include "Ostap/FormulaVar.h"
 #include "Ostap/Fourier.h"
@@ -42,20 +46,25 @@
 #include "Ostap/Hesse.h"
 #include "Ostap/HFuncs.h"
 #include "Ostap/HistoDump.h"
+#include "Ostap/HistoFill.h"
 #include "Ostap/HistoHash.h"
+#include "Ostap/HistoMemo.h"
 #include "Ostap/HistoInterpolation.h"
 #include "Ostap/HistoInterpolators.h"
 #include "Ostap/HistoMake.h"
 #include "Ostap/HistoProject.h"
 #include "Ostap/HistoStat.h"
 #include "Ostap/KramersKronig.h"
+#include "Ostap/Instrumentation.h"
 #include "Ostap/Interpolation.h"
 #include "Ostap/Iterator.h"
 #include "Ostap/Line.h"
 #include "Ostap/LineTypes.h"
+#include "Ostap/LazyFrame.h"
 #include "Ostap/Lomont.h"
 #include "Ostap/LorentzVectorWithError.h"
 #include "Ostap/Kinematics.h"
+#include "Ostap/KinematicsBatch.h"
 #include "Ostap/Math.h"
 #include "Ostap/MatrixUtils.h"
 #include "Ostap/MatrixUtils2.h"
@@ -65,6 +74,7 @@
 #include "Ostap/Models2D.h"
 #include "Ostap/Moments.h"
 #include "Ostap/MoreMath.h"
+#include "Ostap/MoreMathBatch.h"
 #include "Ostap/MoreRooFit.h"
 #include "Ostap/MoreVars.h"
 #include "Ostap/Mute.h"
@@ -85,6 +95,7 @@
 #include "Ostap/Polynomials.h"
 #include "Ostap/Power.h"
 #include "Ostap/Primitives.h"
+#include "Ostap/PrimitivesT.h"
 #include "Ostap/Printable.h"
 #include "Ostap/PyCallable.h"   
 #include "Ostap/PyFuncs.h"   
@@ -95,6 +106,7 @@
 #include "Ostap/PyVar.h"     
 #include "Ostap/PyBLOB.h"
 #include "Ostap/Polarization.h"
+#include "Ostap/ReadPlan.h"
 #include "Ostap/RootID.h"
 #include "Ostap/SFactor.h"
 #include "Ostap/StatEntity.h"
@@ -102,14 +114,18 @@
 #include "Ostap/StatusCode.h"
 #include "Ostap/SVectorWithError.h"
 #include "Ostap/SymmetricMatrixTypes.h"
+#include "Ostap/TabulatedFunction.h"
 #include "Ostap/Tensors.h"
 #include "Ostap/Tee.h"
+#include "Ostap/ThreadPool.h"
 #include "Ostap/ToStream.h"
 #include "Ostap/Topics.h"
+#include "Ostap/ToyRunner.h"
 #include "Ostap/TypeWrapper.h"
 #include "Ostap/Tmva.h"
 #include "Ostap/Valid.h"
 #include "Ostap/ValueWithError.h"
+#include "Ostap/ValuesWithErrors.h"
 #include "Ostap/Vector3DTypes.h"
 #include "Ostap/Vector3DWithError.h"
 #include "Ostap/Vector4DTypes.h"
@@ -28,13 +28,43 @@ namespace
   // ==========================================================================
   typedef Ostap::Math::GSL::GSL_Error_Handler Sentry ;
   // ==========================================================================
-  /// get GSL-workspace
-  inline gsl_integration_workspace* workspace
-  ( const Ostap::Math::WorkSpace& ws )
+  /** @class WorkSpaceLease 
+   *  GSL-workspace, taken from the thread-local pool, 
+   *  and returned back to the pool at destruction.
+   *  Being created as temporary within the integration call, 
+   *  it lives till the end of the integration.
+   *  @see Ostap::Math::WorkSpace
+   */
+  class WorkSpaceLease 
   {
-    void* _ws =  ws.workspace() ;
-    return (gsl_integration_workspace*) _ws ;
-  }
+  public:
+    // ========================================================================
+    explicit WorkSpaceLease ( const Ostap::Math::WorkSpace& ws ) 
+      : m_ws ( (gsl_integration_workspace*) ws.acquire () ) 
+    {}
+    WorkSpaceLease ( WorkSpaceLease&& right ) 
+      : m_ws ( right.m_ws ) 
+    { right.m_ws = nullptr ; }
+    WorkSpaceLease ( const WorkSpaceLease&  ) = delete ;
+    WorkSpaceLease& operator=( const WorkSpaceLease& ) = delete ;
+    WorkSpaceLease& operator=(       WorkSpaceLease&& ) = delete ;
+    ~WorkSpaceLease () 
+    { if ( nullptr != m_ws ) { Ostap::Math::WorkSpace::release ( m_ws ) ; } }
+    // ========================================================================
+    operator gsl_integration_workspace* () const { return m_ws ; }
+    // ========================================================================
+  private:
+    // ========================================================================
+    gsl_integration_workspace* m_ws { nullptr } ;
+    // ========================================================================
+  } ;
+  // ==========================================================================
+  /** get GSL-workspace from the thread-local pool
+   *  @attention it is returned to the pool at the end of the full expression,
+   *             do not keep the pointer!
+   */
+  inline WorkSpaceLease workspace
+  ( const Ostap::Math::WorkSpace& ws ) { return WorkSpaceLease ( ws ) ; }
   // ==========================================================================
   // get size of GSL-workspace 
   // ==========================================================================
@@ -0,0 +1,233 @@
+// ============================================================================
+#ifndef OSTAP_LOCAL_KINEMATICS_H
+#define OSTAP_LOCAL_KINEMATICS_H 1
+// ============================================================================
+// Include files
+// ============================================================================
+// STD&STL
+// ============================================================================
+#include <cmath>
+#include <limits>
+// ============================================================================
+// Ostap
+// ============================================================================
+#include "Ostap/Vector4DTypes.h"
+#include "Ostap/Tensors.h"
+// ============================================================================
+/** @file
+ *  The inline kinematical expressions, shared by the scalar functions
+ *  from Ostap/Kinematics.h and their batch versions from Ostap/KinematicsBatch.h
+ *  @see Ostap/Kinematics.h
+ *  @see Ostap/KinematicsBatch.h
+ *  @author Ostap developers
+ *  @date 2026-10-19
+ */
+// ============================================================================
+namespace
+{
+  // ==========================================================================
+  static_assert ( std::numeric_limits<float> ::is_specialized      ,
+                  "std::numeric_limits<float>  is not specialized" ) ;
+  /// large negative number
+  constexpr double s_INVALID = -0.9 * std::numeric_limits<float>::max () ;
+  static_assert (  s_INVALID <  0   , "invalid negative number"    ) ;
+  // ==========================================================================
+  /// @see Ostap::Kinematics::decayAngle ( P , Q , D )
+  inline double decay_angle
+  ( const Ostap::LorentzVector& P ,
+    const Ostap::LorentzVector& Q ,
+    const Ostap::LorentzVector& D )
+  {
+    //
+    const double pd  = P.Dot ( D ) ; // P * D
+    const double pq  = P.Dot ( Q ) ; // P * Q
+    const double qd  = Q.Dot ( D ) ; // D * Q
+    const double mq2 = Q.M2  (   ) ; // Q^2
+    const double mp2 = P.M2  (   ) ; // P^2
+    const double md2 = D.M2  (   ) ; // D^2
+    //
+    const double value = ( pq * pq - mq2 * mp2 ) * ( qd * qd - mq2 * md2 ) ;
+    //
+    return 0 <= value ? ( pd * mq2 - pq * qd ) / std::sqrt ( value ) : s_INVALID ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::decayAngle ( D , M )
+  inline double decay_angle
+  ( const Ostap::LorentzVector& D ,
+    const Ostap::LorentzVector& M )
+  { return decay_angle ( Ostap::LorentzVector ( 0 , 0 , 0 , 10 * M.E () ) , M , D ) ; }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::cosThetaRest ( v1 , v2 , M )
+  inline double cos_theta_rest
+  ( const Ostap::LorentzVector& v1 ,
+    const Ostap::LorentzVector& v2 ,
+    const Ostap::LorentzVector& M  )
+  {
+    //
+    const double M2 = M.M2 () ;
+    if ( 0 >= M2 ) { return s_INVALID ; }     // RETURN
+    //
+    const double v1M  = v1.Dot ( M ) ;
+    const double v2M  = v2.Dot ( M ) ;
+    const double m1_2 = v1.M2 () ;
+    const double m2_2 = v2.M2 () ;
+    //
+    // calculate e1*e2
+    const double e1e2  = v1M * v2M / M2 ;
+    //
+    // calculate (|p1|*|p2|)^2
+    const double p1p2_ = ( ( v1M * v1M ) / M2 - m1_2 ) * ( ( v2M * v2M ) / M2 - m2_2 ) ;
+    if ( 0 >= p1p2_ ) { return s_INVALID ; }  // RETURN
+    //
+    const double p1p2  = std::sqrt ( p1p2_ ) ; // |p1|*|p2|
+    //
+    const double var   = ( v1 + v2 ).M2 () - m1_2 - m2_2 ;
+    //
+    // finally evaluate the cosine
+    return ( e1e2 - 0.5 * var ) / p1p2 ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::cosDecayAngleChi ( d1 , d2 , h1 , h2 )
+  inline double cos_chi
+  ( const Ostap::LorentzVector& d1 ,
+    const Ostap::LorentzVector& d2 ,
+    const Ostap::LorentzVector& h1 ,
+    const Ostap::LorentzVector& h2 )
+  {
+    typedef Ostap::Math::Tensors::Epsilon Epsilon ;
+    // get the intermediate particles D & H
+    const Ostap::LorentzVector D ( d1 + d2 ) ;
+    const Ostap::LorentzVector H ( h1 + h2 ) ;
+    //
+    // evaluate the length of normales :
+    const double l1 = Epsilon::mag2 ( d1 , d2 , H ) ; // == | [d1,d2,M] |
+    const double l2 = Epsilon::mag2 ( h1 , h2 , D ) ; // == | [h1,h2,M] |
+    //
+    if ( 0 <= l1 ) { return s_INVALID ; }
+    if ( 0 <= l2 ) { return s_INVALID ; }
+    //
+    return -Epsilon::epsilon ( d1 , d2 , H , h1 , h2 , D ) / std::sqrt ( l1 * l2 ) ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::sinDecayAngleChi ( d1 , d2 , h1 , h2 )
+  inline double sin_chi
+  ( const Ostap::LorentzVector& d1 ,
+    const Ostap::LorentzVector& d2 ,
+    const Ostap::LorentzVector& h1 ,
+    const Ostap::LorentzVector& h2 )
+  {
+    typedef Ostap::Math::Tensors::Epsilon Epsilon ;
+    //  reconstruct the intermediate particles
+    const Ostap::LorentzVector D ( d1 + d2 ) ;
+    const Ostap::LorentzVector H ( h1 + h2 ) ;
+    /// Mother Particle
+    const Ostap::LorentzVector M ( D  + H  ) ;
+    //
+    const double M2 = M.M2 () ;
+    if ( 0 >= M2 ) { return s_INVALID ; }
+    //
+    // get the length of 4-normales
+    const double l1 = Epsilon::mag2 ( d1 , d2 , H ) ; // == | [d1,d2,M] |
+    const double l2 = Epsilon::mag2 ( h1 , h2 , D ) ; // == | [h1,h2,M] |
+    //
+    if ( 0 <= l1 ) { return s_INVALID ; }
+    if ( 0 <= l2 ) { return s_INVALID ; }
+    //
+    const double DH  = D.Dot ( H ) ;
+    const double var = Epsilon::epsilon ( d1 , d2 , h1 , h2 ) * ( DH * DH - D.M2 () * H.M2 () ) ;
+    //
+    const double HM  = H.Dot ( M ) ;
+    const double p_H = HM * HM - H.M2 () * M2 ;
+    //
+    if ( 0 >= p_H ) { return s_INVALID ; }
+    //
+    return var / std::sqrt ( l1 * l2 * p_H ) ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::decayAngleChi ( d1 , d2 , h1 , h2 )
+  inline double decay_angle_chi
+  ( const Ostap::LorentzVector& d1 ,
+    const Ostap::LorentzVector& d2 ,
+    const Ostap::LorentzVector& h1 ,
+    const Ostap::LorentzVector& h2 )
+  {
+    //
+    const double cosChi = cos_chi ( d1 , d2 , h1 , h2 ) ;
+    if ( std::abs ( cosChi ) > 1 ) { return s_INVALID ; }
+    //
+    const double sinChi = sin_chi ( d1 , d2 , h1 , h2 ) ;
+    if ( std::abs ( sinChi ) > 1 ) { return s_INVALID ; }
+    //
+    return std::atan2 ( sinChi , cosChi ) ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::armenterosPodolanskiX ( d1 , d2 )
+  inline double armenteros
+  ( const double x1 , const double y1 , const double z1 ,
+    const double x2 , const double y2 , const double z2 )
+  {
+    const double x = x1 + x2 ;
+    const double y = y1 + y2 ;
+    const double z = z1 + z2 ;
+    const double m1 = x1 * x1 + y1 * y1 + z1 * z1 ;
+    const double m2 = x2 * x2 + y2 * y2 + z2 * z2 ;
+    return ( m1 - m2 ) / ( x * x + y * y + z * z ) ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::restMomentum ( v , M )
+  inline double rest_momentum
+  ( const Ostap::LorentzVector& v ,
+    const Ostap::LorentzVector& M )
+  {
+    const double M2 = M.M2 () ;
+    if ( 0 >= M2 ) { return s_INVALID ; } //   ATTENTION!
+    const double vM = v.Dot ( M ) ;
+    const double P2 = vM * vM / M2 - v.M2 () ;
+    return 0 <= P2 ? std::sqrt ( P2 ) : s_INVALID ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::restEnergy ( v , M )
+  inline double rest_energy
+  ( const Ostap::LorentzVector& v ,
+    const Ostap::LorentzVector& M )
+  {
+    const double M2 = M.M2 () ;
+    return 0 < M2 ? v.Dot ( M ) / std::sqrt ( M2 ) : s_INVALID ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::transverseMomentumDir ( mom , dir )
+  inline double pt_dir
+  ( const double px , const double py , const double pz ,
+    const double dx , const double dy , const double dz )
+  {
+    const double dmag2 = dx * dx + dy * dy + dz * dz ;
+    if ( 0 == dmag2 ) { return std::sqrt ( px * px + py * py + pz * pz ) ; }
+    const double s  = ( px * dx + py * dy + pz * dz ) / dmag2 ;
+    const double tx = px - dx * s ;
+    const double ty = py - dy * s ;
+    const double tz = pz - dz * s ;
+    return std::sqrt ( tx * tx + ty * ty + tz * tz ) ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::Gram::Delta ( p1 , p2 )
+  inline double gram_delta
+  ( const Ostap::LorentzVector& p1 ,
+    const Ostap::LorentzVector& p2 )
+  {
+    const long double p1p2 = p1.Dot ( p2 ) ;
+    return p1.M2 () * 1.0L * p2.M2 () - p1p2 * p1p2 ;
+  }
+  // ==========================================================================
+  /// @see Ostap::Kinematics::triangle ( a , b , c )
+  inline double triangle_
+  ( const double a ,
+    const double b ,
+    const double c )
+  { return a * a + b * b + c * c - 2 * a * b - 2 * b * c - 2 * a * c ; }
+  // ==========================================================================
+}
+// ============================================================================
+#endif // OSTAP_LOCAL_KINEMATICS_H
+// ============================================================================
+//                                                                      The END
+// ============================================================================